@@ -25,6 +25,7 @@ set(OMR_JITBUILDER ON CACHE BOOL "")
 set(OMR_JITBUILDER_TEST OFF CACHE BOOL "")
 
 set(OMR_GC_SEGREGATED_HEAP ON CACHE BOOL "")
+set(OMR_GC_REGIONAL ON CACHE BOOL "")
 set(OMR_GC_MODRON_SCAVENGER ON CACHE BOOL "")
 set(OMR_GC_MODRON_CONCURRENT_MARK ON CACHE BOOL "")
 
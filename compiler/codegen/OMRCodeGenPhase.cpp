@@ -135,7 +135,12 @@ OMR::CodeGenPhase::performAll()
       TR::RegionProfiler rp(_cg->comp()->trMemory()->heapMemoryRegion(), *_cg->comp(), "codegen/%s/%s",
          _cg->comp()->getHotnessName(_cg->comp()->getMethodHotness()), self()->getName(phaseToDo));
 
+      TR::PhaseProfiler::Sample phaseSample;
+      _cg->comp()->phaseProfiler().begin(phaseSample);
+
       _phaseToFunctionTable[phaseToDo](_cg, self());
+
+      _cg->comp()->phaseProfiler().end(phaseSample, TR::PhaseProfiler::CodeGen, self()->getName(phaseToDo));
       }
    }
 
@@ -3109,6 +3109,13 @@ OMR::CodeGenerator::addStaticRelocation(const TR::StaticRelocation &relocation)
    _staticRelocationList.push_back(relocation);
    }
 
+bool
+OMR::CodeGenerator::needsStaticRelocations()
+   {
+   return self()->comp()->getOption(TR_EmitRelocatableELFFile)
+      || (self()->comp()->getStaticRelocationCollector() != NULL);
+   }
+
 intptr_t OMR::CodeGenerator::hiValue(intptr_t address)
    {
    if (self()->comp()->compileRelocatableCode()) // We don't want to store values using HI_VALUE at compile time, otherwise, we do this a 2nd time when we relocate (and new value is based on old one)
@@ -1188,6 +1188,12 @@ public:
    void addExternalRelocation(TR::Relocation *r, TR::RelocationDebugInfo *info, TR::ExternalRelocationPositionRequest where = TR::ExternalRelocationAtBack);
    void addStaticRelocation(const TR::StaticRelocation &relocation);
 
+   /**
+    * \brief Answers whether static relocations must be recorded for the body being generated,
+    *        either for a relocatable ELF file or for a collector that keeps the body.
+    */
+   bool needsStaticRelocations();
+
    void addProjectSpecializedRelocation(uint8_t *location,
                                           uint8_t *target,
                                           uint8_t *target2,
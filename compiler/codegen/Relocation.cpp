@@ -106,6 +106,16 @@ void TR::LabelAbsoluteRelocation::apply(TR::CodeGenerator *cg)
    intptr_t *cursor = (intptr_t *)getUpdateLocation();
    assertLabelDefined();
    *cursor = (intptr_t)getLabel()->getCodeLocation();
+
+   // a body that is kept to be installed elsewhere must have its absolute references to itself rebased
+   if (cg->comp()->getStaticRelocationCollector() != NULL)
+      {
+      cg->addStaticRelocation(TR::StaticRelocation(
+         (uint8_t *)cursor,
+         NULL,
+         sizeof(intptr_t) == 8 ? TR::StaticRelocationSize::word64 : TR::StaticRelocationSize::word32,
+         TR::StaticRelocationType::Absolute));
+      }
    }
 
 TR::InstructionLabelRelative16BitRelocation::InstructionLabelRelative16BitRelocation(TR::Instruction* cursor, int32_t offset, TR::LabelSymbol* l, int32_t divisor)
@@ -102,6 +102,32 @@ private:
    const StaticRelocationType _type;
    };
 
+/**
+ * @brief The StaticRelocationCollector class receives a successfully compiled method body together with its static relocations,
+ * so that the body can be kept and later installed at a different address.
+ *
+ * While a collector is attached to a compilation, the code generator also records a relocation without a symbol for every
+ * absolute reference the body makes to itself; the value at its location is an address within the body.
+ */
+class StaticRelocationCollector
+   {
+public:
+
+   /**
+    * @brief collectBody Receives the body of the compiled method. Called once, before any relocation is collected.
+    * @param codeStart The start of the method body.
+    * @param codeEnd The end of the method body.
+    * @param entryPoint The entry point of the method, within the body.
+    */
+   virtual void collectBody(uint8_t *codeStart, uint8_t *codeEnd, uint8_t *entryPoint) = 0;
+
+   /**
+    * @brief collectRelocation Receives one of the static relocations recorded for the body.
+    * @param relocation The relocation, whose symbol is NULL if it targets the body itself.
+    */
+   virtual void collectRelocation(const TR::StaticRelocation &relocation) = 0;
+   };
+
 }
 
 #endif // STATICRELOCATION_HPP
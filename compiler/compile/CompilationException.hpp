@@ -65,6 +65,23 @@ struct ILGenFailure : public virtual CompilationException
    virtual const char* what() const throw() { return "IL Gen Failure"; }
    };
 
+/**
+ * Compiled Body Reused exception type.
+ *
+ * Thrown by IL generation that found a body compiled earlier for identical IL.
+ * The compilation ends successfully with the entry point of that body, without
+ * optimizing or generating code.
+ */
+struct CompiledBodyReused : public virtual CompilationException
+   {
+   CompiledBodyReused(void *entryPoint) : _entryPoint(entryPoint) { }
+   virtual const char* what() const throw() { return "Compiled Body Reused"; }
+   void *entryPoint() const { return _entryPoint; }
+
+private:
+   void *_entryPoint;
+   };
+
 /**
  * Recoverable IL Generation Failure exception type.
  *
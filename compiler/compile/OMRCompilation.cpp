@@ -274,6 +274,7 @@ OMR::Compilation::Compilation(
    _failCHtableCommitFlag(false),
    _phaseTimer("Compilation", self()->allocator("phaseTimer"), self()->getOption(TR_Timing)),
    _phaseMemProfiler("Compilation", self()->allocator("phaseMemProfiler"), self()->getOption(TR_LexicalMemProfiler)),
+   _phaseProfiler(*self(), heapMemoryRegion, options),
    _compilationNodes(NULL),
    _copyPropagationRematerializationCandidates(self()->allocator("CP rematerialization")),
    _nodeOpCodeLength(0),
@@ -281,6 +282,7 @@ OMR::Compilation::Compilation(
    _scratchSpaceLimit(TR::Options::_scratchSpaceLimit),
    _cpuTimeAtStartOfCompilation(-1),
    _ilVerifier(NULL),
+   _staticRelocationCollector(NULL),
    _gpuPtxList(m),
    _gpuKernelLineNumberList(m),
    _gpuPtxCount(0),
@@ -52,6 +52,7 @@ namespace OMR { typedef OMR::Compilation CompilationConnector; }
 #include "control/Options_inlines.hpp"
 #include "cs2/timer.h"
 #include "env/PersistentInfo.hpp"
+#include "env/PhaseProfiler.hpp"
 #include "env/TRMemory.hpp"
 #include "env/Region.hpp"
 #include "env/jittypes.h"
@@ -96,6 +97,7 @@ namespace TR { class CodeGenerator; }
 namespace TR { class Compilation; }
 namespace TR { class IlGenRequest; }
 namespace TR { class IlVerifier; }
+namespace TR { class StaticRelocationCollector; }
 namespace TR { class ILValidator; }
 namespace TR { class Instruction; }
 namespace TR { class KnownObjectTable; }
@@ -755,6 +757,12 @@ public:
 
    void setIlVerifier(TR::IlVerifier *ilVerifier) { _ilVerifier = ilVerifier; }
 
+   /**
+    * \brief The collector that receives the compiled body and its static relocations, or NULL if the body is not kept.
+    */
+   TR::StaticRelocationCollector *getStaticRelocationCollector() { return _staticRelocationCollector; }
+   void setStaticRelocationCollector(TR::StaticRelocationCollector *collector) { _staticRelocationCollector = collector; }
+
    typedef std::pair<const void * const, TR::DebugCounterBase *> DebugCounterEntry;
    typedef TR::typed_allocator<DebugCounterEntry, TR::Allocator> DebugCounterMapAllocator;
    typedef std::map<const void *, TR::DebugCounterBase *, std::less<const void *>, DebugCounterMapAllocator> DebugCounterMap;
@@ -886,6 +894,7 @@ public:
 
    PhaseTimingSummary  &phaseTimer()        { return _phaseTimer; }
    TR::PhaseMemSummary &phaseMemProfiler()  { return _phaseMemProfiler; }
+   TR::PhaseProfiler   &phaseProfiler()     { return _phaseProfiler; }
    TR::NodePool        &getNodePool()       { return *_compilationNodes; }
 
    bool mustNotBeRecompiled();
@@ -1304,6 +1313,7 @@ private:
 
    PhaseTimingSummary                _phaseTimer;
    TR::PhaseMemSummary               _phaseMemProfiler;
+   TR::PhaseProfiler                 _phaseProfiler;
    TR::NodePool                      *_compilationNodes;
 
    TR::SparseBitVector _copyPropagationRematerializationCandidates;
@@ -1320,6 +1330,7 @@ private:
    int64_t                           _cpuTimeAtStartOfCompilation;
 
    TR::IlVerifier                    *_ilVerifier;
+   TR::StaticRelocationCollector     *_staticRelocationCollector;
 
    ListHeadAndTail<char*> _gpuPtxList;
    ListHeadAndTail<int32_t> _gpuKernelLineNumberList; //TODO: fix to get real line numbers
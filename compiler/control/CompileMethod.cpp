@@ -34,6 +34,7 @@
 #include "env/FrontEnd.hpp"
 #include "codegen/LinkageConventionsEnum.hpp"
 #include "compile/Compilation.hpp"
+#include "compile/CompilationException.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/ResolvedMethod.hpp"
 #include "control/OptimizationPlan.hpp"
@@ -271,7 +272,8 @@ compileMethodFromDetails(
       OMR_VMThread *omrVMThread,
       TR::IlGeneratorMethodDetails & details,
       TR_Hotness hotness,
-      int32_t &rc)
+      int32_t &rc,
+      TR::SegmentAllocator *threadSegmentProvider)
    {
    uint64_t translationStartTime = TR::Compiler->vm.getUSecClock();
    OMR::FrontEnd &fe = OMR::FrontEnd::singleton();
@@ -279,9 +281,12 @@ compileMethodFromDetails(
    TR::RawAllocator rawAllocator;
    TR::SystemSegmentProvider defaultSegmentProvider(1 << 16, rawAllocator);
    TR::DebugSegmentProvider debugSegmentProvider(1 << 16, rawAllocator);
+   // a compilation thread may supply its own provider, so that concurrent compilations never share one
    TR::SegmentAllocator &scratchSegmentProvider =
       TR::Options::getCmdLineOptions()->getOption(TR_EnableScratchMemoryDebugging) ?
          static_cast<TR::SegmentAllocator &>(debugSegmentProvider) :
+      (NULL != threadSegmentProvider) ?
+         *threadSegmentProvider :
          static_cast<TR::SegmentAllocator &>(defaultSegmentProvider);
    TR::Region dispatchRegion(scratchSegmentProvider, rawAllocator);
    TR_Memory trMemory(*fe.persistentMemory(), dispatchRegion);
@@ -343,6 +348,7 @@ compileMethodFromDetails(
          }
 
       compiler.setIlVerifier(details.getIlVerifier());
+      compiler.setStaticRelocationCollector(details.getStaticRelocationCollector());
 
       if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompileStart))
          {
@@ -412,7 +418,9 @@ compileMethodFromDetails(
                auto &relocations = codeGenerator.getStaticRelocations();
                for (auto it = relocations.begin(); it != relocations.end(); ++it)
                   {
-                  codeCacheManager.registerStaticRelocation(*it);
+                  // references the body makes to itself are only recorded for a collector
+                  if (it->symbol() != NULL)
+                     codeCacheManager.registerStaticRelocation(*it);
                   }
                }
             if (compiler.getOption(TR_PerfTool))
@@ -421,6 +429,18 @@ compileMethodFromDetails(
                }
             }
 
+         TR::StaticRelocationCollector *collector = compiler.getStaticRelocationCollector();
+         if (collector != NULL)
+            {
+            TR::CodeGenerator &codeGenerator(*compiler.cg());
+            collector->collectBody(codeGenerator.getCodeStart(), codeGenerator.getCodeEnd(), startPC);
+            auto &relocations = codeGenerator.getStaticRelocations();
+            for (auto it = relocations.begin(); it != relocations.end(); ++it)
+               {
+               collector->collectRelocation(*it);
+               }
+            }
+
          if (compiler.getOutFile() != NULL && compiler.getOption(TR_TraceAll))
             traceMsg((&compiler), "<result success=\"true\" startPC=\"%#p\" time=\"%lld.%lldms\"/>\n",
                                   startPC,
@@ -438,6 +458,25 @@ compileMethodFromDetails(
          }
 
       }
+   catch (const TR::CompiledBodyReused &exception)
+      {
+      // IL generation installed a body compiled earlier for identical IL, which stands in for this compilation
+      rc = COMPILATION_SUCCEEDED;
+      startPC = (uint8_t *)exception.entryPoint();
+
+      if (TR::Options::isAnyVerboseOptionSet(TR_VerboseCompileEnd, TR_VerbosePerformance))
+         {
+         TR_VerboseLog::CriticalSection vlogLock;
+         TR_VerboseLog::write(TR_Vlog_COMP, "(%s) %s @ " POINTER_PRINTF_FORMAT " reused\n",
+                                        compiler.getHotnessName(compiler.getMethodHotness()),
+                                        compiler.signature(),
+                                        startPC);
+         trfflush(jitConfig->options.vLogFile);
+         }
+
+      if (compiler.getOutFile() != NULL && compiler.getOption(TR_TraceAll))
+         traceMsg((&compiler), "<result success=\"true\" startPC=\"%#p\" reused=\"true\"/>\n", startPC);
+      }
    catch (const TR::ILValidationFailure &exception)
       {
       rc = COMPILATION_IL_VALIDATION_FAILURE;
@@ -462,6 +501,12 @@ compileMethodFromDetails(
 #endif
       }
 
+   if (TR::Options::getVerboseOption(TR_VerboseCompilePhases))
+      {
+      compiler.phaseProfiler().report(compiler.signature(), rc == COMPILATION_SUCCEEDED);
+      trfflush(jitConfig->options.vLogFile);
+      }
+
    // A better place to do this would have been the destructor for
    // TR::Compilation. We'll need exceptions working instead of setjmp
    // before we can get working, and we need to make sure the other
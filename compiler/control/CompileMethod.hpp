@@ -27,8 +27,9 @@ struct OMR_VMThread;
 class TR_ResolvedMethod;
 namespace TR { class IlGeneratorMethodDetails; }
 namespace TR { class JitConfig; }
+namespace TR { class SegmentAllocator; }
 
 int32_t init_options(TR::JitConfig *jitConfig, char * cmdLineOptions);
 int32_t commonJitInit(OMR::FrontEnd &fe, char * cmdLineOptions);
 uint8_t *compileMethod(OMR_VMThread *omrVMThread, TR_ResolvedMethod &compilee, TR_Hotness hotness, int32_t &rc);
-uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness, int32_t &rc);
+uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness, int32_t &rc, TR::SegmentAllocator *scratchSegmentProvider = NULL);
@@ -189,6 +189,10 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"compilationThreads=",   "R<nnn>\tnumber of compilation threads to use",
                                TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_numUsableCompilationThreads, 0, "F%d", NOT_IN_SUBSET},
    {"compile",                "D\tCompile these methods immediately. Primarily for use with Compiler.command",  SET_OPTION_BIT(TR_CompileBit),  "F" },
+   {"compileTimeBudget=",     "O<nnn>\tms a compilation may spend before it fails; 0 for no budget",
+        TR::Options::set32BitNumeric, offsetof(OMR::Options, _compileTimeBudget), 0, "F%d"},
+   {"compileTimeBudgetPhaseShare=", "O<nnn>\tpercentage of compileTimeBudget any one optimization or codegen phase may spend. Range: 1-100. Default 50.",
+        TR::Options::set32BitPercentage, offsetof(OMR::Options, _compileTimeBudgetPhaseShare), 0, "F%d"},
    {"compThreadCPUEntitlement=", "M<nnn>\tThreshold for CPU utilization of compilation threads",
                                TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_compThreadCPUEntitlement, 0, "F%d", NOT_IN_SUBSET },
    {"concurrentLPQ", "M\tCompilations from low priority queue can go in parallel with compilations from main queue", SET_OPTION_BIT(TR_ConcurrentLPQ), "F", NOT_IN_SUBSET },
@@ -922,6 +926,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
         TR::Options::set32BitSignedNumeric, offsetof(OMR::Options,_lastOptSubIndex), 0, "F%d"},
    {"lastOptTransformationIndex=", "O<nnn>\tindex of the last optimization transformation to perform",
         TR::Options::set32BitSignedNumeric, offsetof(OMR::Options,_lastOptTransformationIndex), 0, "F%d"},
+   {"linearScanGRA=",     "O<level>\tuse linear scan global register assignment at the given opt level (noOpt, cold, warm, hot, veryHot or scorching) and colder levels",
+        TR::Options::setHotnessLevel, offsetof(OMR::Options, _linearScanGRAMaxHotness), 0, "F%d"},
    {"lockReserveClass=",  "O{regex}\tenable reserving locks for specified classes", TR::Options::setRegex, offsetof(OMR::Options, _lockReserveClass), 0, "P"},
    {"lockVecRegs=",    "M<nn>\tThe number of vector register to lock (from end) Range: 0-32", TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_numVecRegsToLock, 0, "F%d", NOT_IN_SUBSET},
    {"log=",               "L<filename>\twrite log output to filename",
@@ -1200,6 +1206,7 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
    {"traceLoopReduction",               "L\ttrace loop reduction",                         TR::Options::traceOptimization, loopReduction, 0, "P"},
    {"traceLoopReplicator",              "L\ttrace loop replicator",                        TR::Options::traceOptimization, loopReplicator, 0, "P"},
    {"traceLoopStrider",                 "L\ttrace loop strider",                           TR::Options::traceOptimization, loopStrider,   0, "P"},
+   {"traceLoopVectorizer",              "L\ttrace loop vectorizer",                        TR::Options::traceOptimization, loopVectorizer, 0, "P"},
    {"traceLoopVersioner",               "L\ttrace loop versioner",                          TR::Options::traceOptimization, loopVersioner, 0, "P"},
    {"traceMarkingOfHotFields",          "M\ttrace marking of Hot Fields",                 SET_OPTION_BIT(TR_TraceMarkingOfHotFields), "F"},
    {"traceMethodHandleTransformer",     "L\ttrace MethodHandle transformer",               TR::Options::traceOptimization, methodHandleTransformer, 0, "P"},
@@ -1410,6 +1417,21 @@ OMR::Options::set64BitSignedNumeric(char *option, void *base, TR::OptionTable *e
    }
 
 
+char *
+OMR::Options::set32BitPercentage(char *option, void *base, TR::OptionTable *entry)
+   {
+   char *value = option;
+   int64_t percentage = TR::Options::getNumericValue(option);
+
+   // Leaving the option unconsumed reports it as invalid
+   if (percentage < 1 || percentage > 100)
+      return value;
+
+   *((int32_t*)((char*)base+entry->parm1)) = static_cast<int32_t>(percentage);
+   return option;
+   }
+
+
 char *
 OMR::Options::set32BitHexadecimal(char *option, void *base, TR::OptionTable *entry)
    {
@@ -2670,6 +2692,9 @@ OMR::Options::jitPreProcess()
    _alwaysWorthInliningThreshold = 15;
    _maxLimitedGRACandidates = TR_MAX_LIMITED_GRA_CANDIDATES;
    _maxLimitedGRARegs = TR_MAX_LIMITED_GRA_REGS;
+   _linearScanGRAMaxHotness = -1;
+   _compileTimeBudget = 0;
+   _compileTimeBudgetPhaseShare = 50;
    _counterBucketGranularity = 2;
    _minCounterFidelity = INT_MIN;
    _lastIpaOptTransformationIndex = INT_MAX;
@@ -4947,7 +4972,8 @@ char *OMR::Options::_verboseOptionNames[TR_NumVerboseOptions] =
    "vectorAPI",
    "iprofilerPersistence",
    "CheckpointRestore",
-   "CheckpointRestoreDetails"
+   "CheckpointRestoreDetails",
+   "compilePhases"
    };
 
 
@@ -5045,6 +5071,34 @@ OMR::Options::set32BitValue(char *option, void *base, TR::OptionTable *entry)
    }
 
 
+char *
+OMR::Options::setHotnessLevel(char *option, void *base, TR::OptionTable *entry)
+   {
+   static const struct { const char *name; TR_Hotness level; } levels[] =
+      {
+      { "noOpt",     noOpt     },
+      { "cold",      cold      },
+      { "warm",      warm      },
+      { "hot",       hot       },
+      { "veryHot",   veryHot   },
+      { "scorching", scorching },
+      };
+
+   for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+      {
+      size_t length = strlen(levels[i].name);
+      if (!strncmp(option, levels[i].name, length) && !isalnum(option[length]))
+         {
+         *((int32_t*)((char*)base+entry->parm1)) = (int32_t)levels[i].level;
+         return option + length;
+         }
+      }
+
+   // Leaving the option unconsumed reports it as invalid
+   return option;
+   }
+
+
 char *
 OMR::Options::enableOptimization(char *option, void *base, TR::OptionTable *entry)
    {
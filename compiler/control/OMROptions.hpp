@@ -1072,6 +1072,7 @@ enum TR_VerboseFlags
    TR_VerboseIProfilerPersistence,
    TR_VerboseCheckpointRestore,
    TR_VerboseCheckpointRestoreDetails,
+   TR_VerboseCompilePhases,    // per-pass time, memory and node counts for each compilation
    //If adding new options add an entry to _verboseOptionNames as well
    TR_NumVerboseOptions        // Must be the last one;
    };
@@ -1468,6 +1469,9 @@ public:
       _insertGCRTrees = false;
       _maxLimitedGRACandidates = 0;
       _maxLimitedGRARegs = 0;
+      _linearScanGRAMaxHotness = -1;
+      _compileTimeBudget = 0;
+      _compileTimeBudgetPhaseShare = 0;
       _enableGPU = 0;
       _isAOTCompile = false;
       _jProfilingMethodRecompThreshold = 0;
@@ -1822,6 +1826,9 @@ public:
    int32_t getAlwaysWorthInliningThreshold() const { return _alwaysWorthInliningThreshold; }
    int32_t getMaxLimitedGRACandidates()   { return _maxLimitedGRACandidates; }
    int32_t getMaxLimitedGRARegs()         { return _maxLimitedGRARegs; }
+   int32_t getLinearScanGRAMaxHotness()   { return _linearScanGRAMaxHotness; }
+   int32_t getCompileTimeBudget()         { return _compileTimeBudget; }
+   int32_t getCompileTimeBudgetPhaseShare() { return _compileTimeBudgetPhaseShare; }
    int32_t getNumLimitedGRARegsWithheld();
 
    int32_t getProfilingCompNodecountThreshold()  { return _profilingCompNodecountThreshold; }
@@ -2143,6 +2150,11 @@ private:
    //
    static char *set32BitValue(char *option, void *base, TR::OptionTable *entry);
 
+   // Set 32-bit word at offset "offset" from the base to the opt level named
+   // by the option value (noOpt, cold, warm, hot, veryHot or scorching)
+   //
+   static char *setHotnessLevel(char *option, void *base, TR::OptionTable *entry);
+
    // Disable an optimization
    //
    static char *disableOptimization(char *option, void *base, TR::OptionTable *entry);
@@ -2182,6 +2194,11 @@ private:
    //
    static char *set32BitHexadecimal(char *option, void *base, TR::OptionTable *entry);
 
+   // Scan the option for a percentage from 1 to 100 and set 32bit word at
+   // offset "offset" from the base to that value. Other values are rejected.
+   //
+   static char *set32BitPercentage(char *option, void *base, TR::OptionTable *entry);
+
    // Scan the option for a numeric value and set 32bit word at offset "offset"
    // from the 'private' base (derived from the 'base' passed in) to that value.
    //
@@ -2481,6 +2498,10 @@ protected:
 
    int32_t                     _maxLimitedGRACandidates;
    int32_t                     _maxLimitedGRARegs;
+   int32_t                     _linearScanGRAMaxHotness; // hottest level whose GRA uses linear scan assignment, -1 for none
+
+   int32_t                     _compileTimeBudget;           // ms a compilation may take, 0 for no budget
+   int32_t                     _compileTimeBudgetPhaseShare; // percentage of the budget any one phase may take
 
    int32_t                     _enableGPU;
 
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "env/PhaseProfiler.hpp"
+
+#include "compile/Compilation.hpp"
+#include "compile/CompilationException.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/SegmentProvider.hpp"
+#include "env/VerboseLog.hpp"
+
+TR::PhaseProfiler::PhaseProfiler(TR::Compilation &compilation, TR::Region &region, TR::Options &options) :
+   _compilation(compilation),
+   _region(region),
+   _entries(region),
+   _startTime(0),
+   _budget(static_cast<uint64_t>(options.getCompileTimeBudget()) * 1000),
+   _phaseBudget(_budget * options.getCompileTimeBudgetPhaseShare() / 100),
+   _budgetExceededBy(NULL),
+   _active(_budget > 0 || TR::Options::getVerboseOption(TR_VerboseCompilePhases))
+   {
+   if (_active)
+      _startTime = TR::Compiler->vm.getUSecClock();
+   }
+
+size_t
+TR::PhaseProfiler::peakBytes()
+   {
+   return _region._segmentProvider.bytesAllocated();
+   }
+
+void
+TR::PhaseProfiler::begin(Sample &sample)
+   {
+   if (!_active)
+      return;
+
+   sample._startTime = TR::Compiler->vm.getUSecClock();
+   sample._startBytes = peakBytes();
+   }
+
+void
+TR::PhaseProfiler::end(Sample &sample, Kind kind, const char *name)
+   {
+   if (!_active)
+      return;
+
+   uint64_t now = TR::Compiler->vm.getUSecClock();
+   uint64_t elapsedTime = now - sample._startTime;
+
+   Entry *entry = NULL;
+   for (auto it = _entries.begin(); it != _entries.end(); ++it)
+      {
+      if (it->_name == name && it->_kind == kind)
+         {
+         entry = &*it;
+         break;
+         }
+      }
+
+   if (entry == NULL)
+      {
+      Entry newEntry = { name, kind, 0, 0, 0, 0 };
+      _entries.push_back(newEntry);
+      entry = &_entries.back();
+      }
+
+   entry->_runs++;
+   entry->_elapsedTime += elapsedTime;
+   entry->_peakBytes += peakBytes() - sample._startBytes;
+   entry->_nodeCount = _compilation.getNodeCount();
+
+   if (_budget == 0 || budgetExceeded())
+      return;
+
+   if (elapsedTime > _phaseBudget || now - _startTime > _budget)
+      {
+      _budgetExceededBy = name;
+
+      if (_compilation.getOption(TR_TraceOpts) || _compilation.getOption(TR_TraceCG))
+         traceMsg(&_compilation, "%s exceeded the compile-time budget after %lluus\n", name, static_cast<unsigned long long>(elapsedTime));
+
+      // Skipping the rest of the strategy could leave the IL in a state later
+      // phases do not expect, so the compilation is failed instead. The front
+      // end may retry it at a lower opt level.
+      _compilation.failCompilation<TR::ExcessiveComplexity>("%s exceeded the compile-time budget", name);
+      }
+   }
+
+void
+TR::PhaseProfiler::report(const char *signature, bool succeeded)
+   {
+   if (!_active)
+      return;
+
+   TR_VerboseLog::CriticalSection vlogLock;
+   TR_VerboseLog::write(TR_Vlog_PHASES, "(%s) %s rc=%s time=%llu peakKB=%llu nodes=%u",
+      _compilation.getHotnessName(_compilation.getMethodHotness()),
+      signature,
+      succeeded ? "ok" : "failed",
+      static_cast<unsigned long long>(TR::Compiler->vm.getUSecClock() - _startTime),
+      static_cast<unsigned long long>(peakBytes() / 1024),
+      static_cast<unsigned>(_compilation.getNodeCount()));
+
+   if (budgetExceeded())
+      TR_VerboseLog::write(" budget=%s", _budgetExceededBy);
+
+   for (auto it = _entries.begin(); it != _entries.end(); ++it)
+      {
+      TR_VerboseLog::write(" %c:%s=%u,%llu,%llu,%u",
+         static_cast<char>(it->_kind),
+         it->_name,
+         it->_runs,
+         static_cast<unsigned long long>(it->_elapsedTime),
+         static_cast<unsigned long long>(it->_peakBytes / 1024),
+         it->_nodeCount);
+      }
+
+   TR_VerboseLog::write("\n");
+   }
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_PHASE_PROFILER_HPP
+#define OMR_PHASE_PROFILER_HPP
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "env/Region.hpp"
+#include "infra/vector.hpp"
+
+namespace TR { class Compilation; }
+namespace TR { class Options; }
+
+namespace TR {
+
+/**
+ * @class
+ * @brief The PhaseProfiler class keeps a per-compilation breakdown of the wall
+ * time, scratch memory and IL growth of every optimization pass and code
+ * generation phase, and enforces the optional compile-time budget.
+ *
+ * A phase is measured between a call to begin() and the matching call to end().
+ * Repeated runs of the same pass are folded into a single entry, so the record
+ * stays a fixed, small size however many times the local optimizations iterate.
+ * Phase names are expected to be static strings and are compared by address.
+ *
+ * The profiler is active when verbose={compilePhases} or compileTimeBudget= is
+ * given; otherwise begin() and end() return immediately. report() writes one
+ * line per compilation to the verbose log:
+ *
+ *    #PHASES:  (warm) signature rc=ok time=<us> peakKB=<n> nodes=<n> [budget=<phase>] <entry>...
+ *
+ * where each entry is <o|c>:<name>=<runs>,<us>,<KB>,<nodes>; o marks an
+ * optimization and c a code generation phase, KB is how far the phase raised
+ * the scratch memory high water mark, and nodes is the IL node count after
+ * its last run.
+ *
+ * When a phase runs past its share of the budget, or the compilation as a
+ * whole runs past the budget, the compilation fails with ExcessiveComplexity
+ * and the phase is named in the record.
+ */
+class PhaseProfiler
+   {
+public:
+   enum Kind
+      {
+      Optimization = 'o',
+      CodeGen      = 'c'
+      };
+
+   struct Sample
+      {
+      uint64_t _startTime;
+      size_t   _startBytes;
+      };
+
+   PhaseProfiler(TR::Compilation &compilation, TR::Region &region, TR::Options &options);
+
+   bool isActive()       const { return _active; }
+   bool budgetExceeded() const { return _budgetExceededBy != NULL; }
+
+   void begin(Sample &sample);
+   void end(Sample &sample, Kind kind, const char *name);
+
+   void report(const char *signature, bool succeeded);
+
+private:
+   struct Entry
+      {
+      const char *_name;
+      Kind        _kind;
+      uint32_t    _runs;
+      uint64_t    _elapsedTime;
+      size_t      _peakBytes;
+      uint32_t    _nodeCount;
+      };
+
+   size_t peakBytes();
+
+   TR::Compilation &_compilation;
+   TR::Region &_region;
+   TR::vector<Entry, TR::Region&> _entries;
+   uint64_t _startTime;
+   uint64_t _budget;      // us for the whole compilation, 0 for none
+   uint64_t _phaseBudget; // us for any one phase
+   const char *_budgetExceededBy;
+   bool _active;
+   };
+
+}
+
+#endif
@@ -36,6 +36,7 @@ namespace TR {
 
 class SegmentProvider;
 class RegionProfiler;
+class PhaseProfiler;
 
 class Region
    {
@@ -165,6 +166,7 @@ public:
    static size_t initialSize() { return INITIAL_SEGMENT_SIZE; }
 private:
    friend class TR::RegionProfiler;
+   friend class TR::PhaseProfiler;
 
    size_t round(size_t bytes);
 
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_COMPILEDBODYSTORE_INCL
+#define OMR_COMPILEDBODYSTORE_INCL
+
+#include <stdint.h>
+#include "codegen/StaticRelocation.hpp"
+
+namespace TR { class MethodBuilder; }
+
+namespace TR
+{
+
+/**
+ * @brief The CompiledBodyStore class lets a MethodBuilder reuse a body that was compiled earlier for identical IL,
+ * instead of optimizing that IL and generating code for it again.
+ *
+ * A store is attached to a single compilation. If it holds no body for the IL, the compilation goes ahead and the
+ * store collects the new body and its static relocations, so that the body can be reused later. A store should only
+ * keep a body after lookup() was called for the compilation: IL that cannot be fingerprinted is never offered to it.
+ */
+class CompiledBodyStore : public TR::StaticRelocationCollector
+   {
+public:
+
+   /**
+    * @brief lookup Installs a body previously compiled for the given IL.
+    * @param methodBuilder The method builder being compiled; the functions it defines resolve the body's relocations.
+    * @param fingerprint A canonical encoding of the method builder's IL.
+    * @param fingerprintLength The length of the fingerprint in bytes.
+    * @return The entry point of the installed body, or NULL if the store holds no usable body for this IL.
+    */
+   virtual void *lookup(TR::MethodBuilder *methodBuilder, const uint8_t *fingerprint, uint32_t fingerprintLength) = 0;
+   };
+
+} // namespace TR
+
+#endif // !defined(OMR_COMPILEDBODYSTORE_INCL)
@@ -39,6 +39,7 @@ class TR_FrontEnd;
 class TR_ResolvedMethod;
 namespace TR { class IlGeneratorMethodDetails; }
 namespace TR { class IlVerifier; }
+namespace TR { class StaticRelocationCollector; }
 
 namespace OMR
 {
@@ -66,8 +67,11 @@ public:
    TR::IlVerifier * getIlVerifier()                     { return _ilVerifier; }
    void setIlVerifier(TR::IlVerifier * ilVerifier)      { _ilVerifier = ilVerifier; }
 
+   TR::StaticRelocationCollector * getStaticRelocationCollector()                  { return _staticRelocationCollector; }
+   void setStaticRelocationCollector(TR::StaticRelocationCollector * collector)    { _staticRelocationCollector = collector; }
+
 protected:
-   IlGeneratorMethodDetails() : _ilVerifier(NULL) { }
+   IlGeneratorMethodDetails() : _ilVerifier(NULL), _staticRelocationCollector(NULL) { }
    virtual ~IlGeneratorMethodDetails() {}
 
    void *operator new(size_t size, TR::IlGeneratorMethodDetails *p){ return (void*) p; }
@@ -77,6 +81,7 @@ protected:
    void operator delete(void *pMem, size_t size) { ::operator delete(pMem); };
 
    TR::IlVerifier     * _ilVerifier;
+   TR::StaticRelocationCollector * _staticRelocationCollector;
    };
 
 }
@@ -37,11 +37,13 @@
 #include "il/StaticSymbol.hpp"
 #include "codegen/CodeGenerator.hpp"
 #include "compile/Compilation.hpp"
+#include "compile/CompilationException.hpp"
 #include "compile/SymbolReferenceTable.hpp"
 #include "control/CompileMethod.hpp"
 #include "control/Recompilation.hpp"
 #include "infra/Assert.hpp"
 #include "infra/Cfg.hpp"
+#include "infra/vector.hpp"
 #include "infra/STLUtils.hpp"
 #include "infra/List.hpp"
 #include "infra/String.hpp"
@@ -50,6 +52,7 @@
 #include "ilgen/IlBuilder.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
+#include "ilgen/CompiledBodyStore.hpp"
 #include "ilgen/TypeDictionary.hpp"
 #include "ilgen/VirtualMachineState.hpp"
 
@@ -122,7 +125,8 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
    _inlineSiteIndex(-1),
    _nextInlineSiteIndex(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _compiledBodyStore(NULL)
    {
    _definingLine[0] = '\0';
    }
@@ -155,7 +159,8 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
    _inlineSiteIndex(callerMB->getNextInlineSiteIndex()),
    _nextInlineSiteIndex(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _compiledBodyStore(NULL)
    {
    _definingLine[0] = '\0';
    initialize(callerMB->_details, callerMB->_methodSymbol, callerMB->_fe, callerMB->_symRefTab);
@@ -716,14 +721,164 @@ OMR::MethodBuilder::GetNextBytecodeFromWorklist()
    return bci;
    }
 
+typedef TR::vector<uint8_t, TR::Region &> ILFingerprint;
+
+static void
+appendToFingerprint(ILFingerprint &fingerprint, const void *bytes, size_t length)
+   {
+   const uint8_t *cursor = static_cast<const uint8_t *>(bytes);
+   fingerprint.insert(fingerprint.end(), cursor, cursor + length);
+   }
+
+template <typename T> static void
+appendToFingerprint(ILFingerprint &fingerprint, T value)
+   {
+   appendToFingerprint(fingerprint, &value, sizeof(value));
+   }
+
+static void
+appendStringToFingerprint(ILFingerprint &fingerprint, const char *string)
+   {
+   uint32_t length = (NULL != string) ? static_cast<uint32_t>(strlen(string)) : 0;
+   appendToFingerprint(fingerprint, length);
+   appendToFingerprint(fingerprint, string, length);
+   }
+
+// Anything that can change the generated code must be part of the fingerprint. Addresses that
+// the code embeds without a static relocation (statics, address constants, helpers) are recorded
+// as they are, so that a body is only reused where they are the same; calls to functions defined
+// on the MethodBuilder are recorded by name, and relocated when a stored body is installed.
+static bool
+fingerprintNode(TR::Compilation *comp, TR::Node *node, vcount_t visitCount, ILFingerprint &fingerprint)
+   {
+   appendToFingerprint(fingerprint, static_cast<uint32_t>(node->getGlobalIndex()));
+   if (node->getVisitCount() == visitCount)
+      {
+      // commoned reference to a node already recorded
+      appendToFingerprint(fingerprint, static_cast<uint8_t>(0));
+      return true;
+      }
+   node->setVisitCount(visitCount);
+
+   appendToFingerprint(fingerprint, static_cast<uint8_t>(1));
+   appendToFingerprint(fingerprint, static_cast<uint32_t>(node->getOpCodeValue()));
+   appendToFingerprint(fingerprint, static_cast<uint32_t>(node->getDataType().getDataType()));
+   appendToFingerprint(fingerprint, static_cast<uint32_t>(node->getNumChildren()));
+   appendToFingerprint(fingerprint, node->getFlags().getValue());
+
+   if (node->getOpCode().isLoadConst())
+      {
+      switch (node->getDataType())
+         {
+         case TR::Int8:
+         case TR::Int16:
+         case TR::Int32:
+         case TR::Int64:
+            appendToFingerprint(fingerprint, node->get64bitIntegralValueAsUnsigned());
+            break;
+         case TR::Float:
+            appendToFingerprint(fingerprint, node->getFloatBits());
+            break;
+         case TR::Double:
+            appendToFingerprint(fingerprint, node->getDoubleBits());
+            break;
+         case TR::Address:
+            appendToFingerprint(fingerprint, node->getAddress());
+            break;
+         default:
+            return false;
+         }
+      }
+
+   if (node->getOpCodeValue() == TR::BBStart || node->getOpCodeValue() == TR::BBEnd)
+      {
+      TR::Block *block = node->getBlock();
+      appendToFingerprint(fingerprint, static_cast<int32_t>(block->getNumber()));
+      appendToFingerprint(fingerprint, static_cast<uint8_t>(block->isCold()));
+      appendToFingerprint(fingerprint, static_cast<int32_t>(block->getFrequency()));
+      }
+
+   if (node->getOpCode().isBranch() || node->getOpCodeValue() == TR::Case)
+      {
+      TR::TreeTop *destination = node->getBranchDestination();
+      appendToFingerprint(fingerprint, static_cast<int32_t>(destination->getNode()->getBlock()->getNumber()));
+      if (node->getOpCodeValue() == TR::Case)
+         appendToFingerprint(fingerprint, static_cast<int64_t>(node->getCaseConstant()));
+      }
+
+   if (node->getOpCode().hasSymbolReference())
+      {
+      TR::SymbolReference *symRef = node->getSymbolReference();
+      TR::Symbol *symbol = symRef->getSymbol();
+      appendToFingerprint(fingerprint, static_cast<int32_t>(symRef->getReferenceNumber()));
+      appendToFingerprint(fingerprint, static_cast<int64_t>(symRef->getOffset()));
+      appendToFingerprint(fingerprint, static_cast<uint32_t>(symbol->getDataType().getDataType()));
+      appendToFingerprint(fingerprint, static_cast<uint64_t>(symbol->getSize()));
+      appendToFingerprint(fingerprint, symbol->getFlags());
+      if (symbol->isStatic())
+         {
+         appendToFingerprint(fingerprint, symbol->castToStaticSymbol()->getStaticAddress());
+         }
+      else if (symbol->isResolvedMethod())
+         {
+         TR_ResolvedMethod *method = symbol->castToResolvedMethodSymbol()->getResolvedMethod();
+         appendStringToFingerprint(fingerprint, method->externalName(comp->trMemory()));
+         }
+      else if (symbol->isMethod())
+         {
+         appendToFingerprint(fingerprint, symbol->castToMethodSymbol()->getMethodAddress());
+         }
+      }
+
+   for (int32_t c = 0; c < node->getNumChildren(); c++)
+      {
+      if (!fingerprintNode(comp, node->getChild(c), visitCount, fingerprint))
+         return false;
+      }
+   return true;
+   }
+
+bool
+OMR::MethodBuilder::injectIL()
+   {
+   bool rc = TR::IlBuilder::injectIL();
+   if (!rc || NULL == _compiledBodyStore)
+      return rc;
+
+   ILFingerprint fingerprint(comp()->trMemory()->currentStackRegion());
+   appendStringToFingerprint(fingerprint, comp()->signature());
+
+   vcount_t visitCount = comp()->incVisitCount();
+   for (TR::TreeTop *tt = _methodSymbol->getFirstTreeTop(); NULL != tt; tt = tt->getNextTreeTop())
+      {
+      if (!fingerprintNode(comp(), tt->getNode(), visitCount, fingerprint))
+         {
+         TraceIL("[ %p ] IL cannot be fingerprinted, not using the compiled body store\n", this);
+         return rc;
+         }
+      }
+
+   void *storedEntryPoint = _compiledBodyStore->lookup(static_cast<TR::MethodBuilder *>(this), fingerprint.data(), static_cast<uint32_t>(fingerprint.size()));
+   if (NULL != storedEntryPoint)
+      {
+      // the stored body is used instead, so the compilation ends here and succeeds with its entry point
+      TraceIL("[ %p ] compiled body store installed a body at %p\n", this, storedEntryPoint);
+      throw TR::CompiledBodyReused(storedEntryPoint);
+      }
+   return rc;
+   }
+
 int32_t
-OMR::MethodBuilder::Compile(void **entry)
+OMR::MethodBuilder::Compile(void **entry, TR::SegmentAllocator *scratchSegmentProvider, TR::CompiledBodyStore *store)
    {
    TR::ResolvedMethod resolvedMethod(static_cast<TR::MethodBuilder *>(this));
    TR::IlGeneratorMethodDetails details(&resolvedMethod);
+   details.setStaticRelocationCollector(store);
+   _compiledBodyStore = store;
 
    int32_t rc=0;
-   *entry = (void *) compileMethodFromDetails(NULL, details, warm, rc);
+   *entry = (void *) compileMethodFromDetails(NULL, details, warm, rc, scratchSegmentProvider);
+   _compiledBodyStore = NULL;
 
    // let TypeDictionary know to clear out sym refs used in this compilation so
    // no dangling pointers
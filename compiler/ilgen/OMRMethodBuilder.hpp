@@ -38,6 +38,8 @@ namespace TR { class ResolvedMethod; }
 namespace TR { class SymbolReference; }
 namespace TR { class VirtualMachineState; }
 
+namespace TR { class SegmentAllocator; }
+namespace TR { class CompiledBodyStore; }
 namespace TR { class SegmentProvider; }
 namespace TR { class Region; }
 
@@ -60,6 +62,13 @@ class MethodBuilder : public TR::IlBuilder
 
    virtual void setupForBuildIL();
 
+   /**
+    * @brief generates the IL, then offers it to the compiled body store, if there is one; when the
+    *        store installs a body for this IL, throws TR::CompiledBodyReused so the compilation
+    *        ends successfully with that body
+    */
+   virtual bool injectIL();
+
    /**
     * @brief returns the next index to be used for new values
     * @returns the next value index
@@ -144,7 +153,16 @@ class MethodBuilder : public TR::IlBuilder
                        int32_t          numParms,
                        TR::IlType     ** parmTypes);
 
-   int32_t Compile(void **entry);
+   /**
+    * @brief compile this method builder
+    * @param entry set to the entry point of the compiled code, or NULL if the compilation failed
+    * @param scratchSegmentProvider if not NULL, provides the scratch memory for the compilation instead
+    *        of a provider that lives only as long as the compilation
+    * @param store if not NULL, supplies a body compiled earlier for identical IL, or otherwise collects
+    *        the body compiled now so that it can be reused
+    * @return the compilation return code
+    */
+   int32_t Compile(void **entry, TR::SegmentAllocator *scratchSegmentProvider = NULL, TR::CompiledBodyStore *store = NULL);
 
    /**
     * @brief will be called if a Call is issued to a function that has not yet been defined, provides a
@@ -388,6 +406,9 @@ class MethodBuilder : public TR::IlBuilder
    TR::IlBuilder             * _returnBuilder;
    const char                * _returnSymbolName;
 
+   // Only set while Compile() runs with a store
+   TR::CompiledBodyStore     * _compiledBodyStore;
+
 private:
    static ClientAllocator      _clientAllocator;
    static ImplGetter _getImpl;
@@ -475,7 +475,17 @@ TR_GlobalRegisterAllocator::perform()
       //
       if (canAffordAssignment)
          {
-         globalFPAssignmentDone = _candidates->assign(cfgBlocks, numberOfBlocks, _firstGlobalRegisterNumber, _lastGlobalRegisterNumber);
+         // Cheaper compiles can trade some allocation quality for compile time
+         // by assigning registers with a single linear scan over live intervals
+         //
+         if (comp()->getMethodHotness() <= comp()->getOptions()->getLinearScanGRAMaxHotness())
+            {
+            if (trace())
+               traceMsg(comp(), "Using linear scan register assignment at %s\n", TR::Compilation::getHotnessName(comp()->getMethodHotness()));
+            globalFPAssignmentDone = _candidates->assignLinearScan(cfgBlocks, numberOfBlocks, _firstGlobalRegisterNumber, _lastGlobalRegisterNumber);
+            }
+         else
+            globalFPAssignmentDone = _candidates->assign(cfgBlocks, numberOfBlocks, _firstGlobalRegisterNumber, _lastGlobalRegisterNumber);
 
          if (_lastGlobalRegisterNumber > -1)
             {
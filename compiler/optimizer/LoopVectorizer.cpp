@@ -0,0 +1,864 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/LoopVectorizer.hpp"
+
+#include <stdint.h>
+#include <algorithm>
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "env/TRMemory.hpp"
+#include "il/Block.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/CfgEdge.hpp"
+#include "infra/CfgNode.hpp"
+#include "optimizer/InductionVariable.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/Structure.hpp"
+
+#define OPT_DETAILS "O^O LOOP VECTORIZER: "
+
+// Each check compares two address ranges; beyond this many the versioning
+// test costs more than the scalar loop it is trying to avoid.
+#define MAX_ALIAS_CHECKS 8
+
+TR_LoopVectorizer::TR_LoopVectorizer(TR::OptimizationManager *manager)
+   : TR::Optimization(manager),
+     _cfg(NULL)
+   {}
+
+bool TR_LoopVectorizer::shouldPerform()
+   {
+   if (comp()->getOption(TR_DisableAutoSIMD))
+      {
+      if (trace())
+         traceMsg(comp(), "AutoSIMD is disabled -- returning from loop vectorizer.\n");
+      return false;
+      }
+
+   // The versioning and trip count tests are computed in 64 bits
+   if (!comp()->target().is64Bit())
+      return false;
+
+   if (!comp()->mayHaveLoops())
+      {
+      if (trace())
+         traceMsg(comp(), "Method does not have loops -- returning from loop vectorizer.\n");
+      return false;
+      }
+
+   return true;
+   }
+
+int32_t TR_LoopVectorizer::perform()
+   {
+   _cfg = comp()->getFlowGraph();
+   TR_Structure *rootStructure = _cfg->getStructure();
+   if (!rootStructure || !rootStructure->asRegion())
+      return 0;
+
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+   if (trace())
+      comp()->dumpMethodTrees("Before loop vectorization");
+
+   TR::vector<TR_RegionStructure *, TR::Region &> loops(stackMemoryRegion);
+   bool containsLoop = false;
+   collectInnermostLoops(rootStructure->asRegion(), loops, containsLoop);
+
+   // Analyze every loop while the structure is still valid, then transform
+   TR::vector<LoopInfo *, TR::Region &> candidates(stackMemoryRegion);
+   for (auto it = loops.begin(); it != loops.end(); ++it)
+      {
+      TR_RegionStructure *loop = *it;
+      LoopInfo &info = *new (stackMemoryRegion) LoopInfo(stackMemoryRegion);
+
+      if (!analyzeLoopShape(loop, info))
+         continue;
+
+      // Prefer the widest vectors the code generator can handle for every
+      // operation in the loop.
+      static const TR::VectorLength lengths[] = { TR::VectorLength256, TR::VectorLength128 };
+      for (int32_t i = 0; i < 2 && info._vectorLength == TR::NoVectorLength; i++)
+         {
+         if (lengths[i] > TR::NumVectorLengths)
+            continue;
+
+         info._vectorLength = lengths[i];
+         if (!analyzeLoopBody(info))
+            info._vectorLength = TR::NoVectorLength;
+         }
+
+      if (info._vectorLength == TR::NoVectorLength)
+         {
+         if (trace())
+            traceMsg(comp(), "Loop %d: body cannot be vectorized\n", loop->getNumber());
+         continue;
+         }
+
+      if (!analyzeDependences(info))
+         continue;
+
+      if (!performTransformation(comp(), "%sVectorizing loop %d (block_%d) with %s vectors of %s%s\n", OPT_DETAILS,
+            loop->getNumber(), info._loop->getNumber(),
+            TR::DataType::getVectorLengthName(info._vectorLength),
+            TR::DataType::getName(info._elementType),
+            info._aliasChecks.empty() ? "" : " under a runtime alias check"))
+         continue;
+
+      candidates.push_back(&info);
+      }
+
+   if (!candidates.empty())
+      {
+      _cfg->setStructure(NULL);
+
+      for (auto it = candidates.begin(); it != candidates.end(); ++it)
+         transformLoop(**it);
+
+      optimizer()->setUseDefInfo(NULL);
+      optimizer()->setValueNumberInfo(NULL);
+      requestOpt(OMR::inductionVariableAnalysis);
+
+      if (trace())
+         comp()->dumpMethodTrees("After loop vectorization");
+      }
+
+   return static_cast<int32_t>(candidates.size());
+   }
+
+const char *
+TR_LoopVectorizer::optDetailString() const throw()
+   {
+   return "O^O LOOP VECTORIZER: ";
+   }
+
+void
+TR_LoopVectorizer::collectInnermostLoops(TR_RegionStructure *region, TR::vector<TR_RegionStructure *, TR::Region &> &loops, bool &containsLoop)
+   {
+   bool subRegionContainsLoop = false;
+   TR_RegionStructure::Cursor it(*region);
+   for (TR_StructureSubGraphNode *node = it.getFirst(); node; node = it.getNext())
+      {
+      TR_RegionStructure *subRegion = node->getStructure()->asRegion();
+      if (subRegion)
+         collectInnermostLoops(subRegion, loops, subRegionContainsLoop);
+      }
+
+   if (region->isNaturalLoop())
+      {
+      if (!subRegionContainsLoop)
+         loops.push_back(region);
+      containsLoop = true;
+      }
+   else if (subRegionContainsLoop)
+      {
+      containsLoop = true;
+      }
+   }
+
+/*
+ * Check the loop is a single block ending in
+ *
+ *    istore iv (iadd (iload iv) (iconst 1))
+ *    ificmplt --> loop (==>iadd, limit)
+ *
+ * with a pre-header that falls through into it and a fall through exit.
+ */
+bool
+TR_LoopVectorizer::analyzeLoopShape(TR_RegionStructure *loop, LoopInfo &info)
+   {
+   if (loop->numSubNodes() != 1 || !loop->getEntry()->getStructure()->asBlock())
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: not a single block loop\n", loop->getNumber());
+      return false;
+      }
+
+   TR::Block *block = loop->getEntryBlock();
+   TR_PrimaryInductionVariable *piv = loop->getPrimaryInductionVariable();
+   if (!piv
+       || piv->getBranchBlock() != block
+       || piv->getDeltaOnBackEdge() != 1
+       || piv->getNumLoopExits() != 1
+       || piv->usesUnchangedValueInLoopTest()
+       || piv->getSymRef()->getSymbol()->getDataType() != TR::Int32)
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: no unit stride primary induction variable\n", loop->getNumber());
+      return false;
+      }
+
+   TR::Block *exit = block->getNextBlock();
+   if (!exit
+       || block->getSuccessors().size() != 2
+       || !block->getExceptionSuccessors().empty()
+       || block->getPredecessors().size() != 2)
+      return false;
+
+   TR::Block *preHeader = NULL;
+   bool hasBackEdge = false;
+   for (auto edge = block->getPredecessors().begin(); edge != block->getPredecessors().end(); ++edge)
+      {
+      if ((*edge)->getFrom() == block)
+         hasBackEdge = true;
+      else
+         preHeader = toBlock((*edge)->getFrom());
+      }
+
+   bool exitsToNextBlock = false;
+   for (auto edge = block->getSuccessors().begin(); edge != block->getSuccessors().end(); ++edge)
+      {
+      if ((*edge)->getTo() == exit)
+         exitsToNextBlock = true;
+      }
+
+   if (!hasBackEdge || !exitsToNextBlock || !preHeader || !preHeader->getEntry()
+       || preHeader->getNextBlock() != block
+       || preHeader->getSuccessors().size() != 1)
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: unexpected control flow around block_%d\n", loop->getNumber(), block->getNumber());
+      return false;
+      }
+
+   TR::ILOpCode &preHeaderLastOp = preHeader->getLastRealTreeTop()->getNode()->getOpCode();
+   if (preHeaderLastOp.isBranch() || preHeaderLastOp.isJumpWithMultipleTargets() || preHeaderLastOp.isReturn())
+      return false;
+
+   TR::SymbolReference *iv = piv->getSymRef();
+   TR::TreeTop *branchTree = block->getLastRealTreeTop();
+   TR::TreeTop *incrementTree = branchTree->getPrevTreeTop();
+   TR::Node *branch = branchTree->getNode();
+   TR::Node *increment = incrementTree->getNode();
+
+   if (!increment->getOpCode().isStoreDirect() || increment->getSymbolReference() != iv)
+      return false;
+
+   TR::Node *step = increment->getFirstChild();
+   if (step->getNumChildren() != 2
+       || !step->getFirstChild()->getOpCode().isLoadVarDirect()
+       || step->getFirstChild()->getSymbolReference() != iv
+       || step->getSecondChild()->getOpCodeValue() != TR::iconst
+       || !((step->getOpCodeValue() == TR::iadd && step->getSecondChild()->getInt() == 1)
+            || (step->getOpCodeValue() == TR::isub && step->getSecondChild()->getInt() == -1)))
+      return false;
+
+   TR::Node *ivValue = NULL;
+   TR::Node *limit = NULL;
+   if (branch->getOpCodeValue() == TR::ificmplt)
+      {
+      ivValue = branch->getFirstChild();
+      limit = branch->getSecondChild();
+      }
+   else if (branch->getOpCodeValue() == TR::ificmpgt)
+      {
+      ivValue = branch->getSecondChild();
+      limit = branch->getFirstChild();
+      }
+
+   if (!ivValue || branch->getBranchDestination() != block->getEntry())
+      return false;
+
+   // The test must be on the incremented value
+   if (ivValue != step
+       && !(ivValue->getOpCode().isLoadVarDirect() && ivValue->getSymbolReference() == iv && ivValue->getReferenceCount() == 1))
+      return false;
+
+   for (TR::TreeTop *tt = block->getFirstRealTreeTop(); tt != block->getExit(); tt = tt->getNextTreeTop())
+      {
+      if (tt->getNode()->getOpCode().isStoreDirect())
+         info._storedSymRefs.push_back(tt->getNode()->getSymbolReference());
+      }
+
+   info._loop = block;
+   info._preHeader = preHeader;
+   info._exit = exit;
+   info._iv = iv;
+   info._limit = limit;
+   info._incrementTree = incrementTree;
+
+   if (limit->getOpCodeValue() != TR::iconst && !isLoopInvariantLoad(limit, info))
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: limit is not loop invariant\n", loop->getNumber());
+      return false;
+      }
+
+   for (TR::TreeTop *tt = block->getFirstRealTreeTop(); tt != incrementTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCode().isStoreIndirect()
+          || (node->getOpCode().isStoreDirect() && node->getSymbolReference() != iv))
+         {
+         info._elementType = node->getDataType();
+         break;
+         }
+      }
+
+   if (!info._elementType.isVectorElement())
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: no stores of a vector element type\n", loop->getNumber());
+      return false;
+      }
+
+   return true;
+   }
+
+bool
+TR_LoopVectorizer::analyzeLoopBody(LoopInfo &info)
+   {
+   info._accesses.clear();
+
+   TR::NodeChecklist visited(comp());
+   TR::DataType vectorType = TR::DataType::createVectorType(info._elementType, info._vectorLength);
+
+   for (TR::TreeTop *tt = info._loop->getFirstRealTreeTop(); tt != info._incrementTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      TR::Node *expression = NULL;
+
+      if (node->getOpCodeValue() == TR::treetop)
+         {
+         expression = node->getFirstChild();
+         }
+      else if (node->getOpCode().isStoreIndirect())
+         {
+         if (node->getDataType() != info._elementType
+             || !isArrayAccess(node, info, true)
+             || !isSupported(TR::ILOpCode::createVectorOpCode(TR::vstorei, vectorType)))
+            return false;
+         expression = node->getSecondChild();
+         }
+      else if (node->getOpCode().isStoreDirect())
+         {
+         if (!isReduction(node, info, &expression)
+             || !isSupported(TR::ILOpCode::createVectorOpCode(TR::vreductionAdd, vectorType)))
+            return false;
+         }
+
+      if (!expression || !isVectorizableExpression(expression, info, visited))
+         {
+         if (trace())
+            traceMsg(comp(), "Loop %d: cannot vectorize n%dn with %s\n", info._loop->getNumber(),
+               node->getGlobalIndex(), TR::DataType::getVectorLengthName(info._vectorLength));
+         return false;
+         }
+      }
+
+   return true;
+   }
+
+/*
+ * Accesses through the same base must hit the same element in each iteration.
+ * Accesses through different bases are disambiguated at run time.
+ */
+bool
+TR_LoopVectorizer::analyzeDependences(LoopInfo &info)
+   {
+   info._aliasChecks.clear();
+
+   for (size_t i = 0; i < info._accesses.size(); i++)
+      {
+      ArrayAccess &first = info._accesses[i];
+      for (size_t j = i + 1; j < info._accesses.size(); j++)
+         {
+         ArrayAccess &second = info._accesses[j];
+         if (!first._isStore && !second._isStore)
+            continue;
+
+         if (first._base == second._base)
+            {
+            if (first._offset != second._offset)
+               {
+               if (trace())
+                  traceMsg(comp(), "Loop %d: loop carried dependence between n%dn and n%dn\n", info._loop->getNumber(),
+                     first._node->getGlobalIndex(), second._node->getGlobalIndex());
+               return false;
+               }
+            continue;
+            }
+
+         bool alreadyChecked = false;
+         for (auto check = info._aliasChecks.begin(); check != info._aliasChecks.end() && !alreadyChecked; ++check)
+            {
+            ArrayAccess &checkedFirst = info._accesses[check->first];
+            ArrayAccess &checkedSecond = info._accesses[check->second];
+            if ((checkedFirst._base == first._base && checkedFirst._offset == first._offset
+                 && checkedSecond._base == second._base && checkedSecond._offset == second._offset)
+                || (checkedFirst._base == second._base && checkedFirst._offset == second._offset
+                    && checkedSecond._base == first._base && checkedSecond._offset == first._offset))
+               alreadyChecked = true;
+            }
+
+         if (alreadyChecked)
+            continue;
+
+         if (info._aliasChecks.size() >= MAX_ALIAS_CHECKS)
+            {
+            if (trace())
+               traceMsg(comp(), "Loop %d: too many alias checks required\n", info._loop->getNumber());
+            return false;
+            }
+
+         info._aliasChecks.push_back(std::make_pair(i, j));
+         }
+      }
+
+   return true;
+   }
+
+bool
+TR_LoopVectorizer::isVectorizableExpression(TR::Node *node, LoopInfo &info, TR::NodeChecklist &visited)
+   {
+   if (visited.contains(node))
+      return true;
+   visited.add(node);
+
+   TR::DataType vectorType = TR::DataType::createVectorType(info._elementType, info._vectorLength);
+   TR::ILOpCode &op = node->getOpCode();
+
+   if (op.isLoadConst() || op.isLoadVarDirect())
+      {
+      return node->getDataType() == info._elementType
+         && (op.isLoadConst() || isLoopInvariantLoad(node, info))
+         && isSupported(TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType));
+      }
+
+   if (op.isLoadIndirect())
+      {
+      return node->getDataType() == info._elementType
+         && isArrayAccess(node, info, false)
+         && isSupported(TR::ILOpCode::createVectorOpCode(TR::vloadi, vectorType));
+      }
+
+   if (op.isBooleanCompare() && !op.isBranch())
+      {
+      // Boolean results are materialized as vmadd(0, 1, mask), so the
+      // compared elements must be the same width as the stored result
+      TR::VectorOperation compare = TR::vBadOperation;
+      switch (node->getOpCodeValue())
+         {
+         case TR::icmpeq: compare = TR::vcmpeq; break;
+         case TR::icmpne: compare = TR::vcmpne; break;
+         case TR::icmplt: compare = TR::vcmplt; break;
+         case TR::icmple: compare = TR::vcmple; break;
+         case TR::icmpgt: compare = TR::vcmpgt; break;
+         case TR::icmpge: compare = TR::vcmpge; break;
+         default: break;
+         }
+
+      if (compare == TR::vBadOperation || info._elementType != TR::Int32)
+         return false;
+
+      TR::DataType maskType = TR::DataType::createMaskType(info._elementType, info._vectorLength);
+      return isSupported(TR::ILOpCode::createVectorOpCode(compare, vectorType, maskType))
+         && isSupported(TR::ILOpCode::createVectorOpCode(TR::vmadd, vectorType))
+         && isSupported(TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType))
+         && isVectorizableExpression(node->getFirstChild(), info, visited)
+         && isVectorizableExpression(node->getSecondChild(), info, visited);
+      }
+
+   if (node->getDataType() != info._elementType)
+      return false;
+
+   TR::ILOpCodes vectorOp = TR::ILOpCode::convertScalarToVector(node->getOpCodeValue(), info._vectorLength);
+   if (vectorOp == TR::BadILOp)
+      return false;
+
+   switch (TR::ILOpCode(vectorOp).getVectorOperation())
+      {
+      case TR::vadd:
+      case TR::vsub:
+      case TR::vmul:
+      case TR::vneg:
+      case TR::vabs:
+      case TR::vmin:
+      case TR::vmax:
+      case TR::vand:
+      case TR::vor:
+      case TR::vxor:
+         break;
+      case TR::vdiv:
+         // Integer division can trap on a lane the scalar loop never reaches
+         if (!info._elementType.isFloatingPoint())
+            return false;
+         break;
+      default:
+         return false;
+      }
+
+   if (!isSupported(vectorOp))
+      return false;
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!isVectorizableExpression(node->getChild(i), info, visited))
+         return false;
+      }
+
+   return true;
+   }
+
+/*
+ * Match sum = sum + expression where sum is only used by this store.
+ * Only integer sums are reassociated.
+ */
+bool
+TR_LoopVectorizer::isReduction(TR::Node *store, LoopInfo &info, TR::Node **expression)
+   {
+   TR::SymbolReference *symRef = store->getSymbolReference();
+   TR::Node *add = store->getFirstChild();
+
+   if (store->getDataType() != info._elementType
+       || info._elementType.isFloatingPoint()
+       || !symRef->getSymbol()->isAutoOrParm()
+       || std::count(info._storedSymRefs.begin(), info._storedSymRefs.end(), symRef) != 1
+       || add->getOpCodeValue() != TR::ILOpCode::addOpCode(info._elementType, comp()->target().is64Bit())
+       || add->getReferenceCount() != 1)
+      return false;
+
+   for (int32_t i = 0; i < 2; i++)
+      {
+      TR::Node *child = add->getChild(i);
+      if (child->getOpCode().isLoadVarDirect()
+          && child->getSymbolReference() == symRef
+          && child->getReferenceCount() == 1)
+         {
+         *expression = add->getChild(1 - i);
+         return true;
+         }
+      }
+
+   return false;
+   }
+
+/*
+ * Match an indirect load or store through an array shadow of
+ *
+ *    aladd (aload base) (lmul (i2l (iload iv)) (lconst elementSize))
+ *
+ * allowing a constant offset on either the element index or the byte offset.
+ */
+bool
+TR_LoopVectorizer::isArrayAccess(TR::Node *node, LoopInfo &info, bool isStore)
+   {
+   if (!node->getSymbolReference()->getSymbol()->isArrayShadowSymbol())
+      return false;
+
+   TR::Node *address = node->getFirstChild();
+   if (address->getOpCodeValue() != TR::aladd)
+      return false;
+
+   TR::Node *base = address->getFirstChild();
+   if (!base->getOpCode().isLoadVarDirect() || base->getDataType() != TR::Address || !isLoopInvariantLoad(base, info))
+      return false;
+
+   int32_t elementSize = TR::DataType::getSize(info._elementType);
+   int64_t offset = 0;
+   TR::Node *index = address->getSecondChild();
+
+   if ((index->getOpCodeValue() == TR::ladd || index->getOpCodeValue() == TR::lsub)
+       && index->getSecondChild()->getOpCodeValue() == TR::lconst)
+      {
+      int64_t value = index->getSecondChild()->getLongInt();
+      offset = (index->getOpCodeValue() == TR::ladd) ? value : -value;
+      index = index->getFirstChild();
+      }
+
+   int64_t scale = 1;
+   if (index->getOpCodeValue() == TR::lmul && index->getSecondChild()->getOpCodeValue() == TR::lconst)
+      {
+      scale = index->getSecondChild()->getLongInt();
+      index = index->getFirstChild();
+      }
+   else if (index->getOpCodeValue() == TR::lshl && index->getSecondChild()->getOpCodeValue() == TR::iconst)
+      {
+      int32_t shift = index->getSecondChild()->getInt();
+      if (shift < 0 || shift > 3)
+         return false;
+      scale = ((int64_t)1) << shift;
+      index = index->getFirstChild();
+      }
+
+   if (scale != elementSize || index->getOpCodeValue() != TR::i2l)
+      return false;
+
+   index = index->getFirstChild();
+   if (index->getOpCodeValue() == TR::iadd && index->getSecondChild()->getOpCodeValue() == TR::iconst)
+      {
+      offset += ((int64_t)index->getSecondChild()->getInt()) * elementSize;
+      index = index->getFirstChild();
+      }
+
+   if (!index->getOpCode().isLoadVarDirect() || index->getSymbolReference() != info._iv)
+      return false;
+
+   ArrayAccess access = { node, base->getSymbolReference(), offset, isStore };
+   info._accesses.push_back(access);
+   return true;
+   }
+
+bool
+TR_LoopVectorizer::isLoopInvariantLoad(TR::Node *node, LoopInfo &info)
+   {
+   TR::SymbolReference *symRef = node->getSymbolReference();
+   return node->getOpCode().isLoadVarDirect()
+      && symRef->getSymbol()->isAutoOrParm()
+      && symRef != info._iv
+      && std::find(info._storedSymRefs.begin(), info._storedSymRefs.end(), symRef) == info._storedSymRefs.end();
+   }
+
+bool
+TR_LoopVectorizer::isSupported(TR::ILOpCodes op)
+   {
+   return op != TR::BadILOp && comp()->cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(op));
+   }
+
+TR::Block *
+TR_LoopVectorizer::createBlock(LoopInfo &info, int32_t frequency)
+   {
+   TR::Block *block = TR::Block::createEmptyBlock(info._loop->getEntry()->getNode(), comp(), frequency, info._loop);
+   _cfg->addNode(block);
+   return block;
+   }
+
+// (long)limit - (long)iv, the number of scalar iterations left to run
+TR::Node *
+TR_LoopVectorizer::createRemainingCount(LoopInfo &info)
+   {
+   return TR::Node::create(TR::lsub, 2,
+      TR::Node::create(TR::i2l, 1, info._limit->duplicateTree()),
+      TR::Node::create(TR::i2l, 1, TR::Node::createLoad(info._iv)));
+   }
+
+/*
+ * Non zero if any checked pair of accesses overlaps over the remaining
+ * iterations. Ranges starting at the same address are fine: both accesses
+ * then touch the same element in every iteration.
+ */
+TR::Node *
+TR_LoopVectorizer::createAliasCheck(LoopInfo &info)
+   {
+   int32_t elementSize = TR::DataType::getSize(info._elementType);
+   TR::Node *extent = TR::Node::create(TR::lmul, 2, createRemainingCount(info), TR::Node::lconst(elementSize));
+   TR::Node *conflict = NULL;
+
+   for (auto check = info._aliasChecks.begin(); check != info._aliasChecks.end(); ++check)
+      {
+      TR::Node *first = TR::Node::create(TR::a2l, 1, info._accesses[check->first]._node->getFirstChild()->duplicateTree());
+      TR::Node *second = TR::Node::create(TR::a2l, 1, info._accesses[check->second]._node->getFirstChild()->duplicateTree());
+
+      TR::Node *overlap = TR::Node::create(TR::iand, 2,
+         TR::Node::create(TR::lcmplt, 2, first, TR::Node::create(TR::ladd, 2, second, extent)),
+         TR::Node::create(TR::lcmplt, 2, second, TR::Node::create(TR::ladd, 2, first, extent)));
+      overlap = TR::Node::create(TR::iand, 2, overlap, TR::Node::create(TR::lcmpne, 2, first, second));
+
+      conflict = conflict ? TR::Node::create(TR::ior, 2, conflict, overlap) : overlap;
+      }
+
+   return conflict;
+   }
+
+TR::Node *
+TR_LoopVectorizer::cloneScalar(TR::Node *node, NodeMap &scalarNodes)
+   {
+   auto found = scalarNodes.find(node);
+   if (found != scalarNodes.end())
+      return found->second;
+
+   TR::Node *clone = TR::Node::copy(node);
+   clone->setReferenceCount(0);
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      clone->setAndIncChild(i, cloneScalar(node->getChild(i), scalarNodes));
+
+   scalarNodes[node] = clone;
+   return clone;
+   }
+
+TR::Node *
+TR_LoopVectorizer::vectorize(TR::Node *node, LoopInfo &info, NodeMap &vectorNodes, NodeMap &scalarNodes)
+   {
+   auto found = vectorNodes.find(node);
+   if (found != vectorNodes.end())
+      return found->second;
+
+   TR::DataType vectorType = TR::DataType::createVectorType(info._elementType, info._vectorLength);
+   TR::ILOpCode &op = node->getOpCode();
+   TR::Node *vectorNode = NULL;
+
+   if (op.isLoadConst() || op.isLoadVarDirect())
+      {
+      vectorNode = TR::Node::create(TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType), 1, cloneScalar(node, scalarNodes));
+      }
+   else if (op.isLoadIndirect())
+      {
+      vectorNode = TR::Node::createWithSymRef(TR::ILOpCode::createVectorOpCode(TR::vloadi, vectorType), 1, 1,
+         cloneScalar(node->getFirstChild(), scalarNodes), node->getSymbolReference());
+      }
+   else if (op.isBooleanCompare())
+      {
+      TR::VectorOperation compare;
+      switch (node->getOpCodeValue())
+         {
+         case TR::icmpeq: compare = TR::vcmpeq; break;
+         case TR::icmpne: compare = TR::vcmpne; break;
+         case TR::icmplt: compare = TR::vcmplt; break;
+         case TR::icmple: compare = TR::vcmple; break;
+         case TR::icmpgt: compare = TR::vcmpgt; break;
+         default:         compare = TR::vcmpge; break;
+         }
+
+      TR::DataType maskType = TR::DataType::createMaskType(info._elementType, info._vectorLength);
+      TR::Node *mask = TR::Node::create(TR::ILOpCode::createVectorOpCode(compare, vectorType, maskType), 2,
+         vectorize(node->getFirstChild(), info, vectorNodes, scalarNodes),
+         vectorize(node->getSecondChild(), info, vectorNodes, scalarNodes));
+
+      TR::ILOpCodes splats = TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType);
+      vectorNode = TR::Node::create(TR::ILOpCode::createVectorOpCode(TR::vmadd, vectorType), 3,
+         TR::Node::create(splats, 1, TR::Node::iconst(0)),
+         TR::Node::create(splats, 1, TR::Node::iconst(1)),
+         mask);
+      }
+   else
+      {
+      TR::ILOpCodes vectorOp = TR::ILOpCode::convertScalarToVector(node->getOpCodeValue(), info._vectorLength);
+      if (node->getNumChildren() == 1)
+         vectorNode = TR::Node::create(vectorOp, 1,
+            vectorize(node->getFirstChild(), info, vectorNodes, scalarNodes));
+      else
+         vectorNode = TR::Node::create(vectorOp, 2,
+            vectorize(node->getFirstChild(), info, vectorNodes, scalarNodes),
+            vectorize(node->getSecondChild(), info, vectorNodes, scalarNodes));
+      }
+
+   vectorNodes[node] = vectorNode;
+   return vectorNode;
+   }
+
+void
+TR_LoopVectorizer::transformLoop(LoopInfo &info)
+   {
+   TR::Block *loop = info._loop;
+   TR::Block *preHeader = info._preHeader;
+   TR::DataType vectorType = TR::DataType::createVectorType(info._elementType, info._vectorLength);
+   int32_t elementsPerVector = TR::DataType::getSize(vectorType) / TR::DataType::getSize(info._elementType);
+
+   TR::Block *tripCountBlock = createBlock(info, preHeader->getFrequency());
+   TR::Block *aliasCheckBlock = info._aliasChecks.empty() ? NULL : createBlock(info, preHeader->getFrequency());
+   TR::Block *vectorBlock = createBlock(info, loop->getFrequency());
+   TR::Block *remainderBlock = createBlock(info, preHeader->getFrequency());
+
+   tripCountBlock->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::iflcmplt, createRemainingCount(info), TR::Node::lconst(elementsPerVector), loop->getEntry())));
+
+   if (aliasCheckBlock)
+      aliasCheckBlock->append(TR::TreeTop::create(comp(),
+         TR::Node::createif(TR::ificmpne, createAliasCheck(info), TR::Node::iconst(0), loop->getEntry())));
+
+   NodeMap vectorNodes((NodeMapAllocator(trMemory()->currentStackRegion())));
+   NodeMap scalarNodes((NodeMapAllocator(trMemory()->currentStackRegion())));
+
+   for (TR::TreeTop *tt = loop->getFirstRealTreeTop(); tt != info._incrementTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      TR::Node *vectorTree = NULL;
+      TR::Node *expression = NULL;
+
+      if (node->getOpCodeValue() == TR::treetop)
+         {
+         vectorTree = TR::Node::create(TR::treetop, 1, vectorize(node->getFirstChild(), info, vectorNodes, scalarNodes));
+         }
+      else if (node->getOpCode().isStoreIndirect())
+         {
+         vectorTree = TR::Node::createWithSymRef(TR::ILOpCode::createVectorOpCode(TR::vstorei, vectorType), 2, 2,
+            cloneScalar(node->getFirstChild(), scalarNodes),
+            vectorize(node->getSecondChild(), info, vectorNodes, scalarNodes),
+            node->getSymbolReference());
+         }
+      else if (isReduction(node, info, &expression))
+         {
+         TR::Node *sum = TR::Node::create(TR::ILOpCode::createVectorOpCode(TR::vreductionAdd, vectorType), 1,
+            vectorize(expression, info, vectorNodes, scalarNodes));
+         vectorTree = TR::Node::createStore(node->getSymbolReference(),
+            TR::Node::create(node->getFirstChild()->getOpCodeValue(), 2, TR::Node::createLoad(node->getSymbolReference()), sum));
+         }
+
+      TR_ASSERT_FATAL(vectorTree, "Loop vectorizer: unexpected tree n%dn in block_%d", node->getGlobalIndex(), loop->getNumber());
+      vectorBlock->append(TR::TreeTop::create(comp(), vectorTree));
+      }
+
+   vectorBlock->append(TR::TreeTop::create(comp(),
+      TR::Node::createStore(info._iv,
+         TR::Node::create(TR::iadd, 2, TR::Node::createLoad(info._iv), TR::Node::iconst(elementsPerVector)))));
+   vectorBlock->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::iflcmpge, createRemainingCount(info), TR::Node::lconst(elementsPerVector), vectorBlock->getEntry())));
+
+   remainderBlock->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::ificmpge, TR::Node::createLoad(info._iv), info._limit->duplicateTree(), info._exit->getEntry())));
+
+   // Lay the new blocks out between the pre-header and the original loop,
+   // each falling through to the next
+   TR::Block *newBlocks[] = { tripCountBlock, aliasCheckBlock, vectorBlock, remainderBlock };
+   TR::Block *previous = preHeader;
+   for (int32_t i = 0; i < 4; i++)
+      {
+      if (!newBlocks[i])
+         continue;
+      previous->getExit()->join(newBlocks[i]->getEntry());
+      previous = newBlocks[i];
+      }
+   previous->getExit()->join(loop->getEntry());
+
+   _cfg->addEdge(preHeader, tripCountBlock);
+   _cfg->addEdge(tripCountBlock, loop);
+   if (aliasCheckBlock)
+      {
+      _cfg->addEdge(tripCountBlock, aliasCheckBlock);
+      _cfg->addEdge(aliasCheckBlock, loop);
+      _cfg->addEdge(aliasCheckBlock, vectorBlock);
+      }
+   else
+      {
+      _cfg->addEdge(tripCountBlock, vectorBlock);
+      }
+   _cfg->addEdge(vectorBlock, vectorBlock);
+   _cfg->addEdge(vectorBlock, remainderBlock);
+   _cfg->addEdge(remainderBlock, info._exit);
+   _cfg->addEdge(remainderBlock, loop);
+   _cfg->removeEdge(preHeader, loop);
+   }
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef LOOPVECTORIZER_INCL
+#define LOOPVECTORIZER_INCL
+
+#include <stdint.h>
+#include <map>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "infra/Checklist.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+class TR_RegionStructure;
+namespace TR { class Block; }
+namespace TR { class CFG; }
+namespace TR { class Node; }
+namespace TR { class SymbolReference; }
+namespace TR { class TreeTop; }
+
+/*
+ * Vectorizes innermost counted loops of the form
+ *
+ *    for (i = start; i < limit; i++)
+ *       c[i] = a[i] op b[i];      // and/or  sum += a[i] op b[i];
+ *
+ * The loop must already be in the shape produced by the loop canonicalizer
+ * and described by induction variable analysis: a single block that is its
+ * own back edge target, an empty-to-fallthrough pre-header, and a primary
+ * induction variable with unit stride that is compared against an invariant
+ * limit at the bottom of the loop.
+ *
+ * The transformed code is laid out in front of the original loop, which is
+ * kept unchanged as the scalar remainder:
+ *
+ *    pre-header
+ *    if (limit - i < VL) goto scalarLoop                  // trip count test
+ *    if (arrays overlap) goto scalarLoop                  // versioning test
+ *    vectorLoop:
+ *       vector body; i += VL
+ *       if (limit - i >= VL) goto vectorLoop
+ *    if (i >= limit) goto loopExit
+ *    scalarLoop: original loop
+ *
+ * Only the vector opcodes the code generator reports as supported through
+ * getSupportsOpCodeForAutoSIMD are generated.
+ */
+class TR_LoopVectorizer : public TR::Optimization
+   {
+   public:
+   TR_LoopVectorizer(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) TR_LoopVectorizer(manager);
+      }
+
+   virtual bool    shouldPerform();
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+
+   /*
+    * A load or store of base[i + _offset] where base is a loop invariant
+    * auto or parm. _offset is in bytes.
+    */
+   struct ArrayAccess
+      {
+      TR::Node *_node;
+      TR::SymbolReference *_base;
+      int64_t _offset;
+      bool _isStore;
+      };
+
+   typedef TR::typed_allocator<std::pair<TR::Node * const, TR::Node *>, TR::Region &> NodeMapAllocator;
+   typedef std::map<TR::Node *, TR::Node *, std::less<TR::Node *>, NodeMapAllocator> NodeMap;
+
+   struct LoopInfo
+      {
+      LoopInfo(TR::Region &region)
+         : _loop(NULL), _preHeader(NULL), _exit(NULL), _iv(NULL), _limit(NULL),
+           _incrementTree(NULL), _elementType(TR::NoType), _vectorLength(TR::NoVectorLength),
+           _storedSymRefs(region), _accesses(region), _aliasChecks(region)
+         {}
+
+      TR::Block *_loop;
+      TR::Block *_preHeader;
+      TR::Block *_exit;
+      TR::SymbolReference *_iv;
+      TR::Node *_limit;
+      TR::TreeTop *_incrementTree;
+      TR::DataType _elementType;
+      TR::VectorLength _vectorLength;
+      TR::vector<TR::SymbolReference *, TR::Region &> _storedSymRefs;
+      TR::vector<ArrayAccess, TR::Region &> _accesses;
+      TR::vector<std::pair<int32_t, int32_t>, TR::Region &> _aliasChecks;
+      };
+
+   void collectInnermostLoops(TR_RegionStructure *region, TR::vector<TR_RegionStructure *, TR::Region &> &loops, bool &containsLoop);
+
+   bool analyzeLoopShape(TR_RegionStructure *loop, LoopInfo &info);
+   bool analyzeLoopBody(LoopInfo &info);
+   bool analyzeDependences(LoopInfo &info);
+   bool isVectorizableExpression(TR::Node *node, LoopInfo &info, TR::NodeChecklist &visited);
+   bool isReduction(TR::Node *store, LoopInfo &info, TR::Node **expression);
+   bool isArrayAccess(TR::Node *node, LoopInfo &info, bool isStore);
+   bool isLoopInvariantLoad(TR::Node *node, LoopInfo &info);
+   bool isSupported(TR::ILOpCodes op);
+
+   void transformLoop(LoopInfo &info);
+   TR::Block *createBlock(LoopInfo &info, int32_t frequency);
+   TR::Node *createRemainingCount(LoopInfo &info);
+   TR::Node *createAliasCheck(LoopInfo &info);
+   TR::Node *vectorize(TR::Node *node, LoopInfo &info, NodeMap &vectorNodes, NodeMap &scalarNodes);
+   TR::Node *cloneScalar(TR::Node *node, NodeMap &scalarNodes);
+
+   TR::CFG *_cfg;
+   };
+
+#endif
@@ -187,6 +187,7 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
          _flags.set(doesNotRequireAliasSets);
          break;
       case OMR::stripMining:
+      case OMR::loopVectorizer:
          _flags.set(requiresStructure | checkStructure | dumpStructure);
          break;
       case OMR::osrDefAnalysis:
@@ -90,6 +90,7 @@
 #include "optimizer/LoopCanonicalizer.hpp"
 #include "optimizer/LoopReducer.hpp"
 #include "optimizer/LoopReplicator.hpp"
+#include "optimizer/LoopVectorizer.hpp"
 #include "optimizer/LoopVersioner.hpp"
 #include "optimizer/OrderBlocks.hpp"
 #include "optimizer/RedundantAsyncCheckRemoval.hpp"
@@ -308,6 +309,8 @@ const OptimizationStrategy partialRedundancyEliminationOpts[] =
    { inductionVariableAnalysis,             IfLoopsAndNotProfiling   },
 #ifdef J9_PROJECT_SPECIFIC
    { SPMDKernelParallelization,          IfLoops },
+#else
+   { loopVectorizer,                     IfLoops },
 #endif
    { loopStrider,                 IfLoops   },
    { treeSimplification,          IfEnabled },
@@ -847,6 +850,8 @@ OMR::Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *metho
       new (comp->allocator()) TR::OptimizationManager(self(), TR_IndexExprManipulator::create, OMR::reorderArrayIndexExpr);
    _opts[OMR::loopStrider] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopStrider::create, OMR::loopStrider);
+   _opts[OMR::loopVectorizer] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopVectorizer::create, OMR::loopVectorizer);
    _opts[OMR::osrDefAnalysis] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_OSRDefAnalysis::create, OMR::osrDefAnalysis);
    _opts[OMR::osrLiveRangeAnalysis] =
@@ -1992,6 +1997,11 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
       LexicalTimer t(manager->name(), comp()->phaseTimer());
       TR::LexicalMemProfiler mp(manager->name(), comp()->phaseMemProfiler());
 
+      bool profilePhase = comp()->isOutermostMethod();
+      TR::PhaseProfiler::Sample phaseSample;
+      if (profilePhase)
+         comp()->phaseProfiler().begin(phaseSample);
+
       int32_t origSymRefCount = comp()->getSymRefCount();
       int32_t origNodeCount = comp()->getNodeCount();
       int32_t origCfgNodeCount = comp()->getFlowGraph()->getNextNodeNumber();
@@ -2143,6 +2153,9 @@ int32_t OMR::Optimizer::performOptimization(const OptimizationStrategy *optimiza
          }
 #endif
 
+      if (profilePhase)
+         comp()->phaseProfiler().end(phaseSample, TR::PhaseProfiler::Optimization, manager->name());
+
    #ifdef DEBUG
       if (manager->getDumpStructure() && debug("dumpStructure"))
          {
@@ -3548,6 +3548,493 @@ OMR::RegisterCandidates::assign(TR::Block ** cfgBlocks, int32_t numberOfBlocks,
    }
 
 
+namespace
+{
+
+// A candidate's live interval: the range of tree order positions spanned by
+// the blocks it is live on entry to or on exit from.  Two candidates whose
+// intervals do not overlap cannot share a block, so they can share a global
+// register without any of the per block conflict analysis done by assign.
+//
+struct LinearScanInterval
+   {
+   TR::RegisterCandidate   *_candidate;
+   int32_t                 _start;
+   int32_t                 _end;
+   TR_GlobalRegisterNumber _lowRegister;
+   TR_GlobalRegisterNumber _highRegister;
+   };
+
+struct LinearScanIntervalOrder
+   {
+   bool operator()(const LinearScanInterval &a, const LinearScanInterval &b) const
+      {
+      if (a._start != b._start)
+         return a._start < b._start;
+      return a._candidate->getWeight() > b._candidate->getWeight();
+      }
+   };
+
+}
+
+bool
+OMR::RegisterCandidates::assignLinearScan(TR::Block ** cfgBlocks, int32_t numberOfBlocks, int32_t & lowestNumber, int32_t & highestNumber)
+   {
+   LexicalTimer t("assignLinearScan", comp()->phaseTimer());
+   bool trace = comp()->getOptions()->trace(OMR::tacticalGlobalRegisterAllocator);
+
+   bool globalFPAssignmentDone = false;
+   highestNumber = -1;
+   lowestNumber = INT_MAX;
+
+   TR::RegisterCandidate * rc = _candidates.getFirst();
+   if (rc == 0)
+      return globalFPAssignmentDone;
+
+   TR::CodeGenerator * cg = comp()->cg();
+   TR::Block * * blocks = cfgBlocks;
+   TR::CFG * cfg = comp()->getFlowGraph();
+   bool enableVectorGRA = cg->getSupportsVectorRegisters() && !comp()->getOption(TR_DisableVectorRegGRA);
+
+   TR_BitVector catchBlockLiveLocals(comp()->getSymRefCount(), trMemory(), stackAlloc, growable);
+   TR_BitVector nonOSRCatchBlockLiveLocals(comp()->getSymRefCount(), trMemory(), stackAlloc, growable);
+   TR_BitVector referencedBlocks(cfg->getNextNodeNumber(), trMemory(), stackAlloc, growable);
+   bool catchBlockLiveLocalsExist = false;
+
+   int32_t *blockStructureWeight = (int32_t *)trMemory()->allocateStackMemory(cfg->getNextNodeNumber()*sizeof(int32_t));
+   memset(blockStructureWeight, 0, cfg->getNextNodeNumber()*sizeof(int32_t));
+   int32_t *blockPosition = (int32_t *)trMemory()->allocateStackMemory(cfg->getNextNodeNumber()*sizeof(int32_t));
+   memset(blockPosition, 0, cfg->getNextNodeNumber()*sizeof(int32_t));
+
+   TR_Array<int32_t> numberOfGPRsLiveOnExit(trMemory(), numberOfBlocks, true, stackAlloc);
+   TR_Array<int32_t> numberOfFPRsLiveOnExit(trMemory(), numberOfBlocks, true, stackAlloc);
+   TR_Array<int32_t> numberOfVRFsLiveOnExit(trMemory(), numberOfBlocks, true, stackAlloc);
+   TR_Array<int32_t> maxGPRsLiveOnExit(trMemory(), numberOfBlocks, true, stackAlloc);
+   TR_Array<int32_t> maxFPRsLiveOnExit(trMemory(), numberOfBlocks, true, stackAlloc);
+   TR_Array<int32_t> maxVRFsLiveOnExit(trMemory(), numberOfBlocks, true, stackAlloc);
+
+   // Number the blocks in tree order, which is the order intervals are
+   // scanned in, and collect the same per block properties assign uses
+   //
+   int32_t position = 0;
+   for (TR::Block * b = comp()->getStartBlock(); b; b = b->getNextBlock())
+      {
+      int32_t blockNumber = b->getNumber();
+      blockPosition[blockNumber] = ++position;
+
+      if (b->getStructureOf())
+         {
+         int32_t blockWeight = 1;
+         ((TR::Optimizer *)comp()->getOptimizer())->getStaticFrequency(b, &blockWeight);
+         blockStructureWeight[blockNumber] = blockWeight;
+         }
+
+      if (!b->getExceptionPredecessors().empty())
+         {
+         TR_BitVector * liveLocals = b->getLiveLocals();
+         if (cg->getLiveLocals() && liveLocals)
+            {
+            catchBlockLiveLocalsExist = true;
+            catchBlockLiveLocals |= *liveLocals;
+            if (!b->isOSRCatchBlock())
+               nonOSRCatchBlockLiveLocals |= *liveLocals;
+            }
+         }
+
+      TR::Node * node = b->getLastRealTreeTop()->getNode();
+      maxGPRsLiveOnExit[blockNumber] = cg->getMaximumNumberOfGPRsAllowedAcrossEdge(b);
+      maxFPRsLiveOnExit[blockNumber] = cg->getMaximumNumberOfFPRsAllowedAcrossEdge(node);
+      maxVRFsLiveOnExit[blockNumber] = cg->getMaximumNumberOfVRFsAllowedAcrossEdge(node);
+      }
+   blockPosition[cfg->getEnd()->getNumber()] = ++position;
+
+   // Weigh the candidates; this also computes the blocks each one is live on
+   // entry to and on exit from, which are the basis of its live interval
+   //
+   TR_Array<int32_t> totalGPRCount(trMemory(), numberOfBlocks, true, stackAlloc);
+   TR_Array<int32_t> totalFPRCount(trMemory(), numberOfBlocks, true, stackAlloc);
+   TR_Array<int32_t> totalVRFCount(trMemory(), numberOfBlocks, true, stackAlloc);
+
+   collectCfgProperties(blocks, numberOfBlocks);
+
+   int32_t numCandidates = 0;
+   for (rc = _candidates.getFirst(); rc; rc = rc->getNext())
+      {
+      rc->setWeight(blocks, blockStructureWeight, comp(), totalGPRCount, totalFPRCount, totalVRFCount, &referencedBlocks, _startOfExtendedBBForBB,
+                    _firstBlock, _isExtensionOfPreviousBlock);
+      numCandidates++;
+
+      TR::DataType dt = rc->getDataType();
+      TR_Array<int32_t> &totalCount = (dt == TR::Float || dt == TR::Double) ? totalFPRCount : (dt.isVector() ? totalVRFCount : totalGPRCount);
+      int32_t numRegs = rc->rcNeeds2Regs(comp()) ? 2 : 1;
+      TR_BitVectorIterator bvi(rc->getBlocksLiveOnExit());
+      while (bvi.hasMoreElements())
+         totalCount[bvi.getNextElement()] += numRegs;
+      }
+
+   // Build the intervals of the candidates that can be held in a register
+   //
+   LinearScanInterval *intervals = (LinearScanInterval *)trMemory()->allocateStackMemory(numCandidates*sizeof(LinearScanInterval));
+   int32_t numIntervals = 0;
+
+   for (rc = _candidates.getFirst(); rc; rc = rc->getNext())
+      {
+      TR::DataType type = rc->getType();
+      TR::DataType dt = rc->getDataType();
+      TR::Symbol * sym = rc->getSymbolReference()->getSymbol();
+
+      if ((type.isInt64() && cg->getDisableLongGRA()) ||
+          dt == TR::Aggregate ||
+          !sym->isAutoOrParm() ||
+          sym->holdsMonitoredObject() ||
+          aliasesPreventAllocation(comp(), rc->getSymbolReference()) ||
+          (dt.isVector() && !cg->hasGlobalVRF()) ||
+          ((dt == TR::Float || dt == TR::Double) && cg->getDisableFloatingPointGRA()))
+         {
+         if (trace)
+            traceMsg(comp(), "Leaving candidate #%d: not assignable\n", rc->getSymbolReference()->getReferenceNumber());
+         continue;
+         }
+
+      // don't put this auto into a global register if it can be accessed from a catch clause
+      //
+      if (((catchBlockLiveLocalsExist && sym->isAuto() && catchBlockLiveLocals.get(sym->getAutoSymbol()->getLiveLocalIndex())) ||
+           ((!catchBlockLiveLocalsExist || !sym->isAuto()) && !rc->getSymbolReference()->getUseonlyAliases().isZero(comp()))) &&
+          (!comp()->penalizePredsOfOSRCatchBlocksInGRA() ||
+           ((catchBlockLiveLocalsExist && sym->isAuto() && nonOSRCatchBlockLiveLocals.get(sym->getAutoSymbol()->getLiveLocalIndex())) ||
+            ((!catchBlockLiveLocalsExist || !sym->isAuto()) && !comp()->getSymRefTab()->aliasBuilder.hasUseonlyAliasesOnlyDueToOSRCatchBlocks(rc->getSymbolReference())))))
+         rc->setLiveAcrossExceptionEdge(true);
+
+      int32_t start = INT_MAX;
+      int32_t end = -1;
+      TR_BitVectorIterator bvi(rc->getBlocksLiveOnEntry());
+      while (bvi.hasMoreElements())
+         {
+         int32_t blockNumber = bvi.getNextElement();
+         if (!blocks[blockNumber]->getExceptionPredecessors().empty())
+            {
+            rc->getBlocksLiveOnEntry().reset(blockNumber);
+            continue;
+            }
+         start = std::min(start, blockPosition[blockNumber]);
+         end = std::max(end, blockPosition[blockNumber]);
+         }
+      bvi.setBitVector(rc->getBlocksLiveOnExit());
+      while (bvi.hasMoreElements())
+         {
+         int32_t blockNumber = bvi.getNextElement();
+         start = std::min(start, blockPosition[blockNumber]);
+         end = std::max(end, blockPosition[blockNumber]);
+         }
+
+      if (end < 0)
+         {
+         if (trace)
+            traceMsg(comp(), "Leaving candidate #%d: not live across any block boundary\n", rc->getSymbolReference()->getReferenceNumber());
+         continue;
+         }
+
+      LinearScanInterval &interval = intervals[numIntervals++];
+      interval._candidate = rc;
+      interval._start = start;
+      interval._end = end;
+      interval._lowRegister = -1;
+      interval._highRegister = -1;
+      }
+
+   std::sort(intervals, intervals + numIntervals, LinearScanIntervalOrder());
+
+   // Registers the code generator reserves in some blocks are recorded in the
+   // usage bit vectors; the registers without any such usage need no check
+   //
+   int32_t numberOfGlobalRegisters = cg->getNumberOfGlobalRegisters();
+   _liveOnEntryUsage.init(trMemory(), numberOfGlobalRegisters, true, stackAlloc);
+   _liveOnExitUsage.init(trMemory(), numberOfGlobalRegisters, true, stackAlloc);
+   int32_t i;
+   for (i = _liveOnEntryUsage.internalSize() - 1; i >= 0; --i)
+      {
+      _liveOnEntryUsage[i].init(numberOfBlocks, trMemory(), stackAlloc, growable);
+      _liveOnExitUsage[i].init(numberOfBlocks, trMemory(), stackAlloc, growable);
+      }
+   cg->setUnavailableRegistersUsage(_liveOnEntryUsage, _liveOnExitUsage);
+
+   TR_BitVector reservedInSomeBlocks(numberOfGlobalRegisters, trMemory(), stackAlloc);
+   for (i = 0; i < numberOfGlobalRegisters; ++i)
+      {
+      if (!_liveOnEntryUsage[i].isEmpty() || !_liveOnExitUsage[i].isEmpty())
+         reservedInSomeBlocks.set(i);
+      }
+
+   // The interval currently holding each register; the register is free once
+   // the scan has moved past the end of that interval
+   //
+   TR_Array<LinearScanInterval *> occupant(trMemory(), numberOfGlobalRegisters, true, stackAlloc);
+   TR_BitVector *blocksWithCalls = NULL;
+   unsigned iterationCount = 0;
+
+   for (int32_t n = 0; n < numIntervals; ++n)
+      {
+      if (((++iterationCount & 0xf) == 0) &&
+          comp()->compilationShouldBeInterrupted(GRA_ASSIGN_CONTEXT))
+         {
+         comp()->failCompilation<TR::CompilationInterrupted>("interrupted in GRA");
+         }
+
+      LinearScanInterval *interval = &intervals[n];
+      rc = interval->_candidate;
+      TR::DataType dt = rc->getDataType();
+      bool isFloat = (dt == TR::Float || dt == TR::Double);
+      bool isVector = dt.isVector();
+      bool needs2Regs = rc->rcNeeds2Regs(comp());
+      int32_t numRegs = needs2Regs ? 2 : 1;
+
+      int32_t firstRegister, lastRegister;
+      TR_Array<int32_t> *liveOnExit, *maxLiveOnExit;
+      if (isFloat)
+         {
+         firstRegister = cg->getFirstGlobalFPR(), lastRegister = cg->getLastGlobalFPR();
+         liveOnExit = &numberOfFPRsLiveOnExit, maxLiveOnExit = &maxFPRsLiveOnExit;
+         }
+      else if (isVector)
+         {
+         firstRegister = cg->getFirstGlobalVRF(), lastRegister = cg->getLastGlobalVRF();
+         liveOnExit = &numberOfVRFsLiveOnExit, maxLiveOnExit = &maxVRFsLiveOnExit;
+         }
+      else
+         {
+         firstRegister = cg->getFirstGlobalGPR(), lastRegister = cg->getLastGlobalGPR();
+         liveOnExit = &numberOfGPRsLiveOnExit, maxLiveOnExit = &maxGPRsLiveOnExit;
+         }
+
+      // Rather than trimming the live range the way assign does, leave the
+      // candidate in memory if it would exceed the registers allowed across
+      // one of its exit edges
+      //
+      bool fitsAcrossEdges = true;
+      TR_BitVectorIterator bvi(rc->getBlocksLiveOnExit());
+      while (fitsAcrossEdges && bvi.hasMoreElements())
+         {
+         int32_t blockNumber = bvi.getNextElement();
+         if ((*liveOnExit)[blockNumber] + numRegs > (*maxLiveOnExit)[blockNumber])
+            fitsAcrossEdges = false;
+         }
+      if (!fitsAcrossEdges)
+         {
+         if (trace)
+            traceMsg(comp(), "Leaving candidate #%d: too many registers live across an exit edge\n", rc->getSymbolReference()->getReferenceNumber());
+         continue;
+         }
+
+      TR_BitVector availableRegisters(lastRegister+1, trMemory(), stackAlloc);
+      for (i = firstRegister; i <= lastRegister; ++i)
+         {
+         if (reservedInSomeBlocks.get(i) &&
+             (_liveOnEntryUsage[i].intersects(rc->getBlocksLiveOnEntry()) ||
+              _liveOnExitUsage[i].intersects(rc->getBlocksLiveOnExit()) ||
+              _liveOnEntryUsage[i].intersects(rc->getBlocksLiveOnExit()) ||
+              _liveOnExitUsage[i].intersects(rc->getBlocksLiveOnEntry())))
+            continue;
+         availableRegisters.set(i);
+         }
+      cg->removeUnavailableRegisters(rc, blocks, availableRegisters);
+
+      TR_BitVector freeRegisters(lastRegister+1, trMemory(), stackAlloc);
+      TR_BitVectorIterator regIt(availableRegisters);
+      while (regIt.hasMoreElements())
+         {
+         i = regIt.getNextElement();
+         bool isFree = !occupant[i] || occupant[i]->_end < interval->_start;
+         if (isFree && enableVectorGRA && (isFloat || isVector) && cg->isAliasedGRN(i))
+            {
+            TR_GlobalRegisterNumber alias = cg->getOverlappedAliasForGRN(i);
+            isFree = !occupant[alias] || occupant[alias]->_end < interval->_start;
+            }
+         if (isFree)
+            freeRegisters.set(i);
+         }
+
+      // Pick a register: the one a parameter arrives in, then one preserved
+      // across calls if the candidate is live into a block with a call, then
+      // the first free one in the code generator's order of preference
+      //
+      TR_GlobalRegisterNumber registerNumber = -1;
+      TR_GlobalRegisterNumber highRegisterNumber = -1;
+      TR::Symbol * sym = rc->getSymbolReference()->getSymbol();
+      if (needs2Regs)
+         {
+         TR_BitVectorIterator freeIt(freeRegisters);
+         if (freeIt.hasMoreElements())
+            registerNumber = freeIt.getNextElement();
+         if (freeIt.hasMoreElements())
+            highRegisterNumber = freeIt.getNextElement();
+         else
+            registerNumber = -1;
+         }
+      else
+         {
+         if (sym->isParm() && sym->getParmSymbol()->getLinkageRegisterIndex() >= 0)
+            {
+            TR_GlobalRegisterNumber linkageRegister = cg->getLinkageGlobalRegisterNumber(sym->getParmSymbol()->getLinkageRegisterIndex(), dt);
+            if (linkageRegister >= firstRegister && linkageRegister <= lastRegister && freeRegisters.get(linkageRegister))
+               registerNumber = linkageRegister;
+            }
+
+         TR_BitVector *preservedRegisters = isFloat ? cg->getGlobalFPRsPreservedAcrossCalls() :
+                                            (isVector ? NULL : cg->getGlobalGPRsPreservedAcrossCalls());
+         if (registerNumber == -1 && preservedRegisters)
+            {
+            if (!blocksWithCalls)
+               blocksWithCalls = cg->getBlocksWithCalls();
+            if (rc->getBlocksLiveOnEntry().intersects(*blocksWithCalls))
+               {
+               TR_BitVectorIterator freeIt(freeRegisters);
+               while (registerNumber == -1 && freeIt.hasMoreElements())
+                  {
+                  i = freeIt.getNextElement();
+                  if (preservedRegisters->get(i))
+                     registerNumber = i;
+                  }
+               }
+            }
+
+         if (registerNumber == -1 && !freeRegisters.isEmpty())
+            registerNumber = TR_BitVectorIterator(freeRegisters).getFirstElement();
+
+         // No free register: spill whichever active interval is the lightest,
+         // provided it is lighter than this candidate
+         //
+         if (registerNumber == -1)
+            {
+            LinearScanInterval *victim = NULL;
+            TR_BitVectorIterator busyIt(availableRegisters);
+            while (busyIt.hasMoreElements())
+               {
+               i = busyIt.getNextElement();
+               LinearScanInterval *active = occupant[i];
+               if (active && active->_highRegister == -1 && active->_lowRegister == i &&
+                   !(enableVectorGRA && (isFloat || isVector) && cg->isAliasedGRN(i)) &&
+                   active->_candidate->getWeight() < rc->getWeight() &&
+                   (!victim || active->_candidate->getWeight() < victim->_candidate->getWeight()))
+                  victim = active;
+               }
+
+            if (victim)
+               {
+               if (trace)
+                  traceMsg(comp(), "Spilling candidate #%d (weight %d) from register %d for candidate #%d (weight %d)\n",
+                           victim->_candidate->getSymbolReference()->getReferenceNumber(), victim->_candidate->getWeight(), victim->_lowRegister,
+                           rc->getSymbolReference()->getReferenceNumber(), rc->getWeight());
+
+               registerNumber = victim->_lowRegister;
+               victim->_lowRegister = -1;
+               bvi.setBitVector(victim->_candidate->getBlocksLiveOnExit());
+               while (bvi.hasMoreElements())
+                  --(*liveOnExit)[bvi.getNextElement()];
+               }
+            }
+         }
+
+      if (registerNumber == -1)
+         {
+         if (trace)
+            traceMsg(comp(), "Leaving candidate #%d (weight %d): no register free over [%d,%d]\n",
+                     rc->getSymbolReference()->getReferenceNumber(), rc->getWeight(), interval->_start, interval->_end);
+         continue;
+         }
+
+      if (trace)
+         traceMsg(comp(), "Candidate #%d (weight %d) live over [%d,%d] gets register %d\n",
+                  rc->getSymbolReference()->getReferenceNumber(), rc->getWeight(), interval->_start, interval->_end, registerNumber);
+
+      interval->_lowRegister = registerNumber;
+      interval->_highRegister = highRegisterNumber;
+      occupant[registerNumber] = interval;
+      if (needs2Regs)
+         occupant[highRegisterNumber] = interval;
+      else if (enableVectorGRA && (isFloat || isVector) && cg->isAliasedGRN(registerNumber))
+         occupant[cg->getOverlappedAliasForGRN(registerNumber)] = interval;
+
+      bvi.setBitVector(rc->getBlocksLiveOnExit());
+      while (bvi.hasMoreElements())
+         (*liveOnExit)[bvi.getNextElement()] += numRegs;
+      }
+
+   // Record the assignments the same way assign does, so the IL transformation
+   // that follows sees no difference between the two
+   //
+   _candidates.setFirst(0);
+   _candidateForSymRefs->clear();
+
+   for (int32_t n = 0; n < numIntervals; ++n)
+      {
+      LinearScanInterval *interval = &intervals[n];
+      if (interval->_lowRegister == -1)
+         continue;
+
+      rc = interval->_candidate;
+      TR_GlobalRegisterNumber registerNumber = interval->_lowRegister;
+      TR_GlobalRegisterNumber highRegisterNumber = interval->_highRegister;
+      bool needs2Regs = highRegisterNumber != -1;
+
+      if (rc->getDataType() == TR::Float || rc->getDataType() == TR::Double)
+         globalFPAssignmentDone = true;
+
+      _candidates.add(rc);
+      (*_candidateForSymRefs)[GET_INDEX_FOR_CANDIDATE_FOR_SYMREF(rc->getSymbolReference())] = rc;
+
+      if (needs2Regs)
+         {
+         rc->setLowGlobalRegisterNumber(registerNumber);
+         rc->setHighGlobalRegisterNumber(highRegisterNumber);
+         }
+      else
+         rc->setGlobalRegisterNumber(registerNumber);
+
+      rc->setIs8BitGlobalGPR(cg->is8BitGlobalGPR(registerNumber));
+
+      if (registerNumber > highestNumber)
+         highestNumber = registerNumber;
+      if (registerNumber < lowestNumber)
+         lowestNumber = registerNumber;
+      if (needs2Regs)
+         {
+         if (highRegisterNumber > highestNumber)
+            highestNumber = highRegisterNumber;
+         if (highRegisterNumber < lowestNumber)
+            lowestNumber = highRegisterNumber;
+         }
+
+      TR_BitVectorIterator bvi(rc->getBlocksLiveOnEntry());
+      while (bvi.hasMoreElements())
+         {
+         int32_t blockNumber = bvi.getNextElement();
+         blocks[blockNumber]->getGlobalRegisters(comp())[registerNumber].setRegisterCandidateOnEntry(rc);
+         if (needs2Regs)
+            blocks[blockNumber]->getGlobalRegisters(comp())[highRegisterNumber].setRegisterCandidateOnEntry(rc);
+         }
+
+      bvi.setBitVector(rc->getBlocksLiveOnExit());
+      while (bvi.hasMoreElements())
+         {
+         int32_t blockNumber = bvi.getNextElement();
+         blocks[blockNumber]->getGlobalRegisters(comp())[registerNumber].setRegisterCandidateOnExit(rc);
+         if (needs2Regs)
+            blocks[blockNumber]->getGlobalRegisters(comp())[highRegisterNumber].setRegisterCandidateOnExit(rc);
+         }
+
+      _liveOnEntryUsage[registerNumber] |= rc->getBlocksLiveOnEntry();
+      _liveOnExitUsage[registerNumber] |= rc->getBlocksLiveOnExit();
+      if (needs2Regs)
+         {
+         _liveOnEntryUsage[highRegisterNumber] |= rc->getBlocksLiveOnEntry();
+         _liveOnExitUsage[highRegisterNumber] |= rc->getBlocksLiveOnExit();
+         }
+      }
+
+   return globalFPAssignmentDone;
+   }
+
+
 static void  ComputeOverlaps(TR::Node *node,
                       TR::Compilation *comp,
                       OMR::RegisterCandidates::Coordinates &overlaps,
@@ -321,6 +321,7 @@ public:
    TR_BitVector *getBlocksReferencingSymRef(uint32_t symRefNum);
 
    virtual bool assign(TR::Block **, int32_t, int32_t &, int32_t &);
+   virtual bool assignLinearScan(TR::Block **, int32_t, int32_t &, int32_t &);
    virtual void computeAvailableRegisters(TR::RegisterCandidate *, int32_t, int32_t, TR::Block **, TR_BitVector *);
 
    static int32_t getWeightForType(TR_RegisterCandidateTypes type)
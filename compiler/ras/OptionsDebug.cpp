@@ -415,7 +415,7 @@ TR_Debug::dumpOptions(
          if (entry->msg[0] == 'P')
             printIt = (value != 0);
          }
-      else if (entry->fcn == TR::Options::set32BitNumeric || entry->fcn == TR::Options::set32BitSignedNumeric || entry->fcn == TR::Options::setCount)
+      else if (entry->fcn == TR::Options::set32BitNumeric || entry->fcn == TR::Options::set32BitSignedNumeric || entry->fcn == TR::Options::set32BitPercentage || entry->fcn == TR::Options::setCount)
          {
          value = (intptr_t)(*((int32_t*)(base+entry->parm1)));
          if (entry->msg[0] == 'P')
@@ -867,7 +867,7 @@ TR::Register *TR::AMD64SystemLinkage::buildDirectDispatch(
          methodSymRef,
          cg());
 
-      if (comp()->getOption(TR_EmitRelocatableELFFile))
+      if (cg()->needsStaticRelocations())
          {
          LoadRegisterInstruction->setReloKind(TR_NativeMethodAbsolute);
          }
@@ -111,6 +111,8 @@ omr_main_entry(int argc, char ** argv, char **envp)
 	MM_AllocationStats *allocationStats = allocationInterface->getAllocationStats();
 	omrtty_printf("thread allocated %d tlh bytes, %d non-tlh bytes, from %d allocations before NULL\n",
 		allocationStats->tlhBytesAllocated(), allocationStats->nontlhBytesAllocated(), allocatedCount);
+	omrtty_printf("thread discarded %.2f%% of its fresh tlh bytes in abandoned tlh tails\n",
+		allocationStats->tlhWasteRatio() * 100.0);
 
 	/* Force GC to print verbose system allocation stats -- should match thread allocation stats from before GC */
 	MM_ObjectAllocationModel allocationModel(env, allocSize, 0);
@@ -70,8 +70,11 @@ public:
 	/**
 	 * Constructor.
 	 */
-	MM_ObjectAllocationModel(MM_EnvironmentBase *env,  uintptr_t requiredSizeInBytes, uintptr_t allocateObjectFlags = 0)
+	MM_ObjectAllocationModel(MM_EnvironmentBase *env,  uintptr_t requiredSizeInBytes, uintptr_t allocateObjectFlags = 0, uintptr_t allocationSiteToken = 0)
 		: MM_AllocateInitialization(env, allocation_category_example, requiredSizeInBytes, allocateObjectFlags)
-	{}
+	{
+		/* the allocation lifetime sampler attributes the object to the site named by the caller */
+		_allocateDescription.setAllocationSiteToken(allocationSiteToken);
+	}
 };
 #endif /* OBJECTALLOCATIONMODEL_HPP_ */
@@ -67,6 +67,22 @@ public:
 	 */
 	virtual void tearDown(MM_GCExtensionsBase *extensions) {}
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/**
+	 * Return the size that a moved object had in its original location. Heap walkers use this to step
+	 * over the evacuated copy of an object that is strictly forwarded during a concurrent scavenge.
+	 * Example objects do not grow when they are moved, so this is the consumed size of the copy.
+	 *
+	 * @param objectPtr Pointer to the moved object
+	 * @return the consumed size of the object before it was moved
+	 */
+	MMINLINE uintptr_t
+	getConsumedSizeInBytesWithHeaderBeforeMove(omrobjectptr_t objectPtr)
+	{
+		return getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+
 	/**
 	 * Constructor.
 	 */
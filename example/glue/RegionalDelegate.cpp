@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_REGIONAL)
+
+#include "omr.h"
+#include "omrExampleVM.hpp"
+#include "omrhashtable.h"
+
+#include "EnvironmentBase.hpp"
+#include "OMRVMThreadListIterator.hpp"
+#include "RegionalGC.hpp"
+
+#include "RegionalDelegate.hpp"
+
+void
+MM_RegionalDelegate::scanRoots(MM_EnvironmentBase *env)
+{
+	OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+	J9HashTableState state;
+	if (NULL != omrVM->rootTable) {
+		RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+		while (NULL != rootEntry) {
+			if (NULL != rootEntry->rootPtr) {
+				_regionalGC->copyObjectSlot(env, (volatile omrobjectptr_t *)&rootEntry->rootPtr);
+			}
+			rootEntry = (RootEntry *)hashTableNextDo(&state);
+		}
+	}
+	OMR_VMThread *walkThread = NULL;
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+		if (NULL != walkThread->_savedObject1) {
+			_regionalGC->copyObjectSlot(env, (volatile omrobjectptr_t *)&walkThread->_savedObject1);
+		}
+		if (NULL != walkThread->_savedObject2) {
+			_regionalGC->copyObjectSlot(env, (volatile omrobjectptr_t *)&walkThread->_savedObject2);
+		}
+	}
+}
+
+void
+MM_RegionalDelegate::scanClearable(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(env->getOmrVM());
+	OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+	if (NULL != omrVM->objectTable) {
+		J9HashTableState state;
+		ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+		while (NULL != objectEntry) {
+			if (_regionalGC->isObjectInCollectionSet(objectEntry->objPtr)) {
+				omrobjectptr_t survivor = _regionalGC->getSurvivingObject(env, objectEntry->objPtr);
+				if (NULL != survivor) {
+					objectEntry->objPtr = survivor;
+				} else {
+					omrmem_free_memory((void *)objectEntry->name);
+					objectEntry->name = NULL;
+					hashTableDoRemove(&state);
+				}
+			}
+			objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+		}
+	}
+}
+
+#endif /* defined(OMR_GC_REGIONAL) */
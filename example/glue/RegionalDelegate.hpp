@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(REGIONALDELEGATE_HPP_)
+#define REGIONALDELEGATE_HPP_
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_REGIONAL)
+
+#include "objectdescription.h"
+
+#include "EnvironmentBase.hpp"
+#include "MixedObjectScanner.hpp"
+
+class GC_ObjectScanner;
+class MM_RegionalGC;
+
+/**
+ * Provides language-specific support for the regional collector: the object scanner used to find the
+ * slots of copied objects, and the root and clearable reference sets of a pause.
+ */
+class MM_RegionalDelegate
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_RegionalGC *_regionalGC;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Initialize the delegate.
+	 *
+	 * @param env environment for calling thread
+	 * @param regionalGC the collector that the delegate is bound to
+	 * @return true if delegate initialized successfully
+	 */
+	bool
+	initialize(MM_EnvironmentBase *env, MM_RegionalGC *regionalGC)
+	{
+		_regionalGC = regionalGC;
+		return true;
+	}
+
+	void tearDown(MM_EnvironmentBase *env) { }
+
+	/**
+	 * Instantiate an object scanner for an object that has been copied or kept in place by a pause.
+	 *
+	 * @param env The environment for the calling thread
+	 * @param objectPtr The object to scan
+	 * @param scannerSpace Space for the scanner instance
+	 * @return the scanner
+	 */
+	MMINLINE GC_ObjectScanner *
+	getObjectScanner(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, void *scannerSpace)
+	{
+		return GC_MixedObjectScanner::newInstance(env, objectPtr, scannerSpace, 0);
+	}
+
+	/**
+	 * Pass every root slot to MM_RegionalGC::copyObjectSlot(). Objects referenced by the roots are
+	 * copied out of the collection set and the root slots are updated.
+	 *
+	 * @param env The environment for the calling thread
+	 */
+	void scanRoots(MM_EnvironmentBase *env);
+
+	/**
+	 * Called once the collection set has been evacuated. References to collection set objects that do not
+	 * keep them alive must be updated to the surviving objects or cleared.
+	 *
+	 * @param env The environment for the calling thread
+	 */
+	void scanClearable(MM_EnvironmentBase *env);
+
+	MM_RegionalDelegate()
+		: _regionalGC(NULL)
+	{}
+};
+
+#endif /* defined(OMR_GC_REGIONAL) */
+
+#endif /* REGIONALDELEGATE_HPP_ */
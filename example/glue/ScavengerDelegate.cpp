@@ -52,6 +52,7 @@
 #include "omrExampleVM.hpp"
 #include "omrvm.h"
 #include "OMRVMInterface.hpp"
+#include "OMRVMThreadListIterator.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
@@ -186,6 +187,40 @@ MM_ScavengerDelegate::reverseForwardedObject(MM_EnvironmentBase *env, MM_Forward
 	}
 }
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+void
+MM_ScavengerDelegate::switchConcurrentForThread(MM_EnvironmentBase *env)
+{
+	/* The read barrier checks whether a cycle is in progress on each load, so there is no thread local state to switch */
+}
+
+void
+MM_ScavengerDelegate::fixupIndirectObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	/* No indirect object slots in example */
+}
+
+void
+MM_ScavengerDelegate::signalThreadsToFlushCaches(MM_EnvironmentBase *env)
+{
+	OMR_VM *omrVM = env->getOmrVM();
+	/* A thread requesting exclusive VM access holds the thread list mutex while waiting for GC threads to yield,
+	 * in which case the caches are flushed when that thread walks the mutators anyway */
+	if (0 == omrthread_monitor_try_enter(omrVM->_vmThreadListMutex)) {
+		GC_OMRVMThreadListIterator threadListIterator(omrVM);
+		OMR_VMThread *walkThread = NULL;
+		while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+			MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(walkThread);
+			if (MUTATOR_THREAD == walkEnv->getThreadType()) {
+				/* only inactive caches are taken, a cache that the mutator is copying into is left alone */
+				_extensions->scavenger->threadReleaseCaches(env, walkEnv, true, false);
+			}
+		}
+		omrthread_monitor_exit(omrVM->_vmThreadListMutex);
+	}
+}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+
 #if defined (OMR_GC_COMPRESSED_POINTERS)
 void
 MM_ScavengerDelegate::fixupDestroyedSlot(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader, MM_MemorySubSpaceSemiSpace *subSpaceNew)
@@ -244,6 +244,18 @@ public:
 	 * Fixup should update slots to point to the forwarded version of the object and/or remove self forwarded bit in the object itself.
 	 */
 	void fixupIndirectObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+	/**
+	 * Called by a GC thread that ran out of scan work during the concurrent phase while mutator threads still
+	 * hold copy caches. Mutator threads deactivate their copy caches as soon as a read barrier copy completes,
+	 * so the inactive caches are pushed for scanning on their behalf.
+	 * @param[in] env The environment for the calling thread.
+	 */
+	void signalThreadsToFlushCaches(MM_EnvironmentBase *env);
+	/**
+	 * Called at the end of the concurrent phase to withdraw a request made by signalThreadsToFlushCaches().
+	 * @param[in] env The environment for the calling thread.
+	 */
+	void cancelSignalToFlushCaches(MM_EnvironmentBase *env) {}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	bool initialize(MM_EnvironmentBase* env) { return true; }
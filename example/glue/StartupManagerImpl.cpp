@@ -28,6 +28,9 @@
 #include "ConfigurationSegregated.hpp"
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #include "ConfigurationFlat.hpp"
+#if defined(OMR_GC_REGIONAL)
+#include "ConfigurationRegional.hpp"
+#endif /* defined(OMR_GC_REGIONAL) */
 #include "MarkingScheme.hpp"
 #include "VerboseManagerImpl.hpp"
 
@@ -37,6 +40,10 @@
 #define OMR_SEGREGATEDHEAP "-Xgcpolicy:segregated"
 #define OMR_SEGREGATEDHEAP_LENGTH 21
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_REGIONAL)
+#define OMR_REGIONAL "-Xgcpolicy:regional"
+#define OMR_REGIONAL_LENGTH 19
+#endif /* defined(OMR_GC_REGIONAL) */
 
 bool
 MM_StartupManagerImpl::handleOption(MM_GCExtensionsBase *extensions, char *option)
@@ -53,6 +60,12 @@ MM_StartupManagerImpl::handleOption(MM_GCExtensionsBase *extensions, char *optio
 			result = true;
 		}
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_REGIONAL)
+		if (0 == strncmp(option, OMR_REGIONAL, OMR_REGIONAL_LENGTH)) {
+			_useRegionalGC = true;
+			result = true;
+		}
+#endif /* defined(OMR_GC_REGIONAL) */
 	}
 
 	return result;
@@ -83,6 +96,11 @@ MM_StartupManagerImpl::createConfiguration(MM_EnvironmentBase *env)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_GCExtensionsBase *ext = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_REGIONAL)
+	if (_useRegionalGC) {
+		return MM_ConfigurationRegional::newInstance(env);
+	} else
+#endif /* defined(OMR_GC_REGIONAL) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	if (_useSegregatedGC) {
 		return MM_ConfigurationSegregated::newInstance(env);
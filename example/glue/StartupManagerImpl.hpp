@@ -41,6 +41,9 @@ protected:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	bool _useSegregatedGC;
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_REGIONAL)
+	bool _useRegionalGC;
+#endif /* defined(OMR_GC_REGIONAL) */
 public:
 	static const uintptr_t defaultMinimumHeapSize = (uintptr_t) 1*1024*1024;
 	static const uintptr_t defaultMaximumHeapSize = (uintptr_t) 2*1024*1024;
@@ -65,6 +68,9 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, _useSegregatedGC(false)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_REGIONAL)
+		, _useRegionalGC(false)
+#endif /* defined(OMR_GC_REGIONAL) */
 	{
 	}
 };
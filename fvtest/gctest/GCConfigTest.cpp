@@ -28,7 +28,9 @@
 #include "omrgc.h"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseBinaryDecoder.hpp"
 #include "VerboseWriterChain.hpp"
+#include "VerboseWriterFileLoggingAsync.hpp"
 
 //#define OMRGCTEST_PRINTFILE
 
@@ -43,16 +45,35 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_lockfree_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_freelistindex_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_lazysweep_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_numa_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_adaptivetlh_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_binaryverbose_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_asyncverbose_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_heapwalk_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_partialcompact_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_slidingcompact_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_cardsummary_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_workstealing_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_lifetimesampling_config.xml"
+#endif
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+                        , "fvtest/gctest/configuration/scavenger_GC_concurrent_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+#endif
+#if defined(OMR_GC_REGIONAL)
+                        , "fvtest/gctest/configuration/regional_GC_config.xml"
 #endif
                         };
 
@@ -67,6 +88,7 @@ GCConfigTest::SetUp()
 
 	gcTestEnv->log("Configuration File: %s\n", GetParam());
 	MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, GetParam());
+	uint64_t startupStartTime = omrtime_hires_clock();
 
 	/* Initialize heap and collector */
 	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
@@ -79,6 +101,7 @@ GCConfigTest::SetUp()
 	/* Kick off the dispatcher threads */
 	rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
 	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+	gcTestEnv->log("Time elapsed in startup: %llu us\n", omrtime_hires_delta(startupStartTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
 
 	/* Instantiate collector interface */
 	env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
@@ -110,7 +133,18 @@ GCConfigTest::SetUp()
 	}
 	omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_%d_%lld.xml", verboseFileNamePrefix, omrsysinfo_get_pid(), omrtime_current_time_millis());
 	verboseManager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
-	verboseManager->configureVerboseGC(exampleVM->_omrVM, verboseFile, numOfFiles, numOfCycles);
+	if (env->getExtensions()->binaryVerboseLog) {
+		/* the binary log is decoded into verboseFile when it is verified */
+		binaryVerboseFile = (char *)omrmem_allocate_memory(MAX_NAME_LENGTH, OMRMEM_CATEGORY_MM);
+		if (NULL == binaryVerboseFile) {
+			FAIL() << "Failed to allocate native memory.";
+		}
+		omrstr_printf(binaryVerboseFile, MAX_NAME_LENGTH, "%s.vgc", verboseFile);
+		verboseManager->configureVerboseGC(exampleVM->_omrVM, binaryVerboseFile, numOfFiles, numOfCycles);
+		gcTestEnv->log("Binary Verbose File: %s\n", binaryVerboseFile);
+	} else {
+		verboseManager->configureVerboseGC(exampleVM->_omrVM, verboseFile, numOfFiles, numOfCycles);
+	}
 	gcTestEnv->log("Verbose File: %s\n", verboseFile);
 	gcTestEnv->log(LEVEL_VERBOSE, "Verbose GC log name: %s; numOfFiles: %d; numOfCycles: %d.\n", verboseFile, numOfFiles, numOfCycles);
 	verboseManager->enableVerboseGC();
@@ -180,6 +214,13 @@ GCConfigTest::TearDown()
 	}
 	omrmem_free_memory((void *)verboseFile);
 	verboseFile = NULL;
+	if (NULL != binaryVerboseFile) {
+		if (false == gcTestEnv->keepLog) {
+			omrfile_unlink(binaryVerboseFile);
+		}
+		omrmem_free_memory((void *)binaryVerboseFile);
+		binaryVerboseFile = NULL;
+	}
 
 	if (NULL != cli) {
 		cli->kill(env);
@@ -296,9 +337,21 @@ GCConfigTest::parseObjectType(pugi::xml_node node)
 	return objType;
 }
 
+/* objects created with the same name prefix are attributed to the same allocation site */
+uintptr_t
+GCConfigTest::allocationSiteToken(const char *namePrefix)
+{
+	uintptr_t token = 5381;
+	for (const char *c = namePrefix; '\0' != *c; c++) {
+		token = (token * 33) + (uint8_t)*c;
+	}
+	return token;
+}
+
 ObjectEntry *
-GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
+GCConfigTest::allocateHelper(const char *objName, uintptr_t size, uintptr_t siteToken)
 {
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
 
 	ObjectEntry objEntry;
@@ -308,14 +361,20 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 
 	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
 	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
-			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true), siteToken);
 	objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
 
 	if (NULL == objEntry.objPtr) {
 		gcTestEnv->log("No free memory to allocate %s of size 0x%llx, GC start.\n", objName, size);
 		MM_ObjectAllocationModel *withGc = new(objectAllocationModelSpace)
-				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false), siteToken);
+		uint64_t startTime = omrtime_hires_clock();
 		objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, withGc);
+		if (!firstGCTimed) {
+			/* the first collection pays for faulting in whatever memory it touches for the first time */
+			gcTestEnv->log("Time elapsed in first GC: %llu us\n", omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+			firstGCTimed = true;
+		}
 	}
 
 	ObjectEntry *newEntry = NULL;
@@ -353,7 +412,7 @@ GCConfigTest::createObject(const char *namePrefix, OMRGCObjectType objType, int3
 		gcTestEnv->log(LEVEL_VERBOSE, "Found object %s in object table.\n", objEntry->name);
 		omrmem_free_memory(objName);
 	} else {
-		objEntry = allocateHelper(objName, size);
+		objEntry = allocateHelper(objName, size, allocationSiteToken(namePrefix));
 		if (NULL != objEntry) {
 			/* Keep count of the new allocated non-garbage object size for garbage insertion. If the object exists in objectTable, its size is ignored. */
 			if ((ROOT == objType) || (NORMAL == objType)) {
@@ -688,7 +747,7 @@ GCConfigTest::removeObjectFromParentSlot(const char *name, ObjectEntry *parentEn
 
 	while (currentSlot < endSlot) {
 		GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
-		if (objEntry->objPtr == slotObject.readReferenceFromSlot()) {
+		if (objEntry->objPtr == standardReadBarrierLoad(exampleVM->_omrVMThread, currentSlot)) {
 			gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from parent %s(%p[0x%llx]) slot %p.\n", name, objEntry->objPtr, objEntry->objPtr->header.raw(), parentEntry->name, parentEntry->objPtr, parentEntry->objPtr->header.raw(), slotObject.readAddressFromSlot());
 			slotObject.writeReferenceToSlot(NULL);
 			rt = 0;
@@ -826,6 +885,28 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		isFound[i] = false;
 	}
 
+	for (MM_VerboseWriter *writer = verboseManager->getWriterChain()->getFirstWriter(); NULL != writer; writer = writer->getNextWriter()) {
+		if (VERBOSE_WRITER_FILE_LOGGING_ASYNC == writer->getType()) {
+			/* wait for the writer thread to catch up before the log is read */
+			((MM_VerboseWriterFileLoggingAsync *)writer)->flush(env);
+		}
+	}
+
+	if (NULL != binaryVerboseFile) {
+		/* rotating binary logs are not decoded file by file */
+		intptr_t fd = omrfile_open(verboseFile, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		MM_VerboseBinaryDecoder decoder(gcTestEnv->portLib);
+		bool decoded = (-1 != fd) && decoder.decode(binaryVerboseFile, fd);
+		if (-1 != fd) {
+			omrfile_close(fd);
+		}
+		if (!decoded) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to decode binary verbose log %s.\n", __FILE__, __LINE__, binaryVerboseFile);
+			goto done;
+		}
+	}
+
 	/* Loop through multiple files if rolling log is enabled */
 	do {
 		pugi::xml_document verboseDoc;
@@ -29,6 +29,7 @@
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
 #include "pugixml.hpp"
+#include "StandardWriteBarrier.hpp"
 #include "StartupManagerTestExample.hpp"
 #include "VerboseManager.hpp"
 
@@ -85,8 +86,11 @@ protected:
 	/* verbose log options */
 	MM_VerboseManager *verboseManager;
 	char *verboseFile;
+	char *binaryVerboseFile; /**< log written by -Xgc:binaryVerboseLog, decoded into verboseFile for verification */
 	uintptr_t numOfFiles;
 
+	bool firstGCTimed; /**< the time of the first collection forced by an allocation has been logged */
+
 	/*
 	 * Function members
 	 */
@@ -94,7 +98,8 @@ protected:
 	void freeAttributeList(AttributeElem *root);
 	int32_t parseAttribute(AttributeElem **root, const char *attrStr);
 	OMRGCObjectType parseObjectType(pugi::xml_node node);
-	ObjectEntry *allocateHelper(const char *objName, uintptr_t size);
+	static uintptr_t allocationSiteToken(const char *namePrefix);
+	ObjectEntry *allocateHelper(const char *objName, uintptr_t size, uintptr_t siteToken);
 	ObjectEntry *createObject(const char *namePrefix, OMRGCObjectType objType, int32_t depth, int32_t nthInRow, uintptr_t size);
 	int32_t createFixedSizeTree(ObjectEntry **objectEntry, const char *namePrefixStr, OMRGCObjectType objType, uintptr_t totalSize, uintptr_t objSize, int32_t breadth);
 	int32_t processObjNode(pugi::xml_node node, const char *namePrefixStr, OMRGCObjectType objType, AttributeElem *numOfFieldsElem, AttributeElem *breadthElem, int32_t depth);
@@ -133,7 +138,14 @@ protected:
 	{
 		ObjectEntry searchEntry;
 		searchEntry.name = name;
-		return (ObjectEntry *)hashTableFind(exampleVM->objectTable, &searchEntry);
+		ObjectEntry *foundEntry = (ObjectEntry *)hashTableFind(exampleVM->objectTable, &searchEntry);
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		/* the object table is not a root, its entries may still refer to evacuate space during a concurrent scavenge */
+		if (NULL != foundEntry) {
+			standardReadBarrier(exampleVM->_omrVMThread, (volatile omrobjectptr_t *)&foundEntry->objPtr);
+		}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+		return foundEntry;
 	}
 
 	ObjectEntry *
@@ -158,7 +170,9 @@ public:
 		, cli(NULL)
 		, verboseManager(NULL)
 		, verboseFile(NULL)
+		, binaryVerboseFile(NULL)
 		, numOfFiles(0)
+		, firstGCTimed(false)
 	{
 		gp.namePrefix = NULL;
 		gp.percentage = 0.0f;
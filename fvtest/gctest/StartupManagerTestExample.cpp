@@ -83,7 +83,8 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,8 +92,14 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "regional")) {
+#if defined(OMR_GC_REGIONAL)
+						_useRegionalGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=regional ignored, requires OMR_GC_REGIONAL (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_REGIONAL) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, regional or optavgpause): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,11 +108,92 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "cardTableSummary")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->cardTableSummary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: cardTableSummary=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentScavenger")) {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+					extensions->concurrentScavenger = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+					extensions->concurrentScavengerForced = extensions->concurrentScavenger;
+					extensions->softwareRangeCheckReadBarrier = extensions->concurrentScavenger;
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentScavenger=true ignored, requires OMR_GC_CONCURRENT_SCAVENGER (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER)*/
+				} else if (0 == strcmp(attr.name(), "compactGC")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					/* same as -Xcompactgc, compaction is disabled by default */
+					if (0 == j9_cmdla_stricmp(attr.value(), "true")) {
+						extensions->noCompactOnGlobalGC = 0;
+						extensions->nocompactOnSystemGC = 0;
+					}
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: compactGC=true ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION)*/
+				} else if (0 == strcmp(attr.name(), "partialCompaction")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					extensions->partialCompaction = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: partialCompaction=true ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION)*/
+				} else if (0 == strcmp(attr.name(), "slidingCompaction")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					extensions->slidingCompaction = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: slidingCompaction=true ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION)*/
+				} else if (0 == strcmp(attr.name(), "partialCompactionMaxPercent")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					extensions->partialCompactionMaxPercent = (uintptr_t)atoi(attr.value());
+#endif /* defined(OMR_GC_MODRON_COMPACTION)*/
+				} else if (0 == strcmp(attr.name(), "packetListLockFree")) {
+					extensions->packetListLockFree = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "freeListSizeIndex")) {
+					extensions->freeListSizeIndex = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "lazySweep")) {
+					extensions->lazySweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveTLHSizing")) {
+					extensions->adaptiveTLHSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "markPrefetchDepth")) {
+					uintptr_t depth = (uintptr_t)atoi(attr.value());
+					if ((1 == depth) || (MARKING_SCHEME_PREFETCH_DEPTH_MAX < depth)) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: markPrefetchDepth must be 0 or 2 to %d: %s\n", MARKING_SCHEME_PREFETCH_DEPTH_MAX, attr.value());
+						result = false;
+					} else {
+						extensions->markPrefetchDepth = depth;
+					}
+				} else if (0 == strcmp(attr.name(), "binaryVerboseLog")) {
+					extensions->binaryVerboseLog = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncVerboseLog")) {
+					extensions->asyncVerboseLog = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "targetPauseTime")) {
+					extensions->heapResizeTargetPauseTime = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "targetGCPercentage")) {
+					extensions->heapResizeTargetGCPercentage = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "heapResizeHysteresis")) {
+					extensions->heapResizeHysteresis = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "heapReserveAlignment")) {
+					extensions->heapReserveAlignment = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "preTouchHeap")) {
+					extensions->preTouchHeap = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "alwaysApplyOverflowRounding")) {
+					extensions->fvtest_alwaysApplyOverflowRounding = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "numaAffinity")) {
+					extensions->numaAffinity = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodes")) {
+					/* logical nodes only, the heap is striped but never bound */
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerWorkStealing")) {
+					extensions->scavengerWorkStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationLifetimeSampling")) {
+					extensions->allocationLifetimeSamplingInterval = (uintptr_t)atoi(attr.value());
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
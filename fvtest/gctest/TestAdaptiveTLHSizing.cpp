@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Allocates small garbage objects between system collects with -Xgc:adaptiveTLHSizing, first with a
+ * refresh interval target long enough that the thread's rate asks for maximum size TLHs, then with
+ * one so short that the rate decays back to initial size TLHs, and checks the sizes requested.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "AllocationStats.hpp"
+
+#define ADAPTIVE_TLH_TEST_OBJECTS 16384
+#define ADAPTIVE_TLH_TEST_OBJECT_SIZE 128
+#define ADAPTIVE_TLH_TEST_LONG_INTERVAL 1000000
+#define ADAPTIVE_TLH_TEST_SHORT_INTERVAL 1
+
+class AdaptiveTLHSizingTest : public GCConfigTest
+{
+protected:
+	void allocatePhase(int32_t phase, uintptr_t refreshIntervalTarget);
+};
+
+void
+AdaptiveTLHSizingTest::allocatePhase(int32_t phase, uintptr_t refreshIntervalTarget)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	extensions->tlhRefreshIntervalTarget = refreshIntervalTarget;
+
+	/* the collect flushes the TLH and clears the thread's allocation stats */
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	uintptr_t gcCount = extensions->globalGCStats.gcCount;
+	for (int32_t i = 0; i < ADAPTIVE_TLH_TEST_OBJECTS; i++) {
+		ASSERT_TRUE(NULL != createObject("adaptiveTLH", GARBAGE_ROOT, phase, i, ADAPTIVE_TLH_TEST_OBJECT_SIZE));
+	}
+	ASSERT_EQ(gcCount, extensions->globalGCStats.gcCount) << "phase " << phase << " collected, its allocation stats are incomplete";
+}
+
+TEST_P(AdaptiveTLHSizingTest, followAllocationRate)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_AllocationStats *stats = env->_objectAllocationInterface->getAllocationStats();
+	ASSERT_TRUE(extensions->adaptiveTLHSizing);
+
+	/* no thread allocates a second's worth of small objects in under tlhMaximumSize bytes */
+	allocatePhase(0, ADAPTIVE_TLH_TEST_LONG_INTERVAL);
+	uintptr_t refreshCount = stats->_tlhRefreshCountFresh + stats->_tlhRefreshCountReused;
+	ASSERT_LT((uintptr_t)1, stats->_tlhRefreshCountFresh);
+	EXPECT_LT((uintptr_t)0, stats->_tlhRefreshCountHot);
+	EXPECT_LT(extensions->tlhMaximumSize / 2, stats->_tlhRequestedBytes / refreshCount) << "TLHs did not grow";
+
+	/* nor allocates tlhMaximumSize bytes in a microsecond; after the first fresh refresh the thread decays to small TLHs */
+	allocatePhase(1, ADAPTIVE_TLH_TEST_SHORT_INTERVAL);
+	refreshCount = stats->_tlhRefreshCountFresh + stats->_tlhRefreshCountReused;
+	ASSERT_LT((uintptr_t)1, stats->_tlhRefreshCountFresh);
+	EXPECT_EQ((uintptr_t)0, stats->_tlhRefreshCountHot);
+	/* adaptive sizes are rounded up to tlhIncrementSize */
+	uintptr_t smallestSize = OMR_MAX(extensions->tlhInitialSize, extensions->tlhIncrementSize);
+	EXPECT_GT(2 * smallestSize, stats->_tlhRequestedBytes / refreshCount) << "TLHs did not shrink";
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, AdaptiveTLHSizingTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_adaptivetlh_config.xml"));
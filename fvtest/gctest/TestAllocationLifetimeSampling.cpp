@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Allocates objects from a site that keeps them reachable interleaved with objects from a site that
+ * drops them, through enough scavenges to tenure some of them, and checks that the allocation lifetime
+ * sampler charges the copied and tenured bytes to the first site and none to the second.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "AllocationLifetimeSampler.hpp"
+
+#define LIFETIME_TEST_ROUNDS 40
+#define LIFETIME_TEST_KEPT_PER_ROUND 64
+#define LIFETIME_TEST_DROPPED_PER_ROUND 4096
+#define LIFETIME_TEST_OBJECT_SIZE 256
+
+class AllocationLifetimeSamplingTest : public GCConfigTest
+{
+};
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+static bool
+isReportedSite(OMRSpaceSaving *sites, uintptr_t site)
+{
+	for (uintptr_t k = 1; k <= spaceSavingGetCurSize(sites); k++) {
+		if (site == (uintptr_t)spaceSavingGetKthMostFreq(sites, k)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+TEST_P(AllocationLifetimeSamplingTest, survivorSites)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t gcCount = extensions->scavengerStats._gcCount;
+	uintptr_t keptSite = allocationSiteToken("lifetimeKept");
+	uintptr_t droppedSite = allocationSiteToken("lifetimeDropped");
+
+	for (int32_t round = 0; round < LIFETIME_TEST_ROUNDS; round++) {
+		for (int32_t i = 0; i < LIFETIME_TEST_KEPT_PER_ROUND; i++) {
+			ObjectEntry *objectEntry = createObject("lifetimeKept", ROOT, round, i, LIFETIME_TEST_OBJECT_SIZE);
+			ASSERT_TRUE(NULL != objectEntry);
+			RootEntry rootEntry;
+			rootEntry.name = objectEntry->name;
+			rootEntry.rootPtr = objectEntry->objPtr;
+			ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+		}
+		for (int32_t i = 0; i < LIFETIME_TEST_DROPPED_PER_ROUND; i++) {
+			/* only the weak object table refers to these */
+			ASSERT_TRUE(NULL != createObject("lifetimeDropped", GARBAGE_ROOT, round, i, LIFETIME_TEST_OBJECT_SIZE));
+		}
+	}
+
+	MM_AllocationLifetimeSampler *sampler = extensions->allocationLifetimeSampler;
+	ASSERT_TRUE(NULL != sampler);
+	ASSERT_LT(gcCount + 1, extensions->scavengerStats._gcCount) << "too few scavenges";
+	ASSERT_LT((uintptr_t)0, sampler->getSamplesTaken());
+
+	/* dropped objects dominate allocation, but every byte copied or tenured comes from the kept ones */
+	EXPECT_EQ(droppedSite, (uintptr_t)spaceSavingGetKthMostFreq(sampler->getSampledSites(), 1));
+	ASSERT_LT((uintptr_t)0, spaceSavingGetCurSize(sampler->getSurvivorSites()));
+	EXPECT_EQ(keptSite, (uintptr_t)spaceSavingGetKthMostFreq(sampler->getSurvivorSites(), 1));
+	EXPECT_FALSE(isReportedSite(sampler->getSurvivorSites(), droppedSite));
+	ASSERT_LT((uintptr_t)0, sampler->getSamplesTenured());
+	EXPECT_EQ(keptSite, (uintptr_t)spaceSavingGetKthMostFreq(sampler->getTenuredSites(), 1));
+	EXPECT_FALSE(isReportedSite(sampler->getTenuredSites(), droppedSite));
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, AllocationLifetimeSamplingTest,
+	::testing::Values("fvtest/gctest/configuration/scavenger_GC_lifetimesampling_config.xml"));
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Dirties patterns of cards in a committed heap region and checks that MM_CardTable::findNextUncleanCard,
+ * which skips clean runs with the vector scan and untouched groups with the card summary, finds exactly
+ * the cards a card at a time scan does, from aligned and unaligned starting points.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "CardTable.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+
+class CardTableScanTest : public GCConfigTest
+{
+};
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+static Card *
+findNextUncleanCardReference(Card *card, Card *cardTop)
+{
+	while ((card < cardTop) && ((Card)CARD_CLEAN == *card)) {
+		card += 1;
+	}
+	return card;
+}
+
+static void
+verifyCardScan(MM_EnvironmentBase *env, MM_CardTable *cardTable, Card *lowCard, Card *highCard)
+{
+	for (uintptr_t skew = 0; skew < 2 * sizeof(uintptr_t); skew++) {
+		Card *cardTop = highCard - skew;
+		Card *expected = lowCard + skew;
+		Card *found = lowCard + skew;
+		do {
+			expected = findNextUncleanCardReference(expected, cardTop);
+			found = cardTable->findNextUncleanCard(env, found, cardTop);
+			ASSERT_EQ(expected, found) << "skew " << skew << " card " << (expected - lowCard);
+			expected += 1;
+			found += 1;
+		} while (found <= cardTop);
+	}
+}
+
+TEST_P(CardTableScanTest, findUncleanCards)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_CardTable *cardTable = extensions->cardTable;
+	ASSERT_TRUE(NULL != cardTable);
+	ASSERT_TRUE(cardTable->isCardSummaryEnabled());
+
+	/* the longest run of contiguous committed regions, so that whole summary slots can be skipped */
+	uint8_t *low = NULL;
+	uint8_t *high = NULL;
+	uint8_t *runLow = NULL;
+	uint8_t *runHigh = NULL;
+	MM_HeapRegionDescriptor *region = NULL;
+	GC_HeapRegionIterator regionIterator(extensions->heap->getHeapRegionManager());
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (NULL == region->getSubSpace()) {
+			continue;
+		}
+		if (runHigh != (uint8_t *)region->getLowAddress()) {
+			runLow = (uint8_t *)region->getLowAddress();
+		}
+		runHigh = (uint8_t *)region->getHighAddress();
+		if ((uintptr_t)(runHigh - runLow) > (uintptr_t)(high - low)) {
+			low = runLow;
+			high = runHigh;
+		}
+	}
+	ASSERT_TRUE(NULL != low);
+
+	Card *lowCard = cardTable->heapAddrToCardAddr(env, low);
+	Card *highCard = cardTable->heapAddrToCardAddr(env, high);
+	uintptr_t cardCount = highCard - lowCard;
+	ASSERT_LT((uintptr_t)(CARD_SUMMARY_CARDS * CARD_SUMMARY_BITS_PER_SLOT), cardCount) << "committed heap too small to skip a whole summary slot";
+
+	/* an untouched range is skipped entirely */
+	cardTable->clearCardsInRange(env, low, high);
+	verifyCardScan(env, cardTable, lowCard, highCard);
+
+	/* isolated cards around slot and summary group boundaries, and a dense run */
+	uintptr_t offsets[] = {0, 1, 7, 8, 9, 15, 16, 100, CARD_SUMMARY_CARDS - 1, CARD_SUMMARY_CARDS, CARD_SUMMARY_CARDS + 3,
+		5 * CARD_SUMMARY_CARDS + 17, CARD_SUMMARY_CARDS * CARD_SUMMARY_BITS_PER_SLOT + 1, cardCount - 9, cardCount - 2, cardCount - 1};
+	for (uintptr_t i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++) {
+		cardTable->dirtyCard(env, (omrobjectptr_t)(low + (offsets[i] * CARD_SIZE)));
+	}
+	for (uintptr_t offset = 3 * CARD_SUMMARY_CARDS; offset < (3 * CARD_SUMMARY_CARDS) + 70; offset += 1) {
+		cardTable->dirtyCard(env, (omrobjectptr_t)(low + (offset * CARD_SIZE)));
+	}
+	for (uintptr_t i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++) {
+		ASSERT_EQ((Card)CARD_DIRTY, lowCard[offsets[i]]);
+	}
+	verifyCardScan(env, cardTable, lowCard, highCard);
+
+	/* clearing the cards again clears their summary */
+	cardTable->clearCardsInRange(env, low, high);
+	verifyCardScan(env, cardTable, lowCard, highCard);
+	ASSERT_EQ(highCard, cardTable->findNextUncleanCard(env, lowCard, highCard));
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, CardTableScanTest,
+	::testing::Values("fvtest/gctest/configuration/optavgpause_GC_cardsummary_config.xml"));
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -0,0 +1,241 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Drives MM_FreeEntrySizeIndex directly with free entries laid out in a private buffer: entries are
+ * inserted, split the way allocation carves objects from the top of an entry, and removed in a random
+ * order, and every findFit() result is checked against the best fit computed from a shadow copy of the
+ * index, for requests served by the size class buckets as well as by the treap of large entries.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "FreeEntrySizeIndex.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "Math.hpp"
+
+#define SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE ((uintptr_t)64)
+#define SIZE_INDEX_TEST_SLOTS 512
+#define SIZE_INDEX_TEST_SLOT_SIZE ((uintptr_t)64 * 1024)
+#define SIZE_INDEX_TEST_OPERATIONS 20000
+#define SIZE_INDEX_TEST_QUERIES 8
+
+class FreeEntrySizeIndexTest : public GCConfigTest
+{
+};
+
+typedef struct SizeIndexShadow {
+	MM_FreeEntrySizeIndex *index;
+	MM_HeapLinkedFreeHeader *entries[SIZE_INDEX_TEST_SLOTS]; /**< indexed entry in each slot, or NULL */
+	uintptr_t largeEntrySize; /**< entries at least this large are in the treap */
+	uintptr_t entryCount;
+	uint64_t seed;
+} SizeIndexShadow;
+
+static uintptr_t
+nextRandom(SizeIndexShadow *shadow, uintptr_t bound)
+{
+	shadow->seed = (shadow->seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+	return (uintptr_t)(shadow->seed >> 33) % bound;
+}
+
+/**
+ * Random entry size of at least the minimum entry size, biased towards small entries so that both the
+ * size class buckets and the treap are populated.
+ */
+static uintptr_t
+randomEntrySize(SizeIndexShadow *shadow, uintptr_t maximumSize)
+{
+	uintptr_t bound = OMR_MIN(maximumSize, SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE << (1 + nextRandom(shadow, 10)));
+	uintptr_t size = SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE + nextRandom(shadow, bound - SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE + 1);
+	return MM_Math::roundToFloor(sizeof(uintptr_t), size);
+}
+
+/**
+ * Size class of an entry below the large entry size: four classes per power of two above the minimum entry size.
+ */
+static uintptr_t
+getSizeClass(uintptr_t size)
+{
+	uintptr_t sizeLog2 = MM_Math::floorLog2(size);
+	uintptr_t minimumSizeLog2 = MM_Math::floorLog2(SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE);
+	if (sizeLog2 < minimumSizeLog2) {
+		return 0;
+	}
+	return ((sizeLog2 - minimumSizeLog2) << MM_FreeEntrySizeIndex::SUBCLASS_SHIFT) + ((size >> (sizeLog2 - MM_FreeEntrySizeIndex::SUBCLASS_SHIFT)) & ((1 << MM_FreeEntrySizeIndex::SUBCLASS_SHIFT) - 1));
+}
+
+/**
+ * Check one findFit() result against the entries of the shadow: the smallest fitting treap entry (lowest
+ * address on ties) for large requests, otherwise an entry of the smallest size class above the request,
+ * then the smallest treap entry, then a fitting entry of the request's own size class.
+ */
+static void
+checkFindFit(SizeIndexShadow *shadow, uintptr_t size)
+{
+	MM_HeapLinkedFreeHeader *bestLarge = NULL;
+	uintptr_t bestClass = UDATA_MAX;
+	bool sameClassFits = false;
+	bool anyFits = false;
+	uintptr_t requestClass = getSizeClass(size);
+
+	for (uintptr_t i = 0; i < SIZE_INDEX_TEST_SLOTS; i++) {
+		MM_HeapLinkedFreeHeader *entry = shadow->entries[i];
+		if (NULL == entry) {
+			continue;
+		}
+		uintptr_t entrySize = entry->getSize();
+		anyFits = anyFits || (entrySize >= size);
+		if (entrySize >= shadow->largeEntrySize) {
+			if ((entrySize >= size) && ((NULL == bestLarge) || (entrySize < bestLarge->getSize()))) {
+				/* slots are visited in address order, so the first of equal entries is kept */
+				bestLarge = entry;
+			}
+		} else if (getSizeClass(entrySize) > requestClass) {
+			bestClass = OMR_MIN(bestClass, getSizeClass(entrySize));
+		} else if ((getSizeClass(entrySize) == requestClass) && (entrySize >= size)) {
+			sameClassFits = true;
+		}
+	}
+
+	MM_HeapLinkedFreeHeader *fit = shadow->index->findFit(size);
+	if (!anyFits) {
+		ASSERT_TRUE(NULL == fit) << "size " << size;
+		return;
+	}
+	ASSERT_TRUE(NULL != fit) << "size " << size;
+	bool indexed = false;
+	for (uintptr_t i = 0; i < SIZE_INDEX_TEST_SLOTS; i++) {
+		indexed = indexed || (fit == shadow->entries[i]);
+	}
+	ASSERT_TRUE(indexed) << "size " << size << " returned an entry that is not indexed";
+	ASSERT_LE(size, fit->getSize());
+
+	if (size >= shadow->largeEntrySize) {
+		EXPECT_EQ(bestLarge, fit) << "size " << size;
+	} else if (UDATA_MAX != bestClass) {
+		EXPECT_GT(shadow->largeEntrySize, fit->getSize()) << "size " << size;
+		EXPECT_EQ(bestClass, getSizeClass(fit->getSize())) << "size " << size;
+	} else if (NULL != bestLarge) {
+		EXPECT_EQ(bestLarge, fit) << "size " << size;
+	} else {
+		EXPECT_TRUE(sameClassFits) << "size " << size;
+		EXPECT_EQ(requestClass, getSizeClass(fit->getSize())) << "size " << size;
+	}
+}
+
+TEST_P(FreeEntrySizeIndexTest, bestFit)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	MM_FreeEntrySizeIndex index;
+	ASSERT_FALSE(index.initialize(sizeof(MM_HeapLinkedFreeHeader))) << "an entry must be able to hold an index node";
+	ASSERT_TRUE(index.initialize(SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE));
+	ASSERT_FALSE(index.isValid());
+	index.clear();
+	ASSERT_TRUE(index.isValid());
+	ASSERT_TRUE(NULL == index.findFit(SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE));
+
+	void *buffer = omrmem_allocate_memory(SIZE_INDEX_TEST_SLOTS * SIZE_INDEX_TEST_SLOT_SIZE, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != buffer);
+
+	SizeIndexShadow shadow;
+	memset(&shadow, 0, sizeof(shadow));
+	shadow.index = &index;
+	/* 8 powers of two of size classes above the minimum entry size */
+	shadow.largeEntrySize = SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE << (MM_FreeEntrySizeIndex::BUCKET_COUNT >> MM_FreeEntrySizeIndex::SUBCLASS_SHIFT);
+	shadow.seed = 1;
+	MM_HeapLinkedFreeHeader *slots[SIZE_INDEX_TEST_SLOTS];
+	for (uintptr_t i = 0; i < SIZE_INDEX_TEST_SLOTS; i++) {
+		slots[i] = (MM_HeapLinkedFreeHeader *)((uintptr_t)buffer + (i * SIZE_INDEX_TEST_SLOT_SIZE));
+	}
+
+	uintptr_t inserts = 0;
+	uintptr_t splits = 0;
+	uintptr_t removes = 0;
+	for (uintptr_t op = 0; op < SIZE_INDEX_TEST_OPERATIONS; op++) {
+		uintptr_t slot = nextRandom(&shadow, SIZE_INDEX_TEST_SLOTS);
+		MM_HeapLinkedFreeHeader *entry = shadow.entries[slot];
+		if (NULL == entry) {
+			/* equal sizes are common, to exercise the address order of the treap */
+			uintptr_t size = (0 == nextRandom(&shadow, 4)) ? shadow.largeEntrySize : randomEntrySize(&shadow, SIZE_INDEX_TEST_SLOT_SIZE);
+			entry = slots[slot];
+			entry->setSize(size);
+			index.insert(entry);
+			shadow.entries[slot] = entry;
+			shadow.entryCount += 1;
+			inserts += 1;
+		} else if ((0 != nextRandom(&shadow, 3)) && (entry->getSize() >= (2 * SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE))) {
+			/* carve an object from the top of the entry, as allocateFromFreeEntryTop() does */
+			uintptr_t remainingSize = randomEntrySize(&shadow, entry->getSize() - SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE);
+			index.remove(entry);
+			entry->setSize(remainingSize);
+			index.insert(entry);
+			splits += 1;
+		} else {
+			index.remove(entry);
+			shadow.entries[slot] = NULL;
+			shadow.entryCount -= 1;
+			removes += 1;
+		}
+		ASSERT_EQ(shadow.entryCount, index.getEntryCount());
+
+		for (uintptr_t i = 0; i < SIZE_INDEX_TEST_QUERIES; i++) {
+			uintptr_t size = randomEntrySize(&shadow, 2 * SIZE_INDEX_TEST_SLOT_SIZE);
+			checkFindFit(&shadow, size);
+			ASSERT_FALSE(HasFatalFailure()) << "operation " << op;
+		}
+	}
+	EXPECT_LT((uintptr_t)1000, inserts);
+	EXPECT_LT((uintptr_t)1000, splits);
+	EXPECT_LT((uintptr_t)1000, removes);
+
+	/* drain the index in address order, leaving a single large entry */
+	for (uintptr_t i = 1; i < SIZE_INDEX_TEST_SLOTS; i++) {
+		if (NULL != shadow.entries[i]) {
+			index.remove(shadow.entries[i]);
+			shadow.entries[i] = NULL;
+			shadow.entryCount -= 1;
+		}
+	}
+	if (NULL != shadow.entries[0]) {
+		index.remove(shadow.entries[0]);
+	}
+	slots[0]->setSize(SIZE_INDEX_TEST_SLOT_SIZE);
+	index.insert(slots[0]);
+	shadow.entries[0] = slots[0];
+	shadow.entryCount = 1;
+	ASSERT_EQ((uintptr_t)1, index.getEntryCount());
+	/* any request up to its size is served by the only entry, from the treap */
+	EXPECT_EQ(slots[0], index.findFit(SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE));
+	EXPECT_EQ(slots[0], index.findFit(shadow.largeEntrySize));
+	EXPECT_EQ(slots[0], index.findFit(SIZE_INDEX_TEST_SLOT_SIZE));
+	EXPECT_TRUE(NULL == index.findFit(SIZE_INDEX_TEST_SLOT_SIZE + 1));
+	index.remove(slots[0]);
+	EXPECT_EQ((uintptr_t)0, index.getEntryCount());
+	EXPECT_TRUE(NULL == index.findFit(SIZE_INDEX_TEST_MINIMUM_ENTRY_SIZE));
+
+	omrmem_free_memory(buffer);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, FreeEntrySizeIndexTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_freelistindex_config.xml"));
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Checks the heap reserved with -Xgc:heapReserveAlignment and -Xgc:preTouchHeap: the heap starts on the
+ * requested boundary, its top stays inside the reservation when overflow rounding moves it down, and the
+ * committed memory was faulted in before any allocation.
+ */
+
+#include "GCConfigTest.hpp"
+
+#if defined(LINUX)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif /* defined(LINUX) */
+
+#include "Heap.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "MemoryManager.hpp"
+#include "ParallelPreTouchTask.hpp"
+
+#define PRE_TOUCH_TEST_ALIGNMENT ((uintptr_t)2 * 1024 * 1024)
+
+class HeapPreTouchTest : public GCConfigTest
+{
+};
+
+#if defined(LINUX)
+/**
+ * @return the number of pages of [low, high) which are resident, or -1 if mincore fails
+ */
+static intptr_t
+countResidentPages(uintptr_t low, uintptr_t high)
+{
+	uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+	uintptr_t base = low & ~(pageSize - 1);
+	uintptr_t pageCount = (high - base + pageSize - 1) / pageSize;
+	unsigned char *residency = new unsigned char[pageCount];
+	intptr_t resident = -1;
+
+	if (0 == mincore((void *)base, high - base, residency)) {
+		resident = 0;
+		for (uintptr_t i = 0; i < pageCount; i++) {
+			resident += (residency[i] & 1);
+		}
+	}
+	delete[] residency;
+	return resident;
+}
+#endif /* defined(LINUX) */
+
+TEST_P(HeapPreTouchTest, alignedAndTouched)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_Heap *heap = extensions->heap;
+	ASSERT_TRUE(extensions->preTouchHeap);
+	ASSERT_TRUE(extensions->fvtest_alwaysApplyOverflowRounding);
+	ASSERT_EQ(PRE_TOUCH_TEST_ALIGNMENT, extensions->heapReserveAlignment);
+
+	/* the reservation is over-allocated so that the heap can start on the requested boundary */
+	uintptr_t heapBase = (uintptr_t)heap->getHeapBase();
+	uintptr_t heapTop = (uintptr_t)heap->getHeapTop();
+	EXPECT_EQ((uintptr_t)0, heapBase % PRE_TOUCH_TEST_ALIGNMENT);
+	EXPECT_LT(heapBase, heapTop);
+	EXPECT_LE(heap->getMaximumMemorySize(), heapTop - heapBase);
+	/* overflow rounding moved the top down from the end of the reservation, not from the aligned base */
+	MM_MemoryHandle *vmemHandle = (MM_MemoryHandle *)((MM_HeapVirtualMemory *)heap)->getVmemHandle();
+	EXPECT_LE(heapTop, (uintptr_t)extensions->memoryManager->getReserveTop(vmemHandle));
+
+	uintptr_t committedSize = 0;
+	GC_HeapRegionIterator regionIterator(heap->getHeapRegionManager());
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		committedSize += region->getSize();
+	}
+	ASSERT_LT((uintptr_t)0, committedSize);
+
+#if defined(LINUX)
+	/* nothing was allocated yet, the committed memory is resident because startup touched it */
+	uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+	GC_HeapRegionIterator residencyIterator(heap->getHeapRegionManager());
+	while (NULL != (region = residencyIterator.nextRegion())) {
+		uintptr_t low = (uintptr_t)region->getLowAddress();
+		uintptr_t high = (uintptr_t)region->getHighAddress();
+		EXPECT_EQ((intptr_t)((high - low) / pageSize), countResidentPages(low, high)) << "region " << region->getLowAddress();
+	}
+#endif /* defined(LINUX) */
+
+	/* every committed byte is accounted for by the work units */
+	EXPECT_EQ(committedSize, MM_ParallelPreTouchTask::preTouchHeap(env));
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, HeapPreTouchTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_pretouch_config.xml"));
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Checks the votes and decisions of MM_HeapResizeGoal, then drives a flat heap with a pause target through
+ * allocation failures while its collections report pauses above the target, and checks that the heap
+ * actually contracts for that reason.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "Heap.hpp"
+#include "HeapResizeStats.hpp"
+
+#define GOAL_TEST_TARGET_PAUSE_US 1000
+#define GOAL_TEST_TARGET_GC_PERCENTAGE 10
+#define GOAL_TEST_HYSTERESIS 3
+#define GOAL_TEST_LONG_PAUSE_US (10 * 1000 * 1000)
+#define GOAL_TEST_LIVE_SIZE (256 * 1024)
+#define GOAL_TEST_GARBAGE_SIZE (2 * 1024 * 1024)
+#define GOAL_TEST_OBJECT_SIZE 64
+#define GOAL_TEST_BREADTH 2
+#define GOAL_TEST_MAX_ROUNDS 64
+#define GOAL_TEST_NAME_LENGTH 32
+
+class HeapResizeGoalTest : public GCConfigTest
+{
+};
+
+TEST_P(HeapResizeGoalTest, decide)
+{
+	MM_HeapResizeGoal goal;
+	double factor = 0.0;
+
+	/* within the band around the gc time target nothing changes */
+	for (uintptr_t i = 0; i < (2 * GOAL_TEST_HYSTERESIS); i++) {
+		EXPECT_EQ(MM_HeapResizeGoal::goal_hold, goal.decide(0, GOAL_TEST_TARGET_GC_PERCENTAGE, GOAL_TEST_TARGET_GC_PERCENTAGE, GOAL_TEST_HYSTERESIS, &factor));
+	}
+	EXPECT_EQ(0.0, factor);
+
+	/* gc time twice the target expands once enough collections agreed, by the overshoot capped at the maximum step */
+	for (uintptr_t i = 1; i < GOAL_TEST_HYSTERESIS; i++) {
+		EXPECT_EQ(MM_HeapResizeGoal::goal_hold, goal.decide(0, GOAL_TEST_TARGET_GC_PERCENTAGE, 2 * GOAL_TEST_TARGET_GC_PERCENTAGE, GOAL_TEST_HYSTERESIS, &factor)) << "vote " << i;
+	}
+	EXPECT_EQ(MM_HeapResizeGoal::goal_expand, goal.decide(0, GOAL_TEST_TARGET_GC_PERCENTAGE, 2 * GOAL_TEST_TARGET_GC_PERCENTAGE, GOAL_TEST_HYSTERESIS, &factor));
+	EXPECT_DOUBLE_EQ(HEAP_RESIZE_GOAL_MAXIMUM_EXPAND, factor);
+	/* the votes start over after a decision */
+	EXPECT_EQ(MM_HeapResizeGoal::goal_hold, goal.decide(0, GOAL_TEST_TARGET_GC_PERCENTAGE, 2 * GOAL_TEST_TARGET_GC_PERCENTAGE, GOAL_TEST_HYSTERESIS, &factor));
+
+	/* a change of mind, or a collection in the band, starts the votes over */
+	EXPECT_EQ(MM_HeapResizeGoal::goal_hold, goal.decide(0, GOAL_TEST_TARGET_GC_PERCENTAGE, 1, GOAL_TEST_HYSTERESIS, &factor));
+	EXPECT_EQ(MM_HeapResizeGoal::goal_hold, goal.decide(0, GOAL_TEST_TARGET_GC_PERCENTAGE, 1, GOAL_TEST_HYSTERESIS, &factor));
+	EXPECT_EQ(MM_HeapResizeGoal::goal_hold, goal.decide(0, GOAL_TEST_TARGET_GC_PERCENTAGE, GOAL_TEST_TARGET_GC_PERCENTAGE, GOAL_TEST_HYSTERESIS, &factor));
+	EXPECT_EQ(MM_HeapResizeGoal::goal_hold, goal.decide(0, GOAL_TEST_TARGET_GC_PERCENTAGE, 1, GOAL_TEST_HYSTERESIS, &factor));
+	EXPECT_EQ(MM_HeapResizeGoal::goal_hold, goal.decide(0, GOAL_TEST_TARGET_GC_PERCENTAGE, 1, GOAL_TEST_HYSTERESIS, &factor));
+
+	/* gc time well below the target gives memory back a minimum step at a time */
+	EXPECT_EQ(MM_HeapResizeGoal::goal_contract_footprint, goal.decide(0, GOAL_TEST_TARGET_GC_PERCENTAGE, 1, GOAL_TEST_HYSTERESIS, &factor));
+	EXPECT_DOUBLE_EQ(HEAP_RESIZE_GOAL_MINIMUM_STEP, factor);
+
+	/* a hysteresis of 0 acts on every vote */
+	EXPECT_EQ(MM_HeapResizeGoal::goal_contract_footprint, goal.decide(0, GOAL_TEST_TARGET_GC_PERCENTAGE, 1, 0, &factor));
+
+	/* pauses over the target contract in proportion to the overshoot, within the maximum step */
+	goal.recordPause(GOAL_TEST_TARGET_PAUSE_US * 10 / 9);
+	EXPECT_EQ(GOAL_TEST_TARGET_PAUSE_US * 10 / 9, goal.getRecentPauseUs());
+	EXPECT_EQ(MM_HeapResizeGoal::goal_contract_pause, goal.decide(GOAL_TEST_TARGET_PAUSE_US, GOAL_TEST_TARGET_GC_PERCENTAGE, GOAL_TEST_TARGET_GC_PERCENTAGE, 1, &factor));
+	EXPECT_NEAR(1.0 - ((double)GOAL_TEST_TARGET_PAUSE_US / (double)(GOAL_TEST_TARGET_PAUSE_US * 10 / 9)), factor, 0.001);
+	goal.recordPause(10 * GOAL_TEST_TARGET_PAUSE_US);
+	EXPECT_EQ(MM_HeapResizeGoal::goal_contract_pause, goal.decide(GOAL_TEST_TARGET_PAUSE_US, GOAL_TEST_TARGET_GC_PERCENTAGE, 2 * GOAL_TEST_TARGET_GC_PERCENTAGE, 1, &factor));
+	EXPECT_DOUBLE_EQ(HEAP_RESIZE_GOAL_MAXIMUM_CONTRACT, factor);
+
+	/* the recent pause is the worse of the last and the average pause, without headroom under the pause target
+	 * a gc time above its target does not expand
+	 */
+	MM_HeapResizeGoal closeToTarget;
+	closeToTarget.recordPause(GOAL_TEST_TARGET_PAUSE_US * 19 / 20);
+	EXPECT_EQ(MM_HeapResizeGoal::goal_hold, closeToTarget.decide(GOAL_TEST_TARGET_PAUSE_US, GOAL_TEST_TARGET_GC_PERCENTAGE, 2 * GOAL_TEST_TARGET_GC_PERCENTAGE, 1, &factor));
+	closeToTarget.recordPause(GOAL_TEST_TARGET_PAUSE_US / 10);
+	EXPECT_LT(GOAL_TEST_TARGET_PAUSE_US * 7 / 10, closeToTarget.getRecentPauseUs());
+	EXPECT_EQ(MM_HeapResizeGoal::goal_expand, closeToTarget.decide(GOAL_TEST_TARGET_PAUSE_US, GOAL_TEST_TARGET_GC_PERCENTAGE, 2 * GOAL_TEST_TARGET_GC_PERCENTAGE, 1, &factor));
+}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+/* the top of the heap is only free to give back once a compaction moved the objects below it */
+TEST_P(HeapResizeGoalTest, contractForPauseTarget)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_HeapResizeStats *resizeStats = extensions->heap->getResizeStats();
+	ASSERT_TRUE(extensions->isGoalDrivenHeapResizing());
+	ASSERT_EQ((uintptr_t)10, extensions->heapResizeTargetPauseTime);
+
+	ObjectEntry *rootEntry = NULL;
+	ASSERT_EQ(0, createFixedSizeTree(&rootEntry, "goalLive", ROOT, GOAL_TEST_LIVE_SIZE, GOAL_TEST_OBJECT_SIZE, GOAL_TEST_BREADTH));
+	uintptr_t initialHeapSize = extensions->heap->getActiveMemorySize();
+	uintptr_t heapSize = initialHeapSize;
+
+	/* the garbage trees fill the heap, every allocation failure collection pauses far longer than the target on a
+	 * heap this size and votes to contract
+	 */
+	char name[GOAL_TEST_NAME_LENGTH];
+	for (int32_t round = 0; (round < GOAL_TEST_MAX_ROUNDS) && (heapSize == initialHeapSize); round++) {
+		resizeStats->getTenureGoal()->recordPause(GOAL_TEST_LONG_PAUSE_US);
+		omrstr_printf(name, sizeof(name), "goalGarbage%d", round);
+		ASSERT_EQ(0, createFixedSizeTree(&rootEntry, name, GARBAGE_ROOT, GOAL_TEST_GARBAGE_SIZE, GOAL_TEST_OBJECT_SIZE, GOAL_TEST_BREADTH));
+		ASSERT_EQ(0, removeObjectFromRootTable(rootEntry->name));
+		heapSize = extensions->heap->getActiveMemorySize();
+	}
+
+	ASSERT_GT(initialHeapSize, heapSize) << "no goal driven contraction after " << extensions->globalGCStats.gcCount << " collections";
+	EXPECT_EQ(PAUSE_TIME_ABOVE_TARGET, resizeStats->getLastContractReason());
+	/* the contraction waited out the stabilization count after the last expansion */
+	EXPECT_LE(resizeStats->getLastHeapExpansionGCCount() + extensions->heapContractionStabilizationCount, resizeStats->getLastHeapContractionGCCount());
+	/* one step never gives back more than the maximum contraction */
+	EXPECT_LE((initialHeapSize - heapSize), (uintptr_t)(initialHeapSize * HEAP_RESIZE_GOAL_MAXIMUM_CONTRACT));
+}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, HeapResizeGoalTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_goalresize_config.xml"));
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Runs global collects with lazy sweep on a heap of interleaved live and garbage trees. Checks that a
+ * collect leaves chunks unconnected, that allocating afterwards connects more chunks without another
+ * collect, and that the free list left by a completed lazy sweep is the one an eager sweep of the same
+ * mark map builds.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "Heap.hpp"
+#include "HeapMemoryPoolIterator.hpp"
+#include "LazySweepScheme.hpp"
+#include "MemoryPool.hpp"
+#include "ParallelGlobalGC.hpp"
+
+#define LAZY_SWEEP_TEST_ROUNDS 20
+#define LAZY_SWEEP_TEST_LIVE_SIZE (64 * 1024)
+#define LAZY_SWEEP_TEST_GARBAGE_SIZE (192 * 1024)
+#define LAZY_SWEEP_TEST_ALLOCATE_SIZE (32 * 1024)
+#define LAZY_SWEEP_TEST_OBJECT_SIZE 64
+#define LAZY_SWEEP_TEST_BREADTH 4
+#define LAZY_SWEEP_TEST_NAME_LENGTH 32
+
+class LazySweepTest : public GCConfigTest
+{
+};
+
+typedef struct FreeListSummary {
+	uintptr_t freeBytes;
+	uintptr_t freeEntryCount;
+	uintptr_t largestFreeEntry;
+} FreeListSummary;
+
+static void
+summarizeFreeList(MM_EnvironmentBase *env, FreeListSummary *summary)
+{
+	MM_HeapMemoryPoolIterator poolIterator(env, env->getExtensions()->heap);
+	MM_MemoryPool *memoryPool = poolIterator.nextPool();
+	summary->freeBytes = memoryPool->getActualFreeMemorySize();
+	summary->freeEntryCount = memoryPool->getActualFreeEntryCount();
+	summary->largestFreeEntry = memoryPool->getLargestFreeEntry();
+	/* lazy sweep only runs on a single pool */
+	ASSERT_TRUE(NULL == poolIterator.nextPool());
+}
+
+TEST_P(LazySweepTest, sweepOnDemand)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->lazySweep);
+	MM_LazySweepScheme *sweepScheme = (MM_LazySweepScheme *)((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getSweepScheme();
+	uintptr_t heapSize = extensions->heap->getActiveMemorySize();
+
+	/* garbage between the live trees leaves free memory in every part of the heap */
+	char name[LAZY_SWEEP_TEST_NAME_LENGTH];
+	for (int32_t round = 0; round < LAZY_SWEEP_TEST_ROUNDS; round++) {
+		ObjectEntry *rootEntry = NULL;
+		omrstr_printf(name, sizeof(name), "lazyLive%d", round);
+		ASSERT_EQ(0, createFixedSizeTree(&rootEntry, name, ROOT, LAZY_SWEEP_TEST_LIVE_SIZE, LAZY_SWEEP_TEST_OBJECT_SIZE, LAZY_SWEEP_TEST_BREADTH));
+		omrstr_printf(name, sizeof(name), "lazyGarbage%d", round);
+		ASSERT_EQ(0, createFixedSizeTree(&rootEntry, name, GARBAGE_ROOT, LAZY_SWEEP_TEST_GARBAGE_SIZE, LAZY_SWEEP_TEST_OBJECT_SIZE, LAZY_SWEEP_TEST_BREADTH));
+		ASSERT_EQ(0, removeObjectFromRootTable(rootEntry->name));
+	}
+
+	/* an implicit collect only connects the first batch of chunks (an explicit one completes the sweep) */
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+	uintptr_t gcCount = extensions->globalGCStats.gcCount;
+	ASSERT_FALSE(sweepScheme->isSweepCompleted(env));
+	uintptr_t connectedBytes = sweepScheme->getConnectedBytes();
+	EXPECT_LT((uintptr_t)0, connectedBytes);
+	EXPECT_GT(heapSize, connectedBytes);
+
+	/* allocating threads which run out of free memory sweep and connect more chunks */
+	for (int32_t round = 0; (connectedBytes == sweepScheme->getConnectedBytes()) && (round < LAZY_SWEEP_TEST_ROUNDS * 8); round++) {
+		ObjectEntry *rootEntry = NULL;
+		omrstr_printf(name, sizeof(name), "lazyAllocate%d", round);
+		ASSERT_EQ(0, createFixedSizeTree(&rootEntry, name, GARBAGE_ROOT, LAZY_SWEEP_TEST_ALLOCATE_SIZE, LAZY_SWEEP_TEST_OBJECT_SIZE, LAZY_SWEEP_TEST_BREADTH));
+		ASSERT_EQ(0, removeObjectFromRootTable(rootEntry->name));
+	}
+	ASSERT_EQ(gcCount, extensions->globalGCStats.gcCount) << "the heap filled up before the sweep was replenished";
+	EXPECT_LT(connectedBytes, sweepScheme->getConnectedBytes());
+
+	/* a completed lazy sweep builds the free list an eager sweep of the same mark map builds */
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+	ASSERT_FALSE(sweepScheme->isSweepCompleted(env));
+	env->acquireExclusiveVMAccess();
+	FreeListSummary lazy;
+	FreeListSummary eager;
+	sweepScheme->completeSweep(env, HEAP_WALK_REQUIRED);
+	EXPECT_TRUE(sweepScheme->isSweepCompleted(env));
+	EXPECT_EQ(heapSize, sweepScheme->getConnectedBytes());
+	summarizeFreeList(env, &lazy);
+	extensions->heap->resetSpacesForGarbageCollect(env);
+	sweepScheme->MM_ParallelSweepScheme::sweep(env);
+	summarizeFreeList(env, &eager);
+	env->releaseExclusiveVMAccess();
+
+	EXPECT_LT((uintptr_t)0, lazy.freeBytes);
+	EXPECT_EQ(eager.freeBytes, lazy.freeBytes);
+	EXPECT_EQ(eager.freeEntryCount, lazy.freeEntryCount);
+	EXPECT_EQ(eager.largestFreeEntry, lazy.largestFreeEntry);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, LazySweepTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_lazysweep_ondemand_config.xml"));
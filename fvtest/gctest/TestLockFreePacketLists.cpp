@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Marks a deep object graph on 4 GC threads with lock-free packet lists, and checks after each global
+ * collect that the packets were moved through the lock-free sublists, that every packet is back on the
+ * empty list, and that the live graph was marked and the garbage was not.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "modronopt.h"
+#include "omrgc.h"
+
+#include "MarkingScheme.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "WorkPackets.hpp"
+
+#define LOCK_FREE_TEST_COLLECTS 5
+#define LOCK_FREE_TEST_LIVE_SIZE (1024 * 1024)
+#define LOCK_FREE_TEST_GARBAGE_SIZE (512 * 1024)
+#define LOCK_FREE_TEST_OBJECT_SIZE 64
+#define LOCK_FREE_TEST_BREADTH 2
+#define LOCK_FREE_TEST_NAME_LENGTH 32
+
+class LockFreePacketListTest : public GCConfigTest
+{
+};
+
+TEST_P(LockFreePacketListTest, markWithLockFreeLists)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_MarkingScheme *markingScheme = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getMarkingScheme();
+	MM_WorkPackets *workPackets = markingScheme->getWorkPackets();
+	ASSERT_TRUE(extensions->packetListLockFree);
+	ASSERT_EQ((uintptr_t)4, extensions->dispatcher->threadCountMaximum());
+
+	ObjectEntry *rootEntry = NULL;
+	ASSERT_EQ(0, createFixedSizeTree(&rootEntry, "lockFreeLive", ROOT, LOCK_FREE_TEST_LIVE_SIZE, LOCK_FREE_TEST_OBJECT_SIZE, LOCK_FREE_TEST_BREADTH));
+
+	char name[LOCK_FREE_TEST_NAME_LENGTH];
+	for (int32_t i = 0; i < LOCK_FREE_TEST_COLLECTS; i++) {
+		omrstr_printf(name, sizeof(name), "lockFreeGarbage%d", i);
+		ASSERT_EQ(0, createFixedSizeTree(&rootEntry, name, GARBAGE_ROOT, LOCK_FREE_TEST_GARBAGE_SIZE, LOCK_FREE_TEST_OBJECT_SIZE, LOCK_FREE_TEST_BREADTH));
+		omrobjectptr_t garbage = rootEntry->objPtr;
+		ASSERT_EQ(0, removeObjectFromRootTable(rootEntry->name));
+
+		ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		/* stats are those of the latest collect */
+		EXPECT_LT((uintptr_t)0, extensions->globalGCStats.workPacketStats.workPacketsLockFreePops) << "collect " << i;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		EXPECT_LT((uintptr_t)0, workPackets->getActivePacketCount()) << "collect " << i;
+		EXPECT_EQ(workPackets->getActivePacketCount(), workPackets->getEmptyPacketCount()) << "collect " << i;
+		EXPECT_EQ((uintptr_t)0, workPackets->getDeferredPacketCount()) << "collect " << i;
+		EXPECT_TRUE(workPackets->isAllPacketsEmpty()) << "collect " << i;
+
+		/* the mark map of the latest collect is still intact */
+		EXPECT_FALSE(markingScheme->isMarked(garbage)) << "collect " << i;
+		for (int32_t depth = 0; depth < 4; depth++) {
+			omrstr_printf(name, sizeof(name), "lockFreeLive_%d_0", depth);
+			ObjectEntry *liveEntry = find(name);
+			ASSERT_TRUE(NULL != liveEntry) << name;
+			EXPECT_TRUE(markingScheme->isMarked(liveEntry->objPtr)) << name << " after collect " << i;
+		}
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, LockFreePacketListTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_lockfree_marking_config.xml"));
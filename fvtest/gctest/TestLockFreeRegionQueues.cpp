@@ -0,0 +1,217 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Many mutator threads move single regions between a lock-free free list and lock-free size class
+ * queues the way the segregated allocation path does (one region at a time and in batches), then
+ * check that no region was lost or handed out twice.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManagerTarok.hpp"
+#include "LockingFreeHeapRegionList.hpp"
+#include "LockingHeapRegionQueue.hpp"
+
+#define REGION_COUNT 256
+#define REGION_SIZE ((uintptr_t)64 * 1024)
+#define SIZE_CLASS_QUEUES 4
+#define MUTATOR_THREADS 16
+#define ITERATIONS_PER_THREAD 20000
+#define BATCH_SIZE 8
+
+class LockFreeRegionQueueTest : public GCConfigTest
+{
+};
+
+typedef struct RegionQueueHammer {
+	MM_LockingFreeHeapRegionList *freeList;
+	MM_LockingHeapRegionQueue *queues[SIZE_CLASS_QUEUES];
+	omrthread_monitor_t monitor;
+	uintptr_t running;
+	uintptr_t seed;
+} RegionQueueHammer;
+
+static int J9THREAD_PROC
+hammerRegionQueues(void *arg)
+{
+	RegionQueueHammer *hammer = (RegionQueueHammer *)arg;
+	/* a private, unlocked queue receives batches, like an environment's region work list */
+	MM_LockingHeapRegionQueue workList(MM_HeapRegionList::HRL_KIND_LOCAL_WORK, true, false, false);
+	MM_HeapRegionDescriptorSegregated *held[BATCH_SIZE];
+	uintptr_t heldCount = 0;
+
+	omrthread_monitor_enter(hammer->monitor);
+	uintptr_t seed = hammer->seed++;
+	omrthread_monitor_exit(hammer->monitor);
+
+	for (uintptr_t i = 0; i < ITERATIONS_PER_THREAD; i++) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		MM_LockingHeapRegionQueue *queue = hammer->queues[(seed >> 33) % SIZE_CLASS_QUEUES];
+		switch ((seed >> 40) % 4) {
+		case 0:
+			/* a size class runs out: take a free region */
+			if (heldCount < BATCH_SIZE) {
+				MM_HeapRegionDescriptorSegregated *region = hammer->freeList->pop();
+				if (NULL != region) {
+					held[heldCount++] = region;
+				}
+			}
+			break;
+		case 1:
+			/* a region is given back to a size class queue */
+			if (0 < heldCount) {
+				queue->enqueue(held[--heldCount]);
+			}
+			break;
+		case 2:
+			/* an allocation context replenishes from a size class queue */
+			if (heldCount < BATCH_SIZE) {
+				MM_HeapRegionDescriptorSegregated *region = queue->dequeueIfNonEmpty();
+				if (NULL != region) {
+					held[heldCount++] = region;
+				}
+			}
+			break;
+		default:
+			/* a batch moves through a private list back to the free list */
+			queue->dequeue(&workList, BATCH_SIZE);
+			hammer->freeList->push(&workList);
+			break;
+		}
+	}
+
+	while (0 < heldCount) {
+		hammer->freeList->push(held[--heldCount]);
+	}
+
+	omrthread_monitor_enter(hammer->monitor);
+	hammer->running -= 1;
+	omrthread_monitor_notify_all(hammer->monitor);
+	omrthread_monitor_exit(hammer->monitor);
+	return 0;
+}
+
+TEST_P(LockFreeRegionQueueTest, hammer)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	uintptr_t descriptorSize = sizeof(MM_HeapRegionDescriptorSegregated) + sizeof(uintptr_t *) * env->getExtensions()->arrayletsPerRegion;
+	MM_HeapRegionManagerTarok *regionManager = MM_HeapRegionManagerTarok::newInstance(env, REGION_SIZE, descriptorSize, MM_HeapRegionDescriptorSegregated::initializer, MM_HeapRegionDescriptorSegregated::destructor);
+	ASSERT_TRUE(NULL != regionManager);
+	void *heapMemory = omrmem_allocate_memory((REGION_COUNT + 1) * REGION_SIZE, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != heapMemory);
+	void *heapBase = (void *)(((uintptr_t)heapMemory + REGION_SIZE - 1) & ~(REGION_SIZE - 1));
+	ASSERT_TRUE(regionManager->setContiguousHeapRange(env, heapBase, (void *)((uintptr_t)heapBase + (REGION_COUNT * REGION_SIZE))));
+
+	RegionQueueHammer hammer;
+	hammer.freeList = MM_LockingFreeHeapRegionList::newInstance(env, MM_HeapRegionList::HRL_KIND_FREE, true, regionManager);
+	ASSERT_TRUE(NULL != hammer.freeList);
+	ASSERT_TRUE(hammer.freeList->isLockFree());
+	for (uintptr_t i = 0; i < SIZE_CLASS_QUEUES; i++) {
+		hammer.queues[i] = MM_LockingHeapRegionQueue::newInstance(env, MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true, regionManager);
+		ASSERT_TRUE(NULL != hammer.queues[i]);
+		ASSERT_TRUE(hammer.queues[i]->isLockFree());
+	}
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&hammer.monitor, 0, "LockFreeRegionQueueTest"));
+	hammer.running = MUTATOR_THREADS;
+	hammer.seed = 1;
+
+	for (uintptr_t i = 0; i < REGION_COUNT; i++) {
+		MM_HeapRegionDescriptorSegregated *region = (MM_HeapRegionDescriptorSegregated *)regionManager->mapRegionTableIndexToDescriptor(i);
+		region->setRangeHead(region);
+		region->setRangeCount(1);
+		hammer.freeList->push(region);
+	}
+	ASSERT_EQ((uintptr_t)REGION_COUNT, hammer.freeList->length());
+
+	for (uintptr_t i = 0; i < MUTATOR_THREADS; i++) {
+		omrthread_t thread = NULL;
+		ASSERT_EQ(0, omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, hammerRegionQueues, &hammer));
+	}
+	omrthread_monitor_enter(hammer.monitor);
+	while (0 != hammer.running) {
+		omrthread_monitor_wait(hammer.monitor);
+	}
+	omrthread_monitor_exit(hammer.monitor);
+
+	/* every region is on exactly one list and the counts agree with the chains */
+	uint8_t seen[REGION_COUNT];
+	memset(seen, 0, sizeof(seen));
+	uintptr_t total = 0;
+	MM_LockingHeapRegionQueue *drain = MM_LockingHeapRegionQueue::newInstance(env, MM_HeapRegionList::HRL_KIND_LOCAL_WORK, true, false, false);
+	ASSERT_TRUE(NULL != drain);
+	for (uintptr_t i = 0; i <= SIZE_CLASS_QUEUES; i++) {
+		uintptr_t expected = 0;
+		if (i < SIZE_CLASS_QUEUES) {
+			expected = hammer.queues[i]->length();
+			drain->enqueue(hammer.queues[i]);
+			EXPECT_TRUE(hammer.queues[i]->isEmpty());
+		} else {
+			expected = hammer.freeList->length();
+			MM_HeapRegionDescriptorSegregated *region = NULL;
+			while (NULL != (region = hammer.freeList->pop())) {
+				drain->enqueue(region);
+			}
+			EXPECT_TRUE(hammer.freeList->isEmpty());
+		}
+		total += expected;
+		uintptr_t found = 0;
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (NULL != (region = drain->dequeue())) {
+			uintptr_t index = regionManager->mapDescriptorToRegionTableIndex(region);
+			ASSERT_LT(index, (uintptr_t)REGION_COUNT);
+			EXPECT_EQ(0, seen[index]) << "region " << index << " is on more than one list";
+			seen[index] = 1;
+			found += 1;
+		}
+		EXPECT_EQ(expected, found);
+	}
+	EXPECT_EQ((uintptr_t)REGION_COUNT, total);
+
+	/* a batch taken from a locking queue lands on the stack of a lock-free target */
+	for (uintptr_t i = 0; i < BATCH_SIZE; i++) {
+		drain->enqueue((MM_HeapRegionDescriptorSegregated *)regionManager->mapRegionTableIndexToDescriptor(i));
+	}
+	EXPECT_EQ((uintptr_t)BATCH_SIZE, drain->dequeue(hammer.queues[0], BATCH_SIZE));
+	EXPECT_TRUE(drain->isEmpty());
+	EXPECT_EQ((uintptr_t)BATCH_SIZE, hammer.queues[0]->length());
+	uintptr_t batchFound = 0;
+	while (NULL != hammer.queues[0]->dequeue()) {
+		batchFound += 1;
+	}
+	EXPECT_EQ((uintptr_t)BATCH_SIZE, batchFound);
+
+	drain->kill(env);
+	omrthread_monitor_destroy(hammer.monitor);
+	for (uintptr_t i = 0; i < SIZE_CLASS_QUEUES; i++) {
+		hammer.queues[i]->kill(env);
+	}
+	hammer.freeList->kill(env);
+	regionManager->destroyRegionTable(env);
+	regionManager->kill(env);
+	omrmem_free_memory(heapMemory);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, LockFreeRegionQueueTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_config.xml"));
@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Marks a wide object graph with and without the prefetching scan loop (markPrefetchDepth). Checks that
+ * both collects scan the same objects and bytes, that every object of the live trees is marked and that
+ * no object of the garbage trees is.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "MarkingScheme.hpp"
+#include "ParallelGlobalGC.hpp"
+
+#define MARK_PREFETCH_TEST_DEPTH 8
+#define MARK_PREFETCH_TEST_LIVE_SIZE (1024 * 1024)
+#define MARK_PREFETCH_TEST_GARBAGE_SIZE (512 * 1024)
+#define MARK_PREFETCH_TEST_OBJECT_SIZE 256
+#define MARK_PREFETCH_TEST_BREADTH 16
+#define MARK_PREFETCH_TEST_NAME_LENGTH 32
+#define MARK_PREFETCH_TEST_MAX_OBJECTS (MARK_PREFETCH_TEST_LIVE_SIZE / MARK_PREFETCH_TEST_OBJECT_SIZE)
+
+class MarkPrefetchTest : public GCConfigTest
+{
+public:
+	/**
+	 * Find the objects of the tree created by createFixedSizeTree() with the given prefix.
+	 * @return the number of objects found, at most maxObjects
+	 */
+	uintptr_t
+	findTree(const char *namePrefix, omrobjectptr_t *objects, uintptr_t maxObjects)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		char name[MARK_PREFETCH_TEST_NAME_LENGTH];
+		uintptr_t objectCount = 0;
+		for (int32_t depth = 0; objectCount < maxObjects; depth++) {
+			int32_t nth = 0;
+			for (; objectCount < maxObjects; nth++) {
+				omrstr_printf(name, sizeof(name), "%s_%d_%d", namePrefix, depth, nth);
+				ObjectEntry *entry = find(name);
+				if (NULL == entry) {
+					break;
+				}
+				objects[objectCount] = entry->objPtr;
+				objectCount += 1;
+			}
+			if (0 == nth) {
+				break;
+			}
+		}
+		return objectCount;
+	}
+};
+
+TEST_P(MarkPrefetchTest, markSameAsWithoutPrefetch)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_MarkingScheme *markingScheme = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getMarkingScheme();
+	MM_MarkStats *markStats = &extensions->globalGCStats.markStats;
+	ASSERT_EQ((uintptr_t)MARK_PREFETCH_TEST_DEPTH, extensions->markPrefetchDepth);
+
+	ObjectEntry *rootEntry = NULL;
+	ASSERT_EQ(0, createFixedSizeTree(&rootEntry, "prefetchLive", ROOT, MARK_PREFETCH_TEST_LIVE_SIZE, MARK_PREFETCH_TEST_OBJECT_SIZE, MARK_PREFETCH_TEST_BREADTH));
+
+	omrobjectptr_t live[MARK_PREFETCH_TEST_MAX_OBJECTS];
+	uintptr_t liveCount = findTree("prefetchLive", live, MARK_PREFETCH_TEST_MAX_OBJECTS);
+	ASSERT_LT((uintptr_t)MARK_PREFETCH_TEST_BREADTH, liveCount);
+
+	omrobjectptr_t garbage[MARK_PREFETCH_TEST_MAX_OBJECTS];
+	uintptr_t objectsScanned[2];
+	uintptr_t bytesScanned[2];
+	uintptr_t prefetchDepths[2] = { 0, MARK_PREFETCH_TEST_DEPTH };
+	char garbageName[MARK_PREFETCH_TEST_NAME_LENGTH];
+	for (uintptr_t i = 0; i < 2; i++) {
+		extensions->markPrefetchDepth = prefetchDepths[i];
+		omrstr_printf(garbageName, sizeof(garbageName), "prefetchGarbage%d", (int32_t)i);
+		ASSERT_EQ(0, createFixedSizeTree(&rootEntry, garbageName, GARBAGE_ROOT, MARK_PREFETCH_TEST_GARBAGE_SIZE, MARK_PREFETCH_TEST_OBJECT_SIZE, MARK_PREFETCH_TEST_BREADTH));
+		ASSERT_EQ(0, removeObjectFromRootTable(rootEntry->name));
+		uintptr_t garbageCount = findTree(garbageName, garbage, MARK_PREFETCH_TEST_MAX_OBJECTS);
+		ASSERT_LT((uintptr_t)MARK_PREFETCH_TEST_BREADTH, garbageCount);
+
+		ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+		objectsScanned[i] = markStats->_objectsScanned;
+		bytesScanned[i] = markStats->_bytesScanned;
+		EXPECT_LE(liveCount, objectsScanned[i]) << "prefetch depth " << prefetchDepths[i];
+
+		/* the mark map of the latest collect is still intact */
+		for (uintptr_t j = 0; j < liveCount; j++) {
+			EXPECT_TRUE(markingScheme->isMarked(live[j])) << "live object " << j << " with prefetch depth " << prefetchDepths[i];
+		}
+		for (uintptr_t j = 0; j < garbageCount; j++) {
+			EXPECT_FALSE(markingScheme->isMarked(garbage[j])) << "garbage object " << j << " with prefetch depth " << prefetchDepths[i];
+		}
+	}
+
+	EXPECT_EQ(objectsScanned[0], objectsScanned[1]);
+	EXPECT_EQ(bytesScanned[0], bytesScanned[1]);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, MarkPrefetchTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_markprefetch_config.xml"));
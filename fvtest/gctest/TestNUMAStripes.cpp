@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Stripes a fixed size heap over 2 simulated NUMA nodes. After a global collect, checks that free list i
+ * only holds free memory of node i's heap stripe, so that the free entry which runs over the stripe
+ * boundary was split there, and that new threads refill their first TLH from their own node's stripe.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+#include "omrthread.h"
+
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "MemoryPoolSplitAddressOrderedListBase.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+#include "NUMAManager.hpp"
+#include "ObjectAllocationModel.hpp"
+
+#define NUMA_TEST_NODES 2
+#define NUMA_TEST_LIVE_ROUNDS 4
+#define NUMA_TEST_LIVE_SIZE (32 * 1024)
+#define NUMA_TEST_OBJECT_SIZE 64
+#define NUMA_TEST_BREADTH 4
+#define NUMA_TEST_ALLOCATING_THREADS (2 * NUMA_TEST_NODES)
+#define NUMA_TEST_NAME_LENGTH 32
+
+class NUMAStripesTest : public GCConfigTest
+{
+};
+
+typedef struct NodeLocalAllocation {
+	OMR_VM *omrVM;
+	omrthread_monitor_t monitor;
+	bool done;
+	uintptr_t nodeIndex;
+	omrobjectptr_t object;
+} NodeLocalAllocation;
+
+/**
+ * Attach a new mutator thread, allocate one object from its first TLH and detach again.
+ */
+static int J9THREAD_PROC
+allocateFromNewThread(void *arg)
+{
+	NodeLocalAllocation *allocation = (NodeLocalAllocation *)arg;
+	OMR_VMThread *omrVMThread = NULL;
+
+	if (OMR_ERROR_NONE == OMR_Thread_Init(allocation->omrVM, NULL, &omrVMThread, "NUMAStripesTestThread")) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		allocation->nodeIndex = env->getNumaNodeIndex();
+		MM_ObjectAllocationModel allocationModel(env, NUMA_TEST_OBJECT_SIZE, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+		allocation->object = OMR_GC_AllocateObject(omrVMThread, &allocationModel);
+		OMR_Thread_Free(omrVMThread);
+	}
+
+	omrthread_monitor_enter(allocation->monitor);
+	allocation->done = true;
+	omrthread_monitor_notify_all(allocation->monitor);
+	omrthread_monitor_exit(allocation->monitor);
+	return 0;
+}
+
+TEST_P(NUMAStripesTest, nodeLocalFreeLists)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_NUMAManager *numaManager = &extensions->_numaManager;
+	ASSERT_TRUE(extensions->numaAffinity);
+	ASSERT_EQ((uintptr_t)NUMA_TEST_NODES, numaManager->getAffinityLeaderCount());
+	ASSERT_TRUE(numaManager->isHeapStriped());
+	MM_MemoryPoolSplitAddressOrderedListBase *memoryPool = (MM_MemoryPoolSplitAddressOrderedListBase *)extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool();
+	ASSERT_EQ((uintptr_t)NUMA_TEST_NODES, memoryPool->getHeapFreeListCount());
+
+	/* a little live data at the bottom of node 0's stripe leaves a free entry running over the stripe boundary */
+	ASSERT_EQ((uintptr_t)0, env->getNumaNodeIndex());
+	char name[NUMA_TEST_NAME_LENGTH];
+	for (int32_t round = 0; round < NUMA_TEST_LIVE_ROUNDS; round++) {
+		ObjectEntry *rootEntry = NULL;
+		omrstr_printf(name, sizeof(name), "numaLive%d", round);
+		ASSERT_EQ(0, createFixedSizeTree(&rootEntry, name, ROOT, NUMA_TEST_LIVE_SIZE, NUMA_TEST_OBJECT_SIZE, NUMA_TEST_BREADTH));
+	}
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+
+	/* each list only holds the free memory of its own node's stripe */
+	bool const compressed = env->compressObjectReferences();
+	uintptr_t freeBytes = 0;
+	uintptr_t freeEntryCount = 0;
+	for (uintptr_t i = 0; i < NUMA_TEST_NODES; i++) {
+		MM_HeapLinkedFreeHeader *freeEntry = memoryPool->getFirstFreeEntry(i);
+		ASSERT_TRUE(NULL != freeEntry) << "no free memory on the list of node " << i;
+		if (0 != i) {
+			/* the entry which ran over the boundary was split there */
+			EXPECT_EQ(numaManager->getHeapStripeBase(i), (void *)freeEntry) << "node " << i;
+		}
+		for (; NULL != freeEntry; freeEntry = freeEntry->getNext(compressed)) {
+			void *lastByte = (void *)((uintptr_t)freeEntry->afterEnd() - 1);
+			EXPECT_EQ(i, numaManager->getHeapStripeIndex(freeEntry)) << "free entry " << (void *)freeEntry << " on the list of node " << i;
+			EXPECT_EQ(i, numaManager->getHeapStripeIndex(lastByte)) << "free entry " << (void *)freeEntry << " on the list of node " << i;
+			freeBytes += freeEntry->getSize();
+			freeEntryCount += 1;
+		}
+	}
+	EXPECT_EQ(memoryPool->getActualFreeMemorySize(), freeBytes);
+	EXPECT_EQ(memoryPool->getActualFreeEntryCount(), freeEntryCount);
+
+	/* new threads are spread over the nodes and refill their first TLH from their node's stripe */
+	uintptr_t threadsOnNode[NUMA_TEST_NODES];
+	memset(threadsOnNode, 0, sizeof(threadsOnNode));
+	NodeLocalAllocation allocation;
+	allocation.omrVM = exampleVM->_omrVM;
+	ASSERT_EQ(0, (int32_t)omrthread_monitor_init_with_name(&allocation.monitor, 0, "NUMAStripesTest"));
+	for (uintptr_t i = 0; i < NUMA_TEST_ALLOCATING_THREADS; i++) {
+		allocation.done = false;
+		allocation.nodeIndex = UDATA_MAX;
+		allocation.object = NULL;
+		omrthread_t thread = NULL;
+		ASSERT_EQ(0, (int32_t)omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, allocateFromNewThread, &allocation));
+		omrthread_monitor_enter(allocation.monitor);
+		while (!allocation.done) {
+			omrthread_monitor_wait(allocation.monitor);
+		}
+		omrthread_monitor_exit(allocation.monitor);
+
+		ASSERT_GT((uintptr_t)NUMA_TEST_NODES, allocation.nodeIndex);
+		ASSERT_TRUE(NULL != allocation.object);
+		EXPECT_EQ(allocation.nodeIndex, numaManager->getHeapStripeIndex(allocation.object)) << "thread " << i;
+		threadsOnNode[allocation.nodeIndex] += 1;
+	}
+	omrthread_monitor_destroy(allocation.monitor);
+	for (uintptr_t i = 0; i < NUMA_TEST_NODES; i++) {
+		EXPECT_LT((uintptr_t)0, threadsOnNode[i]) << "no thread allocated on node " << i;
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, NUMAStripesTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_numa_stripes_config.xml"));
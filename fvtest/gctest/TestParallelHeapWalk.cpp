@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Walks the heap with MM_ParallelHeapWalker::allObjectsDoBatched and checks that the merged per-thread
+ * census matches a single threaded walk, before and after a global collect (when the mark map lets
+ * regions be split into chunks) and after allocating past the mark. Without a forced gc thread count the
+ * walk runs on fewer threads than the dispatcher started, taken from whichever workers are waiting.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "HeapWalker.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+
+#define WALK_TEST_OBJECT_COUNT 2000
+#define WALK_TEST_UNFORCED_CPUS 2
+#define WALK_TEST_UNFORCED_WALKS 50
+#define WALK_TEST_UNFORCED_TREE_SIZE (2 * 1024 * 1024)
+#define WALK_TEST_UNFORCED_OBJECT_SIZE 64
+#define WALK_TEST_UNFORCED_BREADTH 4
+
+class ParallelHeapWalkTest : public GCConfigTest
+{
+};
+
+class ParallelHeapWalkUnforcedTest : public GCConfigTest
+{
+};
+
+typedef struct HeapCensus {
+	uintptr_t objects;
+	uintptr_t bytes;
+	uintptr_t threads; /**< number of thread accumulators merged */
+	MM_GCExtensionsBase *extensions;
+} HeapCensus;
+
+static void
+countObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapCensus *census = (HeapCensus *)userData;
+	census->objects += 1;
+	census->bytes += census->extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+}
+
+static void
+countObjectBatch(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t *objects, uintptr_t count, void *threadData, void *userData)
+{
+	HeapCensus *threadCensus = (HeapCensus *)threadData;
+	MM_GCExtensionsBase *extensions = ((HeapCensus *)userData)->extensions;
+	for (uintptr_t i = 0; i < count; i++) {
+		threadCensus->objects += 1;
+		threadCensus->bytes += extensions->objectModel.getConsumedSizeInBytesWithHeader(objects[i]);
+	}
+}
+
+static void
+mergeCensus(OMR_VMThread *omrVMThread, void *threadData, void *userData)
+{
+	HeapCensus *threadCensus = (HeapCensus *)threadData;
+	HeapCensus *census = (HeapCensus *)userData;
+	census->objects += threadCensus->objects;
+	census->bytes += threadCensus->bytes;
+	census->threads += 1;
+}
+
+static void
+compareWalks(MM_EnvironmentBase *env, const char *when)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getHeapWalker();
+
+	HeapCensus expected = {0, 0, 0, extensions};
+	heapWalker->MM_HeapWalker::allObjectsDo(env, countObject, &expected, 0, false, false);
+
+	HeapCensus census = {0, 0, 0, extensions};
+	ASSERT_TRUE(heapWalker->allObjectsDoBatched(env, countObjectBatch, mergeCensus, sizeof(HeapCensus), &census, 0, false)) << when;
+	EXPECT_LT((uintptr_t)0, expected.objects) << when;
+	EXPECT_EQ(expected.objects, census.objects) << when;
+	EXPECT_EQ(expected.bytes, census.bytes) << when;
+	/* one accumulator is merged for every thread which took part in the walk */
+	EXPECT_EQ(extensions->dispatcher->activeThreadCount(), census.threads) << when;
+}
+
+TEST_P(ParallelHeapWalkTest, census)
+{
+	for (int32_t i = 0; i < WALK_TEST_OBJECT_COUNT; i++) {
+		uintptr_t size = (1 + (i % 37)) * sizeof(fomrobject_t) + sizeof(uintptr_t);
+		ASSERT_TRUE(NULL != createObject("walkA", ROOT, 0, i, size));
+	}
+	compareWalks(env, "before collect");
+
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, 0));
+	for (int32_t i = 0; i < WALK_TEST_OBJECT_COUNT; i++) {
+		uintptr_t size = (1 + (i % 53)) * sizeof(fomrobject_t) + sizeof(uintptr_t);
+		ASSERT_TRUE(NULL != createObject("walkB", ROOT, 0, i, size));
+	}
+	compareWalks(env, "after collect");
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, ParallelHeapWalkTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_heapwalk_config.xml"));
+
+TEST_P(ParallelHeapWalkUnforcedTest, census)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_EQ((uintptr_t)4, extensions->dispatcher->threadCountMaximum());
+
+	ObjectEntry *rootEntry = NULL;
+	ASSERT_EQ(0, createFixedSizeTree(&rootEntry, "walkC", ROOT, WALK_TEST_UNFORCED_TREE_SIZE, WALK_TEST_UNFORCED_OBJECT_SIZE, WALK_TEST_UNFORCED_BREADTH));
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, 0));
+
+	/* the dispatcher now sizes each task by the available cpus, the workers which take part vary from walk to walk */
+	extensions->gcThreadCountForced = false;
+	omrsysinfo_set_number_user_specified_CPUs(WALK_TEST_UNFORCED_CPUS);
+	for (int32_t i = 0; i < WALK_TEST_UNFORCED_WALKS; i++) {
+		compareWalks(env, "unforced thread count");
+		EXPECT_EQ((uintptr_t)WALK_TEST_UNFORCED_CPUS, extensions->dispatcher->activeThreadCount());
+	}
+	omrsysinfo_set_number_user_specified_CPUs(0);
+	extensions->gcThreadCountForced = true;
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, ParallelHeapWalkUnforcedTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_heapwalk_unforced_config.xml"));
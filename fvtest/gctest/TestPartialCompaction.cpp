@@ -0,0 +1,217 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Interleaves long lived objects with garbage over most of a fixed size heap, so that after a global
+ * collect the free memory is spread over small holes, then allocates an object larger than any hole.
+ * The collect for that allocation must compact, and with -Xgc:partialCompaction only a window of the
+ * most fragmented sub areas is evacuated. The live objects reference each other in a ring, so references
+ * from the sub areas that were only fixed up into the evacuated ones, and back, are all checked.
+ * A second test lets the largest free entry shrink collection after collection, with no allocation failing,
+ * until the fragmentation forecast projects it below the large allocation size and a system collect
+ * compacts the most fragmented sub areas ahead of the failure.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "HeapWalker.hpp"
+#include "ParallelGlobalGC.hpp"
+
+#define PARTIAL_COMPACTION_TEST_NAME_LENGTH 64
+#define PARTIAL_COMPACTION_TEST_PAIRS 7000
+#define PARTIAL_COMPACTION_TEST_LIVE_SIZE 1024
+#define PARTIAL_COMPACTION_TEST_GARBAGE_SIZE 1024
+#define PARTIAL_COMPACTION_TEST_LARGE_SIZE (3 * 1024 * 1024)
+#define FORECAST_TEST_LIVE_SIZE (256 * 1024)
+#define FORECAST_TEST_GARBAGE_SIZE (192 * 1024)
+#define FORECAST_TEST_PAIRS_PER_ROUND 2
+#define FORECAST_TEST_MAX_ROUNDS 16
+#define FORECAST_TEST_HORIZON 16
+
+class PartialCompactionTest : public GCConfigTest
+{
+protected:
+	void verifyRing(const char *when);
+	uintptr_t countHeapObjects();
+};
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+static void
+countObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	*(uintptr_t *)userData += 1;
+}
+
+void
+PartialCompactionTest::verifyRing(const char *when)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	char name[PARTIAL_COMPACTION_TEST_NAME_LENGTH];
+
+	/* each live object refers to the current address of the next one, as recorded in the object table */
+	for (int32_t i = 0; i < PARTIAL_COMPACTION_TEST_PAIRS; i++) {
+		omrstr_printf(name, sizeof(name), "partialLive_0_%d", i);
+		ObjectEntry *entry = find(name);
+		ASSERT_TRUE(NULL != entry) << name << " " << when;
+		omrstr_printf(name, sizeof(name), "partialLive_0_%d", (i + 1) % PARTIAL_COMPACTION_TEST_PAIRS);
+		ObjectEntry *nextEntry = find(name);
+		ASSERT_TRUE(NULL != nextEntry) << name << " " << when;
+		GC_SlotObject slotObject(exampleVM->_omrVM, (fomrobject_t *)entry->objPtr + 1);
+		ASSERT_EQ(nextEntry->objPtr, slotObject.readReferenceFromSlot()) << name << " " << when;
+		ASSERT_EQ((uintptr_t)PARTIAL_COMPACTION_TEST_LIVE_SIZE, extensions->objectModel.getSizeInBytesWithHeader(nextEntry->objPtr)) << name << " " << when;
+	}
+}
+
+uintptr_t
+PartialCompactionTest::countHeapObjects()
+{
+	uintptr_t objectCount = 0;
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)env->getExtensions()->getGlobalCollector();
+	globalCollector->getHeapWalker()->allObjectsDo(env, countObject, &objectCount, 0, false, false);
+	return objectCount;
+}
+
+TEST_P(PartialCompactionTest, evacuateFragmentedSubAreas)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_MemoryPool *memoryPool = extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool();
+	char name[PARTIAL_COMPACTION_TEST_NAME_LENGTH];
+
+	for (int32_t i = 0; i < PARTIAL_COMPACTION_TEST_PAIRS; i++) {
+		ObjectEntry *liveEntry = createObject("partialLive", ROOT, 0, i, PARTIAL_COMPACTION_TEST_LIVE_SIZE);
+		ASSERT_TRUE(NULL != liveEntry);
+		RootEntry rootEntry;
+		rootEntry.name = liveEntry->name;
+		rootEntry.rootPtr = liveEntry->objPtr;
+		ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+		ASSERT_TRUE(NULL != createObject("partialGarbage", GARBAGE_ROOT, 0, i, PARTIAL_COMPACTION_TEST_GARBAGE_SIZE));
+	}
+	for (int32_t i = 0; i < PARTIAL_COMPACTION_TEST_PAIRS; i++) {
+		omrstr_printf(name, sizeof(name), "partialLive_0_%d", i);
+		ObjectEntry *entry = find(name);
+		omrstr_printf(name, sizeof(name), "partialLive_0_%d", (i + 1) % PARTIAL_COMPACTION_TEST_PAIRS);
+		ObjectEntry *nextEntry = find(name);
+		ASSERT_EQ(0, attachChildEntry(entry, nextEntry));
+	}
+
+	/* leave the garbage behind as holes no larger than a garbage object */
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	verifyRing("after system collect");
+	ASSERT_GT((uintptr_t)PARTIAL_COMPACTION_TEST_LARGE_SIZE, memoryPool->getLargestFreeEntry()) << "heap not fragmented";
+	ASSERT_LT((uintptr_t)PARTIAL_COMPACTION_TEST_LARGE_SIZE, memoryPool->getActualFreeMemorySize());
+
+	uintptr_t gcCount = extensions->globalGCStats.gcCount;
+	ObjectEntry *largeEntry = createObject("partialLarge", ROOT, 0, 0, PARTIAL_COMPACTION_TEST_LARGE_SIZE);
+	ASSERT_TRUE(NULL != largeEntry);
+	RootEntry rootEntry;
+	rootEntry.name = largeEntry->name;
+	rootEntry.rootPtr = largeEntry->objPtr;
+	ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+
+	/* a single collect compacted just enough of the heap to satisfy the allocation */
+	ASSERT_EQ(gcCount + 1, extensions->globalGCStats.gcCount);
+	MM_CompactStats *compactStats = &extensions->globalGCStats.compactStats;
+	EXPECT_EQ(COMPACT_LARGE, compactStats->_compactReason);
+	EXPECT_LT((uintptr_t)0, compactStats->_partialCompactBytes);
+	EXPECT_GT(extensions->heap->getActiveMemorySize(), compactStats->_partialCompactBytes);
+	EXPECT_LT((uintptr_t)0, compactStats->_movedBytes);
+
+	verifyRing("after partial compaction");
+	EXPECT_EQ((uintptr_t)(PARTIAL_COMPACTION_TEST_PAIRS + 1), hashTableGetCount(exampleVM->objectTable));
+	EXPECT_EQ(hashTableGetCount(exampleVM->objectTable), countHeapObjects());
+
+	/* objects that were only fixed up must still be found by a full collect */
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	verifyRing("after global collect");
+	EXPECT_EQ(hashTableGetCount(exampleVM->objectTable), countHeapObjects());
+}
+
+TEST_P(PartialCompactionTest, compactAheadOfForecastFailure)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_MemoryPool *memoryPool = extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool();
+	MM_CompactStats *compactStats = &extensions->globalGCStats.compactStats;
+	char name[PARTIAL_COMPACTION_TEST_NAME_LENGTH];
+	ASSERT_TRUE(extensions->processLargeAllocateStats);
+
+	/* project far enough ahead that the forecast triggers while most of the heap is still free */
+	extensions->fragmentationForecastHorizon = FORECAST_TEST_HORIZON;
+
+	/* each round leaves live objects in the largest free entry, separated by holes too small to take the next
+	 * round's live objects, so every collect samples a smaller largest free entry
+	 */
+	int32_t liveCount = 0;
+	int32_t round = 0;
+	uintptr_t gcCount = extensions->globalGCStats.gcCount;
+	for (; round < FORECAST_TEST_MAX_ROUNDS; round++) {
+		for (int32_t i = 0; i < FORECAST_TEST_PAIRS_PER_ROUND; i++) {
+			ObjectEntry *liveEntry = createObject("forecastLive", ROOT, round, i, FORECAST_TEST_LIVE_SIZE);
+			ASSERT_TRUE(NULL != liveEntry) << "round " << round;
+			RootEntry rootEntry;
+			rootEntry.name = liveEntry->name;
+			rootEntry.rootPtr = liveEntry->objPtr;
+			ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+			liveCount += 1;
+			ASSERT_TRUE(NULL != createObject("forecastGarbage", GARBAGE_ROOT, round, i, FORECAST_TEST_GARBAGE_SIZE)) << "round " << round;
+		}
+		/* the allocations never fail, only the system collects run */
+		ASSERT_EQ(gcCount, extensions->globalGCStats.gcCount) << "round " << round;
+
+		/* an explicit collect is aggressive and compacts on its own */
+		uintptr_t largestFreeEntry = memoryPool->getLargestFreeEntry();
+		ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+		gcCount += 1;
+		if (COMPACT_FRAGMENTATION_FORECAST == compactStats->_compactReason) {
+			/* compacted while the next live object would still have fit */
+			EXPECT_LE((uintptr_t)FORECAST_TEST_LIVE_SIZE, largestFreeEntry);
+			break;
+		}
+		EXPECT_EQ(COMPACT_NONE, compactStats->_compactReason) << "round " << round;
+	}
+
+	ASSERT_GT(FORECAST_TEST_MAX_ROUNDS, round) << "the fragmentation forecast never called for a compaction";
+	EXPECT_LT(1, round);
+	EXPECT_LT((uintptr_t)0, compactStats->_partialCompactBytes);
+	EXPECT_GT(extensions->heap->getActiveMemorySize(), compactStats->_partialCompactBytes);
+	EXPECT_LE((uintptr_t)FORECAST_TEST_LIVE_SIZE, memoryPool->getLargestFreeEntry());
+
+	/* the evacuated live objects are intact at their new addresses */
+	for (int32_t r = 0; r <= round; r++) {
+		for (int32_t i = 0; i < FORECAST_TEST_PAIRS_PER_ROUND; i++) {
+			omrstr_printf(name, sizeof(name), "forecastLive_%d_%d", r, i);
+			ObjectEntry *entry = find(name);
+			ASSERT_TRUE(NULL != entry) << name;
+			EXPECT_EQ((uintptr_t)FORECAST_TEST_LIVE_SIZE, extensions->objectModel.getSizeInBytesWithHeader(entry->objPtr)) << name;
+		}
+	}
+	EXPECT_EQ((uintptr_t)liveCount, hashTableGetCount(exampleVM->objectTable));
+	EXPECT_EQ(hashTableGetCount(exampleVM->objectTable), countHeapObjects());
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, PartialCompactionTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_partialcompact_config.xml"));
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
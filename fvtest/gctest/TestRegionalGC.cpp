@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Allocates long lived parents and, in later rounds, children that are only referenced from those
+ * parents, among enough garbage to run many partial pauses of the regional collector. Each parent has
+ * been copied out of the eden by the time its children are attached, so the children only survive if
+ * the remembered set kept by the write barrier leads the partial pauses to the parent slots. Every
+ * slot and object table entry is checked after the partial pauses and again after a global pause.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "HeapWalker.hpp"
+#include "RegionalGC.hpp"
+
+#define REGIONAL_TEST_NAME_LENGTH 64
+#define REGIONAL_TEST_PARENTS 32
+#define REGIONAL_TEST_ROUNDS 16
+#define REGIONAL_TEST_GARBAGE_PER_ROUND 4096
+#define REGIONAL_TEST_PARENT_SIZE (REGIONAL_TEST_ROUNDS * sizeof(fomrobject_t) + sizeof(uintptr_t))
+#define REGIONAL_TEST_CHILD_SIZE 48
+#define REGIONAL_TEST_GARBAGE_SIZE 512
+
+class RegionalGCTest : public GCConfigTest
+{
+protected:
+	void verifyChildren(const char *when);
+	uintptr_t countHeapObjects();
+};
+
+#if defined(OMR_GC_REGIONAL)
+static void
+countObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	*(uintptr_t *)userData += 1;
+}
+
+void
+RegionalGCTest::verifyChildren(const char *when)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	char name[REGIONAL_TEST_NAME_LENGTH];
+
+	/* a child slot holds the current address of the child, as recorded in the object table */
+	for (int32_t i = 0; i < REGIONAL_TEST_PARENTS; i++) {
+		omrstr_printf(name, sizeof(name), "regionalParent_0_%d", i);
+		ObjectEntry *parentEntry = find(name);
+		ASSERT_TRUE(NULL != parentEntry) << name << " " << when;
+		fomrobject_t *firstSlot = (fomrobject_t *)parentEntry->objPtr + 1;
+		for (int32_t round = 0; round < REGIONAL_TEST_ROUNDS; round++) {
+			omrstr_printf(name, sizeof(name), "regionalChild_%d_%d", round, i);
+			ObjectEntry *childEntry = find(name);
+			ASSERT_TRUE(NULL != childEntry) << name << " " << when;
+			GC_SlotObject slotObject(exampleVM->_omrVM, firstSlot + round);
+			ASSERT_EQ(childEntry->objPtr, slotObject.readReferenceFromSlot()) << name << " " << when;
+			ASSERT_EQ((uintptr_t)REGIONAL_TEST_CHILD_SIZE, extensions->objectModel.getSizeInBytesWithHeader(childEntry->objPtr)) << name << " " << when;
+		}
+	}
+}
+
+uintptr_t
+RegionalGCTest::countHeapObjects()
+{
+	uintptr_t objectCount = 0;
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)env->getExtensions()->getGlobalCollector();
+	globalCollector->getHeapWalker()->allObjectsDo(env, countObject, &objectCount, 0, false, false);
+	return objectCount;
+}
+
+TEST_P(RegionalGCTest, rememberedChildren)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_RegionalGC *regionalGC = (MM_RegionalGC *)env->getExtensions()->getGlobalCollector();
+	char name[REGIONAL_TEST_NAME_LENGTH];
+
+	for (int32_t i = 0; i < REGIONAL_TEST_PARENTS; i++) {
+		ObjectEntry *parentEntry = createObject("regionalParent", ROOT, 0, i, REGIONAL_TEST_PARENT_SIZE);
+		ASSERT_TRUE(NULL != parentEntry);
+		RootEntry rootEntry;
+		rootEntry.name = parentEntry->name;
+		rootEntry.rootPtr = parentEntry->objPtr;
+		ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+	}
+	/* move the parents out of the eden, so the children attached from here on are referenced from old regions */
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, 0));
+	uintptr_t partialCollectCount = regionalGC->getPartialCollectCount();
+	ASSERT_LT((uintptr_t)0, partialCollectCount);
+
+	for (int32_t round = 0; round < REGIONAL_TEST_ROUNDS; round++) {
+		for (int32_t i = 0; i < REGIONAL_TEST_PARENTS; i++) {
+			ObjectEntry *childEntry = createObject("regionalChild", NORMAL, round, i, REGIONAL_TEST_CHILD_SIZE);
+			ASSERT_TRUE(NULL != childEntry);
+			omrstr_printf(name, sizeof(name), "regionalParent_0_%d", i);
+			ObjectEntry *parentEntry = find(name);
+			ASSERT_TRUE(NULL != parentEntry);
+			ASSERT_EQ(0, attachChildEntry(parentEntry, childEntry));
+		}
+		for (int32_t i = 0; i < REGIONAL_TEST_GARBAGE_PER_ROUND; i++) {
+			ASSERT_TRUE(NULL != createObject("regionalGarbage", GARBAGE_ROOT, round, i, REGIONAL_TEST_GARBAGE_SIZE));
+		}
+	}
+	ASSERT_LT(partialCollectCount + (REGIONAL_TEST_ROUNDS / 2), regionalGC->getPartialCollectCount()) << "too few partial pauses";
+	verifyChildren("after partial pauses");
+	/* floating garbage in old regions keeps its object table entries until a global pause */
+	EXPECT_LE(hashTableGetCount(exampleVM->objectTable), countHeapObjects());
+
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	EXPECT_LT((uintptr_t)0, regionalGC->getGlobalCollectCount());
+	verifyChildren("after global pause");
+	EXPECT_EQ((uintptr_t)(REGIONAL_TEST_PARENTS * (REGIONAL_TEST_ROUNDS + 1)), hashTableGetCount(exampleVM->objectTable));
+	EXPECT_EQ(hashTableGetCount(exampleVM->objectTable), countHeapObjects());
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, RegionalGCTest,
+	::testing::Values("fvtest/gctest/configuration/regional_GC_config.xml"));
+#endif /* defined(OMR_GC_REGIONAL) */
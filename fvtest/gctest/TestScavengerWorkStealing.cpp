@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Runs scavenges with work stealing on a pool of 4 GC threads whose thread count is not forced. With the
+ * target CPU count set to 2, each scavenge is dispatched to the first 2 pool threads to wake up, which need
+ * not have worker IDs 0 and 1. Checks that scan caches are still stolen in these scavenges, and (through
+ * the assertions in the scavenger) that the forced back outs find every deque drained.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "ParallelDispatcher.hpp"
+
+#define WORK_STEALING_TEST_ROUNDS 40
+#define WORK_STEALING_TEST_LIVE_ROUNDS 4
+#define WORK_STEALING_TEST_LIVE_SIZE (64 * 1024)
+#define WORK_STEALING_TEST_GARBAGE_SIZE (192 * 1024)
+#define WORK_STEALING_TEST_OBJECT_SIZE 64
+#define WORK_STEALING_TEST_BREADTH 4
+#define WORK_STEALING_TEST_NAME_LENGTH 32
+
+class ScavengerWorkStealingTest : public GCConfigTest
+{
+};
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+TEST_P(ScavengerWorkStealingTest, stealWithPartialThreadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_ParallelDispatcher *dispatcher = extensions->dispatcher;
+	ASSERT_TRUE(extensions->scavengerWorkStealing);
+	ASSERT_EQ((uintptr_t)4, dispatcher->threadCountMaximum());
+
+	/* keep the pool, but let the dispatcher size each scavenge from the (simulated) CPU count */
+	extensions->gcThreadCountForced = false;
+	extensions->adaptiveGCThreading = false;
+	omrsysinfo_set_number_user_specified_CPUs(2);
+
+	uintptr_t gcCount = extensions->scavengerStats._gcCount;
+	uintptr_t scavenges = 0;
+	uintptr_t steals = 0;
+	char prefix[WORK_STEALING_TEST_NAME_LENGTH];
+	for (int32_t round = 0; round < WORK_STEALING_TEST_ROUNDS; round++) {
+		ObjectEntry *rootEntry = NULL;
+		omrstr_printf(prefix, sizeof(prefix), "stealLive%d", round);
+		ASSERT_EQ(0, createFixedSizeTree(&rootEntry, prefix, ROOT, WORK_STEALING_TEST_LIVE_SIZE, WORK_STEALING_TEST_OBJECT_SIZE, WORK_STEALING_TEST_BREADTH));
+		omrstr_printf(prefix, sizeof(prefix), "stealGarbage%d", round);
+		ASSERT_EQ(0, createFixedSizeTree(&rootEntry, prefix, GARBAGE_ROOT, WORK_STEALING_TEST_GARBAGE_SIZE, WORK_STEALING_TEST_OBJECT_SIZE, WORK_STEALING_TEST_BREADTH));
+		ASSERT_EQ(0, removeObjectFromRootTable(rootEntry->name));
+		if (WORK_STEALING_TEST_LIVE_ROUNDS <= round) {
+			/* only the trees of the latest rounds stay live, and are copied by each scavenge */
+			omrstr_printf(prefix, sizeof(prefix), "stealLive%d_0_0", round - WORK_STEALING_TEST_LIVE_ROUNDS);
+			ASSERT_EQ(0, removeObjectFromRootTable(prefix));
+		}
+
+		if (gcCount != extensions->scavengerStats._gcCount) {
+			/* stats are those of the latest scavenge, which ran on activeThreadCount() threads */
+			gcCount = extensions->scavengerStats._gcCount;
+			scavenges += 1;
+			steals += extensions->scavengerStats._scanCacheStealCount;
+			ASSERT_EQ((uintptr_t)2, dispatcher->activeThreadCount());
+		}
+	}
+	omrsysinfo_set_number_user_specified_CPUs(0);
+
+	ASSERT_LT((uintptr_t)2, scavenges) << "too few scavenges";
+	EXPECT_LT((uintptr_t)0, steals);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, ScavengerWorkStealingTest,
+	::testing::Values("fvtest/gctest/configuration/scavenger_GC_workstealing_pool_config.xml"));
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
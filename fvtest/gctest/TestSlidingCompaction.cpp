@@ -0,0 +1,170 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Interleaves long lived objects with garbage over most of a fixed size heap, so that after a global
+ * collect the free memory is spread over small holes, then allocates an object larger than any hole.
+ * The collect for that allocation must compact, and with -Xgc:slidingCompaction it slides the live
+ * objects towards the start of their regions, forwarding references through the block summaries.
+ * The live objects reference each other in a ring, so every forwarded reference is checked, and they
+ * must keep their relative address order.
+ */
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "HeapWalker.hpp"
+#include "ParallelGlobalGC.hpp"
+
+#define SLIDING_COMPACTION_TEST_NAME_LENGTH 64
+#define SLIDING_COMPACTION_TEST_PAIRS 7000
+#define SLIDING_COMPACTION_TEST_LIVE_SIZE 1024
+#define SLIDING_COMPACTION_TEST_GARBAGE_SIZE 1024
+#define SLIDING_COMPACTION_TEST_LARGE_SIZE (3 * 1024 * 1024)
+
+class SlidingCompactionTest : public GCConfigTest
+{
+protected:
+	omrobjectptr_t liveObject(int32_t i);
+	void verifyRing(const char *when);
+	uintptr_t countHeapObjects();
+};
+
+#if defined(OMR_GC_MODRON_COMPACTION) && defined(OMR_ENV_DATA64) && !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+static void
+countObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	*(uintptr_t *)userData += 1;
+}
+
+omrobjectptr_t
+SlidingCompactionTest::liveObject(int32_t i)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	char name[SLIDING_COMPACTION_TEST_NAME_LENGTH];
+	omrstr_printf(name, sizeof(name), "slidingLive_0_%d", i);
+	ObjectEntry *entry = find(name);
+	return (NULL == entry) ? NULL : entry->objPtr;
+}
+
+void
+SlidingCompactionTest::verifyRing(const char *when)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* each live object refers to the current address of the next one, as recorded in the object table */
+	for (int32_t i = 0; i < SLIDING_COMPACTION_TEST_PAIRS; i++) {
+		omrobjectptr_t object = liveObject(i);
+		ASSERT_TRUE(NULL != object) << i << " " << when;
+		omrobjectptr_t nextObject = liveObject((i + 1) % SLIDING_COMPACTION_TEST_PAIRS);
+		ASSERT_TRUE(NULL != nextObject) << i << " " << when;
+		GC_SlotObject slotObject(exampleVM->_omrVM, (fomrobject_t *)object + 1);
+		ASSERT_EQ(nextObject, slotObject.readReferenceFromSlot()) << i << " " << when;
+		ASSERT_EQ((uintptr_t)SLIDING_COMPACTION_TEST_LIVE_SIZE, extensions->objectModel.getSizeInBytesWithHeader(nextObject)) << i << " " << when;
+	}
+}
+
+uintptr_t
+SlidingCompactionTest::countHeapObjects()
+{
+	uintptr_t objectCount = 0;
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)env->getExtensions()->getGlobalCollector();
+	globalCollector->getHeapWalker()->allObjectsDo(env, countObject, &objectCount, 0, false, false);
+	return objectCount;
+}
+
+TEST_P(SlidingCompactionTest, slideFragmentedHeap)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_MemoryPool *memoryPool = extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool();
+	ASSERT_TRUE(extensions->slidingCompaction);
+
+	for (int32_t i = 0; i < SLIDING_COMPACTION_TEST_PAIRS; i++) {
+		ObjectEntry *liveEntry = createObject("slidingLive", ROOT, 0, i, SLIDING_COMPACTION_TEST_LIVE_SIZE);
+		ASSERT_TRUE(NULL != liveEntry);
+		RootEntry rootEntry;
+		rootEntry.name = liveEntry->name;
+		rootEntry.rootPtr = liveEntry->objPtr;
+		ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+		ASSERT_TRUE(NULL != createObject("slidingGarbage", GARBAGE_ROOT, 0, i, SLIDING_COMPACTION_TEST_GARBAGE_SIZE));
+	}
+	for (int32_t i = 0; i < SLIDING_COMPACTION_TEST_PAIRS; i++) {
+		char name[SLIDING_COMPACTION_TEST_NAME_LENGTH];
+		omrstr_printf(name, sizeof(name), "slidingLive_0_%d", i);
+		ObjectEntry *entry = find(name);
+		omrstr_printf(name, sizeof(name), "slidingLive_0_%d", (i + 1) % SLIDING_COMPACTION_TEST_PAIRS);
+		ObjectEntry *nextEntry = find(name);
+		ASSERT_EQ(0, attachChildEntry(entry, nextEntry));
+	}
+
+	/* leave the garbage behind as holes no larger than a garbage object */
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	verifyRing("after system collect");
+	ASSERT_GT((uintptr_t)SLIDING_COMPACTION_TEST_LARGE_SIZE, memoryPool->getLargestFreeEntry()) << "heap not fragmented";
+	ASSERT_LT((uintptr_t)SLIDING_COMPACTION_TEST_LARGE_SIZE, memoryPool->getActualFreeMemorySize());
+
+	/* sliding never reorders objects, whichever order the allocator placed them in */
+	bool *ascending = (bool *)omrmem_allocate_memory(SLIDING_COMPACTION_TEST_PAIRS * sizeof(bool), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != ascending);
+	for (int32_t i = 0; i < (SLIDING_COMPACTION_TEST_PAIRS - 1); i++) {
+		ascending[i] = (liveObject(i) < liveObject(i + 1));
+	}
+
+	uintptr_t gcCount = extensions->globalGCStats.gcCount;
+	ObjectEntry *largeEntry = createObject("slidingLarge", ROOT, 0, 0, SLIDING_COMPACTION_TEST_LARGE_SIZE);
+	ASSERT_TRUE(NULL != largeEntry);
+	RootEntry rootEntry;
+	rootEntry.name = largeEntry->name;
+	rootEntry.rootPtr = largeEntry->objPtr;
+	ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+
+	/* a single collect slid the whole heap to satisfy the allocation */
+	ASSERT_EQ(gcCount + 1, extensions->globalGCStats.gcCount);
+	MM_CompactStats *compactStats = &extensions->globalGCStats.compactStats;
+	EXPECT_EQ(COMPACT_LARGE, compactStats->_compactReason);
+	EXPECT_TRUE(compactStats->_slidingCompaction);
+	EXPECT_EQ((uintptr_t)0, compactStats->_partialCompactBytes);
+	EXPECT_LT((uintptr_t)0, compactStats->_movedBytes);
+
+	verifyRing("after sliding compaction");
+	int32_t reordered = 0;
+	for (int32_t i = 0; i < (SLIDING_COMPACTION_TEST_PAIRS - 1); i++) {
+		if (ascending[i] != (liveObject(i) < liveObject(i + 1))) {
+			reordered += 1;
+		}
+	}
+	omrmem_free_memory(ascending);
+	EXPECT_EQ(0, reordered);
+	EXPECT_EQ((uintptr_t)(SLIDING_COMPACTION_TEST_PAIRS + 1), hashTableGetCount(exampleVM->objectTable));
+	EXPECT_EQ(hashTableGetCount(exampleVM->objectTable), countHeapObjects());
+
+	/* slid objects must still be found by a full collect */
+	ASSERT_EQ(0, (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	verifyRing("after global collect");
+	EXPECT_EQ(hashTableGetCount(exampleVM->objectTable), countHeapObjects());
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, SlidingCompactionTest,
+	::testing::Values("fvtest/gctest/configuration/global_GC_slidingcompact_config.xml"));
+#endif /* defined(OMR_GC_MODRON_COMPACTION) && defined(OMR_ENV_DATA64) && !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
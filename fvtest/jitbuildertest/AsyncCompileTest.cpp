@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+#include "AtomicSupport.hpp"
+
+#define ASYNC_COMPILE_TEST_METHODS 8
+
+typedef int32_t (*AsyncAddOneFunction)(int32_t);
+
+DEFINE_BUILDER( AsyncAddOne,
+                Int32,
+                PARAM("value", Int32) )
+   {
+   Return(
+      Add(
+         Load("value"),
+         ConstInt32(1)));
+   return true;
+   }
+
+struct AsyncCompileResults
+   {
+   volatile uint32_t _succeeded;
+   volatile uint32_t _failed;
+   };
+
+extern "C" void
+recordAsyncCompilation(void *userData, void *entryPoint, int32_t returnCode)
+   {
+   AsyncCompileResults *results = static_cast<AsyncCompileResults *>(userData);
+   if ((0 == returnCode) && (NULL != entryPoint))
+      VM_AtomicSupport::addU32(&results->_succeeded, 1);
+   else
+      VM_AtomicSupport::addU32(&results->_failed, 1);
+   }
+
+class AsyncCompileTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      JitBuilderTest::SetUpTestCase();
+#if !defined(OMR_OS_WINDOWS)
+      ASSERT_TRUE(startCompilationThreads(2)) << "Failed to start the compilation threads.";
+#endif /* !defined(OMR_OS_WINDOWS) */
+      }
+   };
+
+#if defined(OMR_OS_WINDOWS)
+TEST_F(AsyncCompileTest, UnsupportedOnWindows)
+   {
+   // there are no compilation threads, so requests are refused instead of compiled synchronously
+   ASSERT_FALSE(startCompilationThreads(2));
+   OMR::JitBuilder::TypeDictionary types;
+   AsyncAddOne builder(&types);
+   void *entryPoint = NULL;
+   ASSERT_NE(1, compileMethodBuilderAsync(&builder, 0, &entryPoint, NULL, NULL));
+   ASSERT_TRUE(NULL == entryPoint);
+   ASSERT_NE(0, waitForCompilation(&builder));
+   }
+#else /* defined(OMR_OS_WINDOWS) */
+
+TEST_F(AsyncCompileTest, WaitForEachCompilation)
+   {
+   // concurrent compilations must not share a type dictionary
+   OMR::JitBuilder::TypeDictionary *types[ASYNC_COMPILE_TEST_METHODS];
+   AsyncAddOne *builders[ASYNC_COMPILE_TEST_METHODS];
+   void *entryPoints[ASYNC_COMPILE_TEST_METHODS];
+   for (int32_t i = 0; i < ASYNC_COMPILE_TEST_METHODS; i++)
+      {
+      types[i] = new OMR::JitBuilder::TypeDictionary();
+      builders[i] = new AsyncAddOne(types[i]);
+      entryPoints[i] = NULL;
+      ASSERT_EQ(1, compileMethodBuilderAsync(builders[i], i % 3, &entryPoints[i], NULL, NULL)) << "request " << i << " was not queued";
+      }
+
+   for (int32_t i = 0; i < ASYNC_COMPILE_TEST_METHODS; i++)
+      {
+      ASSERT_EQ(0, waitForCompilation(builders[i])) << "compilation " << i << " failed";
+      ASSERT_TRUE(NULL != entryPoints[i]);
+      AsyncAddOneFunction addOne = (AsyncAddOneFunction)entryPoints[i];
+      ASSERT_EQ(i + 1, addOne(i));
+      }
+
+   // every request has been collected
+   ASSERT_NE(0, waitForCompilation(builders[0]));
+
+   for (int32_t i = 0; i < ASYNC_COMPILE_TEST_METHODS; i++)
+      {
+      delete builders[i];
+      delete types[i];
+      }
+   }
+
+TEST_F(AsyncCompileTest, CallbackOnCompletion)
+   {
+   OMR::JitBuilder::TypeDictionary *types[ASYNC_COMPILE_TEST_METHODS];
+   AsyncAddOne *builders[ASYNC_COMPILE_TEST_METHODS];
+   void *entryPoints[ASYNC_COMPILE_TEST_METHODS];
+   AsyncCompileResults results = { 0, 0 };
+   for (int32_t i = 0; i < ASYNC_COMPILE_TEST_METHODS; i++)
+      {
+      types[i] = new OMR::JitBuilder::TypeDictionary();
+      builders[i] = new AsyncAddOne(types[i]);
+      entryPoints[i] = NULL;
+      ASSERT_EQ(1, compileMethodBuilderAsync(builders[i], ASYNC_COMPILE_TEST_METHODS - i, &entryPoints[i], (void *)recordAsyncCompilation, &results)) << "request " << i << " was not queued";
+      }
+
+   waitForAllCompilations();
+   ASSERT_EQ((uint32_t)ASYNC_COMPILE_TEST_METHODS, results._succeeded);
+   ASSERT_EQ((uint32_t)0, results._failed);
+
+   for (int32_t i = 0; i < ASYNC_COMPILE_TEST_METHODS; i++)
+      {
+      ASSERT_TRUE(NULL != entryPoints[i]);
+      AsyncAddOneFunction addOne = (AsyncAddOneFunction)entryPoints[i];
+      ASSERT_EQ(-i + 1, addOne(-i));
+      // requests with a callback are not kept for waitForCompilation()
+      ASSERT_NE(0, waitForCompilation(builders[i]));
+      delete builders[i];
+      delete types[i];
+      }
+   }
+
+#endif /* defined(OMR_OS_WINDOWS) */
@@ -0,0 +1,262 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <string>
+
+typedef int32_t (*StoredFunction)(int32_t);
+
+static int32_t
+storedCallee(int32_t value)
+   {
+   #define STORED_CALLEE_LINE LINETOSTR(__LINE__)
+   return value * 3;
+   }
+
+DEFINE_BUILDER( StoredAddOne,
+                Int32,
+                PARAM("value", Int32) )
+   {
+   Return(
+      Add(
+         Load("value"),
+         ConstInt32(1)));
+   return true;
+   }
+
+DEFINE_BUILDER( StoredAddTwo,
+                Int32,
+                PARAM("value", Int32) )
+   {
+   Return(
+      Add(
+         Load("value"),
+         ConstInt32(2)));
+   return true;
+   }
+
+DEFINE_BUILDER( StoredCall,
+                Int32,
+                PARAM("value", Int32) )
+   {
+   DefineFunction((char *)"storedCallee",
+                  (char *)__FILE__,
+                  (char *)STORED_CALLEE_LINE,
+                  (void *)&storedCallee,
+                  Int32,
+                  1,
+                  Int32);
+
+   Return(
+      Add(
+         Call("storedCallee", 1, Load("value")),
+         ConstInt32(1)));
+   return true;
+   }
+
+DEFINE_BUILDER( StoredTableSwitch,
+                Int32,
+                PARAM("selector", Int32) )
+   {
+   OMR::JitBuilder::IlBuilder *defaultBuilder = NULL;
+   OMR::JitBuilder::IlBuilder *case1Builder = NULL;
+   OMR::JitBuilder::IlBuilder *case2Builder = NULL;
+   OMR::JitBuilder::IlBuilder *case3Builder = NULL;
+   OMR::JitBuilder::IlBuilder *case4Builder = NULL;
+   TableSwitch(Load("selector"), &defaultBuilder, false, 4,
+               MakeCase(1, &case1Builder, false),
+               MakeCase(2, &case2Builder, false),
+               MakeCase(3, &case3Builder, false),
+               MakeCase(4, &case4Builder, false));
+
+   case1Builder->Return(case1Builder->ConstInt32(10));
+   case2Builder->Return(case2Builder->ConstInt32(20));
+   case3Builder->Return(case3Builder->ConstInt32(30));
+   case4Builder->Return(case4Builder->ConstInt32(40));
+   defaultBuilder->Return(defaultBuilder->ConstInt32(-1));
+   return true;
+   }
+
+class CodeStoreTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      // compilation ends are logged, so the tests can tell how the store handled each body
+      snprintf(_verboseLogPath, sizeof(_verboseLogPath), "/tmp/jbcodestore%d.vlog", (int)getpid());
+      std::string options = std::string("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,verbose={compileEnd},vlog=") + _verboseLogPath;
+      ASSERT_TRUE(initializeJitWithOptions((char *)options.c_str())) << "Failed to initialize the JIT.";
+      }
+
+   static void TearDownTestCase()
+      {
+      JitBuilderTest::TearDownTestCase();
+      remove(_verboseLogPath);
+      }
+
+   virtual void SetUp()
+      {
+      char pattern[] = "/tmp/jbcodestoreXXXXXX";
+      ASSERT_TRUE(NULL != mkdtemp(pattern)) << "Failed to create the store directory.";
+      _directory = pattern;
+      }
+
+   virtual void TearDown()
+      {
+      closeCodeStore();
+      DIR *dir = opendir(_directory.c_str());
+      if (NULL != dir)
+         {
+         for (struct dirent *e = readdir(dir); NULL != e; e = readdir(dir))
+            {
+            if (0 != strcmp(e->d_name, ".") && 0 != strcmp(e->d_name, ".."))
+               remove((_directory + "/" + e->d_name).c_str());
+            }
+         closedir(dir);
+         }
+      rmdir(_directory.c_str());
+      }
+
+   int32_t countStoredBodies()
+      {
+      int32_t count = 0;
+      DIR *dir = opendir(_directory.c_str());
+      if (NULL == dir)
+         return -1;
+      for (struct dirent *e = readdir(dir); NULL != e; e = readdir(dir))
+         {
+         size_t length = strlen(e->d_name);
+         if (length > 7 && 0 == strcmp(e->d_name + length - 7, ".jbcode"))
+            count++;
+         }
+      closedir(dir);
+      return count;
+      }
+
+   std::string readVerboseLog()
+      {
+      std::string log;
+      FILE *file = fopen(_verboseLogPath, "r");
+      if (NULL == file)
+         return log;
+      char buffer[1024];
+      for (size_t length = fread(buffer, 1, sizeof(buffer), file); length > 0; length = fread(buffer, 1, sizeof(buffer), file))
+         log.append(buffer, length);
+      fclose(file);
+      return log;
+      }
+
+   template <typename Builder>
+   StoredFunction compileWithStore()
+      {
+      OMR::JitBuilder::TypeDictionary types;
+      Builder builder(&types);
+      void *entry = NULL;
+      EXPECT_EQ(0, compileMethodBuilder(&builder, &entry)) << "Compilation failed";
+      return (StoredFunction)entry;
+      }
+
+   std::string _directory;
+   static char _verboseLogPath[64];
+   };
+
+char CodeStoreTest::_verboseLogPath[64];
+
+TEST_F(CodeStoreTest, ReuseStoredBody)
+   {
+   ASSERT_TRUE(openCodeStore((char *)_directory.c_str()));
+   // only one store can be open at a time
+   ASSERT_FALSE(openCodeStore((char *)_directory.c_str()));
+
+   StoredFunction compiled = compileWithStore<StoredAddOne>();
+   ASSERT_TRUE(NULL != compiled);
+   ASSERT_EQ(42, compiled(41));
+   ASSERT_EQ(1, countStoredBodies());
+
+   // identical IL from a new builder installs the stored body at a new address
+   closeCodeStore();
+   ASSERT_TRUE(openCodeStore((char *)_directory.c_str()));
+   StoredFunction installed = compileWithStore<StoredAddOne>();
+   ASSERT_TRUE(NULL != installed);
+   ASSERT_NE(compiled, installed);
+   ASSERT_EQ(42, installed(41));
+   ASSERT_EQ(-1, installed(-2));
+   ASSERT_EQ(1, countStoredBodies());
+   // installing the stored body completes the compilation, it does not fail it
+   std::string log = readVerboseLog();
+   ASSERT_NE(std::string::npos, log.find("StoredAddOne @ ")) << log;
+   ASSERT_NE(std::string::npos, log.find(" reused")) << log;
+   ASSERT_EQ(std::string::npos, log.find("failed compilation")) << log;
+
+   // different IL is stored separately
+   StoredFunction other = compileWithStore<StoredAddTwo>();
+   ASSERT_TRUE(NULL != other);
+   ASSERT_EQ(43, other(41));
+   ASSERT_EQ(2, countStoredBodies());
+   }
+
+TEST_F(CodeStoreTest, RelocateCallToDefinedFunction)
+   {
+   ASSERT_TRUE(openCodeStore((char *)_directory.c_str()));
+
+   StoredFunction compiled = compileWithStore<StoredCall>();
+   ASSERT_TRUE(NULL != compiled);
+   ASSERT_EQ(31, compiled(10));
+   ASSERT_EQ(1, countStoredBodies());
+
+   StoredFunction installed = compileWithStore<StoredCall>();
+   ASSERT_TRUE(NULL != installed);
+   ASSERT_NE(compiled, installed);
+   ASSERT_EQ(31, installed(10));
+   ASSERT_EQ(-5, installed(-2));
+   ASSERT_EQ(1, countStoredBodies());
+   }
+
+TEST_F(CodeStoreTest, SkipBodyWithJumpTable)
+   {
+   ASSERT_TRUE(openCodeStore((char *)_directory.c_str()));
+
+   StoredFunction compiled = compileWithStore<StoredTableSwitch>();
+   ASSERT_TRUE(NULL != compiled);
+   ASSERT_EQ(20, compiled(2));
+   // the jump table is allocated apart from the body, so the body cannot be installed elsewhere
+   ASSERT_EQ(0, countStoredBodies());
+
+   StoredFunction recompiled = compileWithStore<StoredTableSwitch>();
+   ASSERT_TRUE(NULL != recompiled);
+   ASSERT_NE(compiled, recompiled);
+   for (int32_t selector = 1; selector <= 4; selector++)
+      ASSERT_EQ(10 * selector, recompiled(selector)) << "selector " << selector;
+   ASSERT_EQ(-1, recompiled(0));
+   ASSERT_EQ(-1, recompiled(5));
+   ASSERT_EQ(0, countStoredBodies());
+   std::string log = readVerboseLog();
+   ASSERT_NE(std::string::npos, log.find("code store did not save")) << "no reason was logged\n" << log;
+   }
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include <string>
+
+#define PHASED_SUM_STEPS 64
+
+typedef int32_t (*PhasedSumFunction)(int32_t);
+
+static int32_t
+phasedSum(int32_t n)
+   {
+   uint32_t sum = 0;
+   for (int32_t i = 0; i < n; i++)
+      for (uint32_t step = 1; step <= PHASED_SUM_STEPS; step++)
+         sum = sum * step + static_cast<uint32_t>(i);
+   return static_cast<int32_t>(sum);
+   }
+
+DEFINE_BUILDER( PhasedSum,
+                Int32,
+                PARAM("n", Int32) )
+   {
+   Store("sum", ConstInt32(0));
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+
+   // enough IL that no compilation of it fits in a 1ms budget
+   for (int32_t step = 1; step <= PHASED_SUM_STEPS; step++)
+      {
+      loop->Store("sum",
+      loop->   Add(
+      loop->      Mul(
+      loop->         Load("sum"),
+      loop->         ConstInt32(step)),
+      loop->      Load("i")));
+      }
+
+   Return(Load("sum"));
+   return true;
+   }
+
+class CompilePhasesTestBase : public JitBuilderTest
+   {
+   public:
+
+   static void initializeJitWithPhases(const char *options)
+      {
+      snprintf(_verboseLogPath, sizeof(_verboseLogPath), "/tmp/jbcompilephases%d.vlog", (int)getpid());
+      std::string jitOptions = std::string("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,verbose={compilePhases},vlog=") + _verboseLogPath + options;
+      ASSERT_TRUE(initializeJitWithOptions((char *)jitOptions.c_str())) << "Failed to initialize the JIT.";
+      }
+
+   static void TearDownTestCase()
+      {
+      JitBuilderTest::TearDownTestCase();
+      remove(_verboseLogPath);
+      }
+
+   // the #PHASES record of the last compilation of the named method
+   std::string readPhasesRecord(const char *method)
+      {
+      std::string log;
+      FILE *file = fopen(_verboseLogPath, "r");
+      if (NULL == file)
+         return log;
+      char buffer[1024];
+      for (size_t length = fread(buffer, 1, sizeof(buffer), file); length > 0; length = fread(buffer, 1, sizeof(buffer), file))
+         log.append(buffer, length);
+      fclose(file);
+
+      std::string record;
+      for (size_t start = log.find("#PHASES:"); std::string::npos != start; start = log.find("#PHASES:", start + 1))
+         {
+         std::string line = log.substr(start, log.find('\n', start) - start);
+         if (std::string::npos != line.find(method))
+            record = line;
+         }
+      return record;
+      }
+
+   int32_t compilePhasedSum(PhasedSumFunction *entry)
+      {
+      OMR::JitBuilder::TypeDictionary types;
+      PhasedSum builder(&types);
+      void *entryPoint = NULL;
+      int32_t rc = compileMethodBuilder(&builder, &entryPoint);
+      *entry = (PhasedSumFunction)entryPoint;
+      return rc;
+      }
+
+   static char _verboseLogPath[64];
+   };
+
+char CompilePhasesTestBase::_verboseLogPath[64];
+
+class CompilePhasesTest : public CompilePhasesTestBase
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      initializeJitWithPhases("");
+      }
+   };
+
+class CompileTimeBudgetTest : public CompilePhasesTestBase
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      // a 1ms budget of which any one phase may spend 10us
+      initializeJitWithPhases(",compileTimeBudget=1,compileTimeBudgetPhaseShare=1");
+      }
+   };
+
+TEST_F(CompilePhasesTest, RecordEveryPhase)
+   {
+   PhasedSumFunction compiled = NULL;
+   ASSERT_EQ(0, compilePhasedSum(&compiled)) << "Compilation failed";
+   ASSERT_TRUE(NULL != compiled);
+   for (int32_t n = 0; n < 8; n++)
+      ASSERT_EQ(phasedSum(n), compiled(n)) << "n " << n;
+
+   std::string record = readPhasesRecord("PhasedSum");
+   ASSERT_NE(std::string::npos, record.find(" rc=ok ")) << record;
+   ASSERT_NE(std::string::npos, record.find(" time=")) << record;
+   ASSERT_NE(std::string::npos, record.find(" peakKB=")) << record;
+   ASSERT_NE(std::string::npos, record.find(" nodes=")) << record;
+   // both optimization passes and codegen phases are measured
+   ASSERT_NE(std::string::npos, record.find(" o:")) << record;
+   ASSERT_NE(std::string::npos, record.find(" c:")) << record;
+   // without a budget none can be exceeded
+   ASSERT_EQ(std::string::npos, record.find(" budget=")) << record;
+   }
+
+TEST_F(CompileTimeBudgetTest, FailCompilationOverBudget)
+   {
+   PhasedSumFunction compiled = NULL;
+   ASSERT_NE(0, compilePhasedSum(&compiled)) << "Compilation over budget succeeded";
+   ASSERT_TRUE(NULL == compiled);
+
+   // the record is written for the failed compilation and names the phase that exceeded the budget
+   std::string record = readPhasesRecord("PhasedSum");
+   ASSERT_NE(std::string::npos, record.find(" rc=failed ")) << record;
+   size_t budget = record.find(" budget=");
+   ASSERT_NE(std::string::npos, budget) << record;
+   std::string phase = record.substr(budget + 8, record.find(' ', budget + 1) - budget - 8);
+   ASSERT_FALSE(phase.empty()) << record;
+   ASSERT_NE(std::string::npos, record.find(":" + phase + "=")) << record;
+   }
+
+TEST(CompileTimeBudgetOptionsTest, RejectPhaseShareOutOfRange)
+   {
+   ASSERT_FALSE(initializeJitWithOptions((char *)"-Xjit:compileTimeBudget=10,compileTimeBudgetPhaseShare=0"));
+   ASSERT_FALSE(initializeJitWithOptions((char *)"-Xjit:compileTimeBudget=10,compileTimeBudgetPhaseShare=101"));
+   }
@@ -0,0 +1,345 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+#include <stdio.h>
+#include <unistd.h>
+#include <string>
+
+#define MAX_LOOP_VECTORIZER_TEST_LENGTH 67
+
+// Every kernel below is expected to be vectorized where the vectorizer is known to fire
+#if defined(__x86_64__) || defined(_M_X64)
+#define EXPECT_LOOP_VECTORIZATION 1
+#endif
+
+typedef void (*Int32BinaryKernel)(int32_t *, int32_t *, int32_t *, int32_t);
+typedef void (*DoubleBinaryKernel)(double *, double *, double *, int32_t);
+typedef void (*FloatScaleKernel)(float *, float, int32_t);
+typedef int32_t (*Int32SumKernel)(int32_t *, int32_t);
+typedef int64_t (*Int64SumKernel)(int64_t *, int32_t);
+
+DEFINE_BUILDER( Int32AddArrays,
+                NoType,
+                PARAM("c", PointerTo(Int32)),
+                PARAM("a", PointerTo(Int32)),
+                PARAM("b", PointerTo(Int32)),
+                PARAM("n", Int32) )
+   {
+   OMR::JitBuilder::IlType *pInt32 = PointerTo(Int32);
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pInt32, loop->Load("c"), loop->Load("i")),
+   loop->   Add(
+   loop->      LoadAt(pInt32, loop->IndexAt(pInt32, loop->Load("a"), loop->Load("i"))),
+   loop->      LoadAt(pInt32, loop->IndexAt(pInt32, loop->Load("b"), loop->Load("i")))));
+
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER( Int32LessThanArrays,
+                NoType,
+                PARAM("c", PointerTo(Int32)),
+                PARAM("a", PointerTo(Int32)),
+                PARAM("b", PointerTo(Int32)),
+                PARAM("n", Int32) )
+   {
+   OMR::JitBuilder::IlType *pInt32 = PointerTo(Int32);
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pInt32, loop->Load("c"), loop->Load("i")),
+   loop->   LessThan(
+   loop->      LoadAt(pInt32, loop->IndexAt(pInt32, loop->Load("a"), loop->Load("i"))),
+   loop->      LoadAt(pInt32, loop->IndexAt(pInt32, loop->Load("b"), loop->Load("i")))));
+
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER( DoubleMulArrays,
+                NoType,
+                PARAM("result", PointerTo(Double)),
+                PARAM("vector1", PointerTo(Double)),
+                PARAM("vector2", PointerTo(Double)),
+                PARAM("length", Int32) )
+   {
+   OMR::JitBuilder::IlType *pDouble = PointerTo(Double);
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("length"), ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pDouble, loop->Load("result"), loop->Load("i")),
+   loop->   Mul(
+   loop->      LoadAt(pDouble, loop->IndexAt(pDouble, loop->Load("vector1"), loop->Load("i"))),
+   loop->      LoadAt(pDouble, loop->IndexAt(pDouble, loop->Load("vector2"), loop->Load("i")))));
+
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER( FloatScaleArray,
+                NoType,
+                PARAM("a", PointerTo(Float)),
+                PARAM("k", Float),
+                PARAM("n", Int32) )
+   {
+   OMR::JitBuilder::IlType *pFloat = PointerTo(Float);
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pFloat, loop->Load("a"), loop->Load("i")),
+   loop->   Mul(
+   loop->      LoadAt(pFloat, loop->IndexAt(pFloat, loop->Load("a"), loop->Load("i"))),
+   loop->      Load("k")));
+
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER( Int32SumArray,
+                Int32,
+                PARAM("a", PointerTo(Int32)),
+                PARAM("n", Int32) )
+   {
+   OMR::JitBuilder::IlType *pInt32 = PointerTo(Int32);
+   Store("sum", ConstInt32(0));
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+
+   loop->Store("sum",
+   loop->   Add(
+   loop->      Load("sum"),
+   loop->      LoadAt(pInt32, loop->IndexAt(pInt32, loop->Load("a"), loop->Load("i")))));
+
+   Return(Load("sum"));
+   return true;
+   }
+
+DEFINE_BUILDER( Int64SumArray,
+                Int64,
+                PARAM("a", PointerTo(Int64)),
+                PARAM("n", Int32) )
+   {
+   OMR::JitBuilder::IlType *pInt64 = PointerTo(Int64);
+   Store("sum", ConstInt64(0));
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+
+   loop->Store("sum",
+   loop->   Add(
+   loop->      Load("sum"),
+   loop->      LoadAt(pInt64, loop->IndexAt(pInt64, loop->Load("a"), loop->Load("i")))));
+
+   Return(Load("sum"));
+   return true;
+   }
+
+class LoopVectorizerTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      // transformations are logged, so the tests can tell that their loops were vectorized
+      snprintf(_logPath, sizeof(_logPath), "/tmp/jbloopvectorizer%d.log", (int)getpid());
+      std::string options = std::string("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,optDetails,log=") + _logPath;
+      ASSERT_TRUE(initializeJitWithOptions((char *)options.c_str())) << "Failed to initialize the JIT.";
+      }
+
+   static void TearDownTestCase()
+      {
+      JitBuilderTest::TearDownTestCase();
+      remove(_logPath);
+      }
+
+   int32_t countVectorizedLoops()
+      {
+      std::string log;
+      FILE *file = fopen(_logPath, "r");
+      if (NULL != file)
+         {
+         char buffer[4096];
+         for (size_t length = fread(buffer, 1, sizeof(buffer), file); length > 0; length = fread(buffer, 1, sizeof(buffer), file))
+            log.append(buffer, length);
+         fclose(file);
+         }
+      int32_t count = 0;
+      for (size_t position = log.find("Vectorizing loop"); std::string::npos != position; position = log.find("Vectorizing loop", position + 1))
+         count++;
+      return count;
+      }
+
+   void expectVectorizedSince(int32_t countBefore, const char *kernel)
+      {
+#if defined(EXPECT_LOOP_VECTORIZATION)
+      EXPECT_LT(countBefore, countVectorizedLoops()) << kernel << " was not vectorized";
+#endif
+      }
+
+   private:
+
+   static char _logPath[64];
+   };
+
+char LoopVectorizerTest::_logPath[64];
+
+TEST_F(LoopVectorizerTest, Int32AddEveryLength)
+   {
+   Int32BinaryKernel kernel;
+   int32_t vectorized = countVectorizedLoops();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, Int32AddArrays, kernel);
+   expectVectorizedSince(vectorized, "Int32AddArrays");
+
+   int32_t a[MAX_LOOP_VECTORIZER_TEST_LENGTH], b[MAX_LOOP_VECTORIZER_TEST_LENGTH], c[MAX_LOOP_VECTORIZER_TEST_LENGTH + 1];
+   for (int32_t n = 0; n <= MAX_LOOP_VECTORIZER_TEST_LENGTH; n++)
+      {
+      for (int32_t i = 0; i < MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+         {
+         a[i] = i * 7 - 100;
+         b[i] = 0x7fffff00 + i;
+         c[i] = -1;
+         }
+      c[MAX_LOOP_VECTORIZER_TEST_LENGTH] = -1;
+      kernel(c, a, b, n);
+      for (int32_t i = 0; i < n; i++)
+         ASSERT_EQ((int32_t)((uint32_t)a[i] + (uint32_t)b[i]), c[i]) << "n = " << n << ", i = " << i;
+      for (int32_t i = n; i <= MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+         ASSERT_EQ(-1, c[i]) << "stored past the end: n = " << n << ", i = " << i;
+      }
+   }
+
+TEST_F(LoopVectorizerTest, Int32AddOverlappingArrays)
+   {
+   Int32BinaryKernel kernel;
+   int32_t vectorized = countVectorizedLoops();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, Int32AddArrays, kernel);
+   expectVectorizedSince(vectorized, "Int32AddArrays");
+
+   // c[i] = c[i-1] + b[i] carries a dependence between iterations, so the result must match the scalar loop
+   int32_t a[MAX_LOOP_VECTORIZER_TEST_LENGTH + 1], b[MAX_LOOP_VECTORIZER_TEST_LENGTH];
+   for (int32_t i = 0; i <= MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+      a[i] = 1;
+   for (int32_t i = 0; i < MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+      b[i] = i;
+   kernel(a + 1, a, b, MAX_LOOP_VECTORIZER_TEST_LENGTH);
+
+   int32_t expected = 1;
+   for (int32_t i = 0; i < MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+      {
+      expected += i;
+      ASSERT_EQ(expected, a[i + 1]) << "i = " << i;
+      }
+   }
+
+TEST_F(LoopVectorizerTest, Int32LessThan)
+   {
+   Int32BinaryKernel kernel;
+   int32_t vectorized = countVectorizedLoops();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, Int32LessThanArrays, kernel);
+   expectVectorizedSince(vectorized, "Int32LessThanArrays");
+
+   int32_t a[MAX_LOOP_VECTORIZER_TEST_LENGTH], b[MAX_LOOP_VECTORIZER_TEST_LENGTH], c[MAX_LOOP_VECTORIZER_TEST_LENGTH];
+   for (int32_t i = 0; i < MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+      {
+      a[i] = (i % 5) - 2;
+      b[i] = (i % 3) - 1;
+      c[i] = 99;
+      }
+   kernel(c, a, b, MAX_LOOP_VECTORIZER_TEST_LENGTH);
+   for (int32_t i = 0; i < MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+      ASSERT_EQ(a[i] < b[i] ? 1 : 0, c[i]) << "i = " << i;
+   }
+
+TEST_F(LoopVectorizerTest, DoubleMul)
+   {
+   DoubleBinaryKernel kernel;
+   int32_t vectorized = countVectorizedLoops();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, DoubleMulArrays, kernel);
+   expectVectorizedSince(vectorized, "DoubleMulArrays");
+
+   double v1[MAX_LOOP_VECTORIZER_TEST_LENGTH], v2[MAX_LOOP_VECTORIZER_TEST_LENGTH], result[MAX_LOOP_VECTORIZER_TEST_LENGTH];
+   for (int32_t n = 0; n <= MAX_LOOP_VECTORIZER_TEST_LENGTH; n += 5)
+      {
+      for (int32_t i = 0; i < MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+         {
+         v1[i] = i * 0.5;
+         v2[i] = 3.25 - i;
+         result[i] = -1.0;
+         }
+      kernel(result, v1, v2, n);
+      for (int32_t i = 0; i < MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+         ASSERT_EQ(i < n ? v1[i] * v2[i] : -1.0, result[i]) << "n = " << n << ", i = " << i;
+      }
+   }
+
+TEST_F(LoopVectorizerTest, FloatScaleInPlace)
+   {
+   FloatScaleKernel kernel;
+   int32_t vectorized = countVectorizedLoops();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, FloatScaleArray, kernel);
+   expectVectorizedSince(vectorized, "FloatScaleArray");
+
+   float a[MAX_LOOP_VECTORIZER_TEST_LENGTH];
+   for (int32_t i = 0; i < MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+      a[i] = (float)i;
+   kernel(a, 1.5f, MAX_LOOP_VECTORIZER_TEST_LENGTH);
+   for (int32_t i = 0; i < MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+      ASSERT_EQ((float)i * 1.5f, a[i]) << "i = " << i;
+   }
+
+TEST_F(LoopVectorizerTest, IntegerReductions)
+   {
+   Int32SumKernel sum32;
+   int32_t vectorized = countVectorizedLoops();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, Int32SumArray, sum32);
+   expectVectorizedSince(vectorized, "Int32SumArray");
+   Int64SumKernel sum64;
+   vectorized = countVectorizedLoops();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, Int64SumArray, sum64);
+   expectVectorizedSince(vectorized, "Int64SumArray");
+
+   int32_t a32[MAX_LOOP_VECTORIZER_TEST_LENGTH];
+   int64_t a64[MAX_LOOP_VECTORIZER_TEST_LENGTH];
+   for (int32_t i = 0; i < MAX_LOOP_VECTORIZER_TEST_LENGTH; i++)
+      {
+      a32[i] = 0x10000000 * (i % 7) - i;
+      a64[i] = (int64_t)0x100000000LL * i + i;
+      }
+   for (int32_t n = 0; n <= MAX_LOOP_VECTORIZER_TEST_LENGTH; n++)
+      {
+      uint32_t expected32 = 0;
+      int64_t expected64 = 0;
+      for (int32_t i = 0; i < n; i++)
+         {
+         expected32 += (uint32_t)a32[i];
+         expected64 += a64[i];
+         }
+      ASSERT_EQ((int32_t)expected32, sum32(a32, n)) << "n = " << n;
+      ASSERT_EQ(expected64, sum64(a64, n)) << "n = " << n;
+      }
+   }
@@ -75,6 +75,7 @@ protected:
 	bool  _collectAndClimb;
 	bool  _climb;				/* indicates that current attempt to allocate should try parent, if current subspace failed */
 	bool  _completedFromTlh;
+	uintptr_t _allocationSiteToken; /**< language-defined token for the code allocating the object, reported by the allocation lifetime sampler */
 
 public:
 
@@ -210,6 +211,9 @@ public:
 	MMINLINE bool isCompletedFromTlh() { return _completedFromTlh; }
 	MMINLINE void completedFromTlh() { _completedFromTlh = true; }
 
+	MMINLINE void setAllocationSiteToken(uintptr_t siteToken) { _allocationSiteToken = siteToken; }
+	MMINLINE uintptr_t getAllocationSiteToken() { return _allocationSiteToken; }
+
 	/**
 	 * Set whether the allocation succeeded
 	 * @param suceeded - true if the allocation succeeded, false otherwise
@@ -249,6 +253,7 @@ public:
 		, _collectAndClimb(collectAndClimb)
 		, _climb(false)
 		, _completedFromTlh(false)
+		, _allocationSiteToken(0)
 	{}
 };
 
@@ -25,6 +25,7 @@
 #include "CardTable.hpp"
 
 #include "AtomicOperations.hpp"
+#include "Bits.hpp"
 #include "CardCleaner.hpp"
 #include "GCExtensionsBase.hpp"
 #include "EnvironmentBase.hpp"
@@ -71,6 +72,25 @@ MM_CardTable::tearDown(MM_EnvironmentBase *env)
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
 	/* Get rid of the virtual memory allocated for card table */
 	memoryManager->destroyVirtualMemory(env, &_cardTableMemoryHandle);
+
+	if (NULL != _cardSummary) {
+		env->getForge()->free((void *)_cardSummary);
+		_cardSummary = NULL;
+	}
+}
+
+bool
+MM_CardTable::initializeCardSummary(MM_EnvironmentBase *env, uintptr_t maximumHeapSize)
+{
+	uintptr_t groups = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS, calculateCardTableSize(env, maximumHeapSize) / sizeof(Card)) / CARD_SUMMARY_CARDS;
+	_cardSummarySlots = MM_Math::roundToCeiling(CARD_SUMMARY_BITS_PER_SLOT, groups) / CARD_SUMMARY_BITS_PER_SLOT;
+	uintptr_t *summary = (uintptr_t *)env->getForge()->allocate(_cardSummarySlots * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != summary) {
+		/* nothing is known about the cards until they are first cleared */
+		memset(summary, 0xFF, _cardSummarySlots * sizeof(uintptr_t));
+		_cardSummary = summary;
+	}
+	return NULL != summary;
 }
 
 uintptr_t
@@ -256,6 +276,7 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 		if (newValue != oldValue) {
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
+			dirtyCardSummary(card);
 		}
 	}
 }
@@ -270,6 +291,7 @@ MM_CardTable::dirtyCardRange(MM_EnvironmentBase *env, void *heapAddrFrom, void *
 		/* If card not already dirty then dirty it */
 		if ((Card)CARD_DIRTY != *card) {
 			*card = (Card)CARD_DIRTY;
+			dirtyCardSummary(card);
 		}
 	}
 }
@@ -298,6 +320,60 @@ MM_CardTable::cardAddrToHeapAddr(MM_EnvironmentBase *env, Card *cardAddr)
 	return (void *)((uintptr_t)getHeapBase() + (((uintptr_t)cardAddr - (uintptr_t)getCardTableStart()) << CARD_SIZE_SHIFT));
 }
 
+Card *
+MM_CardTable::skipCleanCards(MM_EnvironmentBase *env, Card *card, Card *cardTop)
+{
+	/* a card at a time up to a slot boundary... */
+	while ((card < cardTop) && (0 != ((uintptr_t)card % sizeof(uintptr_t)))) {
+		if ((Card)CARD_CLEAN != *card) {
+			return card;
+		}
+		card += 1;
+	}
+
+	/* ...then whole slots, with the same bulk scan used for empty runs of the mark map... */
+	uintptr_t *slot = (uintptr_t *)card;
+	uintptr_t *slotTop = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)cardTop);
+	if (slot < slotTop) {
+		card = (Card *)env->getExtensions()->heapMapScan.skipSlots(slot, slotTop, (uintptr_t)CARD_CLEAN);
+	}
+
+	/* ...and a card at a time within the slot found or the tail of the range */
+	while ((card < cardTop) && ((Card)CARD_CLEAN == *card)) {
+		card += 1;
+	}
+	return card;
+}
+
+Card *
+MM_CardTable::findNextUncleanCard(MM_EnvironmentBase *env, Card *card, Card *cardTop)
+{
+	if (NULL == _cardSummary) {
+		return skipCleanCards(env, card, cardTop);
+	}
+
+	while (card < cardTop) {
+		uintptr_t group = (uintptr_t)(card - _cardTableStart) >> CARD_SUMMARY_SHIFT;
+		uintptr_t slotIndex = group / CARD_SUMMARY_BITS_PER_SLOT;
+		uintptr_t bits = _cardSummary[slotIndex] >> (group % CARD_SUMMARY_BITS_PER_SLOT);
+		if (0 == bits) {
+			/* none of the remaining groups in this summary slot has been dirtied */
+			card = _cardTableStart + (((slotIndex + 1) * CARD_SUMMARY_BITS_PER_SLOT) << CARD_SUMMARY_SHIFT);
+		} else {
+			group += MM_Bits::leadingZeroes(bits);
+			Card *groupBase = _cardTableStart + (group << CARD_SUMMARY_SHIFT);
+			Card *groupTop = OMR_MIN(groupBase + CARD_SUMMARY_CARDS, cardTop);
+			card = skipCleanCards(env, OMR_MAX(card, groupBase), groupTop);
+			if (card < groupTop) {
+				return card;
+			}
+			card = groupTop;
+		}
+	}
+
+	return cardTop;
+}
+
 MMINLINE void
 MM_CardTable::cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, Card *low, Card *high)
 {
@@ -305,14 +381,15 @@ MM_CardTable::cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, C
 	Card *endCard = high;
 	uintptr_t cardsCleaned = 0;
 	while (thisCard < endCard) {
-		if (CARD_CLEAN != *thisCard) {
+		thisCard = findNextUncleanCard(env, thisCard, endCard);
+		if (thisCard < endCard) {
 			void *lowAddress = (void *)cardAddrToHeapAddr(env, thisCard);
 			void *highAddress = (void *)((uintptr_t)lowAddress + CARD_SIZE);
 			
 			cardCleaner->clean(env, lowAddress, highAddress, thisCard);
 			cardsCleaned += 1;
+			thisCard += 1;
 		}
-		thisCard += 1;
 	}
 	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
 }
@@ -378,6 +455,28 @@ MM_CardTable::clearCardsInRange(MM_EnvironmentBase *env, void* heapBase, void* h
 	Card *lastCard = heapAddrToCardAddr(env,heapTop);
 	uintptr_t sizeToClear = (uint8_t *)lastCard - (uint8_t *)firstCard;
 
+	if (NULL != _cardSummary) {
+		/* Clear the summary bits of the groups wholly within the range before their cards, so that a card
+		 * dirtied concurrently can never be left with a clear summary bit. Groups only partly in the range
+		 * keep their bits.
+		 */
+		uintptr_t group = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS, (uintptr_t)(firstCard - _cardTableStart)) >> CARD_SUMMARY_SHIFT;
+		uintptr_t groupTop = (uintptr_t)(lastCard - _cardTableStart) >> CARD_SUMMARY_SHIFT;
+		while (group < groupTop) {
+			uintptr_t bit = group % CARD_SUMMARY_BITS_PER_SLOT;
+			uintptr_t count = OMR_MIN(CARD_SUMMARY_BITS_PER_SLOT - bit, groupTop - group);
+			volatile uintptr_t *slot = _cardSummary + (group / CARD_SUMMARY_BITS_PER_SLOT);
+			if (CARD_SUMMARY_BITS_PER_SLOT == count) {
+				*slot = 0;
+			} else {
+				uintptr_t mask = (((uintptr_t)1 << count) - 1) << bit;
+				MM_AtomicOperations::bitAnd(slot, ~mask);
+			}
+			group += count;
+		}
+		MM_AtomicOperations::writeBarrier();
+	}
+
 	/* We can't use OMRZeroMemory() here as that requires the  area to
 	 * be cleared to be uintptr_t aligned
 	 */
@@ -33,6 +33,7 @@
 #include "omrmodroncore.h"
 #include "modronbase.h"
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
 #include "MemoryManager.hpp"
 
@@ -41,6 +42,14 @@ class MM_CardCleaner;
 class MM_Heap;
 class MM_HeapRegionDescriptor;
 
+/**
+ * The card summary has one bit for each group of 2^CARD_SUMMARY_SHIFT cards (256KB of heap).
+ * @ingroup GC_Base
+ */
+#define CARD_SUMMARY_SHIFT 9
+#define CARD_SUMMARY_CARDS ((uintptr_t)1 << CARD_SUMMARY_SHIFT)
+#define CARD_SUMMARY_BITS_PER_SLOT (sizeof(uintptr_t) * 8)
+
 /**
  * @todo Provide typedef documentation
  * @ingroup GC_Base
@@ -62,6 +71,8 @@ private:
 	Card *_cardTableStart;
 	Card *_cardTableVirtualStart;
 	void *_heapBase; 
+	volatile uintptr_t *_cardSummary; /**< a bit per CARD_SUMMARY_CARDS cards, set once any of them may have been dirtied since they were last cleared; NULL if not maintained */
+	uintptr_t _cardSummarySlots; /**< size of _cardSummary in slots */
 
 
 public:
@@ -134,6 +145,47 @@ public:
 	 * @return The lowest address of the heap which the given card tracks 
 	 */
 	void *cardAddrToHeapAddr(MM_EnvironmentBase *env, Card *cardAddr);	
+
+	/**
+	 * Find the first card in [card, cardTop) which is not CARD_CLEAN. Groups of cards with a clear
+	 * summary bit are skipped without being read, and runs of clean cards are skipped a vector (or
+	 * uintptr_t) at a time using the processor specific scan selected at startup.
+	 * @param[in] card first card to examine
+	 * @param[in] cardTop end of the range (exclusive)
+	 * @return the first card in the range which is not clean, or cardTop if there is none
+	 */
+	Card *findNextUncleanCard(MM_EnvironmentBase *env, Card *card, Card *cardTop);
+
+	/**
+	 * @return true if the card summary is maintained for this card table
+	 */
+	MMINLINE bool isCardSummaryEnabled() { return NULL != _cardSummary; }
+
+	/**
+	 * Returns the card summary bitmap, so that inline write barriers can maintain it.
+	 * @return the summary, or NULL if it is not maintained
+	 */
+	MMINLINE volatile uintptr_t *getCardSummary() { return _cardSummary; }
+
+	/**
+	 * Record in the card summary that the given card has been dirtied. Anything which dirties a card directly,
+	 * including inline write barriers, must do this after the card store while the summary is enabled.
+	 * Summary bits are only cleared together with their cards, while the write barrier is inactive, so a bit
+	 * which is already set does not need to be set again.
+	 * @param[in] card the card which has been dirtied
+	 */
+	MMINLINE void
+	dirtyCardSummary(Card *card)
+	{
+		if (NULL != _cardSummary) {
+			uintptr_t group = (uintptr_t)(card - _cardTableStart) >> CARD_SUMMARY_SHIFT;
+			volatile uintptr_t *slot = _cardSummary + (group / CARD_SUMMARY_BITS_PER_SLOT);
+			uintptr_t bit = (uintptr_t)1 << (group % CARD_SUMMARY_BITS_PER_SLOT);
+			if (0 == (*slot & bit)) {
+				MM_AtomicOperations::bitOr(slot, bit);
+			}
+		}
+	}
 	
 	/**
 	 * Called to request that that the CardTable for entire heap range be cleaned.
@@ -245,6 +297,13 @@ protected:
 	 */
 	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
 	virtual void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Allocate the card summary, with all bits set, for a heap of the given maximum size. Only card tables whose
+	 * users dirty cards through dirtyCardSummary() (or write barriers which do the same) may enable it.
+	 * @return false if the summary could not be allocated
+	 */
+	bool initializeCardSummary(MM_EnvironmentBase *env, uintptr_t maximumHeapSize);
 	
 	/**
 	 * Commits the card table range between lowCard and highCard:  [lowCard, highCard)
@@ -268,12 +327,19 @@ protected:
 		, _cardTableStart(NULL)
 		, _cardTableVirtualStart(NULL)
 		, _heapBase(NULL)
+		, _cardSummary(NULL)
+		, _cardSummarySlots(0)
 	{
 		_typeId = __FUNCTION__;
 	}
 
 private:
 	void cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, Card *low, Card *high);
+
+	/**
+	 * Find the first card in [card, cardTop) which is not CARD_CLEAN, ignoring the summary.
+	 */
+	Card *skipCleanCards(MM_EnvironmentBase *env, Card *card, Card *cardTop);
 };
 
 #endif /* CARDTABLE_HPP_ */
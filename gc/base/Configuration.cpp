@@ -72,6 +72,7 @@ MM_Configuration::initialize(MM_EnvironmentBase* env)
 			if (initializeNUMAManager(env)) {
 				initializeGCThreadCount(env);
 				initializeGCParameters(env);
+				extensions->heapMapScan.initialize(env->getPortLibrary(), extensions->vectorHeapMapScan);
 				extensions->_lightweightNonReentrantLockPool = pool_new(sizeof(J9ThreadMonitorTracing), 0, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_MM, POOL_FOR_PORT(env->getPortLibrary()));
 				result = (NULL != extensions->_lightweightNonReentrantLockPool);
 			}
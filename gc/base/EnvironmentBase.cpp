@@ -132,6 +132,39 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 	return _delegate.initialize(this);
 }
 
+void
+MM_EnvironmentBase::assignNumaNodeIndex()
+{
+	MM_NUMAManager *numaManager = &getExtensions()->_numaManager;
+	uintptr_t leaderCount = 0;
+	J9MemoryNodeDetail const *leaders = numaManager->getAffinityLeaders(&leaderCount);
+	uintptr_t nodeIndex = leaderCount;
+
+	if ((NULL != _omrVMThread) && numaManager->isPhysicalNUMASupported()) {
+		/* respect a binding made by the launcher or the application */
+		uintptr_t j9NodeNumber = getNumaAffinity();
+		if (0 != j9NodeNumber) {
+			for (uintptr_t i = 0; i < leaderCount; i++) {
+				if (j9NodeNumber == leaders[i].j9NodeNumber) {
+					nodeIndex = i;
+					break;
+				}
+			}
+		}
+	}
+
+	if (nodeIndex == leaderCount) {
+		nodeIndex = numaManager->getNextAffinityLeaderIndex();
+		if ((NULL != _omrVMThread) && numaManager->isPhysicalNUMASupported() && numaManager->shouldSetCPUAffinity()) {
+			/* run where the memory this thread allocates from lives; on failure the thread just stays unbound */
+			uintptr_t j9NodeNumber = leaders[nodeIndex].j9NodeNumber;
+			setNumaAffinity(&j9NodeNumber, 1);
+		}
+	}
+
+	_numaNodeIndex = nodeIndex;
+}
+
 void
 MM_EnvironmentBase::tearDown(MM_GCExtensionsBase *extensions)
 {
@@ -66,7 +66,8 @@ typedef enum {
 	WRITE_BARRIER_THREAD,
 	CON_MARK_HELPER_THREAD,
 	GC_WORKER_THREAD,
-	GC_MAIN_THREAD
+	GC_MAIN_THREAD,
+	CON_SWEEP_HELPER_THREAD
 } ThreadType;
 
 /**
@@ -78,6 +79,13 @@ class MM_EnvironmentBase : public MM_BaseVirtual
 private:
 	uintptr_t _workerID;
 	uintptr_t _environmentId;
+	uintptr_t _numaNodeIndex; /**< affinity leader whose heap stripe this thread allocates from first, UDATA_MAX until first asked for */
+
+	/**
+	 * Pick the affinity leader this thread allocates from: the node it is already bound to if there is one,
+	 * otherwise the next leader in round robin order, binding the thread to it when allowed.
+	 */
+	void assignNumaNodeIndex();
 
 protected:
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
@@ -149,6 +157,7 @@ public:
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
 	uintptr_t _traceAllocationBytes;  /**< Tracks the bytes allocated since the last object trace */
 	uintptr_t _traceAllocationBytesCurrentTLH; /**< keep the bytes of times of sampling threshold for last object trace(include allocation bytes inside TLH) */
+	uintptr_t _lifetimeSamplingBytes; /**< Tracks the bytes allocated since the last allocation lifetime sample */
 
 	uintptr_t approxScanCacheCount; /**< Local copy of approximate entries in global Cache Scan List. Updated upon allocation of new cache. */
 
@@ -388,6 +397,20 @@ public:
 	 */
 	MMINLINE uintptr_t getEnvironmentId() { return _environmentId; }
 
+	/**
+	 * Get the affinity leader whose heap stripe this thread should allocate from first.
+	 * Only valid when NUMA affinity is enabled (see MM_GCExtensionsBase::numaAffinity).
+	 * @return index into the NUMA manager's affinity leader array
+	 */
+	MMINLINE uintptr_t
+	getNumaNodeIndex()
+	{
+		if (UDATA_MAX == _numaNodeIndex) {
+			assignNumaNodeIndex();
+		}
+		return _numaNodeIndex;
+	}
+
 	/**
 	 * Set the vmState to that supplied, and return the previous
 	 * state so it can be restored later
@@ -696,6 +719,7 @@ public:
 		MM_BaseVirtual()
 		,_workerID(0)
 		,_environmentId(0)
+		,_numaNodeIndex(UDATA_MAX)
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
 		, _compressObjectReferences(OMRVMTHREAD_COMPRESS_OBJECT_REFERENCES(omrVMThread))
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
@@ -733,6 +757,7 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_lifetimeSamplingBytes(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -754,6 +779,7 @@ public:
 		MM_BaseVirtual()
 		,_workerID(0)
 		,_environmentId(0)
+		,_numaNodeIndex(UDATA_MAX)
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
 		, _compressObjectReferences(OMRVM_COMPRESS_OBJECT_REFERENCES(omrVM))
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
@@ -790,6 +816,7 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_lifetimeSamplingBytes(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
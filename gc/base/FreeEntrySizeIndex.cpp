@@ -0,0 +1,233 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "ModronAssertions.h"
+
+#include "FreeEntrySizeIndex.hpp"
+
+#include "Bits.hpp"
+#include "Debug.hpp"
+#include "Math.hpp"
+
+bool
+MM_FreeEntrySizeIndex::initialize(uintptr_t minimumEntrySize)
+{
+	if (minimumEntrySize < (sizeof(MM_HeapLinkedFreeHeader) + sizeof(Node))) {
+		return false;
+	}
+	_minimumEntrySizeLog2 = MM_Math::floorLog2(minimumEntrySize);
+	uintptr_t largeEntrySizeLog2 = _minimumEntrySizeLog2 + (BUCKET_COUNT >> SUBCLASS_SHIFT);
+	_largeEntrySize = (largeEntrySizeLog2 < (sizeof(uintptr_t) * 8)) ? ((uintptr_t)1 << largeEntrySizeLog2) : UDATA_MAX;
+	invalidate();
+	return true;
+}
+
+void
+MM_FreeEntrySizeIndex::clear()
+{
+	for (uintptr_t i = 0; i < BUCKET_COUNT; i++) {
+		_buckets[i] = NULL;
+	}
+	_bucketMap = 0;
+	_treeRoot = NULL;
+	_entryCount = 0;
+	_valid = true;
+}
+
+uintptr_t
+MM_FreeEntrySizeIndex::getBucketIndex(uintptr_t size)
+{
+	uintptr_t sizeLog2 = MM_Math::floorLog2(size);
+	if (sizeLog2 < _minimumEntrySizeLog2) {
+		return 0;
+	}
+	uintptr_t subClass = (size >> (sizeLog2 - SUBCLASS_SHIFT)) & ((1 << SUBCLASS_SHIFT) - 1);
+	return ((sizeLog2 - _minimumEntrySizeLog2) << SUBCLASS_SHIFT) + subClass;
+}
+
+void
+MM_FreeEntrySizeIndex::insert(MM_HeapLinkedFreeHeader *freeEntry)
+{
+	Node *node = getNode(freeEntry);
+	node->size = freeEntry->getSize();
+	node->parent = NULL;
+	node->left = NULL;
+
+	if (node->size < _largeEntrySize) {
+		uintptr_t index = getBucketIndex(node->size);
+		node->right = _buckets[index];
+		if (NULL != node->right) {
+			node->right->left = node;
+		}
+		_buckets[index] = node;
+		_bucketMap |= ((uintptr_t)1 << index);
+	} else {
+		node->right = NULL;
+		treeInsert(node);
+	}
+	_entryCount += 1;
+}
+
+void
+MM_FreeEntrySizeIndex::remove(MM_HeapLinkedFreeHeader *freeEntry)
+{
+	Node *node = getNode(freeEntry);
+	assume0(node->size == freeEntry->getSize());
+
+	if (node->size < _largeEntrySize) {
+		uintptr_t index = getBucketIndex(node->size);
+		if (NULL == node->left) {
+			Assert_MM_true(_buckets[index] == node);
+			_buckets[index] = node->right;
+			if (NULL == node->right) {
+				_bucketMap &= ~((uintptr_t)1 << index);
+			}
+		} else {
+			node->left->right = node->right;
+		}
+		if (NULL != node->right) {
+			node->right->left = node->left;
+		}
+	} else {
+		treeRemove(node);
+	}
+	_entryCount -= 1;
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntrySizeIndex::findFit(uintptr_t size)
+{
+	if (size >= _largeEntrySize) {
+		return treeFindFit(size);
+	}
+
+	/* every entry in a higher size class fits */
+	uintptr_t index = getBucketIndex(size);
+	uintptr_t higherBuckets = _bucketMap & ~(((uintptr_t)2 << index) - 1);
+	if (0 != higherBuckets) {
+		return getFreeEntry(_buckets[MM_Bits::leadingZeroes(higherBuckets)]);
+	}
+
+	/* every entry in the treap fits too, take the smallest */
+	if (NULL != _treeRoot) {
+		return treeFindFit(size);
+	}
+
+	/* last resort: entries of the requested size class which happen to be large enough */
+	for (Node *node = _buckets[index]; NULL != node; node = node->right) {
+		if (node->size >= size) {
+			return getFreeEntry(node);
+		}
+	}
+	return NULL;
+}
+
+void
+MM_FreeEntrySizeIndex::rotateUp(Node *node)
+{
+	Node *parent = node->parent;
+	Node *grandParent = parent->parent;
+
+	if (node == parent->left) {
+		parent->left = node->right;
+		if (NULL != node->right) {
+			node->right->parent = parent;
+		}
+		node->right = parent;
+	} else {
+		parent->right = node->left;
+		if (NULL != node->left) {
+			node->left->parent = parent;
+		}
+		node->left = parent;
+	}
+	parent->parent = node;
+	node->parent = grandParent;
+
+	if (NULL == grandParent) {
+		_treeRoot = node;
+	} else if (parent == grandParent->left) {
+		grandParent->left = node;
+	} else {
+		grandParent->right = node;
+	}
+}
+
+void
+MM_FreeEntrySizeIndex::treeInsert(Node *node)
+{
+	Node *parent = NULL;
+	Node **link = &_treeRoot;
+	while (NULL != *link) {
+		parent = *link;
+		link = isLess(node, parent) ? &parent->left : &parent->right;
+	}
+	*link = node;
+	node->parent = parent;
+
+	/* restore the heap order of priorities */
+	while ((NULL != node->parent) && (getPriority(node) > getPriority(node->parent))) {
+		rotateUp(node);
+	}
+}
+
+void
+MM_FreeEntrySizeIndex::treeRemove(Node *node)
+{
+	/* rotate the node down until it is a leaf */
+	while ((NULL != node->left) || (NULL != node->right)) {
+		Node *child = NULL;
+		if (NULL == node->left) {
+			child = node->right;
+		} else if (NULL == node->right) {
+			child = node->left;
+		} else {
+			child = (getPriority(node->left) > getPriority(node->right)) ? node->left : node->right;
+		}
+		rotateUp(child);
+	}
+
+	Node *parent = node->parent;
+	if (NULL == parent) {
+		_treeRoot = NULL;
+	} else if (node == parent->left) {
+		parent->left = NULL;
+	} else {
+		parent->right = NULL;
+	}
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntrySizeIndex::treeFindFit(uintptr_t size)
+{
+	Node *candidate = NULL;
+	Node *node = _treeRoot;
+	while (NULL != node) {
+		if (node->size >= size) {
+			candidate = node;
+			node = node->left;
+		} else {
+			node = node->right;
+		}
+	}
+	return (NULL == candidate) ? NULL : getFreeEntry(candidate);
+}
@@ -0,0 +1,180 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(FREEENTRYSIZEINDEX_HPP_)
+#define FREEENTRYSIZEINDEX_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "HeapLinkedFreeHeader.hpp"
+
+/**
+ * Size index over the entries of an address ordered free list.
+ * Entries smaller than the large entry threshold are kept in segregated size class buckets (four classes per
+ * power of two), larger ones in a treap ordered by size and address. Index nodes are stored in the free memory
+ * right after the free entry header, so the index needs no storage of its own, but an entry must be removed from
+ * the index before its memory is reused or its header rewritten.
+ * The index is not thread safe; the owning memory pool serializes access with its own lock.
+ * @ingroup GC_Base_Core
+ */
+class MM_FreeEntrySizeIndex
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum {
+		SUBCLASS_SHIFT = 2, /**< log2 of the number of size classes per power of two */
+		BUCKET_COUNT = 32 /**< number of size class buckets (8 powers of two) */
+	};
+
+private:
+	struct Node {
+		Node *left; /**< left child in the treap, previous entry in a bucket */
+		Node *right; /**< right child in the treap, next entry in a bucket */
+		Node *parent; /**< parent in the treap, unused in a bucket */
+		uintptr_t size; /**< size of the free entry when it was indexed */
+	};
+
+	Node *_buckets[BUCKET_COUNT]; /**< heads of the size class buckets */
+	uintptr_t _bucketMap; /**< bit i is set when _buckets[i] is not empty */
+	Node *_treeRoot; /**< root of the treap of large entries */
+	uintptr_t _minimumEntrySizeLog2; /**< floor(log2) of the smallest entry size the index can be asked to hold */
+	uintptr_t _largeEntrySize; /**< entries at least this large are held in the treap */
+	uintptr_t _entryCount; /**< number of indexed entries */
+	bool _valid; /**< false when the index doesn't reflect the free list and must be rebuilt before use */
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE Node *getNode(MM_HeapLinkedFreeHeader *freeEntry)
+	{
+		return (Node *)((uintptr_t)freeEntry + sizeof(MM_HeapLinkedFreeHeader));
+	}
+
+	MMINLINE MM_HeapLinkedFreeHeader *getFreeEntry(Node *node)
+	{
+		return (MM_HeapLinkedFreeHeader *)((uintptr_t)node - sizeof(MM_HeapLinkedFreeHeader));
+	}
+
+	/**
+	 * Treap priority of a node, derived from its address so that no state is needed to keep the treap balanced.
+	 */
+	MMINLINE uintptr_t getPriority(Node *node)
+	{
+#if defined(OMR_ENV_DATA64)
+		return ((uintptr_t)node * (uintptr_t)0x9E3779B97F4A7C15) >> 17;
+#else /* OMR_ENV_DATA64 */
+		return ((uintptr_t)node * (uintptr_t)0x9E3779B9) >> 9;
+#endif /* OMR_ENV_DATA64 */
+	}
+
+	/**
+	 * Treap ordering: by size, then by address so that ties are broken towards the bottom of the heap.
+	 */
+	MMINLINE bool isLess(Node *node, Node *other)
+	{
+		return (node->size < other->size) || ((node->size == other->size) && (node < other));
+	}
+
+	uintptr_t getBucketIndex(uintptr_t size);
+	void rotateUp(Node *node);
+	void treeInsert(Node *node);
+	void treeRemove(Node *node);
+	MM_HeapLinkedFreeHeader *treeFindFit(uintptr_t size);
+
+public:
+	/**
+	 * Set up an empty, invalid index.
+	 * @param minimumEntrySize the minimum size of entries on the free list
+	 * @return true if entries of that size are large enough to hold an index node
+	 */
+	bool initialize(uintptr_t minimumEntrySize);
+
+	/**
+	 * Empty the index and mark it valid. The caller is then responsible for inserting every free list entry.
+	 */
+	void clear();
+
+	/**
+	 * Drop the index contents without touching the heap. The index must be rebuilt before it is used again.
+	 */
+	MMINLINE void invalidate()
+	{
+		_valid = false;
+	}
+
+	MMINLINE bool isValid()
+	{
+		return _valid;
+	}
+
+	MMINLINE uintptr_t getEntryCount()
+	{
+		return _entryCount;
+	}
+
+	/**
+	 * Add a free entry to the index.
+	 * @param freeEntry entry on the free list, with its final size set
+	 */
+	void insert(MM_HeapLinkedFreeHeader *freeEntry);
+
+	/**
+	 * Remove a free entry from the index. Must be called before the entry is consumed, resized or overwritten.
+	 * @param freeEntry entry previously inserted
+	 */
+	void remove(MM_HeapLinkedFreeHeader *freeEntry);
+
+	/**
+	 * Find an entry of at least the given size. Size class buckets are searched first and the smallest class
+	 * guaranteed to fit is preferred; within the treap the smallest fitting entry (lowest address on ties) is returned.
+	 * @param size minimum size of the entry
+	 * @return a fitting entry or NULL if there is none
+	 */
+	MM_HeapLinkedFreeHeader *findFit(uintptr_t size);
+
+	/**
+	 * Create a FreeEntrySizeIndex object.
+	 */
+	MM_FreeEntrySizeIndex()
+		: _bucketMap(0)
+		, _treeRoot(NULL)
+		, _minimumEntrySizeLog2(0)
+		, _largeEntrySize(UDATA_MAX)
+		, _entryCount(0)
+		, _valid(false)
+	{
+		for (uintptr_t i = 0; i < BUCKET_COUNT; i++) {
+			_buckets[i] = NULL;
+		}
+	}
+};
+
+#endif /* FREEENTRYSIZEINDEX_HPP_ */
@@ -37,6 +37,7 @@
 #include "Forge.hpp"
 #include "GlobalGCStats.hpp"
 #include "GlobalVLHGCStats.hpp"
+#include "HeapMapScan.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "MemoryHandle.hpp"
 #include "MixedObjectModel.hpp"
@@ -47,6 +48,7 @@
 #include "ScavengerStats.hpp"
 #include "SublistPool.hpp"
 
+class MM_AllocationLifetimeSampler;
 class MM_CardTable;
 class MM_ClassLoaderRememberedSet;
 class MM_CollectorLanguageInterface;
@@ -81,6 +83,7 @@ class MM_SweepPoolManager;
 class MM_SweepPoolManagerAddressOrderedList;
 class MM_SweepPoolManagerAddressOrderedListBase;
 class MM_RealtimeGC;
+class MM_RegionalRememberedSet;
 class MM_VerboseManagerBase;
 struct J9Pool;
 
@@ -102,6 +105,9 @@ class HeapRegionStateTable;
 #define DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE 512
 #define DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE 16384
 
+/* The largest number of popped objects marking prefetches ahead of the one being scanned (see markPrefetchDepth). */
+#define MARKING_SCHEME_PREFETCH_DEPTH_MAX 32
+
 #define DEFAULT_SCAN_CACHE_MAXIMUM_SIZE (128 * 1024)
 #define DEFAULT_SCAN_CACHE_MINIMUM_SIZE (8 * 1024)
 
@@ -249,9 +255,15 @@ public:
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_Scavenger *scavenger;
+	MM_AllocationLifetimeSampler *allocationLifetimeSampler; /**< attributes nursery survival to allocation sites, created by the scavenger when allocationLifetimeSamplingInterval is set */
 	void *_mainThreadTenureTLHRemainderBase;  /**< base and top pointers of the last unused tenure TLH copy cache, that will be loaded to thread env during main setup */
 	void *_mainThreadTenureTLHRemainderTop;
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_REGIONAL)
+	MM_RegionalRememberedSet *regionalRememberedSet; /**< region to region remembered set of the regional collector, updated by the write barrier */
+	uintptr_t regionalEdenSize; /**< bytes of free regions handed to allocation between regional pauses, 0 (default) sizes eden to a quarter of the heap */
+	uintptr_t regionalOldRegionsPerPause; /**< most old regions a partial regional pause adds to its collection set, which bounds the pause independently of heap size */
+#endif /* defined(OMR_GC_REGIONAL) */
 
 	J9Pool* environments;
 	MM_ExcessiveGCStats excessiveGCStats;
@@ -346,6 +358,9 @@ public:
 	uintptr_t tlhMaximumSize;
 	uintptr_t tlhInitialSize;
 	uintptr_t tlhIncrementSize;
+	bool adaptiveTLHSizing; /**< if true, each thread's TLH refresh size follows its decayed allocation rate instead of growing by tlhIncrementSize (-Xgc:adaptiveTLHSizing) */
+	uintptr_t tlhRefreshIntervalTarget; /**< with adaptiveTLHSizing, microseconds of allocation a thread's TLH is sized to last */
+	float tlhAllocationRateHistoryWeight; /**< with adaptiveTLHSizing, weight of the history (vs the newest sample) in a thread's decayed allocation rate */
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 
@@ -357,6 +372,9 @@ public:
 	uintptr_t splitFreeListSplitAmount;
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
 	bool enableHybridMemoryPool;
+	bool freeListSizeIndex; /**< if true, address ordered memory pools keep a size index of their free list and allocate non-TLH objects best fit */
+	bool lazySweep; /**< if true, a flat heap global collect only sweeps what it needs to satisfy the failed allocate, allocation and a background thread sweep the rest (-Xgc:lazySweep) */
+	bool numaAffinity; /**< if true, a Standard heap is split into one stripe per NUMA node and threads refill their TLHs from their own node's stripe first (-Xgc:numaAffinity) */
 
 	bool largeObjectArea;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -380,6 +398,8 @@ public:
 
 	bool disableExplicitGC;
 	uintptr_t heapAlignment;
+	uintptr_t heapReserveAlignment; /**< alignment of the base of the heap reservation, so that huge pages can back it from the first byte; 0 to use heapAlignment (-Xgc:heapReserveAlignment=) */
+	bool preTouchHeap; /**< fault in the memory committed for the heap at startup on the GC threads (-Xgc:preTouchHeap) */
 	uintptr_t absoluteMinimumOldSubSpaceSize;
 	uintptr_t absoluteMinimumNewSubSpaceSize;
 
@@ -399,6 +419,9 @@ public:
 
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	uintptr_t heapResizeTargetPauseTime; /**< pause in milliseconds the tenure and nursery sizes are resized towards, 0 if none (-Xgc:targetPauseTime=) */
+	uintptr_t heapResizeTargetGCPercentage; /**< percentage of time spent in gc the tenure and nursery sizes are resized towards, 0 if none (-Xgc:targetGCPercentage=) */
+	uintptr_t heapResizeHysteresis; /**< consecutive collections which must call for the same goal driven resize before it happens (-Xgc:heapResizeHysteresis=) */
 
 	float heapSizeStartupHintConservativeFactor; /**< Use only a fraction of hints stored in SC */
 	float heapSizeStartupHintWeightNewValue;		/**< Learn slowly by historic averaging of stored hints */
@@ -406,6 +429,11 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool packetListLockFree; /**< if true, the shared work packet lists use lock-free (tagged head) sublists instead of locked ones, set by -Xgc:lockFreePacketLists */
+	uintptr_t markPrefetchDepth; /**< number of popped objects prefetched ahead of the one being scanned during marking, 0 to scan each object as it is popped, otherwise 2 to MARKING_SCHEME_PREFETCH_DEPTH_MAX (-Xgc:markPrefetchDepth=) */
+
+	MM_HeapMapScan heapMapScan; /**< bulk skipping of empty or full heap map slots, specialized for the processor at startup */
+	bool vectorHeapMapScan; /**< if false, heap map scanning does not use vector instructions, set by -Xgc:noVectorHeapMapScan */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -500,6 +528,7 @@ public:
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
+	uintptr_t allocationLifetimeSamplingInterval; /**< each thread samples one allocation in this many bytes allocated to follow across scavenges, 0 (default) disables sampling */
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS, complimentary to concurrentScavengerHWSupport with CS active */
@@ -543,6 +572,8 @@ public:
 	double dnssMinimumContraction;
 	bool enableSplitHeap; /**< true if we are using gencon with -Xgc:splitheap (we will fail to boostrap if we can't allocate both ranges) */
 	double aliasInhibitingThresholdPercentage; /**< percentage of threads that can be blocked before copy cache aliasing is inhibited (set through aliasInhibitingThresholdPercentage=) */
+	bool scavengerWorkStealing; /**< if true, scan caches are queued on per-thread work-stealing deques and the scan list is only used for overflow (STW scavenge only) */
+	uintptr_t scavengerStealAttempts; /**< number of randomly chosen victims an idle thread tries to steal from before falling back to the scan list */
 
 	/* Start of variables relating to Adaptive Threading */
 	bool adaptiveGCThreading; /**< Flag to indicate whether the Scavenger Adaptive Threading Optimization is enabled*/
@@ -585,6 +616,10 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool slidingCompaction; /**< if true, compaction slides objects within each region and forwards references through a table with one summary word per 256 bytes of heap (-Xgc:slidingCompaction) */
+	bool partialCompaction; /**< if true, compactions run to satisfy a large allocation or a fragmentation forecast only evacuate the most fragmented sub areas (-Xgc:partialCompaction) */
+	uintptr_t partialCompactionMaxPercent; /**< upper bound, as a percentage of the heap, of the address range a partial compaction evacuates (-Xgc:partialCompactionMaxPercent=) */
+	uintptr_t fragmentationForecastHorizon; /**< number of global collections the fragmentation forecast projects the largest free entry ahead (-Xgc:fragmentationForecastHorizon=) */
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 	bool payAllocationTax;
@@ -600,6 +635,7 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool cardTableSummary; /**< maintain a bit per group of cards so card cleaning skips untouched heap ranges; the write barrier must set it too (-Xgc:cardTableSummary) */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -693,6 +729,7 @@ public:
 	uintptr_t traceCostToCheckYield; /**< tracing cost (in number of objects marked and pointers scanned) after we try to yield */
 	uintptr_t sweepCostToCheckYield; /**< weighted count of free chunks/marked objects before we check yield in sweep small loop */
 	uintptr_t splitAvailableListSplitAmount; /**< Number of split available lists per size class, per defragment bucket */
+	bool lockFreeRegionQueues; /**< if true, the shared queues and the free list of single regions are lock-free stacks instead of locked lists (-Xgc:lockFreeRegionQueues) */
 	uint32_t newThreadAllocationColor;
 	uintptr_t minimumFreeEntrySize;
 	uintptr_t arrayletsPerRegion;
@@ -718,6 +755,10 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool binaryVerboseLog; /**< Enabled by -Xgc:binaryVerboseLog.  Record verbose:gc file logs as fixed layout binary events in a memory mapped ring instead of formatting XML */
+	uintptr_t binaryVerboseLogRecords; /**< number of records in the binary verbose:gc ring, rounded up to a power of two (-Xgc:binaryVerboseLogRecords=) */
+	bool asyncVerboseLog; /**< Enabled by -Xgc:asyncVerboseLog.  Hand verbose:gc file output to a low priority writer thread instead of writing it on the GC threads */
+	uintptr_t asyncVerboseLogBufferSize; /**< bytes of verbose:gc output the asynchronous writer may hold before it drops output (-Xgc:asyncVerboseLogBufferSize=) */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -946,6 +987,11 @@ public:
 	MMINLINE void setObjectMap(MM_ObjectMap *objectMap) { _objectMap = objectMap; }
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
+	/**
+	 * @return true if the heap is resized towards pause and gc time targets instead of the free space and gc ratio thresholds
+	 */
+	MMINLINE bool isGoalDrivenHeapResizing() { return (0 != heapResizeTargetPauseTime) || (0 != heapResizeTargetGCPercentage); }
+
 	MMINLINE bool
 	isConcurrentScavengerEnabled()
 	{
@@ -1482,9 +1528,15 @@ public:
 		, _tenureSize(0)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, scavenger(NULL)
+		, allocationLifetimeSampler(NULL)
 		, _mainThreadTenureTLHRemainderBase(NULL)
 		, _mainThreadTenureTLHRemainderTop(NULL)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_REGIONAL)
+		, regionalRememberedSet(NULL)
+		, regionalEdenSize(0)
+		, regionalOldRegionsPerPause(4)
+#endif /* defined(OMR_GC_REGIONAL) */
 		, environments(NULL)
 		, excessiveGCStats()
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
@@ -1559,6 +1611,9 @@ public:
 		, tlhMaximumSize(131072)
 		, tlhInitialSize(2048)
 		, tlhIncrementSize(4096)
+		, adaptiveTLHSizing(false)
+		, tlhRefreshIntervalTarget(1000)
+		, tlhAllocationRateHistoryWeight(0.7f)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
 		, allocationStats()
@@ -1568,6 +1623,9 @@ public:
 		, splitFreeListSplitAmount(0)
 		, splitFreeListNumberChunksPrepared(0)
 		, enableHybridMemoryPool(false)
+		, freeListSizeIndex(false)
+		, lazySweep(false)
+		, numaAffinity(false)
 		, largeObjectArea(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 		, largeObjectMinimumSize(64 * 1024)
@@ -1583,6 +1641,8 @@ public:
 #endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
 		, disableExplicitGC(false)
 		, heapAlignment(HEAP_ALIGNMENT)
+		, heapReserveAlignment(0)
+		, preTouchHeap(false)
 		, absoluteMinimumOldSubSpaceSize(MINIMUM_OLD_SPACE_SIZE)
 		, absoluteMinimumNewSubSpaceSize(MINIMUM_NEW_SPACE_SIZE)
 		, darkMatterCompactThreshold((float)0.15)
@@ -1598,11 +1658,18 @@ public:
 		, heapContractionGCRatioThreshold()
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, heapResizeTargetPauseTime(0)
+		, heapResizeTargetGCPercentage(0)
+		, heapResizeHysteresis(3)
 		, heapSizeStartupHintConservativeFactor((float)0.7)
 		, heapSizeStartupHintWeightNewValue((float)0.8)
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, packetListLockFree(false)
+		, markPrefetchDepth(0)
+		, heapMapScan()
+		, vectorHeapMapScan(true)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1680,6 +1747,7 @@ public:
 		, scvTenureStrategyHistory(true)
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
+		, allocationLifetimeSamplingInterval(0)
 		, cacheListSplit(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
@@ -1721,6 +1789,8 @@ public:
 		, dnssMinimumContraction(0.0)
 		, enableSplitHeap(false)
 		, aliasInhibitingThresholdPercentage(0.20)
+		, scavengerWorkStealing(false)
+		, scavengerStealAttempts(4)
 		, adaptiveGCThreading(true)
 		, adaptiveThreadingSensitivityFactor(1.0f)
 		, adaptiveThreadingWeightActiveThreads(0.50f)
@@ -1748,6 +1818,10 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, slidingCompaction(false)
+		, partialCompaction(false)
+		, partialCompactionMaxPercent(25)
+		, fragmentationForecastHorizon(3)
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1761,6 +1835,7 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, cardTableSummary(false)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1829,6 +1904,7 @@ public:
 		, traceCostToCheckYield(500) /* weighted sum of marked objects and scanned pointers before we check yield in main tracing loop */
 		, sweepCostToCheckYield(500) /* weighted count of free chunks/marked objects before we check yield in sweep small loop */
 		, splitAvailableListSplitAmount(0)
+		, lockFreeRegionQueues(false)
 		, newThreadAllocationColor(0)
 		, minimumFreeEntrySize((uintptr_t)-1) /* -1 => user did not override default minimumFreeEntrySize */
 		, arrayletsPerRegion(0)
@@ -1848,6 +1924,10 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, binaryVerboseLog(false)
+		, binaryVerboseLogRecords(16 * 1024)
+		, asyncVerboseLog(false)
+		, asyncVerboseLogBufferSize(1024 * 1024)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
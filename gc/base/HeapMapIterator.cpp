@@ -131,6 +131,18 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Skip the rest of an empty run in bulk. The range is rounded up to whole map slots, as the loop
+				 * above would also read the slot holding the chunk top.
+				 */
+				uintptr_t heapMapSlotsLeft = MM_Math::roundToCeiling(J9MODRON_HMI_HEAPMAP_ALIGNMENT, (uintptr_t)_heapChunkTop - (uintptr_t)_heapSlotCurrent) / J9MODRON_HMI_HEAPMAP_ALIGNMENT;
+				uintptr_t *heapMapSlotNext = _extensions->heapMapScan.skipSlots(_heapMapSlotCurrent + 1, _heapMapSlotCurrent + heapMapSlotsLeft, J9MODRON_HMI_SLOT_EMPTY);
+				_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNext - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = heapMapSlotNext;
+				if (_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "HeapMapScan.hpp"
+
+#include "Bits.hpp"
+
+/* The vector paths are compiled with per-function target attributes so that the rest of the GC keeps
+ * the baseline instruction set; they are only ever called after the processor check in initialize().
+ */
+#if defined(OMR_ARCH_X86) && (defined(__GNUC__) || defined(__clang__))
+#define OMR_GC_HEAPMAPSCAN_X86
+#include <immintrin.h>
+#elif defined(OMR_ARCH_AARCH64) && defined(__ARM_NEON)
+#define OMR_GC_HEAPMAPSCAN_ASIMD
+#include <arm_neon.h>
+#endif
+
+#define SLOTS_PER_BYTES(bytes) ((bytes) / sizeof(uintptr_t))
+
+uintptr_t *
+MM_HeapMapScan::skipSlotsScalar(uintptr_t *slot, uintptr_t *slotTop, uintptr_t pattern)
+{
+	while ((slot < slotTop) && (pattern == *slot)) {
+		slot += 1;
+	}
+	return slot;
+}
+
+#if defined(OMR_GC_HEAPMAPSCAN_X86)
+/**
+ * Compare one 256-bit vector of slots against the pattern.
+ * @return a bit per slot, set if the slot equals the pattern
+ */
+__attribute__((target("avx2"))) static MMINLINE uintptr_t
+matchSlotsAVX2(const uintptr_t *slot, __m256i patternVector)
+{
+	__m256i vector = _mm256_loadu_si256((const __m256i *)slot);
+#if defined(OMR_ENV_DATA64)
+	return (uintptr_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(vector, patternVector)));
+#else /* OMR_ENV_DATA64 */
+	return (uintptr_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(vector, patternVector)));
+#endif /* OMR_ENV_DATA64 */
+}
+
+/**
+ * Two 256-bit lanes, 512 bits of the map, per iteration. The mismatching slot is located from the
+ * comparison masks, so the scalar loop only handles the tail of the range.
+ */
+__attribute__((target("avx2"))) static uintptr_t *
+skipSlotsAVX2(uintptr_t *slot, uintptr_t *slotTop, uintptr_t pattern)
+{
+#if defined(OMR_ENV_DATA64)
+	__m256i patternVector = _mm256_set1_epi64x((long long)pattern);
+#else /* OMR_ENV_DATA64 */
+	__m256i patternVector = _mm256_set1_epi32((int)pattern);
+#endif /* OMR_ENV_DATA64 */
+	uintptr_t const lanes = SLOTS_PER_BYTES(sizeof(__m256i));
+	uintptr_t const allMatch = ((uintptr_t)1 << lanes) - 1;
+
+	while ((uintptr_t)(slotTop - slot) >= (2 * lanes)) {
+		uintptr_t match = matchSlotsAVX2(slot, patternVector) | (matchSlotsAVX2(slot + lanes, patternVector) << lanes);
+		if (((allMatch << lanes) | allMatch) != match) {
+			return slot + MM_Bits::leadingZeroes(~match);
+		}
+		slot += 2 * lanes;
+	}
+	if ((uintptr_t)(slotTop - slot) >= lanes) {
+		uintptr_t match = matchSlotsAVX2(slot, patternVector);
+		if (allMatch != match) {
+			return slot + MM_Bits::leadingZeroes(~match);
+		}
+		slot += lanes;
+	}
+
+	return MM_HeapMapScan::skipSlotsScalar(slot, slotTop, pattern);
+}
+
+/**
+ * @return the OS enabled state components from XCR0. Only valid if the processor reports OSXSAVE.
+ */
+static uint64_t
+readXCR0()
+{
+	uint32_t eax = 0;
+	uint32_t edx = 0;
+	__asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+	return ((uint64_t)edx << 32) | eax;
+}
+
+#define XCR0_AVX_STATE ((uint64_t)0x6) /* SSE and AVX (YMM) state */
+#endif /* OMR_GC_HEAPMAPSCAN_X86 */
+
+#if defined(OMR_GC_HEAPMAPSCAN_ASIMD)
+/**
+ * Four 128-bit lanes per iteration.
+ */
+static uintptr_t *
+skipSlotsASIMD(uintptr_t *slot, uintptr_t *slotTop, uintptr_t pattern)
+{
+	uint64x2_t patternVector = vdupq_n_u64((uint64_t)pattern);
+	uintptr_t const stride = SLOTS_PER_BYTES(4 * sizeof(uint64x2_t));
+
+	while ((uintptr_t)(slotTop - slot) >= stride) {
+		const uint64_t *base = (const uint64_t *)slot;
+		uint64x2_t difference = veorq_u64(vld1q_u64(base), patternVector);
+		difference = vorrq_u64(difference, veorq_u64(vld1q_u64(base + 2), patternVector));
+		difference = vorrq_u64(difference, veorq_u64(vld1q_u64(base + 4), patternVector));
+		difference = vorrq_u64(difference, veorq_u64(vld1q_u64(base + 6), patternVector));
+		if (0 != vmaxvq_u32(vreinterpretq_u32_u64(difference))) {
+			break;
+		}
+		slot += stride;
+	}
+
+	return MM_HeapMapScan::skipSlotsScalar(slot, slotTop, pattern);
+}
+#endif /* OMR_GC_HEAPMAPSCAN_ASIMD */
+
+void
+MM_HeapMapScan::initialize(OMRPortLibrary *portLibrary, bool allowVector)
+{
+	_skipSlots = skipSlotsScalar;
+	_implementation = scan_scalar;
+
+#if defined(OMR_GC_HEAPMAPSCAN_X86) || defined(OMR_GC_HEAPMAPSCAN_ASIMD)
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRProcessorDesc processorDescription;
+
+	if (allowVector && (0 == omrsysinfo_get_processor_description(&processorDescription))) {
+#if defined(OMR_GC_HEAPMAPSCAN_X86)
+		/* the processor flags only say the instructions exist, the OS must also save the wider registers */
+		if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_OSXSAVE)) {
+			/* 512-bit operations are deliberately not used: the scans are short bursts between scalar work and
+			 * the frequency transitions they cause cost more than the wider loads gain
+			 */
+			if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX2)
+				&& (XCR0_AVX_STATE == (readXCR0() & XCR0_AVX_STATE))
+			) {
+				_skipSlots = skipSlotsAVX2;
+				_implementation = scan_avx2;
+			}
+		}
+#elif defined(OMR_GC_HEAPMAPSCAN_ASIMD)
+		if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_ARM64_ASIMD)) {
+			_skipSlots = skipSlotsASIMD;
+			_implementation = scan_asimd;
+		}
+#endif /* OMR_GC_HEAPMAPSCAN_X86 */
+	}
+#endif /* OMR_GC_HEAPMAPSCAN_X86 || OMR_GC_HEAPMAPSCAN_ASIMD */
+}
+
+const char *
+MM_HeapMapScan::getImplementationName()
+{
+	const char *name = "scalar";
+	switch (_implementation) {
+	case scan_avx2:
+		name = "avx2";
+		break;
+	case scan_asimd:
+		name = "asimd";
+		break;
+	default:
+		break;
+	}
+	return name;
+}
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPSCAN_HPP_)
+#define HEAPMAPSCAN_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "modronbase.h"
+
+/**
+ * Skips runs of identical heap map slots (all clear or all set) in bulk. The card table uses it
+ * the same way to skip runs of clean cards, a uintptr_t of cards per slot.
+ * The implementation is picked once at startup from the vector extensions the processor reports
+ * (AVX2 on x86, ASIMD on aarch64) and falls back to a scalar loop everywhere else.
+ * Short runs, which dominate on dense heaps, are resolved inline without going through the dispatch.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapScan
+{
+	/* Data Members */
+public:
+	typedef uintptr_t *(*SkipFunction)(uintptr_t *slot, uintptr_t *slotTop, uintptr_t pattern);
+
+	enum Implementation {
+		scan_scalar = 0,
+		scan_avx2,
+		scan_asimd
+	};
+
+	enum {
+		INLINE_PROBE_SLOTS = 4 /**< slots compared inline before dispatching to the bulk implementation */
+	};
+
+private:
+	SkipFunction _skipSlots; /**< bulk implementation selected for this processor */
+	Implementation _implementation; /**< identifies _skipSlots */
+
+	/* Member Functions */
+public:
+	/**
+	 * Select the widest implementation supported by the processor.
+	 * @param[in] portLibrary port library used to query processor features
+	 * @param[in] allowVector if false, always use the scalar implementation
+	 */
+	void initialize(OMRPortLibrary *portLibrary, bool allowVector);
+
+	/**
+	 * Find the first slot in [slot, slotTop) which differs from pattern.
+	 * @param[in] slot first heap map slot to examine
+	 * @param[in] slotTop end of the range (exclusive)
+	 * @param[in] pattern slot value to skip, typically 0 (no marked objects) or UDATA_MAX (all bits set)
+	 * @return the first slot not equal to pattern, or slotTop if there is none
+	 */
+	MMINLINE uintptr_t *
+	skipSlots(uintptr_t *slot, uintptr_t *slotTop, uintptr_t pattern)
+	{
+		uintptr_t *probeTop = slot + INLINE_PROBE_SLOTS;
+		if (probeTop > slotTop) {
+			probeTop = slotTop;
+		}
+		while (slot < probeTop) {
+			if (pattern != *slot) {
+				return slot;
+			}
+			slot += 1;
+		}
+		if (slot < slotTop) {
+			slot = _skipSlots(slot, slotTop, pattern);
+		}
+		return slot;
+	}
+
+	MMINLINE Implementation getImplementation() { return _implementation; }
+
+	/**
+	 * @return printable name of the selected implementation
+	 */
+	const char *getImplementationName();
+
+	/**
+	 * Portable implementation, one slot at a time.
+	 */
+	static uintptr_t *skipSlotsScalar(uintptr_t *slot, uintptr_t *slotTop, uintptr_t pattern);
+
+	/**
+	 * Create a HeapMapScan object, using the scalar implementation until initialized.
+	 */
+	MM_HeapMapScan()
+		: _skipSlots(skipSlotsScalar)
+		, _implementation(scan_scalar)
+	{}
+};
+
+#endif /* HEAPMAPSCAN_HPP_ */
@@ -321,15 +321,76 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
+	uintptr_t prefetchDepth = _extensions->markPrefetchDepth;
+	Assert_MM_true(prefetchDepth <= MARKING_SCHEME_PREFETCH_DEPTH_MAX);
 	do {
-		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
-			env->_markStats._bytesScanned += scanObject(env, objectPtr);
-			env->_markStats._objectsScanned += 1;
+		if (1 < prefetchDepth) {
+			completeScanPrefetching(env, prefetchDepth);
+		} else {
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+			}
 		}
 	} while (_workPackets->handleWorkPacketOverflow(env));
 }
 
+void
+MM_MarkingScheme::completeScanPrefetching(MM_EnvironmentBase *env, uintptr_t prefetchDepth)
+{
+	omrobjectptr_t pending[MARKING_SCHEME_PREFETCH_DEPTH_MAX];
+	uintptr_t head = 0;
+	uintptr_t count = 0;
+
+	while (true) {
+		omrobjectptr_t objectPtr = NULL;
+		if (0 == count) {
+			/* Only wait for work (and so take part in termination) while holding no pending objects */
+			objectPtr = (omrobjectptr_t)env->_workStack.pop(env);
+			if (NULL == objectPtr) {
+				break;
+			}
+			if ((env->_workStack.inputPacketSize() < prefetchDepth) || isArraySplitTagNext(env)) {
+				/* Too little work to hide any latency, or the object has to find its array split tag: scan it as it is popped */
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+				continue;
+			}
+			MARKING_SCHEME_PREFETCH(objectPtr);
+			pending[head] = objectPtr;
+			count = 1;
+		}
+
+		/* Top up the FIFO without waiting, prefetching each object as it enters so its header is in
+		 * cache by the time it reaches the front
+		 */
+		while (count < prefetchDepth) {
+			objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env);
+			if (NULL == objectPtr) {
+				break;
+			}
+			if (isArraySplitTagNext(env)) {
+				/* The tag now on top of the packet belongs to this object, which peeks for it when scanned:
+				 * scan it ahead of the FIFO and stop filling, so no other object is scanned in between
+				 */
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+				break;
+			}
+			MARKING_SCHEME_PREFETCH(objectPtr);
+			pending[(head + count) % prefetchDepth] = objectPtr;
+			count += 1;
+		}
+
+		objectPtr = pending[head];
+		head = (head + 1) % prefetchDepth;
+		count -= 1;
+		env->_markStats._bytesScanned += scanObject(env, objectPtr);
+		env->_markStats._objectsScanned += 1;
+	}
+}
+
 /****************************************
  * Marking Core Functionality
  ****************************************/
@@ -38,6 +38,12 @@
 #include "ObjectScannerState.hpp"
 #include "WorkStack.hpp"
 
+#if defined(__GNUC__) || defined(__clang__)
+#define MARKING_SCHEME_PREFETCH(objectPtr) __builtin_prefetch((const void *)(objectPtr), 0, 3)
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define MARKING_SCHEME_PREFETCH(objectPtr)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
 /**
  * @todo Provide class documentation
  */
@@ -76,6 +82,23 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Private internal. Called exclusively from completeScan();
+	 * Scan until the work stack is empty, keeping up to prefetchDepth popped objects in a FIFO whose
+	 * headers are prefetched while the objects ahead of them are scanned.
+	 */
+	void completeScanPrefetching(MM_EnvironmentBase *env, uintptr_t prefetchDepth);
+
+	/**
+	 * Private internal. Called exclusively from completeScanPrefetching();
+	 * @return true if the entry on top of the input packet is an array split tag, which belongs to the object popped last
+	 */
+	MMINLINE bool
+	isArraySplitTagNext(MM_EnvironmentBase *env)
+	{
+		return PACKET_ARRAY_SPLIT_TAG == ((uintptr_t)env->_workStack.peek(env) & PACKET_ARRAY_SPLIT_TAG);
+	}
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
@@ -75,6 +75,12 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 
 	uintptr_t allocateSize = size;
 
+	/* the reservation is over-allocated so that its base can be aligned, to a huge page boundary if requested */
+	uintptr_t baseAlignment = heapAlignment;
+	if (extensions->heapReserveAlignment > baseAlignment) {
+		baseAlignment = MM_Math::roundToCeiling(heapAlignment, extensions->heapReserveAlignment);
+	}
+
 	uintptr_t concurrentScavengerPageSize = 0;
 	if (extensions->isConcurrentScavengerHWSupported()) {
 		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
@@ -86,12 +92,15 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 		 */
 		concurrentScavengerPageSize = extensions->getConcurrentScavengerPageSectionSize() * CONCURRENT_SCAVENGER_PAGE_SECTIONS;
 		allocateSize += concurrentScavengerPageSize;
+		if (baseAlignment > heapAlignment) {
+			allocateSize += (baseAlignment - heapAlignment);
+		}
 		if (extensions->isDebugConcurrentScavengerPageAlignment()) {
 			omrtty_printf("Requested heap size 0x%zx has been extended to 0x%zx for guaranteed alignment\n", size, allocateSize);
 		}
 	} else {
-		if (heapAlignment > pageSize) {
-			allocateSize += (heapAlignment - pageSize);
+		if (baseAlignment > pageSize) {
+			allocateSize += (baseAlignment - pageSize);
 		}
 	}
 
@@ -131,14 +140,14 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 
 	if (NULL == ceiling) {
 		instance = MM_VirtualMemory::newInstance(env, heapAlignment, allocateSize, pageSize, pageFlags, tailPadding, preferredAddress,
-												 ceiling, mode, options, memoryCategory);
+												 ceiling, mode, options, memoryCategory, baseAlignment);
 
 #if defined(OMR_ENV_DATA64) && defined(OMR_GC_FULL_POINTERS)
 		if (!env->compressObjectReferences()) {
 			if (1 == extensions->fvtest_enableReadBarrierVerification) {
 				MM_VirtualMemory* instanceShadow = MM_VirtualMemory::newInstance(env, heapAlignment, allocateSize, pageSize, pageFlags,
 						tailPadding, preferredAddress, (void*)OMR_MIN(NON_SCALING_LOW_MEMORY_HEAP_CEILING,
-						(uintptr_t)ceiling), mode, options, memoryCategory);
+						(uintptr_t)ceiling), mode, options, memoryCategory, baseAlignment);
 
 				extensions->shadowHeapBase = instanceShadow->getHeapBase();
 				extensions->shadowHeapTop = instanceShadow->getHeapTop();
@@ -214,7 +223,7 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 				options |= OMRPORT_VMEM_ALLOC_DIR_BOTTOM_UP;
 
 				/* An attempt to allocate memory chunk for heap for Concurrent Scavenger */
-				instance = MM_VirtualMemory::newInstance(env, heapAlignment, allocateSize, pageSize, pageFlags, tailPadding, preferredAddress, ceilingToRequest, mode, options, memoryCategory);
+				instance = MM_VirtualMemory::newInstance(env, heapAlignment, allocateSize, pageSize, pageFlags, tailPadding, preferredAddress, ceilingToRequest, mode, options, memoryCategory, baseAlignment);
 			} else {
 				if (requestedTopAddress <= ceiling) {
 					bool allocationTopDown = true;
@@ -232,14 +241,14 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 						void* maxAddress = (void *)(((uintptr_t)1 << 32) << extensions->forcedShiftingCompressionAmount);
 
 						instance = MM_VirtualMemory::newInstance(env, heapAlignment, allocateSize, pageSize, pageFlags, tailPadding, preferredAddress,
-								maxAddress, mode, options, memoryCategory);
+								maxAddress, mode, options, memoryCategory, baseAlignment);
 					} else {
 						if (requestedTopAddress < (void*)NON_SCALING_LOW_MEMORY_HEAP_CEILING) {
 							/*
 							 * Attempt to allocate heap below 4G
 							 */
 							instance = MM_VirtualMemory::newInstance(env, heapAlignment, allocateSize, pageSize, pageFlags, tailPadding, preferredAddress,
-																	 (void*)OMR_MIN(NON_SCALING_LOW_MEMORY_HEAP_CEILING, (uintptr_t)ceiling), mode, options, memoryCategory);
+																	 (void*)OMR_MIN(NON_SCALING_LOW_MEMORY_HEAP_CEILING, (uintptr_t)ceiling), mode, options, memoryCategory, baseAlignment);
 						}
 
 						if ((NULL == instance) && (ceiling > (void*)NON_SCALING_LOW_MEMORY_HEAP_CEILING)) {
@@ -263,7 +272,7 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 									 * Attempt to allocate heap below 32G
 									 */
 									instance = MM_VirtualMemory::newInstance(env, heapAlignment, allocateSize, pageSize, pageFlags, tailPadding, preferredAddress,
-																			 (void*)OMR_MIN((uintptr_t)THIRTY_TWO_GB_ADDRESS, (uintptr_t)ceiling), mode, options, memoryCategory);
+																			 (void*)OMR_MIN((uintptr_t)THIRTY_TWO_GB_ADDRESS, (uintptr_t)ceiling), mode, options, memoryCategory, baseAlignment);
 								}
 							}
 
@@ -272,7 +281,7 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 							 */
 							if ((NULL == instance) && (ceiling > (void *)THIRTY_TWO_GB_ADDRESS)) {
 								instance = MM_VirtualMemory::newInstance(env, heapAlignment, allocateSize, pageSize, pageFlags, tailPadding, preferredAddress,
-																		 ceiling, mode, options, memoryCategory);
+																		 ceiling, mode, options, memoryCategory, baseAlignment);
 							}
 						}
 					}
@@ -292,6 +292,17 @@ public:
 		return handle->getMemoryTop();
 	};
 
+	/**
+	 * Return the end of the memory reserved for the virtual memory object, which the heap top never exceeds.
+	 *
+	 * @param handle pointer to memory handle
+	 * @return pointer to the first byte after the reservation
+	 */
+	MMINLINE void* getReserveTop(MM_MemoryHandle* handle)
+	{
+		return handle->getVirtualMemory()->getReserveTop();
+	};
+
 	/**
 	 * Return the size of the pages used in the virtual memory object
 	 *
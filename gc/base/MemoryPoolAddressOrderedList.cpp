@@ -142,6 +142,12 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	/* the size index relies on every change to the free list between collections being made through this pool */
+	_sizeIndexEnabled = ext->freeListSizeIndex && !ext->isVLHGC() && _sizeIndex.initialize(_minimumFreeEntrySize);
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	_sizeIndexEnabled = _sizeIndexEnabled && !ext->concurrentSweep;
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
 	_hintActive = NULL;
 	_hintLru = 0;
 
@@ -453,9 +459,26 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 		_heapLock.acquire();
 	}
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
+	if (prepareSizeIndex()) {
+		/* Best fit from the size index. The object is carved from the top of the entry so the entry keeps its place
+		 * in the list, which requires the entry to be large enough to leave a valid free entry behind.
+		 */
+		MM_HeapLinkedFreeHeader *fitEntry = _sizeIndex.findFit(sizeInBytesRequired + _minimumFreeEntrySize);
+		if (NULL != fitEntry) {
+			addrBase = allocateFromFreeEntryTop(fitEntry, sizeInBytesRequired);
+
+			if (NULL != largeObjectAllocateStats) {
+				largeObjectAllocateStats->allocateObject(sizeInBytesRequired);
+			}
+			if (lockingRequired) {
+				_heapLock.release();
+			}
+			return addrBase;
+		}
+		/* no entry can be split, fall back to walking the list for an entry that fits exactly enough */
+	}
+
 retry:
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	currentFreeEntry = _heapFreeList;
 	previousFreeEntry = NULL;
@@ -504,11 +527,9 @@ retry:
 
 	/* Check if an entry was found */
 	if(!currentFreeEntry) {
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 		if(_memorySubSpace->replenishPoolForAllocate(env, this, sizeInBytesRequired)) {
 			goto retry;
 		}
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 		goto fail_allocate;
 	}
 
@@ -530,10 +551,12 @@ retry:
 
 	addrBase = (void *)currentFreeEntry;
 	recycleEntry = (MM_HeapLinkedFreeHeader *)(((uint8_t *)currentFreeEntry) + sizeInBytesRequired);
+	sizeIndexRemove(currentFreeEntry);
 
 	if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize, previousFreeEntry, currentFreeEntry->getNext(compressed))) {
 		updatePrevCardUnalignedFreeEntry(currentFreeEntry->getNext(compressed), recycleEntry);
 		updateHint(currentFreeEntry, recycleEntry);
+		sizeIndexInsert(recycleEntry);
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		updatePrevCardUnalignedFreeEntry(currentFreeEntry->getNext(compressed), previousFreeEntry);
@@ -570,6 +593,30 @@ fail_allocate:
 	return NULL;
 }
 
+void *
+MM_MemoryPoolAddressOrderedList::allocateFromFreeEntryTop(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t sizeInBytesRequired)
+{
+	uintptr_t freeEntrySize = freeEntry->getSize();
+	uintptr_t remainingSize = freeEntrySize - sizeInBytesRequired;
+	Assert_MM_true(remainingSize >= _minimumFreeEntrySize);
+
+	/* The entry only shrinks, so hints and the list links stay valid */
+	_sizeIndex.remove(freeEntry);
+	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(freeEntrySize);
+	freeEntry->setSize(remainingSize);
+	_sizeIndex.insert(freeEntry);
+	_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(remainingSize);
+
+	/* Adjust the free memory size */
+	_freeMemorySize -= sizeInBytesRequired;
+
+	/* Update allocation statistics */
+	_allocCount += 1;
+	_allocBytes += sizeInBytesRequired;
+
+	return (void *)((uintptr_t)freeEntry + remainingSize);
+}
+
 void *
 MM_MemoryPoolAddressOrderedList::allocateObject(MM_EnvironmentBase *env,  MM_AllocateDescription *allocDescription)
 {
@@ -648,7 +695,6 @@ MM_MemoryPoolAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase *env, ui
 
 retry:
 	freeEntry = _heapFreeList;
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 
 	/* Check if an entry was found */
 	if(!freeEntry) {
@@ -657,13 +703,6 @@ retry:
 		}
 		goto fail_allocate;
 	}
-#else /* OMR_GC_CONCURRENT_SWEEP */
-
-	/* Check if an entry was found */
-	if(!freeEntry) {
-		goto fail_allocate;
-	}
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	if (doesNeedCardAlignment(env, freeEntry)) {
 		freeEntry = doFreeEntryCardAlignmentUpTo(env, freeEntry);
@@ -673,6 +712,7 @@ retry:
 	}
 
 	freeEntrySize = freeEntry->getSize();
+	sizeIndexRemove(freeEntry);
 
 	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(freeEntrySize);
 
@@ -707,6 +747,7 @@ retry:
 		/* Recycle the remaining entry back onto the free list (if applicable) */
 		if (recycleHeapChunk(addrTop, topOfRecycledChunk, NULL, entryNext)) {
 			updatePrevCardUnalignedFreeEntry(entryNext, (MM_HeapLinkedFreeHeader *)addrTop);
+			sizeIndexInsert((MM_HeapLinkedFreeHeader *)addrTop);
 			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 		} else {
 			updatePrevCardUnalignedFreeEntry(entryNext, FREE_ENTRY_END);
@@ -822,6 +863,7 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	MM_MemoryPool::reset(cause);
 
 	clearHints();
+	_sizeIndex.invalidate();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
 	_scannableBytes = 0;
 	_nonScannableBytes = 0;
@@ -835,6 +877,28 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	resetLargeObjectAllocateStats();
 }
 
+void
+MM_MemoryPoolAddressOrderedList::postProcess(MM_EnvironmentBase *env, Cause cause)
+{
+	/* rebuild the size index while the collector still owns the pool rather than on the next allocate */
+	if (_sizeIndexEnabled) {
+		rebuildSizeIndex();
+	}
+}
+
+void
+MM_MemoryPoolAddressOrderedList::rebuildSizeIndex()
+{
+	bool const compressed = compressObjectReferences();
+
+	_sizeIndex.clear();
+	MM_HeapLinkedFreeHeader *freeEntry = _heapFreeList;
+	while (NULL != freeEntry) {
+		_sizeIndex.insert(freeEntry);
+		freeEntry = freeEntry->getNext(compressed);
+	}
+}
+
 /**
  * As opposed to reset, which will empty out, this will fill out as if everything is free.
  * Returns the freelist entry created at the end of the given region
@@ -923,6 +987,9 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		return ;
 	}
 
+	/* heap resizing is rare, let the size index be rebuilt rather than updated */
+	_sizeIndex.invalidate();
+
 	/* Find the free entries in the list the appear before/after the range being added */
 	previousFreeEntry = NULL;
 	nextFreeEntry = _heapFreeList;
@@ -1029,6 +1096,8 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	_sizeIndex.invalidate();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -1115,6 +1184,9 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 	bool const compressed = compressObjectReferences();
 	uintptr_t localFreeListMemoryCount = freeListMemoryCount;
 
+	/* only done when the LOA is resized or after compaction, let the size index be rebuilt */
+	_sizeIndex.invalidate();
+
 	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
 
 	while (currentFreeEntry != NULL) {
@@ -1180,6 +1252,62 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 	_freeEntryCount += localFreeListMemoryCount;
 }
 
+MM_HeapLinkedFreeHeader *
+MM_MemoryPoolAddressOrderedList::detachFreeList()
+{
+	MM_HeapLinkedFreeHeader *freeList = _heapFreeList;
+	_heapFreeList = NULL;
+	return freeList;
+}
+
+void
+MM_MemoryPoolAddressOrderedList::reattachFreeList(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeList, uintptr_t freeBytes, uintptr_t freeEntryCount, uintptr_t largestFreeEntry)
+{
+	bool const compressed = compressObjectReferences();
+	bool const indexed = _sizeIndex.isValid();
+	uintptr_t entryCount = _freeEntryCount + freeEntryCount;
+	uintptr_t largestEntry = OMR_MAX(getLargestFreeEntry(), largestFreeEntry);
+
+	/* the detached entries are still indexed, only the ones connected since need to be added */
+	if (indexed) {
+		MM_HeapLinkedFreeHeader *freeEntry = _heapFreeList;
+		while (NULL != freeEntry) {
+			_sizeIndex.insert(freeEntry);
+			freeEntry = freeEntry->getNext(compressed);
+		}
+	}
+
+	if (NULL != freeList) {
+		MM_HeapLinkedFreeHeader *freeListTail = freeList;
+		while (NULL != freeListTail->getNext(compressed)) {
+			freeListTail = freeListTail->getNext(compressed);
+		}
+
+		assume0((NULL == _heapFreeList) || (freeListTail < _heapFreeList));
+		if ((NULL != _heapFreeList) && ((uint8_t *)freeListTail->afterEnd() == (uint8_t *)_heapFreeList)) {
+			if (indexed) {
+				_sizeIndex.remove(freeListTail);
+				_sizeIndex.remove(_heapFreeList);
+			}
+			_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(_heapFreeList->getSize());
+			_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(freeListTail->getSize());
+			freeListTail->expandSize(_heapFreeList->getSize());
+			freeListTail->setNext(_heapFreeList->getNext(compressed), compressed);
+			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(freeListTail->getSize());
+			if (indexed) {
+				_sizeIndex.insert(freeListTail);
+			}
+			entryCount -= 1;
+			largestEntry = OMR_MAX(largestEntry, freeListTail->getSize());
+		} else {
+			freeListTail->setNext(_heapFreeList, compressed);
+		}
+		_heapFreeList = freeList;
+	}
+
+	updateMemoryPoolStatistics(env, _freeMemorySize + freeBytes, entryCount, largestEntry);
+}
+
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 /**
  * Remove all free entries in a specified range from pool and return to caller
@@ -1215,6 +1343,8 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	_sizeIndex.invalidate();
+
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1587,6 +1717,8 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	_sizeIndex.invalidate();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1640,6 +1772,8 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(MM_EnvironmentBase *env, void
 	intptr_t freeEntryCount = 1;
 	_heapLock.acquire();
 
+	_sizeIndex.invalidate();
+
 	MM_HeapLinkedFreeHeader  *currentFreeEntry = _heapFreeList;
 	MM_HeapLinkedFreeHeader  *nextFreeEntry = NULL;
 	MM_HeapLinkedFreeHeader  *previousFreeEntry = NULL;
@@ -1843,6 +1977,8 @@ MM_MemoryPoolAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env)
 {
 	uintptr_t releasedBytes = 0;
 	_heapLock.acquire();
+	/* decommitted pages may hold size index nodes */
+	_sizeIndex.invalidate();
 	releasedBytes = releaseFreeEntryMemoryPages(env, _heapFreeList);
 	_heapLock.release();
 	return releasedBytes;
@@ -1858,6 +1994,8 @@ MM_MemoryPoolAddressOrderedList::doFreeEntryCardAlignmentUpTo(MM_EnvironmentBase
 
 	uintptr_t lostToAlignment = 0;
 
+	_sizeIndex.invalidate();
+
 	uintptr_t freeBytes = _freeMemorySize;
 	uintptr_t freeEntryCount = _freeEntryCount;
 	while ((currentFreeEntry <= lastFreeEntryToAlign) && (NULL != currentFreeEntry)) {
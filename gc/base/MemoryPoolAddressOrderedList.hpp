@@ -27,6 +27,7 @@
 #include "omrcomp.h"
 #include "modronopt.h"
 
+#include "FreeEntrySizeIndex.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LightweightNonReentrantLock.hpp"
 #include "MemoryPoolAddressOrderedListBase.hpp"
@@ -68,6 +69,9 @@ private:
 
 	void *_parallelGCAlignmentBase; /**< Base address of the region where the pool resides */
 	uintptr_t _parallelGCAlignmentSize; /**<  Fixed Size used to determine boundaries for alignment. */
+
+	MM_FreeEntrySizeIndex _sizeIndex; /**< size index of the free list, used for best fit object allocation */
+	bool _sizeIndexEnabled; /**< true if _sizeIndex is in use for this pool */
 protected:
 public:
 	
@@ -85,6 +89,50 @@ private:
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	uintptr_t getConsumedSizeForTLH(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t maximumSizeInBytesRequired);
 
+	/**
+	 * Rebuild the size index from the free list.
+	 */
+	void rebuildSizeIndex();
+
+	/**
+	 * Carve an object from the top of a free entry, which stays on the free list with a reduced size.
+	 * @param freeEntry entry found in the size index, at least _minimumFreeEntrySize bytes larger than the object
+	 * @param sizeInBytesRequired size of the object
+	 * @return address of the object
+	 */
+	void *allocateFromFreeEntryTop(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t sizeInBytesRequired);
+
+	/**
+	 * Check whether allocation can use the size index, rebuilding the index if it has been invalidated.
+	 * The index is not used while card alignment of the free list is pending.
+	 * @return true if the size index reflects the free list
+	 */
+	MMINLINE bool prepareSizeIndex()
+	{
+		bool ready = false;
+		if (_sizeIndexEnabled && (FREE_ENTRY_END == _firstCardUnalignedFreeEntry)) {
+			if (!_sizeIndex.isValid()) {
+				rebuildSizeIndex();
+			}
+			ready = true;
+		}
+		return ready;
+	}
+
+	MMINLINE void sizeIndexInsert(MM_HeapLinkedFreeHeader *freeEntry)
+	{
+		if (_sizeIndex.isValid()) {
+			_sizeIndex.insert(freeEntry);
+		}
+	}
+
+	MMINLINE void sizeIndexRemove(MM_HeapLinkedFreeHeader *freeEntry)
+	{
+		if (_sizeIndex.isValid()) {
+			_sizeIndex.remove(freeEntry);
+		}
+	}
+
 	/* Align a TLH to meet boundary restrictions. Certain phases of some GCs may require that TLHs not span heap chunks for parallel processing. */
 	bool alignTLHForParallelGC(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t *consumedSize);
 
@@ -132,6 +180,7 @@ public:
 	virtual void tearDown(MM_EnvironmentBase *env);
 
 	virtual void reset(Cause cause = any);
+	virtual void postProcess(MM_EnvironmentBase *env, Cause cause);
 	virtual MM_HeapLinkedFreeHeader *rebuildFreeListInRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapLinkedFreeHeader *previousFreeEntry);
 
 #if defined(DEBUG)
@@ -140,6 +189,24 @@ public:
 
 	virtual void addFreeEntries(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader* &freeListHead, MM_HeapLinkedFreeHeader* &freeListTail,
 												uintptr_t freeListMemoryCount, uintptr_t freeListMemorySize);
+
+	/**
+	 * Take the whole free list out of the pool, leaving the pool with an empty list.
+	 * Lets a sweep connect chunks into a list of their own while the pool keeps its existing entries, see reattachFreeList().
+	 * @return the detached free list
+	 */
+	MM_HeapLinkedFreeHeader *detachFreeList();
+
+	/**
+	 * Put a list returned by detachFreeList() back in front of the current free list, coalescing the two entries that meet.
+	 * Every entry currently on the list must lie above the detached list. The pool statistics describe the current list
+	 * on entry and both lists on return.
+	 * @param freeList the detached list
+	 * @param freeBytes free bytes on the detached list
+	 * @param freeEntryCount number of entries on the detached list
+	 * @param largestFreeEntry size of the largest entry on the detached list
+	 */
+	void reattachFreeList(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeList, uintptr_t freeBytes, uintptr_t freeEntryCount, uintptr_t largestFreeEntry);
 	
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 	virtual bool removeFreeEntriesWithinRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress,uintptr_t minimumSize,
@@ -258,6 +325,8 @@ public:
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_parallelGCAlignmentBase(NULL)
 		,_parallelGCAlignmentSize(0)
+		,_sizeIndex()
+		,_sizeIndexEnabled(false)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -270,6 +339,8 @@ public:
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_parallelGCAlignmentBase(NULL)
 		,_parallelGCAlignmentSize(0)
+		,_sizeIndex()
+		,_sizeIndexEnabled(false)
 	{
 		_typeId = __FUNCTION__;
 	};
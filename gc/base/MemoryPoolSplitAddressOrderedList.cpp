@@ -162,7 +162,7 @@ retry:
 	bool firstIteration = true;
 	bool jumpedToSuggested = false;
 	if (skipReserved) {
-		curFreeList = _currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount];
+		curFreeList = getStartFreeList(env);
 	} else {
 		/* tried all lists and the only thing to try is reserved free entry */
 		curFreeList = _reservedFreeListIndex;
@@ -186,6 +186,13 @@ retry:
 					/* found a freeEntry; will release lock only after we handle the remainder */
 					break;
 				}
+				if (firstIteration && isNumaStriped() && (curFreeList == _reservedFreeListIndex) && (sizeInBytesRequired <= _reservedFreeEntrySize)) {
+					/* only the reserved entry fits in the thread's own heap stripe, use it rather than a remote node's stripe */
+					skipReserved = false;
+					currentFreeEntry = getReservedFreeEntry();
+					previousFreeEntry = _previousReservedFreeEntry;
+					break;
+				}
 			} else {
 				/* second pass will directly use reserved free entry */
 				if (sizeInBytesRequired <= _reservedFreeEntrySize) {
@@ -281,7 +288,7 @@ skipSearch:
 
 	/* Was our initial or suggested freelist empty? If not, go back and use it more. */
 	if (NULL != _heapFreeLists[suggestedFreeList]._freeList) {
-		_currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount] = suggestedFreeList;
+		setStartFreeList(env, suggestedFreeList);
 	}
 
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStatsForFreeList is null for Survivor) */
@@ -321,7 +328,7 @@ retry:
 
 
 	if (skipReserved) {
-		curFreeList = _currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount];
+		curFreeList = getStartFreeList(env);
 	} else {
 		/* tried all lists and the only thing to try is reserved free entry */
 		curFreeList = _reservedFreeListIndex;
@@ -359,6 +366,13 @@ retry:
 						break;
 					}
 					previousFreeEntry = NULL;
+					if (firstIteration && isNumaStriped()) {
+						/* the reserved entry is all that is left in the thread's own heap stripe, refill from it rather than from a remote node's stripe */
+						skipReserved = false;
+						freeEntry = getReservedFreeEntry();
+						freeEntrySize = freeEntry->getSize();
+						break;
+					}
 				} else {
 					break;
 				}
@@ -402,7 +416,7 @@ skipSearch:
 	Assert_MM_true(env->getExtensions()->objectModel.isDeadObject((omrobjectptr_t)freeEntry));
 
 	/* Update our current free list */
-	_currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount] = curFreeList;
+	setStartFreeList(env, curFreeList);
 
 	/* Consume the bytes and set the return pointer values */
 	Assert_MM_true(freeEntrySize >= _minimumFreeEntrySize);
@@ -505,7 +519,10 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 
 	resetReservedFreeEntry();
 
-	if (cause == forSweep) {
+	/* A NUMA striped pool is split at free list entry granularity: chunk split candidates would leave an entry that
+	 * runs into the next node's heap stripe whole on the lower node's list.
+	 */
+	if ((cause == forSweep) && !isNumaStriped()) {
 
 		_heapFreeLists[0]._freeSize = _sweepPoolState->_sweepFreeBytes;
 		_heapFreeLists[0]._freeCount = _sweepPoolState->_sweepFreeHoles;
@@ -598,6 +615,7 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 		/* Free list splitting at free list entry granularity.
 		 * Slower but necessary when you don't have valid sweep chunks.
 		 */
+		bool const numaStriped = isNumaStriped();
 		MM_HeapLinkedFreeHeader* previousFreeList = NULL;
 		MM_HeapLinkedFreeHeader* currentFreeList = _heapFreeLists[0]._freeList;
 
@@ -605,6 +623,24 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 		_heapFreeLists[0]._freeSize = 0;
 
 		while (NULL != currentFreeList) {
+			if (numaStriped) {
+				/* Start a new list where the free memory enters a later node's heap stripe. */
+				uintptr_t stripeFreeListIndex = OMR_MIN(_extensions->_numaManager.getHeapStripeIndex(currentFreeList), lastFreeListIndex);
+				if (stripeFreeListIndex > currentFreeListIndex) {
+					if (NULL == previousFreeList) {
+						_heapFreeLists[currentFreeListIndex]._freeList = NULL;
+					} else {
+						previousFreeList->setNext(NULL, compressed);
+						previousFreeList = NULL;
+					}
+					currentFreeListIndex = stripeFreeListIndex;
+					_heapFreeLists[currentFreeListIndex]._freeList = currentFreeList;
+					_heapFreeLists[currentFreeListIndex]._freeSize = 0;
+					_heapFreeLists[currentFreeListIndex]._freeCount = 0;
+				}
+				splitFreeEntryAtHeapStripe(currentFreeList);
+			}
+
 			_heapFreeLists[currentFreeListIndex]._freeSize += currentFreeList->getSize();
 			_heapFreeLists[currentFreeListIndex]._freeCount += 1;
 
@@ -618,7 +654,7 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 			previousFreeList = currentFreeList;
 			currentFreeList = currentFreeList->getNext(compressed);
 
-			if ((_heapFreeLists[currentFreeListIndex]._freeSize >= freeListSplitSize) && (currentFreeListIndex < lastFreeListIndex)) {
+			if (!numaStriped && (_heapFreeLists[currentFreeListIndex]._freeSize >= freeListSplitSize) && (currentFreeListIndex < lastFreeListIndex)) {
 				previousFreeList->setNext(NULL, compressed);
 				previousFreeList = NULL;
 				currentFreeListIndex += 1;
@@ -662,10 +698,6 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 void
 MM_MemoryPoolSplitAddressOrderedList::expandWithRange(MM_EnvironmentBase* env, uintptr_t expandSize, void* lowAddress, void* highAddress, bool canCoalesce)
 {
-	bool const compressed = compressObjectReferences();
-	MM_HeapLinkedFreeHeader* previousFreeEntry = NULL;
-	MM_HeapLinkedFreeHeader* nextFreeEntry = NULL;
-
 	if (0 == expandSize) {
 		return;
 	}
@@ -676,6 +708,21 @@ MM_MemoryPoolSplitAddressOrderedList::expandWithRange(MM_EnvironmentBase* env, u
 		return;
 	}
 
+	internalExpandWithRange(env, expandSize, lowAddress, highAddress, canCoalesce);
+
+	if (isNumaStriped()) {
+		/* The range went onto a single list, spread it over the node stripes it covers. */
+		redistributeFreeListsAcrossHeapStripes(env);
+	}
+}
+
+void
+MM_MemoryPoolSplitAddressOrderedList::internalExpandWithRange(MM_EnvironmentBase* env, uintptr_t expandSize, void* lowAddress, void* highAddress, bool canCoalesce)
+{
+	bool const compressed = compressObjectReferences();
+	MM_HeapLinkedFreeHeader* previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader* nextFreeEntry = NULL;
+
 	MM_HeapLinkedFreeHeader** head = NULL;
 	uintptr_t curFreeListIndex = 0;
 	for (curFreeListIndex = 0; curFreeListIndex < _heapFreeListCount; ++curFreeListIndex) {
@@ -798,6 +845,67 @@ MM_MemoryPoolSplitAddressOrderedList::expandWithRange(MM_EnvironmentBase* env, u
 	Assert_GC_true_with_message2(env, reservedFreeEntryConsistencyCheck(), "expandWithRange _previousReservedFreeEntry=%p, _reservedFreeEntrySize=%zu\n", _previousReservedFreeEntry, _reservedFreeEntrySize);
 }
 
+bool
+MM_MemoryPoolSplitAddressOrderedList::splitFreeEntryAtHeapStripe(MM_HeapLinkedFreeHeader* freeEntry)
+{
+	bool const compressed = compressObjectReferences();
+	MM_NUMAManager* numaManager = &_extensions->_numaManager;
+	uintptr_t stripeIndex = numaManager->getHeapStripeIndex(freeEntry);
+	bool split = false;
+
+	if ((stripeIndex + 1) < _heapFreeListCount) {
+		uint8_t* boundary = (uint8_t*)numaManager->getHeapStripeBase(stripeIndex + 1);
+		uint8_t* entryTop = (uint8_t*)freeEntry->afterEnd();
+		/* both halves must still be usable free entries */
+		if (((((uint8_t*)freeEntry) + _minimumFreeEntrySize) <= boundary) && ((boundary + _minimumFreeEntrySize) <= entryTop)) {
+			MM_HeapLinkedFreeHeader* tailEntry = (MM_HeapLinkedFreeHeader*)boundary;
+			_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(freeEntry->getSize());
+			tailEntry->setNext(freeEntry->getNext(compressed), compressed);
+			tailEntry->setSize((uintptr_t)(entryTop - boundary));
+			freeEntry->setNext(tailEntry, compressed);
+			freeEntry->setSize((uintptr_t)(boundary - (uint8_t*)freeEntry));
+			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(freeEntry->getSize());
+			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(tailEntry->getSize());
+			split = true;
+		}
+	}
+
+	return split;
+}
+
+void
+MM_MemoryPoolSplitAddressOrderedList::redistributeFreeListsAcrossHeapStripes(MM_EnvironmentBase* env)
+{
+	bool const compressed = compressObjectReferences();
+	MM_HeapLinkedFreeHeader* tailEntry = NULL;
+
+	/* The lists are address ordered one after the other, so chaining them together gives the whole free list in address order. */
+	for (uintptr_t i = 0; i < _heapFreeListCount; ++i) {
+		MM_HeapLinkedFreeHeader* head = _heapFreeLists[i]._freeList;
+		if (NULL != head) {
+			if (NULL == tailEntry) {
+				_heapFreeLists[0]._freeList = head;
+			} else {
+				tailEntry->setNext(head, compressed);
+			}
+			tailEntry = head;
+			while (NULL != tailEntry->getNext(compressed)) {
+				tailEntry = tailEntry->getNext(compressed);
+			}
+		}
+		if (0 != i) {
+			_heapFreeLists[i]._freeList = NULL;
+			_heapFreeLists[i]._freeSize = 0;
+			_heapFreeLists[i]._freeCount = 0;
+		}
+		/* hints must not survive their entries moving to another list */
+		_heapFreeLists[i].clearHints();
+	}
+
+	/* re-split the combined list, at free entry granularity, along the stripes */
+	postProcess(env, any);
+}
+
 /**
  * Remove the range of memory to the free list of the receiver.
  *
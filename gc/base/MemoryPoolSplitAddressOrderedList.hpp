@@ -71,6 +71,26 @@ private:
 	 */
 	MM_HeapLinkedFreeHeader* internalAllocateFromList(MM_EnvironmentBase* env, uintptr_t sizeInBytesRequired, uintptr_t curFreeList, MM_HeapLinkedFreeHeader** previousFreeEntry, uintptr_t* largestFreeEntry);
 
+	/**
+	 * Add a range of memory to the free lists, coalescing it with its neighbours when allowed.
+	 * @see expandWithRange()
+	 */
+	void internalExpandWithRange(MM_EnvironmentBase* env, uintptr_t expandSize, void* lowAddress, void* highAddress, bool canCoalesce);
+
+	/**
+	 * Split a free entry which runs into the next NUMA node's heap stripe at the stripe boundary, so each part
+	 * can go on its own node's free list.
+	 * @param[in] freeEntry the free entry to split
+	 * @return true if the entry was split, the new entry for the upper part then follows it on the list
+	 */
+	bool splitFreeEntryAtHeapStripe(MM_HeapLinkedFreeHeader* freeEntry);
+
+	/**
+	 * Rebuild the free lists of a NUMA striped pool so that list i again holds the free memory of heap stripe i.
+	 * Used when memory is added to the pool outside of a sweep.
+	 */
+	void redistributeFreeListsAcrossHeapStripes(MM_EnvironmentBase* env);
+
 	/* helpers for maintaining reserved free entry - start */
 	/**
 	 * check if previousFreeEntry is the same as previousReservedFreeEntry
@@ -141,6 +141,8 @@ MM_MemoryPoolSplitAddressOrderedListBase::initialize(MM_EnvironmentBase* env)
 	 */
 	_sweepPoolManager = extensions->sweepPoolManagerSmallObjectArea;
 
+	_numaAffinity = extensions->numaAffinity && (_heapFreeListCount == extensions->_numaManager.getAffinityLeaderCount());
+
 	/* Allocate at least default _maximumHeapFreeListCount number of entries in the free list related tables. */
 	_maximumHeapFreeListCount = OMR_MAX(_maximumHeapFreeListCount, _heapFreeListCount);
 
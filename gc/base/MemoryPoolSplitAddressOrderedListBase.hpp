@@ -264,6 +264,7 @@ protected:
 	uintptr_t _maximumHeapFreeListCount; /**< Maximum value for _heapFreeListCount that can be reinitialized to during VM restore. */
 	uintptr_t* _currentThreadFreeList;
 	J9ModronFreeList* _heapFreeLists;
+	bool _numaAffinity; /**< true if free list i holds the free memory of the heap stripe of NUMA affinity leader i (see MM_GCExtensionsBase::numaAffinity) */
 
 	MM_LargeObjectAllocateStats* _largeObjectAllocateStatsForFreeList; /**< Approximate allocation profile for large objects. An array of stat structs for each free list */
 	MM_LargeObjectAllocateStats* _largeObjectCollectorAllocateStatsForFreeList; /**< Same as _largeObjectAllocateStatsForFreeList except specifically for collector allocates */
@@ -277,6 +278,36 @@ protected:
 	virtual void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats) = 0;
 	virtual bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats) = 0;
 
+	/**
+	 * @return true if the free lists follow the per node heap stripes, and threads start from their own node's list
+	 */
+	MMINLINE bool isNumaStriped()
+	{
+		return _numaAffinity && _extensions->_numaManager.isHeapStriped();
+	}
+
+	/**
+	 * @return the free list the given thread should try first
+	 */
+	MMINLINE uintptr_t getStartFreeList(MM_EnvironmentBase* env)
+	{
+		if (isNumaStriped()) {
+			return env->getNumaNodeIndex() % _heapFreeListCount;
+		}
+		return _currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount];
+	}
+
+	/**
+	 * Remember the free list the given thread last allocated from, so its next allocate starts there.
+	 * Threads of a NUMA striped pool keep starting from their own node's list.
+	 */
+	MMINLINE void setStartFreeList(MM_EnvironmentBase* env, uintptr_t freeListIndex)
+	{
+		if (!isNumaStriped()) {
+			_currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount] = freeListIndex;
+		}
+	}
+
 	bool recycleHeapChunkForFreeList(MM_EnvironmentBase* env, void* addrBase, void* addrTop, MM_HeapLinkedFreeHeader* previousFreeEntry, MM_HeapLinkedFreeHeader* nextFreeEntry, uintptr_t curFreeList);
 
 	MMINLINE uintptr_t findGoodStartFreeList()
@@ -369,6 +400,17 @@ public:
 	virtual uintptr_t getActualFreeMemorySize();
 	virtual uintptr_t getActualFreeEntryCount();
 
+	/**
+	 * @return the number of free lists of the pool
+	 */
+	MMINLINE uintptr_t getHeapFreeListCount() { return _heapFreeListCount; }
+
+	/**
+	 * @param freeListIndex index of a free list of the pool
+	 * @return the first entry of the free list, the others follow through getNext(), or NULL if the list is empty
+	 */
+	MMINLINE MM_HeapLinkedFreeHeader* getFirstFreeEntry(uintptr_t freeListIndex) { return _heapFreeLists[freeListIndex]._freeList; }
+
 	/**
 	 * Return the maximum TLH size taking into account scavengerScanCacheMaximumSize
 	 * when scavenger is being used.
@@ -397,6 +439,7 @@ public:
 		, _maximumHeapFreeListCount(32) /* Optimize free lists up to 256 Threads. */
 		, _currentThreadFreeList(0)
 		, _heapFreeLists(NULL)
+		, _numaAffinity(false)
 		, _largeObjectAllocateStatsForFreeList(NULL)
 		, _largeObjectCollectorAllocateStatsForFreeList(NULL)
 	{
@@ -408,6 +451,7 @@ public:
 		, _maximumHeapFreeListCount(32) /* Optimize free lists up to 256 Threads. */
 		, _currentThreadFreeList(0)
 		, _heapFreeLists(NULL)
+		, _numaAffinity(false)
 		, _largeObjectAllocateStatsForFreeList(NULL)
 		, _largeObjectCollectorAllocateStatsForFreeList(NULL)
 	{
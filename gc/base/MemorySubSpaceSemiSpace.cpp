@@ -937,8 +937,13 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 				omrtty_printf("%lf (weight %lf)\n", _averageScavengeTimeRatio, weight);
 			}
 
+			if (extensions->isGoalDrivenHeapResizing()) {
+				/* pause and gc time targets replace the expected ratio band below */
+				checkSubSpaceMemoryPostCollectGoalResize(env, scavengeTime);
+			}
+
 			/* If the average scavenge to interval ratio is greater than the maximum, try to expand */
-			if((_averageScavengeTimeRatio > extensions->dnssExpectedRatioMaximum._valueSpecified)
+			if(!extensions->isGoalDrivenHeapResizing() && (_averageScavengeTimeRatio > extensions->dnssExpectedRatioMaximum._valueSpecified)
 					&& (NULL != _physicalSubArena) && _physicalSubArena->canExpand(env) && (maxExpansionInSpace(env) != 0)) {
 
 				/* Try to reach 50% of the expected time ratio through expansion */
@@ -972,7 +977,7 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 			uintptr_t softMxForNursery = extensions->heap->getActualSoftMxSize(env, MEMORY_TYPE_NEW);
 
 			if ((NULL != _physicalSubArena) && _physicalSubArena->canContract(env) && (maxContractionInSpace(env) != 0)) {
-				if (_averageScavengeTimeRatio < extensions->dnssExpectedRatioMinimum._valueSpecified) {
+				if (!extensions->isGoalDrivenHeapResizing() && (_averageScavengeTimeRatio < extensions->dnssExpectedRatioMinimum._valueSpecified)) {
 					/* If the average scavenge to interval ratio is less than the minimum, try to contract */
 
 					/* Try to reach 200% of the expected minimum time ratio through contraction */
@@ -1002,7 +1007,9 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 
 					extensions->heap->getResizeStats()->setLastContractReason(SCAV_RATIO_TOO_LOW);
 
-				} else if ((0 != softMxForNursery) && (softMxForNursery < getCurrentSize())) {
+				}
+
+				if ((0 == _contractionSize) && (0 != softMxForNursery) && (softMxForNursery < getCurrentSize())) {
 					/* If the current nursery size has grown larger than softmx for nursery, than contract to meet softmx target */
 					uintptr_t contractionToSatisfySoftmx = getCurrentSize() - softMxForNursery;
 
@@ -1017,6 +1024,51 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 	}
 }
 
+void
+MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectGoalResize(MM_EnvironmentBase *env, uint64_t scavengeTime)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	uintptr_t regionSize = extensions->getHeap()->getHeapRegionManager()->getRegionSize();
+	MM_HeapResizeGoal *goal = extensions->heap->getResizeStats()->getNurseryGoal();
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	goal->recordPause(scavengeTime);
+
+	uintptr_t targetGCPercentage = extensions->heapResizeTargetGCPercentage;
+	if (0 == targetGCPercentage) {
+		/* only a pause target was given, aim for the middle of the expected scavenge ratio band */
+		targetGCPercentage = (uintptr_t)((extensions->dnssExpectedRatioMaximum._valueSpecified + extensions->dnssExpectedRatioMinimum._valueSpecified) * 50.0);
+		targetGCPercentage = OMR_MAX(targetGCPercentage, (uintptr_t)1);
+	}
+	uintptr_t gcPercentage = (uintptr_t)(_averageScavengeTimeRatio * 100.0);
+	double resizeFactor = 0.0;
+	MM_HeapResizeGoal::Decision decision = goal->decide((uint64_t)extensions->heapResizeTargetPauseTime * 1000, targetGCPercentage, gcPercentage, extensions->heapResizeHysteresis, &resizeFactor);
+
+	if (extensions->debugDynamicNewSpaceSizing) {
+		omrtty_printf("\tGoal resize - pause: %llu us (recent %llu us) gc: %zu%% target: %zu%% decision: %d factor: %lf\n",
+			scavengeTime, goal->getRecentPauseUs(), gcPercentage, targetGCPercentage, (int)decision, resizeFactor);
+	}
+
+	if (MM_HeapResizeGoal::goal_expand == decision) {
+		if ((NULL != _physicalSubArena) && _physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))) {
+			_expansionSize = MM_Math::roundToCeiling(extensions->heapAlignment, (uintptr_t)(getCurrentSize() * resizeFactor));
+			_expansionSize = MM_Math::roundToCeiling(2 * regionSize, _expansionSize);
+			_expansionSize = adjustExpansionWithinSoftMax(env, _expansionSize, 0, MEMORY_TYPE_NEW);
+			extensions->heap->getResizeStats()->setLastExpandReason(GC_TIME_ABOVE_TARGET);
+		}
+	} else if (MM_HeapResizeGoal::goal_hold != decision) {
+		if ((NULL != _physicalSubArena) && _physicalSubArena->canContract(env) && (0 != maxContractionInSpace(env))) {
+			_contractionSize = MM_Math::roundToCeiling(extensions->heapAlignment, (uintptr_t)(getCurrentSize() * resizeFactor));
+			_contractionSize = MM_Math::roundToCeiling(regionSize, _contractionSize);
+			if (MM_HeapResizeGoal::goal_contract_pause == decision) {
+				extensions->heap->getResizeStats()->setLastContractReason(PAUSE_TIME_ABOVE_TARGET);
+			} else {
+				extensions->heap->getResizeStats()->setLastContractReason(GC_TIME_BELOW_TARGET);
+			}
+		}
+	}
+}
+
 /**
  * Adjust the sub space memory consumed after a collect.
  * Adjusting semi space memory consumed after a collect includes changing the tilt and/or
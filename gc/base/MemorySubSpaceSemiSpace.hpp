@@ -103,6 +103,13 @@ private:
 	void checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBase *env);
 	void checkSubSpaceMemoryPostCollectResize(MM_EnvironmentBase *env);
 
+	/**
+	 * Vote on resizing the nursery towards the pause and gc time targets, and set the expansion or contraction size
+	 * once enough scavenges agreed.
+	 * @param scavengeTime duration of the scavenge in microseconds
+	 */
+	void checkSubSpaceMemoryPostCollectGoalResize(MM_EnvironmentBase *env, uint64_t scavengeTime);
+
 protected:
 	virtual void *allocationRequestFailed(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, AllocationType allocationType, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace);
 
@@ -95,6 +95,9 @@ void
 MM_MemorySubSpaceUniSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool _systemGC)
 {
 	uintptr_t oldVMState = env->pushVMstate(OMRVMSTATE_GC_CHECK_RESIZE);
+	if (_extensions->isGoalDrivenHeapResizing()) {
+		checkForGoalResize(env);
+	}
 	if (!timeForHeapContract(env, allocDescription, _systemGC)) {
 		timeForHeapExpand(env, allocDescription);
 	}
@@ -293,20 +296,26 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 		}
 	}
 	
-	/* Don't shrink if -Xmaxf1.0 specfied, i.e max free is 100% */
-	if (100 == _extensions->heapFreeMaximumRatioMultiplier) {
-		Trc_MM_MemorySubSpaceUniSpace_timeForHeapContract_Exit2(env->getLanguageVMThread());
-		return false;
-	}
-	
 	/* No need to shrink if we will not be above -Xmaxf after satisfying the allocate */
 	uintptr_t allocSize = allocDescription ? allocDescription->getBytesRequested() : 0;
-	
-	/* Are we spending too little time in GC ? */
-	bool ratioContract = checkForRatioContract(env);
-	
-	/* How much, if any, do we need to contract by ? */
-	_contractionSize = calculateTargetContractSize(env, allocSize, ratioContract);
+	bool ratioContract = false;
+
+	if (_extensions->isGoalDrivenHeapResizing()) {
+		/* Resizing towards pause and gc time targets replaces the -Xmaxf and gc ratio contraction heuristics */
+		_contractionSize = calculateGoalContractSize(env, allocSize);
+	} else {
+		/* Don't shrink if -Xmaxf1.0 specfied, i.e max free is 100% */
+		if (100 == _extensions->heapFreeMaximumRatioMultiplier) {
+			Trc_MM_MemorySubSpaceUniSpace_timeForHeapContract_Exit2(env->getLanguageVMThread());
+			return false;
+		}
+
+		/* Are we spending too little time in GC ? */
+		ratioContract = checkForRatioContract(env);
+
+		/* How much, if any, do we need to contract by ? */
+		_contractionSize = calculateTargetContractSize(env, allocSize, ratioContract);
+	}
 	
 	if (_contractionSize == 0 ) {
 		Trc_MM_MemorySubSpaceUniSpace_timeForHeapContract_Exit3(env->getLanguageVMThread());
@@ -347,7 +356,11 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 	 }	
 	
 	/* Remember reason for contraction for later */
-	if (ratioContract) {
+	if (MM_HeapResizeGoal::goal_contract_pause == _goalDecision) {
+		_extensions->heap->getResizeStats()->setLastContractReason(PAUSE_TIME_ABOVE_TARGET);
+	} else if (MM_HeapResizeGoal::goal_contract_footprint == _goalDecision) {
+		_extensions->heap->getResizeStats()->setLastContractReason(GC_TIME_BELOW_TARGET);
+	} else if (ratioContract) {
 		_extensions->heap->getResizeStats()->setLastContractReason(GC_RATIO_TOO_LOW);
 	} else {
 		_extensions->heap->getResizeStats()->setLastContractReason(FREE_SPACE_GREATER_MAXF);
@@ -466,7 +479,13 @@ MM_MemorySubSpaceUniSpace::calculateExpandSize(MM_EnvironmentBase *env, uintptr_
 	/* The desired free is the sum of these 2 rounded to heapAlignment */
 	uintptr_t desiredFree = MM_Math::roundToCeiling(_extensions->heapAlignment, minimumFree + bytesRequired);
 
-	if (desiredFree <= currentFree) {
+	if ((desiredFree <= currentFree) && _extensions->isGoalDrivenHeapResizing()) {
+		/* -Xminf is met, expansion beyond it is up to the gc time target */
+		if (MM_HeapResizeGoal::goal_expand == _goalDecision) {
+			expandSize = MM_Math::roundToCeiling(_extensions->heapAlignment, (uintptr_t)(getActiveMemorySize() * _goalResizeFactor));
+			_extensions->heap->getResizeStats()->setLastExpandReason(GC_TIME_ABOVE_TARGET);
+		}
+	} else if (desiredFree <= currentFree) {
 		/* Only expand if we didn't expand in last _extensions->heapExpansionStabilizationCount global collections */
 		if (_extensions->isStandardGC() || _extensions->isMetronomeGC()) {
 			uintptr_t gcCount = 0;
@@ -680,6 +699,67 @@ MM_MemorySubSpaceUniSpace::checkForRatioContract(MM_EnvironmentBase *env)
 }
 
 
+void
+MM_MemorySubSpaceUniSpace::checkForGoalResize(MM_EnvironmentBase *env)
+{
+	uintptr_t gcCount = 0;
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	gcCount = _extensions->globalGCStats.gcCount;
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+	if (gcCount == _goalDecisionGCCount) {
+		/* checkResize runs again once the free list is rebuilt or compacted, the collection has had its vote */
+		return;
+	}
+	_goalDecisionGCCount = gcCount;
+
+	uintptr_t gcPercentage = 0;
+	if (NULL != _collector) {
+		gcPercentage = _collector->getGCTimePercentage(env);
+	} else {
+		gcPercentage = _extensions->getGlobalCollector()->getGCTimePercentage(env);
+	}
+
+	_goalDecision = MM_HeapResizeGoal::goal_hold;
+	/* no ratio history yet (startup or an explicit gc cleared it), don't vote */
+	if (0 != gcPercentage) {
+		uintptr_t targetGCPercentage = _extensions->heapResizeTargetGCPercentage;
+		if (0 == targetGCPercentage) {
+			/* only a pause target was given, aim between the ratio expansion and contraction thresholds */
+			targetGCPercentage = (_extensions->heapContractionGCRatioThreshold._valueSpecified + _extensions->heapExpansionGCRatioThreshold._valueSpecified) / 2;
+		}
+		MM_HeapResizeGoal *goal = _extensions->heap->getResizeStats()->getTenureGoal();
+		_goalDecision = goal->decide((uint64_t)_extensions->heapResizeTargetPauseTime * 1000, targetGCPercentage, gcPercentage, _extensions->heapResizeHysteresis, &_goalResizeFactor);
+	}
+}
+
+/**
+ * Determine how much to contract by for the goal driven resize decision of this collection.
+ * The space never contracts below the size which leaves -Xminf free, so a contraction can not be undone by an
+ * -Xminf expansion at the next collection.
+ * @return the recommended amount of heap in bytes to contract.
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::calculateGoalContractSize(MM_EnvironmentBase *env, uintptr_t allocSize)
+{
+	uintptr_t contractionSize = 0;
+
+	if ((MM_HeapResizeGoal::goal_contract_pause == _goalDecision) || (MM_HeapResizeGoal::goal_contract_footprint == _goalDecision)) {
+		uintptr_t currentFree = getApproximateActiveFreeMemorySize();
+		uintptr_t currentHeapSize = getActiveMemorySize();
+		uintptr_t minimumFree = (currentHeapSize / _extensions->heapFreeMinimumRatioDivisor) * _extensions->heapFreeMinimumRatioMultiplier;
+
+		if ((_extensions->heapFreeMinimumRatioMultiplier < _extensions->heapFreeMinimumRatioDivisor) && (currentFree > (minimumFree + allocSize))) {
+			/* contracting by c leaves currentFree - c free of currentHeapSize - c, keep that at -Xminf or above */
+			uintptr_t maxContract = ((currentFree - minimumFree - allocSize) / (_extensions->heapFreeMinimumRatioDivisor - _extensions->heapFreeMinimumRatioMultiplier))
+					* _extensions->heapFreeMinimumRatioDivisor;
+			contractionSize = OMR_MIN((uintptr_t)(currentHeapSize * _goalResizeFactor), maxContract);
+			contractionSize = MM_Math::roundToFloor(_extensions->regionSize, contractionSize);
+		}
+	}
+
+	return contractionSize;
+}
+
 /**
  * Compare the specified expand amount with the specified minimum and maximum expansion amounts
  * (-Xmine and -Xmaxe command line options) and round the amount to within these limits
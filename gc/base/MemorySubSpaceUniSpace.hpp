@@ -29,6 +29,7 @@
 #if !defined(MEMORYSUBSPACEUNISPACE_HPP_)
 #define MEMORYSUBSPACEUNISPACE_HPP_
 
+#include "HeapResizeStats.hpp"
 #include "MemorySubSpace.hpp"
 
 #define HEAP_FREE_RATIO_EXPAND_DIVISOR		100
@@ -41,6 +42,11 @@
  */
 class MM_MemorySubSpaceUniSpace : public MM_MemorySubSpace
 {
+private:
+	MM_HeapResizeGoal::Decision _goalDecision; /**< goal driven resize decision of the collection _goalDecisionGCCount */
+	double _goalResizeFactor; /**< fraction of the space to resize by for _goalDecision */
+	uintptr_t _goalDecisionGCCount; /**< global gc count of the collection which voted for _goalDecision */
+
 protected:
 	uintptr_t adjustExpansionWithinFreeLimits(MM_EnvironmentBase *env, uintptr_t expandSize);
 	uintptr_t checkForRatioExpand(MM_EnvironmentBase *env, uintptr_t bytesRequired);	
@@ -55,6 +61,13 @@ protected:
 	uintptr_t getHeapFreeMaximumHeuristicMultiplier(MM_EnvironmentBase *env);
 	uintptr_t getHeapFreeMinimumHeuristicMultiplier(MM_EnvironmentBase *env);
 
+	/**
+	 * Vote on resizing towards the pause and gc time targets and store the decision in _goalDecision.
+	 * Each collection votes once, later checkResize calls of the same collection reuse its decision.
+	 */
+	void checkForGoalResize(MM_EnvironmentBase *env);
+	uintptr_t calculateGoalContractSize(MM_EnvironmentBase *env, uintptr_t allocSize);
+
 public:
 	virtual void checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription = NULL, bool _systemGC = false);
 	virtual intptr_t performResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription = NULL);
@@ -66,6 +79,9 @@ public:
 		bool usesGlobalCollector, uintptr_t minimumSize, uintptr_t initialSize, uintptr_t maximumSize, uintptr_t memoryFlags, uint32_t objectFlags)
 	:
 		MM_MemorySubSpace(env, NULL, physicalSubArena, usesGlobalCollector, minimumSize, initialSize, maximumSize, memoryFlags, objectFlags)
+		, _goalDecision(MM_HeapResizeGoal::goal_hold)
+		, _goalResizeFactor(0.0)
+		, _goalDecisionGCCount(UDATA_MAX)
 	{
 		_typeId = __FUNCTION__;
 	};
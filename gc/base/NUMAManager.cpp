@@ -30,6 +30,7 @@
 
 #include "omrport.h"
 
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
 #include "ModronAssertions.h"
@@ -80,6 +81,9 @@ MM_NUMAManager::recacheNUMASupport(MM_EnvironmentBase *env)
 		_freeProcessorPoolNodeCount = 0;
 	}
 	_maximumNodeNumber = 0;
+	/* stripes are laid out over the affinity leaders being replaced */
+	_heapStripeBase = NULL;
+	_heapStripeSize = 0;
 
 	uintptr_t nodeCount = 0;
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
@@ -239,6 +243,22 @@ MM_NUMAManager::getComputationalResourcesAvailableForAllNodes() const
 	return computationalResourceCount;
 }
 
+uintptr_t
+MM_NUMAManager::getNextAffinityLeaderIndex()
+{
+	Assert_MM_true(0 != _affinityLeaderCount);
+	return (MM_AtomicOperations::add(&_nextAffinityLeaderIndex, 1) - 1) % _affinityLeaderCount;
+}
+
+void
+MM_NUMAManager::setHeapStripes(void *stripeBase, uintptr_t stripeSize)
+{
+	Assert_MM_true(0 != _affinityLeaderCount);
+	Assert_MM_true(0 != stripeSize);
+	_heapStripeBase = stripeBase;
+	_heapStripeSize = stripeSize;
+}
+
 bool
 MM_NUMAManager::isPhysicalNUMASupported() const
 {
@@ -51,6 +51,9 @@ private:
 	uintptr_t _affinityLeaderCount;	/**< The number of elements in the _affinityLeaders array */
 	J9MemoryNodeDetail *_freeProcessorPoolNodes;	/**< A subset of the nodes in _activeNodes which represent the nodes which are offering ONLY CPU */
 	uintptr_t _freeProcessorPoolNodeCount;	/**< The number of elements in the _freeProcessorPoolNodes array */
+	volatile uintptr_t _nextAffinityLeaderIndex;	/**< Round robin cursor used to spread threads without an affinity over the affinity leaders */
+	void *_heapStripeBase;	/**< Low address of the heap stripe of the first affinity leader, or NULL if the heap is not striped across nodes */
+	uintptr_t _heapStripeSize;	/**< Size, in bytes, of the heap stripe owned by each affinity leader */
 
 	/* Member Functions */
 private:
@@ -141,6 +144,49 @@ public:
 	 */
 	bool isPhysicalNUMASupported() const;
 
+	/**
+	 * Select an affinity leader for a thread which is not bound to a single node, spreading such threads evenly over the leaders.
+	 * @return index into the affinity leader array
+	 */
+	uintptr_t getNextAffinityLeaderIndex();
+
+	/**
+	 * Record how the heap is split into one contiguous stripe per affinity leader, in affinity leader order.
+	 * @param stripeBase[in] Low address of the first stripe
+	 * @param stripeSize[in] Size of each stripe (the last stripe extends to the top of the heap)
+	 */
+	void setHeapStripes(void *stripeBase, uintptr_t stripeSize);
+
+	/**
+	 * @return True if the heap has been split into per node stripes
+	 */
+	MMINLINE bool isHeapStriped() const { return NULL != _heapStripeBase; }
+
+	/**
+	 * Find the affinity leader owning the heap stripe which contains the given address.
+	 * Addresses outside of the striped range belong to the nearest stripe.
+	 * @param address[in] A heap address
+	 * @return index into the affinity leader array
+	 */
+	MMINLINE uintptr_t
+	getHeapStripeIndex(void *address) const
+	{
+		uintptr_t index = 0;
+		if (address > _heapStripeBase) {
+			index = ((uintptr_t)address - (uintptr_t)_heapStripeBase) / _heapStripeSize;
+			if (index >= _affinityLeaderCount) {
+				index = _affinityLeaderCount - 1;
+			}
+		}
+		return index;
+	}
+
+	/**
+	 * @param stripeIndex[in] index into the affinity leader array
+	 * @return Low address of the heap stripe owned by the given affinity leader
+	 */
+	MMINLINE void *getHeapStripeBase(uintptr_t stripeIndex) const { return (void *)((uintptr_t)_heapStripeBase + (stripeIndex * _heapStripeSize)); }
+
 	/**
 	 * Called to disable NUMA support and clear any caches allocated to track NUMA support
 	 * @param env[in] The main GC thread
@@ -161,6 +207,9 @@ public:
 		, _affinityLeaderCount(0)
 		, _freeProcessorPoolNodes(NULL)
 		, _freeProcessorPoolNodeCount(0)
+		, _nextAffinityLeaderIndex(0)
+		, _heapStripeBase(NULL)
+		, _heapStripeSize(0)
 	{}
 };
 
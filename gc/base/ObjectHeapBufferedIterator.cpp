@@ -81,6 +81,29 @@ GC_ObjectHeapBufferedIterator::nextObject()
 	return next;
 }
 
+omrobjectptr_t *
+GC_ObjectHeapBufferedIterator::nextObjects(uintptr_t *count)
+{
+	*count = 0;
+	if (_cacheCount == 0) {
+		return NULL;
+	}
+
+	if (_cacheIndex == _cacheCount) {
+		_cacheIndex = 0;
+		_cacheCount = _populator->populateObjectHeapBufferedIteratorCache(_cache, _cacheSizeToUse, &_state);
+
+		if (_cacheCount == 0) {
+			return NULL;
+		}
+	}
+
+	omrobjectptr_t *next = &_cache[_cacheIndex];
+	*count = _cacheCount - _cacheIndex;
+	_cacheIndex = _cacheCount;
+	return next;
+}
+
 const MM_ObjectHeapBufferedIteratorPopulator*
 GC_ObjectHeapBufferedIterator::getPopulator()
 {
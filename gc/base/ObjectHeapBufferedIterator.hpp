@@ -80,6 +80,12 @@ public:
 	GC_ObjectHeapBufferedIterator(MM_GCExtensionsBase *extensions, MM_HeapRegionDescriptor *region, bool includeDeadObjects = false, uintptr_t maxElementsToCache = CACHE_SIZE);
 	GC_ObjectHeapBufferedIterator(MM_GCExtensionsBase *extensions, MM_HeapRegionDescriptor *region, void *base, void *top, bool includeDeadObjects = false, uintptr_t maxElementsToCache = CACHE_SIZE);
 	omrobjectptr_t nextObject();
+	/**
+	 * Consume every object left in the cache, refilling it first if it has been used up.
+	 * @param[out] count the number of objects returned
+	 * @return the objects in address order, valid until the iterator is used again, or NULL once the walk is complete
+	 */
+	omrobjectptr_t *nextObjects(uintptr_t *count);
 	void advance(uintptr_t sizeInBytes);
 	void reset(uintptr_t *base, uintptr_t *top);
 };
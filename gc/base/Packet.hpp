@@ -45,6 +45,7 @@ private:
 	uintptr_t *_topPtr;
 	uintptr_t *_currentPtr;
 	uintptr_t _sublistIndex;
+	uintptr_t _packetIndex; /**< 1-based index of the packet among all packets of its MM_WorkPackets, used by lock-free packet lists */
 	MM_EnvironmentBase *_owner;
 protected:
 public:
@@ -65,6 +66,16 @@ private:
 		_sublistIndex = sublistIndex;
 	}
 
+	MMINLINE uintptr_t getPacketIndex()
+	{
+		return _packetIndex;
+	}
+
+	MMINLINE void setPacketIndex(uintptr_t packetIndex)
+	{
+		_packetIndex = packetIndex;
+	}
+
 protected:
 public:
 	/**
@@ -75,6 +86,14 @@ public:
 		return (uintptr_t)(_topPtr - _currentPtr);
 	}
 
+	/**
+	 * Returns the number of slots holding references
+	 */
+	MMINLINE uintptr_t usedSlots()
+	{
+		return (uintptr_t)(_currentPtr - _basePtr);
+	}
+
 	/**
 	 * Sets the address of the owning threads env
 	 */
@@ -212,6 +231,7 @@ public:
 		_topPtr(NULL),
 		_currentPtr(NULL),
 		_sublistIndex(0),
+		_packetIndex(0),
 		_owner(NULL),
 		_next(NULL),
 		_previous(NULL)
@@ -54,6 +54,16 @@ MM_PacketList::initialize(MM_EnvironmentBase *env)
 	return result;
 }
 
+void
+MM_PacketList::setLockFree(MM_Packet **packetBlocks, uintptr_t packetsPerBlock)
+{
+	Assert_MM_true(0 == _count);
+	Assert_MM_true(0 < packetsPerBlock);
+
+	_packetBlocks = packetBlocks;
+	_packetsPerBlock = packetsPerBlock;
+}
+
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 bool
 MM_PacketList::reinitializeForRestore(MM_EnvironmentBase *env)
@@ -118,6 +128,17 @@ MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 	PacketSublist *list = &_sublists[0];
 	MM_Packet *current = head;
 	uintptr_t i;
+
+	if (isLockFree()) {
+		for (i = 0; i < count; ++i) {
+			current->_previous = NULL;
+			current->setSublistIndex(0);
+			current = current->_next;
+		}
+		MM_AtomicOperations::add(&_count, count);
+		pushLockFree(NULL, list, head, tail);
+		return;
+	}
 	
 	list->_lock.acquire();
 	
@@ -146,6 +167,40 @@ MM_PacketList::popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count)
 	*head = NULL;
 	*tail = NULL;
 	*count = 0;
+
+	if (isLockFree()) {
+		/* detach each sublist in turn; the result is only a consistent snapshot if no other thread is using the list */
+		for (uintptr_t i = 0; i < _sublistCount; i++) {
+			PacketSublist *list = &_sublists[i];
+			uint64_t oldTaggedHead = list->_taggedHead;
+			uint64_t seenTaggedHead = oldTaggedHead;
+
+			do {
+				oldTaggedHead = seenTaggedHead;
+				seenTaggedHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, oldTaggedHead, getNextTaggedHead(oldTaggedHead, NULL));
+			} while (seenTaggedHead != oldTaggedHead);
+
+			MM_Packet *current = getPacketFromTaggedHead(oldTaggedHead);
+			if (NULL != current) {
+				didPop = true;
+
+				if (NULL == *head) {
+					*head = current;
+				} else {
+					(*tail)->_next = current;
+				}
+				while (NULL != current) {
+					*tail = current;
+					*count += 1;
+					current = current->_next;
+				}
+			}
+		}
+
+		MM_AtomicOperations::subtract(&_count, *count);
+
+		return didPop;
+	}
 	
 	/* acquire all of our locks */
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
@@ -191,6 +246,9 @@ MM_PacketList::remove(MM_Packet *packetToRemove)
 	PacketSublist *list = &_sublists[packetToRemove->getSublistIndex()];
 	MM_Packet *previous = NULL;
 	MM_Packet *next = NULL;
+
+	/* lock-free sublists are singly linked */
+	Assert_MM_true(!isLockFree());
 	
 	list->_lock.acquire();
 	
@@ -233,7 +291,11 @@ MM_PacketList::getHead()
 	
 	if (popList(&head, &tail, &count)) {
 		pushList(head, tail, count);
-		result = _sublists[0]._head;
+		if (isLockFree()) {
+			result = getPacketFromTaggedHead(_sublists[0]._taggedHead);
+		} else {
+			result = _sublists[0]._head;
+		}
 	}
 
 	return result;
@@ -40,6 +40,9 @@
 
 class MM_GCExtensionsBase;
 
+#define PACKETLIST_TAGGED_HEAD_INDEX_MASK ((uint64_t)0xFFFFFFFF)
+#define PACKETLIST_TAGGED_HEAD_TAG_INCREMENT (((uint64_t)1) << 32)
+
 class MM_PacketList: public MM_BaseNonVirtual
 {
 
@@ -48,6 +51,7 @@ public:
 	struct PacketSublist {
 		MM_Packet *_head;  /**< Head of the list */
 		MM_Packet *_tail;  /**< Tail of the list */
+		volatile uint64_t _taggedHead; /**< Head of the list in lock-free mode: ABA tag in the high 32 bits, 1-based packet index (0 if empty) in the low 32 bits */
 		MM_LightweightNonReentrantLock _lock;  /**< Lock for getting/putting packets */
 
 		bool initialize(MM_EnvironmentBase *env)
@@ -61,6 +65,7 @@ public:
 		PacketSublist()
 			: _head(NULL)
 			, _tail(NULL)
+			, _taggedHead(0)
 		{
 		}
 	};
@@ -72,6 +77,8 @@ private:
 	
 	uintptr_t _sublistCount; /**< The number of lists (split for parallelism). Must be at least 1 */
 	volatile uintptr_t _count;  /**< Number of items in the list */
+	MM_Packet **_packetBlocks; /**< Packet blocks of the owning MM_WorkPackets, used to resolve tagged heads. NULL unless the list is lock-free */
+	uintptr_t _packetsPerBlock; /**< Number of packets in each of the _packetBlocks */
 	
 /* Functionality Section */
 private:
@@ -120,6 +127,112 @@ private:
 	{
 		return env->getEnvironmentId() % _sublistCount;
 	}
+
+	/**
+	 * Resolve the packet referenced by a tagged head.
+	 *
+	 * @param taggedHead the tagged head value
+	 *
+	 * @return the packet, or NULL if the tagged head references no packet
+	 */
+	MMINLINE MM_Packet *
+	getPacketFromTaggedHead(uint64_t taggedHead)
+	{
+		MM_Packet *packet = NULL;
+		uintptr_t packetIndex = (uintptr_t)(taggedHead & PACKETLIST_TAGGED_HEAD_INDEX_MASK);
+
+		if (0 != packetIndex) {
+			packetIndex -= 1;
+			packet = _packetBlocks[packetIndex / _packetsPerBlock] + (packetIndex % _packetsPerBlock);
+		}
+
+		return packet;
+	}
+
+	/**
+	 * Build the tagged head that replaces the specified one. The tag is bumped on every
+	 * update so that a head which was popped and pushed back in between is not mistaken
+	 * for an unchanged one (ABA).
+	 *
+	 * @param oldTaggedHead the tagged head being replaced
+	 * @param packet the new first packet of the list, or NULL if the list becomes empty
+	 *
+	 * @return the new tagged head
+	 */
+	MMINLINE uint64_t
+	getNextTaggedHead(uint64_t oldTaggedHead, MM_Packet *packet)
+	{
+		uint64_t taggedHead = (oldTaggedHead & ~PACKETLIST_TAGGED_HEAD_INDEX_MASK) + PACKETLIST_TAGGED_HEAD_TAG_INCREMENT;
+
+		if (NULL != packet) {
+			taggedHead |= (uint64_t)packet->getPacketIndex();
+		}
+
+		return taggedHead;
+	}
+
+	/**
+	 * Push a chain of packets onto the specified sublist without locking.
+	 *
+	 * @param env the current environment
+	 * @param list the sublist to push onto
+	 * @param head the first packet of the chain
+	 * @param tail the last packet of the chain
+	 */
+	MMINLINE void
+	pushLockFree(MM_EnvironmentBase *env, PacketSublist *list, MM_Packet *head, MM_Packet *tail)
+	{
+		uint64_t oldTaggedHead = list->_taggedHead;
+
+		while (true) {
+			tail->_next = getPacketFromTaggedHead(oldTaggedHead);
+			uint64_t newTaggedHead = getNextTaggedHead(oldTaggedHead, head);
+			uint64_t seenTaggedHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, oldTaggedHead, newTaggedHead);
+			if (seenTaggedHead == oldTaggedHead) {
+				break;
+			}
+			oldTaggedHead = seenTaggedHead;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			if (NULL != env) {
+				env->_workPacketStats.workPacketsCASRetries += 1;
+			}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		}
+	}
+
+	/**
+	 * Pop the first packet off of the specified sublist without locking.
+	 *
+	 * @param env the current environment
+	 * @param list the sublist to pop from
+	 *
+	 * @return the packet, or NULL if the sublist is empty
+	 */
+	MMINLINE MM_Packet *
+	popLockFree(MM_EnvironmentBase *env, PacketSublist *list)
+	{
+		MM_Packet *packet = NULL;
+		uint64_t oldTaggedHead = list->_taggedHead;
+
+		while (0 != (oldTaggedHead & PACKETLIST_TAGGED_HEAD_INDEX_MASK)) {
+			/* the packet block referenced by the head may have just been added by another thread */
+			MM_AtomicOperations::readBarrier();
+			MM_Packet *head = getPacketFromTaggedHead(oldTaggedHead);
+			/* head->_next may be stale if head was popped concurrently, in which case the tag will not match */
+			uint64_t newTaggedHead = getNextTaggedHead(oldTaggedHead, head->_next);
+			uint64_t seenTaggedHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, oldTaggedHead, newTaggedHead);
+			if (seenTaggedHead == oldTaggedHead) {
+				packet = head;
+				break;
+			}
+			oldTaggedHead = seenTaggedHead;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsCASRetries += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		}
+
+		return packet;
+	}
 		
 protected:
 	
@@ -127,6 +240,27 @@ public:
 	
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Switch this (empty) list to lock-free mode. Sublists are then maintained as
+	 * Treiber stacks whose heads are tagged packet indices, which are resolved through
+	 * the packet blocks of the owning MM_WorkPackets.
+	 * @note a lock-free list does not support remove()
+	 *
+	 * @param packetBlocks the packet block array of the owning MM_WorkPackets
+	 * @param packetsPerBlock the number of packets in each block
+	 */
+	void setLockFree(MM_Packet **packetBlocks, uintptr_t packetsPerBlock);
+
+	/**
+	 * Check whether the list is in lock-free mode
+	 *
+	 * @return true if the list is lock-free, false if its sublists are locked
+	 */
+	MMINLINE bool isLockFree()
+	{
+		return (NULL != _packetBlocks);
+	}
 	
 	/**
 	 * Push a list of packets onto this packet list.
@@ -161,6 +295,15 @@ public:
 	{
 		uintptr_t index = getSublistIndex(env);
 		PacketSublist *list = &_sublists[index];
+
+		if (isLockFree()) {
+			packet->_previous = NULL;
+			packet->setSublistIndex(index);
+			/* count before publishing so that the count never drops below the number of packets on the list */
+			MM_AtomicOperations::add(&_count, 1);
+			pushLockFree(env, list, packet, packet);
+			return;
+		}
 	
 		list->_lock.acquire();
 
@@ -191,7 +334,15 @@ public:
 		for (uintptr_t i = 0; i < _sublistCount; i++) {
 			PacketSublist *list = &_sublists[index];
 
-			if (NULL != list->_head) {
+			if (isLockFree()) {
+				packet = popLockFree(env, list);
+				if (NULL != packet) {
+					MM_AtomicOperations::subtract(&_count, 1);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+					env->_workPacketStats.workPacketsLockFreePops += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				}
+			} else if (NULL != list->_head) {
 				list->_lock.acquire();
 				if (NULL != list->_head) {
 					packet = list->_head;
@@ -204,10 +355,16 @@ public:
 					}		
 				}
 				list->_lock.release();
+			}
 
-				if (NULL != packet) {
-					break;
+			if (NULL != packet) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				if (0 != i) {
+					/* the home sublist of this thread was empty */
+					env->_workPacketStats.workPacketsRemoteSublistPops += 1;
 				}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				break;
 			}
 			
 			index = (index + 1) %  _sublistCount;
@@ -263,6 +420,8 @@ public:
 		,_sublists(NULL)
 		,_sublistCount(0)
 		,_count(0)
+		,_packetBlocks(NULL)
+		,_packetsPerBlock(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -24,6 +24,7 @@
 
 #include "ModronAssertions.h"
 
+#include "AtomicOperations.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ParallelTask.hpp"
 #include "ParallelDispatcher.hpp"
@@ -33,7 +34,9 @@
 #include "HeapRegionManager.hpp"
 #include "MarkMap.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
+#include "MemoryPool.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "ParallelObjectHeapIterator.hpp"
 #include "ObjectModel.hpp"
@@ -80,6 +83,84 @@ public:
 	}
 };
 
+#define PARALLEL_HEAP_WALK_RANGE_STRIDE 8 /**< uint64_t entries between the chunk runs of two threads, one cache line */
+#define PARALLEL_HEAP_WALK_THREAD_DATA_ALIGNMENT 64 /**< thread accumulators are cache line aligned so that updating them is not false sharing */
+#define PARALLEL_HEAP_WALK_MAX_CHUNKS ((uintptr_t)0xFFFFFFFF)
+#define PARALLEL_HEAP_WALK_RANGE_NEXT(range) ((uintptr_t)((range) >> 32))
+#define PARALLEL_HEAP_WALK_RANGE_END(range) ((uintptr_t)((range) & 0xFFFFFFFF))
+#define PARALLEL_HEAP_WALK_RANGE(next, end) ((((uint64_t)(next)) << 32) | (uint64_t)(end))
+
+/**
+ * Walks the chunks of a batched heap walk. Each thread owns a run of chunk indices, packed into a single
+ * word so that the owner taking the next chunk from the front and a thief taking half of the run from the
+ * back are both a single compare and swap.
+ * Any of the dispatcher's workers may take part in the task, so the runs and accumulators are indexed by the
+ * order in which the threads joined rather than by worker ID.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelObjectBatchDoTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_HeapWalkerObjectBatchFunc _function;
+	void *_userData;
+	MM_ParallelHeapWalker *_heapWalker;
+	MM_ParallelHeapWalkChunk *_chunks;
+	uintptr_t _chunkCount;
+	volatile uint64_t *_ranges; /**< per thread run of chunks still to walk, next index in the high half and end index in the low half */
+	uint8_t *_threadData;
+	uintptr_t _threadDataStride;
+	volatile uintptr_t _joinedThreadCount; /**< number of threads which entered run, hands out the thread indices */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE volatile uint64_t *getRange(uintptr_t threadIndex) { return &_ranges[threadIndex * PARALLEL_HEAP_WALK_RANGE_STRIDE]; }
+
+	/**
+	 * Take the next chunk of the calling thread's run, stealing from other threads once the run is exhausted.
+	 * @param threadIndex index of the calling thread in the task
+	 * @param[out] chunkIndex index of the chunk to walk
+	 * @return false when no thread has chunks left to give
+	 */
+	bool nextChunk(MM_EnvironmentBase *env, uintptr_t threadIndex, uintptr_t *chunkIndex);
+
+	/**
+	 * Move the back half of the first non-empty run of another thread to the calling thread's (empty) run.
+	 * @param threadIndex index of the calling thread in the task
+	 * @return true if chunks were stolen
+	 */
+	bool steal(MM_EnvironmentBase *env, uintptr_t threadIndex);
+
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	void *getThreadData(uintptr_t threadIndex) { return _threadData + (threadIndex * _threadDataStride); }
+
+	MM_ParallelObjectBatchDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectBatchFunc function, void *userData, MM_ParallelHeapWalkChunk *chunks, uintptr_t chunkCount, volatile uint64_t *ranges, uint8_t *threadData, uintptr_t threadDataStride)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _function(function)
+		, _userData(userData)
+		, _heapWalker(heapWalker)
+		, _chunks(chunks)
+		, _chunkCount(chunkCount)
+		, _ranges(ranges)
+		, _threadData(threadData)
+		, _threadDataStride(threadDataStride)
+		, _joinedThreadCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 /**
  * newInstance of Parallel Heap Walker
  */
@@ -162,6 +243,163 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 	}
 }
 
+/**
+ * Split the regions selected by walkFlags into chunks which can be walked independently.
+ */
+uintptr_t
+MM_ParallelHeapWalker::buildChunkTable(MM_EnvironmentBase *env, MM_ParallelHeapWalkChunk *chunks, uintptr_t walkFlags, uintptr_t chunkSize)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	bool useMarkMap = _markMap->isMarkMapValid() && (!extensions->usingSATBBarrier());
+	MM_HeapMapIterator markedObjectIterator(extensions);
+	GC_HeapRegionIterator regionIterator(extensions->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptor *region = NULL;
+	uintptr_t chunkCount = 0;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (walkFlags == (region->getTypeFlags() & walkFlags)) {
+			uintptr_t *low = (uintptr_t *)region->getLowAddress();
+			uintptr_t *high = (uintptr_t *)region->getHighAddress();
+			uintptr_t windowCount = 1;
+			if ((0 != chunkSize) && (low < high)) {
+				windowCount = MM_Math::roundToCeiling(chunkSize, (uintptr_t)high - (uintptr_t)low) / chunkSize;
+			}
+			if (NULL == chunks) {
+				chunkCount += windowCount;
+				continue;
+			}
+
+			/* a chunk starts at the first object or free entry of its window, either of which begins a parsable run of the heap */
+			MM_ParallelHeapWalkChunk *windows = &chunks[chunkCount];
+			for (uintptr_t i = 0; i < windowCount; i++) {
+				windows[i].region = region;
+				windows[i].base = (0 == i) ? low : NULL;
+			}
+			if (1 < windowCount) {
+				if (useMarkMap) {
+					for (uintptr_t i = 1; i < windowCount; i++) {
+						uintptr_t *windowBase = (uintptr_t *)((uintptr_t)low + (i * chunkSize));
+						uintptr_t *windowTop = (uintptr_t *)OMR_MIN((uintptr_t)windowBase + chunkSize, (uintptr_t)high);
+						markedObjectIterator.reset(_markMap, windowBase, windowTop);
+						windows[i].base = (uintptr_t *)markedObjectIterator.nextObject();
+					}
+				} else if ((MM_HeapRegionDescriptor::ADDRESS_ORDERED == region->getRegionType()) && (NULL != region->getSubSpace()->getMemoryPool())) {
+					MM_MemoryPool *memoryPool = region->getSubSpace()->getMemoryPool();
+					void *freeEntry = memoryPool->getFirstFreeStartingAddr(env);
+					while (NULL != freeEntry) {
+						if (((uintptr_t *)freeEntry > low) && ((uintptr_t *)freeEntry < high)) {
+							MM_ParallelHeapWalkChunk *window = &windows[((uintptr_t)freeEntry - (uintptr_t)low) / chunkSize];
+							if ((NULL == window->base) || ((uintptr_t *)freeEntry < window->base)) {
+								window->base = (uintptr_t *)freeEntry;
+							}
+						}
+						freeEntry = memoryPool->getNextFreeStartingAddr(env, freeEntry);
+					}
+				}
+			}
+
+			/* a window without a starting point is walked as part of the chunk before it */
+			uintptr_t regionChunkCount = 0;
+			for (uintptr_t i = 0; i < windowCount; i++) {
+				if (NULL != windows[i].base) {
+					windows[regionChunkCount] = windows[i];
+					regionChunkCount += 1;
+				}
+			}
+			for (uintptr_t i = 0; i < regionChunkCount; i++) {
+				windows[i].top = ((i + 1) < regionChunkCount) ? windows[i + 1].base : high;
+			}
+			chunkCount += regionChunkCount;
+		}
+	}
+
+	return chunkCount;
+}
+
+/**
+ * Walk the objects of a chunk, passing them to function as batches.
+ */
+void
+MM_ParallelHeapWalker::walkChunk(MM_EnvironmentBase *env, MM_ParallelHeapWalkChunk *chunk, MM_HeapWalkerObjectBatchFunc function, void *threadData, void *userData)
+{
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	GC_ObjectHeapBufferedIterator objectHeapIterator(env->getExtensions(), chunk->region, false);
+	omrobjectptr_t *objects = NULL;
+	uintptr_t count = 0;
+
+	objectHeapIterator.reset(chunk->base, chunk->top);
+	while (NULL != (objects = objectHeapIterator.nextObjects(&count))) {
+		function(omrVMThread, chunk->region, objects, count, threadData, userData);
+	}
+}
+
+/**
+ * Walk through all live objects of the heap on the GC threads, handing them to the provided function in batches.
+ */
+bool
+MM_ParallelHeapWalker::allObjectsDoBatched(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, MM_HeapWalkerThreadDataMergeFunc mergeFunction, uintptr_t threadDataSize, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk)
+{
+	Trc_MM_ParallelHeapWalker_allObjectsDoBatched_Entry(env->getLanguageVMThread());
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	OMR::GC::Forge *forge = env->getForge();
+	bool result = false;
+
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	if (prepareHeapForWalk) {
+		_globalCollector->prepareHeapForWalk(env);
+	}
+
+	/* regions larger than chunkSize are split, so that even a heap made of a single region gives every thread work */
+	uintptr_t threadCount = extensions->dispatcher->threadCount();
+	uintptr_t chunkSize = 0;
+	if (threadCount > 1) {
+		chunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, extensions->heap->getMemorySize() / (threadCount * 8));
+	}
+
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	regionManager->lock();
+
+	uintptr_t threadCountMaximum = extensions->dispatcher->threadCountMaximum();
+	uintptr_t threadDataStride = MM_Math::roundToCeiling(PARALLEL_HEAP_WALK_THREAD_DATA_ALIGNMENT, OMR_MAX(threadDataSize, (uintptr_t)1));
+	uintptr_t chunkCount = buildChunkTable(env, NULL, walkFlags, chunkSize);
+	MM_ParallelHeapWalkChunk *chunks = (MM_ParallelHeapWalkChunk *)forge->allocate(OMR_MAX(chunkCount, (uintptr_t)1) * sizeof(MM_ParallelHeapWalkChunk), OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	volatile uint64_t *ranges = (volatile uint64_t *)forge->allocate(threadCountMaximum * PARALLEL_HEAP_WALK_RANGE_STRIDE * sizeof(uint64_t), OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	void *threadDataMemory = forge->allocate((threadCountMaximum * threadDataStride) + PARALLEL_HEAP_WALK_THREAD_DATA_ALIGNMENT, OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+
+	uintptr_t threadsUsed = 0;
+	if ((NULL != chunks) && (NULL != ranges) && (NULL != threadDataMemory) && (chunkCount <= PARALLEL_HEAP_WALK_MAX_CHUNKS)) {
+		uint8_t *threadData = (uint8_t *)MM_Math::roundToCeiling(PARALLEL_HEAP_WALK_THREAD_DATA_ALIGNMENT, (uintptr_t)threadDataMemory);
+		memset(threadData, 0, threadCountMaximum * threadDataStride);
+		memset((void *)ranges, 0, threadCountMaximum * PARALLEL_HEAP_WALK_RANGE_STRIDE * sizeof(uint64_t));
+		chunkCount = buildChunkTable(env, chunks, walkFlags, chunkSize);
+
+		MM_ParallelObjectBatchDoTask objectBatchDoTask(env, this, function, userData, chunks, chunkCount, ranges, threadData, threadDataStride);
+		extensions->dispatcher->run(env, &objectBatchDoTask);
+
+		threadsUsed = objectBatchDoTask.getThreadCount();
+		if (NULL != mergeFunction) {
+			for (uintptr_t i = 0; i < threadsUsed; i++) {
+				mergeFunction(env->getOmrVMThread(), objectBatchDoTask.getThreadData(i), userData);
+			}
+		}
+		result = true;
+	}
+	regionManager->unlock();
+
+	if (NULL != threadDataMemory) {
+		forge->free(threadDataMemory);
+	}
+	if (NULL != ranges) {
+		forge->free((void *)ranges);
+	}
+	if (NULL != chunks) {
+		forge->free(chunks);
+	}
+
+	Trc_MM_ParallelHeapWalker_allObjectsDoBatched_Exit(env->getLanguageVMThread(), chunkCount, chunkSize, threadsUsed);
+	return result;
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
@@ -170,3 +408,73 @@ MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
 	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
 }
+
+void
+MM_ParallelObjectBatchDoTask::run(MM_EnvironmentBase *env)
+{
+	uintptr_t threadIndex = MM_AtomicOperations::add(&_joinedThreadCount, 1) - 1;
+	Assert_MM_true(threadIndex < getThreadCount());
+
+	if (synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		/* deal the chunks out in contiguous runs so that each thread starts on neighbouring memory */
+		uintptr_t threadCount = getThreadCount();
+		for (uintptr_t i = 0; i < threadCount; i++) {
+			*getRange(i) = PARALLEL_HEAP_WALK_RANGE((_chunkCount * i) / threadCount, (_chunkCount * (i + 1)) / threadCount);
+		}
+		releaseSynchronizedGCThreads(env);
+	}
+
+	void *threadData = getThreadData(threadIndex);
+	uintptr_t chunkIndex = 0;
+	while (nextChunk(env, threadIndex, &chunkIndex)) {
+		_heapWalker->walkChunk(env, &_chunks[chunkIndex], _function, threadData, _userData);
+	}
+}
+
+bool
+MM_ParallelObjectBatchDoTask::nextChunk(MM_EnvironmentBase *env, uintptr_t threadIndex, uintptr_t *chunkIndex)
+{
+	volatile uint64_t *range = getRange(threadIndex);
+
+	do {
+		uint64_t oldRange = *range;
+		while (PARALLEL_HEAP_WALK_RANGE_NEXT(oldRange) < PARALLEL_HEAP_WALK_RANGE_END(oldRange)) {
+			uint64_t newRange = PARALLEL_HEAP_WALK_RANGE(PARALLEL_HEAP_WALK_RANGE_NEXT(oldRange) + 1, PARALLEL_HEAP_WALK_RANGE_END(oldRange));
+			uint64_t seenRange = MM_AtomicOperations::lockCompareExchangeU64(range, oldRange, newRange);
+			if (seenRange == oldRange) {
+				*chunkIndex = PARALLEL_HEAP_WALK_RANGE_NEXT(oldRange);
+				return true;
+			}
+			/* a thief took the back of the run */
+			oldRange = seenRange;
+		}
+	} while (steal(env, threadIndex));
+
+	return false;
+}
+
+bool
+MM_ParallelObjectBatchDoTask::steal(MM_EnvironmentBase *env, uintptr_t threadIndex)
+{
+	uintptr_t threadCount = getThreadCount();
+
+	/* chunks only ever move between runs, so a thread which finds every run empty can stop: the remaining chunks are being walked */
+	for (uintptr_t i = 1; i < threadCount; i++) {
+		volatile uint64_t *victimRange = getRange((threadIndex + i) % threadCount);
+		uint64_t oldRange = *victimRange;
+		while (PARALLEL_HEAP_WALK_RANGE_NEXT(oldRange) < PARALLEL_HEAP_WALK_RANGE_END(oldRange)) {
+			uintptr_t end = PARALLEL_HEAP_WALK_RANGE_END(oldRange);
+			uintptr_t split = end - ((end - PARALLEL_HEAP_WALK_RANGE_NEXT(oldRange) + 1) / 2);
+			uint64_t newRange = PARALLEL_HEAP_WALK_RANGE(PARALLEL_HEAP_WALK_RANGE_NEXT(oldRange), split);
+			uint64_t seenRange = MM_AtomicOperations::lockCompareExchangeU64(victimRange, oldRange, newRange);
+			if (seenRange == oldRange) {
+				/* the calling thread's run is empty, so no other thread will update it */
+				MM_AtomicOperations::setU64(getRange(threadIndex), PARALLEL_HEAP_WALK_RANGE(split, end));
+				return true;
+			}
+			oldRange = seenRange;
+		}
+	}
+
+	return false;
+}
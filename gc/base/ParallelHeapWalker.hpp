@@ -29,9 +29,30 @@
 #include "HeapWalker.hpp"
 
 class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
 class MM_ParallelGlobalGC;
 class MM_MarkMap;
 
+/**
+ * Called with each batch of objects found by a batched heap walk.
+ * @param objects live objects of the region in address order, only valid for the duration of the call
+ * @param threadData the calling thread's accumulator
+ */
+typedef void (*MM_HeapWalkerObjectBatchFunc)(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t *objects, uintptr_t count, void *threadData, void *userData);
+/**
+ * Called once the batched heap walk is complete, on the thread which requested it, for the accumulator of each thread that took part.
+ */
+typedef void (*MM_HeapWalkerThreadDataMergeFunc)(OMR_VMThread *omrVMThread, void *threadData, void *userData);
+
+/**
+ * A unit of work of a batched heap walk.
+ */
+typedef struct MM_ParallelHeapWalkChunk {
+	MM_HeapRegionDescriptor *region; /**< region the chunk belongs to */
+	uintptr_t *base; /**< first object or free entry of the chunk */
+	uintptr_t *top; /**< end of the chunk, the base of the next chunk of the region or the top of the region */
+} MM_ParallelHeapWalkChunk;
+
 class MM_ParallelHeapWalker : public MM_HeapWalker
 {
 	/*
@@ -47,6 +68,20 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Split the regions selected by walkFlags into chunks which can be walked independently.
+	 * Regions are split at chunkSize where the mark map, or failing that the free list, can say where the
+	 * next object starts.
+	 * @param chunks table to fill in, or NULL to only count the chunks
+	 * @param chunkSize size to split regions at, 0 to walk each region as a single chunk
+	 * @return number of chunks, an upper bound when only counting
+	 */
+	uintptr_t buildChunkTable(MM_EnvironmentBase *env, MM_ParallelHeapWalkChunk *chunks, uintptr_t walkFlags, uintptr_t chunkSize);
+
+	/**
+	 * Walk the objects of a chunk, passing them to function as batches.
+	 */
+	void walkChunk(MM_EnvironmentBase *env, MM_ParallelHeapWalkChunk *chunk, MM_HeapWalkerObjectBatchFunc function, void *threadData, void *userData);
 protected:
 public:	
 	/**
@@ -61,6 +96,15 @@ public:
 	 */
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 
+	/**
+	 * Walk through all live objects of the heap on the GC threads, handing them to the provided function in batches.
+	 * The heap is split into chunks which are dealt out to the threads in contiguous runs; a thread which runs out
+	 * steals half of the remaining run of another. Each thread is given its own zeroed accumulator of threadDataSize
+	 * bytes, and mergeFunction is called with every accumulator once the walk is complete.
+	 * @return false if the walk could not be set up, in which case no objects were walked
+	 */
+	bool allObjectsDoBatched(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, MM_HeapWalkerThreadDataMergeFunc mergeFunction, uintptr_t threadDataSize, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk);
+
 	MM_MarkMap *getMarkMap() {
 		return _markMap;
 	}
@@ -85,6 +129,7 @@ public:
 	 * Friends
 	 */
 	friend class MM_ParallelObjectDoTask;
+	friend class MM_ParallelObjectBatchDoTask;
 };
 
 #endif /* PARALLEL_HEAP_WALKER_HPP_ */
@@ -100,6 +100,11 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 		env->_workPacketStats.workPacketsReleased,
 		env->_workPacketStats.workPacketsExchanged,
 		0/* TODO CRG figure out to get the array split size*/);
+	Trc_MM_ParallelMarkTask_packetListStats(
+		env->getLanguageVMThread(),
+		(uint32_t)env->getWorkerID(),
+		env->_workPacketStats.workPacketsCASRetries,
+		env->_workPacketStats.workPacketsRemoteSublistPops);
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+#include "ut_j9mm.h"
+
+#include "ParallelPreTouchTask.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "Math.hpp"
+#include "ParallelDispatcher.hpp"
+
+/* Small enough to balance a few MB of initial nursery across threads, large enough to amortize claiming it */
+#define PRE_TOUCH_CHUNK_SIZE ((uintptr_t)4 * 1024 * 1024)
+
+uintptr_t
+MM_ParallelPreTouchTask::getVMStateID()
+{
+	return OMRVMSTATE_GC_PRE_TOUCH_HEAP;
+}
+
+void
+MM_ParallelPreTouchTask::run(MM_EnvironmentBase *env)
+{
+	MM_HeapRegionManager *regionManager = env->getExtensions()->heap->getHeapRegionManager();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	uintptr_t bytesTouched = 0;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		uintptr_t low = (uintptr_t)region->getLowAddress();
+		uintptr_t high = (uintptr_t)region->getHighAddress();
+		for (uintptr_t chunk = low; chunk < high; chunk += _chunkSize) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				uintptr_t chunkTop = OMR_MIN(chunk + _chunkSize, high);
+				/* a read followed by a write of the same value, so that a page already in use keeps its contents */
+				for (uintptr_t page = MM_Math::roundToFloor(_pageSize, chunk); page < chunkTop; page += _pageSize) {
+					volatile uint8_t *touch = (volatile uint8_t *)OMR_MAX(page, chunk);
+					*touch = *touch;
+				}
+				bytesTouched += chunkTop - chunk;
+			}
+		}
+	}
+
+	MM_AtomicOperations::add(&_bytesTouched, bytesTouched);
+}
+
+uintptr_t
+MM_ParallelPreTouchTask::preTouchHeap(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t pageSize = extensions->heap->getPageSize();
+	uintptr_t chunkSize = MM_Math::roundToCeiling(pageSize, PRE_TOUCH_CHUNK_SIZE);
+
+	Trc_MM_ParallelPreTouchTask_preTouchHeap_Entry(env->getLanguageVMThread(), pageSize, chunkSize);
+
+	MM_ParallelPreTouchTask preTouchTask(env, extensions->dispatcher, chunkSize, pageSize);
+	extensions->dispatcher->run(env, &preTouchTask);
+
+	Trc_MM_ParallelPreTouchTask_preTouchHeap_Exit(env->getLanguageVMThread(), preTouchTask.getBytesTouched());
+	return preTouchTask.getBytesTouched();
+}
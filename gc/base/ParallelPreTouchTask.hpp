@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(PARALLELPRETOUCHTASK_HPP_)
+#define PARALLELPRETOUCHTASK_HPP_
+
+#include "omrcfg.h"
+
+#include "ParallelTask.hpp"
+
+class MM_EnvironmentBase;
+class MM_ParallelDispatcher;
+
+/**
+ * Faults in the memory committed for the heap, so that the first allocations into the nursery and
+ * tenure do not each take a page fault (or a huge page clear) on the mutator's allocation path.
+ * The committed regions are split into chunks which the GC threads claim as work units.
+ * @ingroup GC_Base
+ */
+class MM_ParallelPreTouchTask : public MM_ParallelTask
+{
+private:
+	uintptr_t _chunkSize; /**< bytes touched per work unit, a multiple of the page size */
+	uintptr_t _pageSize; /**< stride between touched bytes */
+	volatile uintptr_t _bytesTouched; /**< total bytes faulted in by all threads */
+
+public:
+	virtual uintptr_t getVMStateID();
+	virtual void run(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of bytes faulted in by the completed task
+	 */
+	MMINLINE uintptr_t getBytesTouched() { return _bytesTouched; }
+
+	/**
+	 * Fault in all of the memory currently committed for the heap on the dispatcher's threads.
+	 * @return the number of bytes touched
+	 */
+	static uintptr_t preTouchHeap(MM_EnvironmentBase *env);
+
+	MM_ParallelPreTouchTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, uintptr_t chunkSize, uintptr_t pageSize)
+		: MM_ParallelTask(env, dispatcher)
+		, _chunkSize(chunkSize)
+		, _pageSize(pageSize)
+		, _bytesTouched(0)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* PARALLELPRETOUCHTASK_HPP_ */
@@ -77,6 +77,7 @@ public:
 	MM_ParallelSweepChunk *_nextChunk;
 	uintptr_t _concurrentSweepState;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
+	volatile uintptr_t _lazySweepState; /**< how far the lazy sweep has got with the chunk, see MM_LazySweepScheme */
 
 	/* Split Free List Data */
 	MM_HeapLinkedFreeHeader* _splitCandidate;
@@ -156,6 +157,7 @@ public:
 		_nextChunk(NULL),
 		_concurrentSweepState(0),
 #endif /* OMR_GC_CONCURRENT_SWEEP */
+		_lazySweepState(0),
 		_splitCandidate(NULL),
 		_splitCandidatePreviousEntry(NULL),
 		_accumulatedFreeSize(0),
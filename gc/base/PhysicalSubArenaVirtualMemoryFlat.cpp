@@ -31,7 +31,11 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionManager.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "Math.hpp"
+#include "MemoryManager.hpp"
 #include "MemorySubSpace.hpp"
+#include "NUMAManager.hpp"
 #include "PhysicalArena.hpp"
 #include "PhysicalArenaVirtualMemory.hpp"
 #include "VirtualMemory.hpp"
@@ -117,6 +121,11 @@ MM_PhysicalSubArenaVirtualMemoryFlat::inflate(MM_EnvironmentBase *env)
 			void *lowAddress = _region->getLowAddress();
 			void *highAddress = _region->getHighAddress();
 
+			if (env->getExtensions()->numaAffinity) {
+				/* the stripes must be known before the memory reaches the pool */
+				setupHeapStripes(env);
+			}
+
 			MM_MemorySubSpace *genericSubSpace = ((MM_MemorySubSpaceFlat *)_subSpace)->getChildSubSpace();
 			result = genericSubSpace->expanded(env, this, _region->getSize(), lowAddress, highAddress, false);
 			if (result) {
@@ -129,6 +138,41 @@ MM_PhysicalSubArenaVirtualMemoryFlat::inflate(MM_EnvironmentBase *env)
 	return result;
 }
 
+/**
+ * Split the range this subarena can grow into in one contiguous stripe per NUMA affinity leader and, when
+ * NUMA is physically supported, bind each stripe's pages to its node.
+ * The whole maximum range is striped so that expansion never moves a stripe boundary.
+ */
+void
+MM_PhysicalSubArenaVirtualMemoryFlat::setupHeapStripes(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_NUMAManager *numaManager = &extensions->_numaManager;
+	uintptr_t leaderCount = numaManager->getAffinityLeaderCount();
+
+	if (1 < leaderCount) {
+		uintptr_t pageSize = _heap->getPageSize();
+		uintptr_t stripeRange = OMR_MIN(_subSpace->getMaximumSize(), (uintptr_t)_heap->getHeapTop() - (uintptr_t)_lowAddress);
+		uintptr_t stripeSize = MM_Math::roundToCeiling(pageSize, stripeRange / leaderCount);
+		numaManager->setHeapStripes(_lowAddress, stripeSize);
+
+#if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
+		if (numaManager->isPhysicalNUMASupported()) {
+			J9MemoryNodeDetail const *leaders = numaManager->getAffinityLeaders(&leaderCount);
+			uintptr_t stripeTop = (uintptr_t)_lowAddress + stripeRange;
+			for (uintptr_t i = 0; i < leaderCount; i++) {
+				uintptr_t base = MM_Math::roundToCeiling(pageSize, (uintptr_t)numaManager->getHeapStripeBase(i));
+				uintptr_t top = OMR_MIN(base + stripeSize, stripeTop);
+				if (base < top) {
+					/* a failed binding only costs locality, the stripe is still used by its node's threads */
+					extensions->memoryManager->setNumaAffinity(((MM_HeapVirtualMemory *)_heap)->getVmemHandle(), leaders[i].j9NodeNumber, (void *)base, top - base);
+				}
+			}
+		}
+#endif /* defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER) */
+	}
+}
+
 /**
  * Expand the physical arena by the parameters in the description.
  * The expand request size is just a guideline - if the subarena cannot satisfy the request,
@@ -44,6 +44,8 @@ class MM_PhysicalArena;
 class MM_PhysicalSubArenaVirtualMemoryFlat : public MM_PhysicalSubArenaVirtualMemory
 {
 private:
+	void setupHeapStripes(MM_EnvironmentBase *env);
+
 protected:
 	MM_HeapRegionDescriptor *_region;
 
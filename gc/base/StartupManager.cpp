@@ -37,19 +37,85 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCSLIDING_COMPACTION "-Xgc:slidingCompaction"
+#define OMR_XGCSLIDING_COMPACTION_LENGTH 22
+#define OMR_XGCPARTIAL_COMPACTION_MAX_PERCENT "-Xgc:partialCompactionMaxPercent="
+#define OMR_XGCPARTIAL_COMPACTION_MAX_PERCENT_LENGTH 33
+#define OMR_XGCPARTIAL_COMPACTION "-Xgc:partialCompaction"
+#define OMR_XGCPARTIAL_COMPACTION_LENGTH 22
+#define OMR_XGCFRAGMENTATION_FORECAST_HORIZON "-Xgc:fragmentationForecastHorizon="
+#define OMR_XGCFRAGMENTATION_FORECAST_HORIZON_LENGTH 34
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
 #define OMR_XGCPOLICY_LENGTH 11
 #define OMR_GCPOLICY_GENCON "gencon"
 #define OMR_GCPOLICY_GENCON_LENGTH 6
+#define OMR_XGCSCAVENGER_WORK_STEALING "-Xgc:scavengerWorkStealing"
+#define OMR_XGCSCAVENGER_WORK_STEALING_LENGTH 26
+#define OMR_XGCALLOCATION_LIFETIME_SAMPLING "-Xgc:allocationLifetimeSampling="
+#define OMR_XGCALLOCATION_LIFETIME_SAMPLING_LENGTH 32
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_REGIONAL)
+#define OMR_XGCREGIONAL_EDEN_SIZE "-Xgc:regionalEdenSize="
+#define OMR_XGCREGIONAL_EDEN_SIZE_LENGTH 22
+#define OMR_XGCREGIONAL_OLD_REGIONS_PER_PAUSE "-Xgc:regionalOldRegionsPerPause="
+#define OMR_XGCREGIONAL_OLD_REGIONS_PER_PAUSE_LENGTH 32
+#endif /* defined(OMR_GC_REGIONAL) */
 #define OMR_XVERBOSEGCLOG "-Xverbosegclog:"
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#define OMR_XGCLOCK_FREE_PACKET_LISTS "-Xgc:lockFreePacketLists"
+#define OMR_XGCLOCK_FREE_PACKET_LISTS_LENGTH 24
+#define OMR_XGCFREE_LIST_SIZE_INDEX "-Xgc:freeListSizeIndex"
+#define OMR_XGCFREE_LIST_SIZE_INDEX_LENGTH 22
+#define OMR_XGCLAZY_SWEEP "-Xgc:lazySweep"
+#define OMR_XGCLAZY_SWEEP_LENGTH 14
+#define OMR_XGCNUMA_AFFINITY "-Xgc:numaAffinity"
+#define OMR_XGCNUMA_AFFINITY_LENGTH 17
+#define OMR_XGCNO_VECTOR_HEAP_MAP_SCAN "-Xgc:noVectorHeapMapScan"
+#define OMR_XGCNO_VECTOR_HEAP_MAP_SCAN_LENGTH 24
+#define OMR_XGCADAPTIVE_TLH_SIZING "-Xgc:adaptiveTLHSizing"
+#define OMR_XGCADAPTIVE_TLH_SIZING_LENGTH 22
+#define OMR_XGCTLH_REFRESH_INTERVAL_TARGET "-Xgc:tlhRefreshIntervalTarget="
+#define OMR_XGCTLH_REFRESH_INTERVAL_TARGET_LENGTH 30
+#define OMR_XGCTLH_ALLOCATION_RATE_HISTORY_WEIGHT "-Xgc:tlhAllocationRateHistoryWeight="
+#define OMR_XGCTLH_ALLOCATION_RATE_HISTORY_WEIGHT_LENGTH 36
+#define OMR_XGCLOCK_FREE_REGION_QUEUES "-Xgc:lockFreeRegionQueues"
+#define OMR_XGCLOCK_FREE_REGION_QUEUES_LENGTH 25
+#define OMR_XGCMARK_PREFETCH_DEPTH "-Xgc:markPrefetchDepth="
+#define OMR_XGCMARK_PREFETCH_DEPTH_LENGTH 23
+#define OMR_XGCBINARY_VERBOSE_LOG_RECORDS "-Xgc:binaryVerboseLogRecords="
+#define OMR_XGCBINARY_VERBOSE_LOG_RECORDS_LENGTH 29
+#define OMR_XGCBINARY_VERBOSE_LOG "-Xgc:binaryVerboseLog"
+#define OMR_XGCBINARY_VERBOSE_LOG_LENGTH 21
+#define OMR_XGCASYNC_VERBOSE_LOG_BUFFER_SIZE "-Xgc:asyncVerboseLogBufferSize="
+#define OMR_XGCASYNC_VERBOSE_LOG_BUFFER_SIZE_LENGTH 31
+#define OMR_XGCASYNC_VERBOSE_LOG "-Xgc:asyncVerboseLog"
+#define OMR_XGCASYNC_VERBOSE_LOG_LENGTH 20
+#define OMR_XGCTARGET_PAUSE_TIME "-Xgc:targetPauseTime="
+#define OMR_XGCTARGET_PAUSE_TIME_LENGTH 21
+#define OMR_XGCTARGET_GC_PERCENTAGE "-Xgc:targetGCPercentage="
+#define OMR_XGCTARGET_GC_PERCENTAGE_LENGTH 24
+#define OMR_XGCHEAP_RESIZE_HYSTERESIS "-Xgc:heapResizeHysteresis="
+#define OMR_XGCHEAP_RESIZE_HYSTERESIS_LENGTH 26
+#define OMR_XGCHEAP_RESERVE_ALIGNMENT "-Xgc:heapReserveAlignment="
+#define OMR_XGCHEAP_RESERVE_ALIGNMENT_LENGTH 26
+#define OMR_XGCHEAP_PAGE_SIZE "-Xgc:heapPageSize="
+#define OMR_XGCHEAP_PAGE_SIZE_LENGTH 18
+#define OMR_XGCPRE_TOUCH_HEAP "-Xgc:preTouchHeap"
+#define OMR_XGCPRE_TOUCH_HEAP_LENGTH 17
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCCARD_TABLE_SUMMARY "-Xgc:cardTableSummary"
+#define OMR_XGCCARD_TABLE_SUMMARY_LENGTH 21
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#define OMR_XGCCONCURRENT_SCAVENGE "-Xgc:concurrentScavenge"
+#define OMR_XGCCONCURRENT_SCAVENGE_LENGTH 23
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -264,6 +330,28 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCSLIDING_COMPACTION, OMR_XGCSLIDING_COMPACTION_LENGTH)) {
+		extensions->slidingCompaction = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCPARTIAL_COMPACTION_MAX_PERCENT, OMR_XGCPARTIAL_COMPACTION_MAX_PERCENT_LENGTH)) {
+		uintptr_t percent = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCPARTIAL_COMPACTION_MAX_PERCENT_LENGTH, &percent)) || (0 == percent) || (100 < percent)) {
+			result = false;
+		} else {
+			extensions->partialCompactionMaxPercent = percent;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCPARTIAL_COMPACTION, OMR_XGCPARTIAL_COMPACTION_LENGTH)) {
+		extensions->partialCompaction = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCFRAGMENTATION_FORECAST_HORIZON, OMR_XGCFRAGMENTATION_FORECAST_HORIZON_LENGTH)) {
+		uintptr_t horizon = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCFRAGMENTATION_FORECAST_HORIZON_LENGTH, &horizon)) {
+			result = false;
+		} else {
+			extensions->fragmentationForecastHorizon = horizon;
+		}
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -287,6 +375,35 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		}
 	}
 #endif /* defined(OMR_GC_MORDON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_WORK_STEALING, OMR_XGCSCAVENGER_WORK_STEALING_LENGTH)) {
+		extensions->scavengerWorkStealing = true;
+	} else if (0 == strncmp(option, OMR_XGCALLOCATION_LIFETIME_SAMPLING, OMR_XGCALLOCATION_LIFETIME_SAMPLING_LENGTH)) {
+		uintptr_t interval = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCALLOCATION_LIFETIME_SAMPLING_LENGTH, &interval) || (0 == interval)) {
+			result = false;
+		} else {
+			extensions->allocationLifetimeSamplingInterval = interval;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_REGIONAL)
+	else if (0 == strncmp(option, OMR_XGCREGIONAL_EDEN_SIZE, OMR_XGCREGIONAL_EDEN_SIZE_LENGTH)) {
+		uintptr_t edenSize = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCREGIONAL_EDEN_SIZE_LENGTH, &edenSize) || (0 == edenSize)) {
+			result = false;
+		} else {
+			extensions->regionalEdenSize = edenSize;
+		}
+	} else if (0 == strncmp(option, OMR_XGCREGIONAL_OLD_REGIONS_PER_PAUSE, OMR_XGCREGIONAL_OLD_REGIONS_PER_PAUSE_LENGTH)) {
+		uintptr_t regionCount = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCREGIONAL_OLD_REGIONS_PER_PAUSE_LENGTH, &regionCount)) {
+			result = false;
+		} else {
+			extensions->regionalOldRegionsPerPause = regionCount;
+		}
+	}
+#endif /* defined(OMR_GC_REGIONAL) */
 	else if (0 == strncmp(option, OMR_XGCTHREADS, OMR_XGCTHREADS_LENGTH)) {
 		uintptr_t forcedThreadCount = 0;
 		if (0 >= getUDATAValue(option + OMR_XGCTHREADS_LENGTH, &forcedThreadCount)) {
@@ -295,6 +412,122 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 			extensions->gcThreadCount = forcedThreadCount;
 			extensions->gcThreadCountForced = true;
 		}
+	} else if (0 == strncmp(option, OMR_XGCLOCK_FREE_PACKET_LISTS, OMR_XGCLOCK_FREE_PACKET_LISTS_LENGTH)) {
+		extensions->packetListLockFree = true;
+	} else if (0 == strncmp(option, OMR_XGCFREE_LIST_SIZE_INDEX, OMR_XGCFREE_LIST_SIZE_INDEX_LENGTH)) {
+		extensions->freeListSizeIndex = true;
+	} else if (0 == strncmp(option, OMR_XGCLAZY_SWEEP, OMR_XGCLAZY_SWEEP_LENGTH)) {
+		extensions->lazySweep = true;
+	} else if (0 == strncmp(option, OMR_XGCNUMA_AFFINITY, OMR_XGCNUMA_AFFINITY_LENGTH)) {
+		extensions->numaAffinity = true;
+		extensions->numaForced = true;
+		extensions->_numaManager.shouldEnablePhysicalNUMA(true);
+	} else if (0 == strncmp(option, OMR_XGCNO_VECTOR_HEAP_MAP_SCAN, OMR_XGCNO_VECTOR_HEAP_MAP_SCAN_LENGTH)) {
+		extensions->vectorHeapMapScan = false;
+	} else if (0 == strncmp(option, OMR_XGCADAPTIVE_TLH_SIZING, OMR_XGCADAPTIVE_TLH_SIZING_LENGTH)) {
+		extensions->adaptiveTLHSizing = true;
+	} else if (0 == strncmp(option, OMR_XGCTLH_REFRESH_INTERVAL_TARGET, OMR_XGCTLH_REFRESH_INTERVAL_TARGET_LENGTH)) {
+		/* microseconds of allocation an adaptively sized TLH should last */
+		uintptr_t interval = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCTLH_REFRESH_INTERVAL_TARGET_LENGTH, &interval)) || (0 == interval)) {
+			result = false;
+		} else {
+			extensions->tlhRefreshIntervalTarget = interval;
+		}
+	} else if (0 == strncmp(option, OMR_XGCTLH_ALLOCATION_RATE_HISTORY_WEIGHT, OMR_XGCTLH_ALLOCATION_RATE_HISTORY_WEIGHT_LENGTH)) {
+		/* percentage weight of the history in the decayed allocation rate; 100 would never take a new sample */
+		uintptr_t percent = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCTLH_ALLOCATION_RATE_HISTORY_WEIGHT_LENGTH, &percent)) || (100 <= percent)) {
+			result = false;
+		} else {
+			extensions->tlhAllocationRateHistoryWeight = (float)percent / 100.0f;
+		}
+	} else if (0 == strncmp(option, OMR_XGCLOCK_FREE_REGION_QUEUES, OMR_XGCLOCK_FREE_REGION_QUEUES_LENGTH)) {
+		extensions->lockFreeRegionQueues = true;
+	} else if (0 == strncmp(option, OMR_XGCMARK_PREFETCH_DEPTH, OMR_XGCMARK_PREFETCH_DEPTH_LENGTH)) {
+		uintptr_t depth = 0;
+		/* a depth of 1 would only delay each object behind itself */
+		if ((0 >= getUDATAValue(option + OMR_XGCMARK_PREFETCH_DEPTH_LENGTH, &depth)) || (1 == depth) || (MARKING_SCHEME_PREFETCH_DEPTH_MAX < depth)) {
+			result = false;
+		} else {
+			extensions->markPrefetchDepth = depth;
+		}
+	} else if (0 == strncmp(option, OMR_XGCBINARY_VERBOSE_LOG_RECORDS, OMR_XGCBINARY_VERBOSE_LOG_RECORDS_LENGTH)) {
+		uintptr_t records = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCBINARY_VERBOSE_LOG_RECORDS_LENGTH, &records)) || (0 == records)) {
+			result = false;
+		} else {
+			extensions->binaryVerboseLogRecords = records;
+		}
+	} else if (0 == strncmp(option, OMR_XGCBINARY_VERBOSE_LOG, OMR_XGCBINARY_VERBOSE_LOG_LENGTH)) {
+		extensions->binaryVerboseLog = true;
+	} else if (0 == strncmp(option, OMR_XGCASYNC_VERBOSE_LOG_BUFFER_SIZE, OMR_XGCASYNC_VERBOSE_LOG_BUFFER_SIZE_LENGTH)) {
+		uintptr_t size = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCASYNC_VERBOSE_LOG_BUFFER_SIZE_LENGTH, &size) || (0 == size)) {
+			result = false;
+		} else {
+			extensions->asyncVerboseLogBufferSize = size;
+		}
+	} else if (0 == strncmp(option, OMR_XGCASYNC_VERBOSE_LOG, OMR_XGCASYNC_VERBOSE_LOG_LENGTH)) {
+		extensions->asyncVerboseLog = true;
+	} else if (0 == strncmp(option, OMR_XGCTARGET_PAUSE_TIME, OMR_XGCTARGET_PAUSE_TIME_LENGTH)) {
+		uintptr_t pauseTime = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCTARGET_PAUSE_TIME_LENGTH, &pauseTime)) {
+			result = false;
+		} else {
+			extensions->heapResizeTargetPauseTime = pauseTime;
+		}
+	} else if (0 == strncmp(option, OMR_XGCTARGET_GC_PERCENTAGE, OMR_XGCTARGET_GC_PERCENTAGE_LENGTH)) {
+		uintptr_t percentage = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCTARGET_GC_PERCENTAGE_LENGTH, &percentage)) || (100 <= percentage)) {
+			result = false;
+		} else {
+			extensions->heapResizeTargetGCPercentage = percentage;
+		}
+	} else if (0 == strncmp(option, OMR_XGCHEAP_RESIZE_HYSTERESIS, OMR_XGCHEAP_RESIZE_HYSTERESIS_LENGTH)) {
+		uintptr_t hysteresis = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCHEAP_RESIZE_HYSTERESIS_LENGTH, &hysteresis)) || (0 == hysteresis)) {
+			result = false;
+		} else {
+			extensions->heapResizeHysteresis = hysteresis;
+		}
+	} else if (0 == strncmp(option, OMR_XGCHEAP_RESERVE_ALIGNMENT, OMR_XGCHEAP_RESERVE_ALIGNMENT_LENGTH)) {
+		uintptr_t alignment = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCHEAP_RESERVE_ALIGNMENT_LENGTH, &alignment) || (0 == alignment) || (0 != (alignment & (alignment - 1)))) {
+			result = false;
+		} else {
+			extensions->heapReserveAlignment = alignment;
+		}
+	} else if (0 == strncmp(option, OMR_XGCHEAP_PAGE_SIZE, OMR_XGCHEAP_PAGE_SIZE_LENGTH)) {
+		OMRPORT_ACCESS_FROM_OMRVM(extensions->getOmrVM());
+		uintptr_t pageSize = 0;
+		result = false;
+		if (getUDATAMemoryValue(option + OMR_XGCHEAP_PAGE_SIZE_LENGTH, &pageSize)) {
+			/* only page sizes the port library can map (hugetlbfs backed on Linux) are accepted */
+			uintptr_t *pageSizes = omrvmem_supported_page_sizes();
+			uintptr_t *pageFlags = omrvmem_supported_page_flags();
+			for (uintptr_t i = 0; 0 != pageSizes[i]; i++) {
+				if (pageSize == pageSizes[i]) {
+					extensions->requestedPageSize = pageSizes[i];
+					extensions->requestedPageFlags = pageFlags[i];
+					result = true;
+					break;
+				}
+			}
+		}
+	} else if (0 == strncmp(option, OMR_XGCPRE_TOUCH_HEAP, OMR_XGCPRE_TOUCH_HEAP_LENGTH)) {
+		extensions->preTouchHeap = true;
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	} else if (0 == strncmp(option, OMR_XGCCARD_TABLE_SUMMARY, OMR_XGCCARD_TABLE_SUMMARY_LENGTH)) {
+		extensions->cardTableSummary = true;
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	} else if (0 == strncmp(option, OMR_XGCCONCURRENT_SCAVENGE, OMR_XGCCONCURRENT_SCAVENGE_LENGTH)) {
+		/* mutators reach nursery objects through the software read barrier (see standardReadBarrier()) */
+		extensions->concurrentScavenger = true;
+		extensions->concurrentScavengerForced = true;
+		extensions->softwareRangeCheckReadBarrier = true;
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 	} else {
 		/* unknown option */
 		result = false;
@@ -36,6 +36,9 @@
 
 #include "AllocateDescription.hpp"
 #include "AllocationContext.hpp"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "AllocationLifetimeSampler.hpp"
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
 #include "FrequentObjectsStats.hpp"
@@ -203,6 +206,12 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 		_stats._allocationCount += 1;
 	}
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if ((NULL != result) && (NULL != extensions->allocationLifetimeSampler)) {
+		extensions->allocationLifetimeSampler->objectAllocated(env, (omrobjectptr_t)result, allocDescription);
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 	uintptr_t sizeInBytesAllocated = (_stats.bytesAllocated(false) - _bytesAllocatedBase);
 	env->_oolTraceAllocationBytes += sizeInBytesAllocated;
 	env->_traceAllocationBytes += sizeInBytesAllocated;
@@ -113,6 +113,39 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
 }
 
+void
+MM_TLHAllocationSupport::updateAllocationRate(MM_EnvironmentBase *env, uintptr_t usedSize)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uint64_t now = omrtime_hires_clock();
+
+	if (0 != _lastRefreshTime) {
+		/* bytes per millisecond over the life of the TLH just retired; a thread which sat idle
+		 * holding a mostly empty TLH produces a low sample and decays towards small TLHs
+		 */
+		uint64_t elapsedMicros = omrtime_hires_delta(_lastRefreshTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		double sample = ((double)usedSize * 1000.0) / (double)OMR_MAX(elapsedMicros, (uint64_t)1);
+		if (0.0 == _allocationRate) {
+			_allocationRate = sample;
+		} else {
+			_allocationRate = MM_Math::weightedAverage(_allocationRate, sample, (double)extensions->tlhAllocationRateHistoryWeight);
+		}
+
+		/* size the next TLH to cover tlhRefreshIntervalTarget microseconds of allocation at the current rate */
+		double targetSize = (_allocationRate * (double)extensions->tlhRefreshIntervalTarget) / 1000.0;
+		uintptr_t refreshSize = extensions->tlhMaximumSize;
+		_hotAllocator = (targetSize >= (double)extensions->tlhMaximumSize);
+		if (!_hotAllocator) {
+			refreshSize = MM_Math::roundToCeiling(extensions->tlhIncrementSize, (uintptr_t)targetSize);
+			refreshSize = OMR_MIN(OMR_MAX(refreshSize, extensions->tlhInitialSize), extensions->tlhMaximumSize);
+		}
+		setRefreshSize(refreshSize);
+	}
+
+	_lastRefreshTime = now;
+}
+
 bool
 MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure)
 {
@@ -128,8 +161,8 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t halfRefreshSize = getRefreshSize() >> 1;
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
-		/* increase thread hungriness if we did not refresh */
-		if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
+		/* increase thread hungriness if we did not refresh; adaptive sizing leaves the refresh size to the allocation rate */
+		if (!extensions->adaptiveTLHSizing && (getRefreshSize() < tlhMaximumSize) && (sizeInBytesRequired < tlhMaximumSize)) {
 			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 		}
 		return false;
@@ -170,6 +203,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	}
 
 	bool didRefresh = false;
+	bool reusedTLH = false;
 	/* Try allocating a TLH */
 	if ((NULL != _abandonedList) && (sizeInBytesRequired <= tlhMinimumSize)) {
 		/* Try to get a cached TLH */
@@ -194,6 +228,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		stats->_tlhAllocatedReused += getSize();
 		stats->_tlhDiscardedBytes -= getSize();
 
+		reusedTLH = true;
 		didRefresh = true;
 	} else {
 		/* Try allocating a fresh TLH */
@@ -254,9 +289,22 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			stats->_tlhRequestedBytes += getRefreshSize();
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
-			/* Increase thread hungriness */
-			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (extensions->adaptiveTLHSizing) {
+				if (reusedTLH) {
+					/* abandoned tails are sized by an earlier refresh; carry the bytes to the next fresh sample
+					 * instead of sampling the rate over a partial interval
+					 */
+					_usedSinceLastRefresh += usedSize;
+				} else {
+					updateAllocationRate(env, _usedSinceLastRefresh + usedSize);
+					_usedSinceLastRefresh = 0;
+					if (_hotAllocator) {
+						stats->_tlhRefreshCountHot += 1;
+					}
+				}
+			} else if (getRefreshSize() < tlhMaximumSize) {
+				/* Increase thread hungriness */
+				/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 			reserveTLHTopForGC(env);
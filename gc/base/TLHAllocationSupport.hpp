@@ -84,6 +84,11 @@ private:
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 	uintptr_t _reservedBytesForGC; /**< Number of bytes reserved in the TLH by collector. If set, we are guaranteed to have this remaining size available when we flush/clear TLH. */
+
+	uint64_t _lastRefreshTime; /**< hires clock at the last fresh TLH refresh, 0 before the first one (adaptiveTLHSizing only) */
+	uintptr_t _usedSinceLastRefresh; /**< bytes used from reused (abandoned) TLHs since the last fresh TLH refresh (adaptiveTLHSizing only) */
+	double _allocationRate; /**< decayed TLH allocation rate of the owning thread, in bytes per millisecond (adaptiveTLHSizing only) */
+	bool _hotAllocator; /**< true if the owning thread allocates fast enough to always get maximum size TLHs (adaptiveTLHSizing only) */
 public:
 protected:
 private:
@@ -195,6 +200,12 @@ private:
 	 */
 	void *restoreTLHTopForGC(MM_EnvironmentBase *env);
 
+	/**
+	 * Fold the TLH being retired into the thread's decayed allocation rate and size the next refresh from it.
+	 * @param[in] usedSize bytes allocated since the last fresh refresh, including any reused TLHs in between
+	 */
+	void updateAllocationRate(MM_EnvironmentBase *env, uintptr_t usedSize);
+
 	/**
 	 * Refresh the TLH.
 	 */
@@ -251,7 +262,11 @@ private:
 		_abandonedList(NULL),
 		_abandonedListSize(0),
 		_zeroTLH(zeroTLH),
-		_reservedBytesForGC(0)
+		_reservedBytesForGC(0),
+		_lastRefreshTime(0),
+		_usedSinceLastRefresh(0),
+		_allocationRate(0.0),
+		_hotAllocator(false)
 	{};
 
 	/*
@@ -42,12 +42,16 @@
  */
 
 MM_VirtualMemory*
-MM_VirtualMemory::newInstance(MM_EnvironmentBase* env, uintptr_t heapAlignment, uintptr_t size, uintptr_t pageSize, uintptr_t pageFlags, uintptr_t tailPadding, void* preferredAddress, void* ceiling, uintptr_t mode, uintptr_t options, uint32_t memoryCategory)
+MM_VirtualMemory::newInstance(MM_EnvironmentBase* env, uintptr_t heapAlignment, uintptr_t size, uintptr_t pageSize, uintptr_t pageFlags, uintptr_t tailPadding, void* preferredAddress, void* ceiling, uintptr_t mode, uintptr_t options, uint32_t memoryCategory, uintptr_t baseAlignment)
 {
 	MM_VirtualMemory* vmem = (MM_VirtualMemory*)env->getForge()->allocate(sizeof(MM_VirtualMemory), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 
 	if (vmem) {
 		new (vmem) MM_VirtualMemory(env, heapAlignment, pageSize, pageFlags, tailPadding, mode);
+		if (baseAlignment > heapAlignment) {
+			Assert_MM_true(0 == (baseAlignment % heapAlignment));
+			vmem->_baseAlignment = baseAlignment;
+		}
 		if (!vmem->initialize(env, size, preferredAddress, ceiling, options, memoryCategory)) {
 			vmem->kill(env);
 			vmem = NULL;
@@ -133,7 +137,8 @@ MM_VirtualMemory::initialize(MM_EnvironmentBase* env, uintptr_t size, void* pref
 void
 MM_VirtualMemory::roundDownTop(uintptr_t rounding)
 {
-	_heapTop = (void*)MM_Math::roundToFloor(_heapAlignment, ((uintptr_t)_heapBase) + (_reserveSize - rounding));
+	/* the reservation starts at _baseAddress, _heapBase may have been aligned up from it */
+	_heapTop = (void*)MM_Math::roundToFloor(_heapAlignment, ((uintptr_t)_baseAddress) + (_reserveSize - rounding));
 }
 
 void*
@@ -156,7 +161,7 @@ MM_VirtualMemory::reserveMemory(J9PortVmemParams* params)
 		_pageSize = omrvmem_get_page_size(&_identifier);
 		_pageFlags = omrvmem_get_page_flags(&_identifier);
 		Assert_MM_true(0 != _pageSize);
-		addressToReturn = (void*)MM_Math::roundToCeiling(_heapAlignment, (uintptr_t)_baseAddress);
+		addressToReturn = (void*)MM_Math::roundToCeiling(_baseAlignment, (uintptr_t)_baseAddress);
 	}
 	return addressToReturn;
 }
@@ -61,6 +61,7 @@ protected:
 	MM_GCExtensionsBase* _extensions;
 	void* _baseAddress; /**< The address returned from port - needed for freeing memory at shutdown */
 	uintptr_t _heapAlignment;
+	uintptr_t _baseAlignment; /**< Alignment of _heapBase, a multiple of _heapAlignment */
 	uintptr_t _pageSize; /**< Page size for this virtual memory object (before reservation requested, after reservation real) */
 	uintptr_t _reserveSize; /**< The total number of bytes reserved, starting from _baseAddress */
 
@@ -74,8 +75,9 @@ private:
 protected:
 	/*
 	 * use "OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE" for mode
+	 * baseAlignment, if larger than heapAlignment, is the alignment of the base of the usable memory; the size must allow for it
 	 */
-	static MM_VirtualMemory* newInstance(MM_EnvironmentBase* env, uintptr_t heapAlignment, uintptr_t size, uintptr_t pageSize, uintptr_t pageFlags, uintptr_t tailPadding, void* preferredAddress, void* ceiling, uintptr_t mode, uintptr_t options, uint32_t memoryCategory);
+	static MM_VirtualMemory* newInstance(MM_EnvironmentBase* env, uintptr_t heapAlignment, uintptr_t size, uintptr_t pageSize, uintptr_t pageFlags, uintptr_t tailPadding, void* preferredAddress, void* ceiling, uintptr_t mode, uintptr_t options, uint32_t memoryCategory, uintptr_t baseAlignment = 0);
 
 	bool initialize(MM_EnvironmentBase* env, uintptr_t size, void* preferredAddress, void* ceiling, uintptr_t options, uint32_t memoryCategory);
 	virtual void tearDown(MM_EnvironmentBase* env);
@@ -98,6 +100,7 @@ protected:
 		, _extensions(env->getExtensions())
 		, _baseAddress(NULL)
 		, _heapAlignment(heapAlignment)
+		, _baseAlignment(heapAlignment)
 		, _pageSize(pageSize)
 		, _reserveSize(0)
 	{
@@ -137,6 +140,14 @@ protected:
 		return _heapTop;
 	};
 
+	/**
+	 * Return the end of the memory reserved by the virtual memory object.
+	 */
+	MMINLINE void* getReserveTop()
+	{
+		return (void*)((uintptr_t)_baseAddress + _reserveSize);
+	};
+
 	/**
 	 * Return the heap file descriptor.
 	 */
@@ -145,6 +145,15 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 
 	_packetsPerBlock = initialPacketCount / _initialBlocks;
 
+	if (_extensions->packetListLockFree) {
+		_emptyPacketList.setLockFree(_packetsStart, _packetsPerBlock);
+		_fullPacketList.setLockFree(_packetsStart, _packetsPerBlock);
+		_nonEmptyPacketList.setLockFree(_packetsStart, _packetsPerBlock);
+		_relativelyFullPacketList.setLockFree(_packetsStart, _packetsPerBlock);
+		_deferredPacketList.setLockFree(_packetsStart, _packetsPerBlock);
+		_deferredFullPacketList.setLockFree(_packetsStart, _packetsPerBlock);
+	}
+
 	/* If -Xgcworkpackets was specified  we don't allow later allocation of more packets */
 	_maxPackets = (0 != _extensions->workpacketCount) ? initialPacketCount : initialPacketCount * _increaseFactor;
 	
@@ -220,6 +229,7 @@ MM_WorkPackets::initWorkPacketsBlock(MM_EnvironmentBase *env)
 	for (uintptr_t i = 0; i < _packetsPerBlock; i++) {
 		baseAddress = (uintptr_t *) (dataStart + (i * dataSize));
 		currentPtr->initialize(env, nextPtr, previousPtr, baseAddress, _slotsInPacket);
+		currentPtr->setPacketIndex((_packetsBlocksTop * _packetsPerBlock) + i + 1);
 
 		previousPtr = currentPtr;
 		currentPtr += 1;
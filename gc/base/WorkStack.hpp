@@ -120,6 +120,14 @@ public:
 		return (NULL != _inputPacket);
 	}
 
+	/**
+	 * Return the number of references left in the input packet, 0 if there is none
+	 */
+	MMINLINE uintptr_t inputPacketSize()
+	{
+		return (NULL == _inputPacket) ? 0 : _inputPacket->usedSlots();
+	}
+
 	/**
 	 * Return back true if output packets list is not empty
 	 */
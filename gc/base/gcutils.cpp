@@ -87,6 +87,8 @@ getCompactionReasonAsString(CompactReason reason)
 			return "page granularity fragmentation";	
 		case COMPACT_MICRO_FRAG:
 			return "micro fragmentation";	
+		case COMPACT_FRAGMENTATION_FORECAST:
+			return "large allocations forecast to fail";
 		default:
 			return "unknown";
 	}
@@ -196,6 +198,10 @@ getContractReasonAsString(ContractReason reason)
 		return "forced nursery contract";
 	case SOFT_MX_CONTRACT:
 		return "satisfy softmx";
+	case PAUSE_TIME_ABOVE_TARGET:
+		return "pause time above target";
+	case GC_TIME_BELOW_TARGET:
+		return "gc time well below target";
 	default:
 		return "unknown";
 	}
@@ -227,6 +233,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS:
 		return "hint from previous runs";
+	case GC_TIME_ABOVE_TARGET:
+		return "gc time above target";
 	default:
 		return "unknown";
 	}
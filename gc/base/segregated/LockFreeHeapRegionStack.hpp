@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(LOCKFREEHEAPREGIONSTACK_HPP_)
+#define LOCKFREEHEAPREGIONSTACK_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#define HEAPREGIONSTACK_TAGGED_HEAD_INDEX_MASK ((uint64_t)0xFFFFFFFF)
+#define HEAPREGIONSTACK_TAGGED_HEAD_TAG_INCREMENT (((uint64_t)1) << 32)
+
+/**
+ * A stack of single regions, linked through their next pointers, which is updated with compare and swap
+ * instead of a lock. The head is a 64 bit word holding an ABA tag in the high half and the 1-based index
+ * of the first region in the region table in the low half, so it can be swapped atomically on every platform.
+ * Chains of regions are pushed and popped with a single swap so that bulk moves between lists cost no more
+ * than moving one region.
+ * Only the next pointer of a region on the stack is meaningful; prev pointers are cleared or rebuilt when
+ * regions come off the stack.
+ */
+class MM_LockFreeHeapRegionStack
+{
+/* Data members & types */
+private:
+	MM_HeapRegionManager *_regionManager; /**< owns the region table the head indexes into, NULL if the stack is not used */
+	volatile uint64_t _taggedHead; /**< ABA tag and 1-based region table index of the first region, 0 index if empty */
+
+/* Methods */
+private:
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	getRegionFromTaggedHead(uint64_t taggedHead)
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		uintptr_t regionIndex = (uintptr_t)(taggedHead & HEAPREGIONSTACK_TAGGED_HEAD_INDEX_MASK);
+
+		if (0 != regionIndex) {
+			region = (MM_HeapRegionDescriptorSegregated *)_regionManager->mapRegionTableIndexToDescriptor(regionIndex - 1);
+		}
+
+		return region;
+	}
+
+	/**
+	 * Build the tagged head that replaces the specified one, bumping the tag so that a region which was
+	 * popped and pushed back in between does not look like an unchanged head.
+	 */
+	MMINLINE uint64_t
+	getNextTaggedHead(uint64_t oldTaggedHead, MM_HeapRegionDescriptorSegregated *region)
+	{
+		uint64_t taggedHead = (oldTaggedHead & ~HEAPREGIONSTACK_TAGGED_HEAD_INDEX_MASK) + HEAPREGIONSTACK_TAGGED_HEAD_TAG_INCREMENT;
+
+		if (NULL != region) {
+			taggedHead |= (uint64_t)(_regionManager->mapDescriptorToRegionTableIndex(region) + 1);
+		}
+
+		return taggedHead;
+	}
+
+public:
+	MMINLINE bool isEnabled() { return NULL != _regionManager; }
+
+	MMINLINE bool isEmpty() { return 0 == (_taggedHead & HEAPREGIONSTACK_TAGGED_HEAD_INDEX_MASK); }
+
+	/**
+	 * @return the first region of the stack. Only safe to follow the chain while nothing else updates the stack.
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *peek() { return getRegionFromTaggedHead(_taggedHead); }
+
+	/**
+	 * Push a chain of regions, linked through their next pointers, onto the stack.
+	 * @param front the first region of the chain
+	 * @param back the last region of the chain
+	 */
+	MMINLINE void
+	push(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back)
+	{
+		uint64_t oldTaggedHead = _taggedHead;
+		uint64_t newTaggedHead = 0;
+
+		do {
+			back->setNext(getRegionFromTaggedHead(oldTaggedHead));
+			newTaggedHead = getNextTaggedHead(oldTaggedHead, front);
+			uint64_t seenTaggedHead = MM_AtomicOperations::lockCompareExchangeU64(&_taggedHead, oldTaggedHead, newTaggedHead);
+			if (seenTaggedHead == oldTaggedHead) {
+				break;
+			}
+			oldTaggedHead = seenTaggedHead;
+		} while (true);
+	}
+
+	/**
+	 * Pop up to maxCount regions off the stack with a single swap.
+	 * @param maxCount maximum number of regions to take
+	 * @param[out] back the last region taken
+	 * @param[out] count number of regions taken
+	 * @return the first region taken, linked to the others in both directions, or NULL if the stack was empty
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	pop(uintptr_t maxCount, MM_HeapRegionDescriptorSegregated **back, uintptr_t *count)
+	{
+		uint64_t oldTaggedHead = _taggedHead;
+		MM_HeapRegionDescriptorSegregated *front = NULL;
+		MM_HeapRegionDescriptorSegregated *last = NULL;
+		uintptr_t taken = 0;
+
+		while (0 != (oldTaggedHead & HEAPREGIONSTACK_TAGGED_HEAD_INDEX_MASK)) {
+			front = getRegionFromTaggedHead(oldTaggedHead);
+			last = front;
+			taken = 1;
+			/* the links may be stale if another thread changed the stack, in which case the tag will not match;
+			 * maxCount bounds the walk should they transiently form a cycle
+			 */
+			while ((taken < maxCount) && (NULL != last->getNext())) {
+				last = last->getNext();
+				taken += 1;
+			}
+			uint64_t newTaggedHead = getNextTaggedHead(oldTaggedHead, last->getNext());
+			uint64_t seenTaggedHead = MM_AtomicOperations::lockCompareExchangeU64(&_taggedHead, oldTaggedHead, newTaggedHead);
+			if (seenTaggedHead == oldTaggedHead) {
+				break;
+			}
+			oldTaggedHead = seenTaggedHead;
+			front = NULL;
+			last = NULL;
+			taken = 0;
+		}
+
+		if (NULL != front) {
+			/* the chain is private now, rebuild the links the queues and lists expect */
+			last->setNext(NULL);
+			front->setPrev(NULL);
+			for (MM_HeapRegionDescriptorSegregated *cur = front; cur != last; cur = cur->getNext()) {
+				cur->getNext()->setPrev(cur);
+			}
+		}
+		*back = last;
+		*count = taken;
+		return front;
+	}
+
+	/**
+	 * Pop a single region off the stack.
+	 * @return the region, with its links cleared, or NULL if the stack was empty
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	pop()
+	{
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t count = 0;
+		return pop(1, &back, &count);
+	}
+
+	/**
+	 * Detach every region of the stack with a single swap.
+	 * @param[out] back the last region taken
+	 * @param[out] count number of regions taken
+	 * @param[out] regionsCount sum of the ranges of the regions taken
+	 * @return the first region taken, linked to the others in both directions, or NULL if the stack was empty
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	popAll(MM_HeapRegionDescriptorSegregated **back, uintptr_t *count, uintptr_t *regionsCount)
+	{
+		uint64_t oldTaggedHead = _taggedHead;
+
+		while (0 != (oldTaggedHead & HEAPREGIONSTACK_TAGGED_HEAD_INDEX_MASK)) {
+			uint64_t seenTaggedHead = MM_AtomicOperations::lockCompareExchangeU64(&_taggedHead, oldTaggedHead, getNextTaggedHead(oldTaggedHead, NULL));
+			if (seenTaggedHead == oldTaggedHead) {
+				break;
+			}
+			oldTaggedHead = seenTaggedHead;
+		}
+
+		MM_HeapRegionDescriptorSegregated *front = getRegionFromTaggedHead(oldTaggedHead);
+		MM_HeapRegionDescriptorSegregated *last = NULL;
+		uintptr_t taken = 0;
+		uintptr_t regions = 0;
+		for (MM_HeapRegionDescriptorSegregated *cur = front; NULL != cur; cur = cur->getNext()) {
+			cur->setPrev(last);
+			last = cur;
+			taken += 1;
+			regions += cur->getRange();
+		}
+		*back = last;
+		*count = taken;
+		*regionsCount = regions;
+		return front;
+	}
+
+	/**
+	 * @param regionManager owner of the region table, NULL to leave the stack unused
+	 */
+	MM_LockFreeHeapRegionStack(MM_HeapRegionManager *regionManager)
+		: _regionManager(regionManager)
+		, _taggedHead(0)
+	{}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEHEAPREGIONSTACK_HPP_ */
@@ -30,11 +30,11 @@
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
 MM_LockingFreeHeapRegionList *
-MM_LockingFreeHeapRegionList::newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly)
+MM_LockingFreeHeapRegionList::newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, MM_HeapRegionManager *lockFreeRegionManager)
 {
 	MM_LockingFreeHeapRegionList *fpl = (MM_LockingFreeHeapRegionList *)env->getForge()->allocate(sizeof(MM_LockingFreeHeapRegionList), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (fpl) {
-		new (fpl) MM_LockingFreeHeapRegionList(regionListKind, singleRegionsOnly);
+		new (fpl) MM_LockingFreeHeapRegionList(regionListKind, singleRegionsOnly, lockFreeRegionManager);
 		if (!fpl->initialize(env)) {
 			fpl->kill(env);
 			return NULL;
@@ -83,7 +83,7 @@ MM_LockingFreeHeapRegionList::showList(MM_EnvironmentBase *env)
 	uintptr_t count = 0;
 	lock();
 	omrtty_printf("LockingFreeHeapRegionList 0x%x: ", this);
-	for (MM_HeapRegionDescriptorSegregated *cur = _head; cur != NULL; cur = cur->getNext()) {
+	for (MM_HeapRegionDescriptorSegregated *cur = getFirst(); cur != NULL; cur = cur->getNext()) {
 		omrtty_printf("  %d-%d-%d ", count, index, cur->getRange());
 		count += 1;
 		index += cur->getRange();
@@ -95,6 +95,10 @@ MM_LockingFreeHeapRegionList::showList(MM_EnvironmentBase *env)
 MM_HeapRegionDescriptorSegregated*
 MM_LockingFreeHeapRegionList::allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess)
 {
+	if (isLockFree()) {
+		/* a lock-free list only holds single regions and can't be searched */
+		return (1 == numRegions) ? MM_FreeHeapRegionList::allocate(env, szClass) : NULL;
+	}
 	lock();
 	for (MM_HeapRegionDescriptorSegregated *cur = _head; cur != NULL; cur = cur->getNext()) {
 		uintptr_t currentSize = cur->getRange();
@@ -45,64 +45,65 @@ private:
 	MM_HeapRegionDescriptorSegregated *_tail;
 	omrthread_monitor_t _lockMonitor;
 	uintptr_t _totalRegionsCount;
+	MM_LockFreeHeapRegionStack _lockFreeStack; /**< holds the regions instead of _head/_tail when the list is lock-free */
 
 /* Methods */
 public:
-	static MM_LockingFreeHeapRegionList *newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly);
+	static MM_LockingFreeHeapRegionList *newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, MM_HeapRegionManager *lockFreeRegionManager = NULL);
 	virtual void kill(MM_EnvironmentBase *env);
 	
 	bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 
-	MM_LockingFreeHeapRegionList(MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly) :
+	/**
+	 * @param lockFreeRegionManager if not NULL, a list of single regions is kept on a lock-free stack indexed into
+	 * this manager's region table. Such a list can't detach regions.
+	 */
+	MM_LockingFreeHeapRegionList(MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, MM_HeapRegionManager *lockFreeRegionManager = NULL) :
 		MM_FreeHeapRegionList(regionListKind, singleRegionsOnly),
 		_head(NULL),
 		_tail(NULL),
 		_lockMonitor(NULL),
-		_totalRegionsCount(0)
+		_totalRegionsCount(0),
+		_lockFreeStack(singleRegionsOnly ? lockFreeRegionManager : NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
 
+	MMINLINE bool isLockFree() { return _lockFreeStack.isEnabled(); }
+
 	virtual void
 	push(MM_HeapRegionDescriptorSegregated *region)
 	{
-		lock();
-		pushInternal(region);
-		unlock();
+		if (isLockFree()) {
+			Assert_MM_true(NULL == region->getNext() && NULL == region->getPrev());
+			/* counts go up before the region is visible and down after it is taken, so they never underflow */
+			MM_AtomicOperations::add((volatile uintptr_t *)&_length, 1);
+			MM_AtomicOperations::add(&_totalRegionsCount, region->getRange());
+			_lockFreeStack.push(region, region);
+		} else {
+			lock();
+			pushInternal(region);
+			unlock();
+		}
 	}
 	
 	virtual void
 	push(MM_HeapRegionQueue *srcAsPQ)
 	{ 
 		MM_LockingHeapRegionQueue* src = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(srcAsPQ);
-		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
+		if (src->isEmpty()) { /* Nothing to move - single read needs no lock */
 			return;
 		}
 		lock();
 		src->lock();
-		
-		/* Remove from src */
-		MM_HeapRegionDescriptorSegregated *front = src->_head;
-		MM_HeapRegionDescriptorSegregated *back = src->_tail;
-		uintptr_t srcLength = src->_length;
-		uintptr_t srcRegionsCount = src->_totalRegionsCount;
-		src->_head = NULL;
-		src->_tail = NULL;
-		src->_length = 0;
-		src->_totalRegionsCount = 0;
-		
-		/* Add to front of self */
-		back->setNext(_head); /* OK even if _head is NULL */
-		if (_head == NULL) {
-			_tail = back;
-		} else {
-			_head->setPrev(back);
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t srcLength = 0;
+		uintptr_t srcRegionsCount = 0;
+		MM_HeapRegionDescriptorSegregated *front = src->detachAllInternal(&back, &srcLength, &srcRegionsCount);
+		if (NULL != front) {
+			pushInternal(front, back, srcLength, srcRegionsCount);
 		}
-		_head = front;
-		_length += srcLength;
-		_totalRegionsCount += srcRegionsCount;
-
 		src->unlock();
 		unlock();
 	}
@@ -111,33 +112,18 @@ public:
 	push(MM_FreeHeapRegionList *srcAsFPL) 
 	{ 
 		MM_LockingFreeHeapRegionList* src = MM_LockingFreeHeapRegionList::asLockingFreeHeapRegionList(srcAsFPL);
-		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
+		if (src->isEmpty()) { /* Nothing to move - single read needs no lock */
 			return;
 		}
 		lock();
 		src->lock();
-		
-		/* Remove from src */
-		MM_HeapRegionDescriptorSegregated *front = src->_head;
-		MM_HeapRegionDescriptorSegregated *back = src->_tail;
-		uintptr_t srcLength = src->_length;
-		uintptr_t srcRegionsCount = src->_totalRegionsCount;
-		src->_head = NULL;
-		src->_tail = NULL;
-		src->_length = 0;
-		src->_totalRegionsCount = 0;
-		
-		/* Add to front of self */
-		back->setNext(_head); /* OK even if _head is NULL */
-		if (_head == NULL) {
-			_tail = back;
-		} else {
-			_head->setPrev(back);
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t srcLength = 0;
+		uintptr_t srcRegionsCount = 0;
+		MM_HeapRegionDescriptorSegregated *front = src->detachAllInternal(&back, &srcLength, &srcRegionsCount);
+		if (NULL != front) {
+			pushInternal(front, back, srcLength, srcRegionsCount);
 		}
-		_head = front;
-		_length += srcLength;
-		_totalRegionsCount += srcRegionsCount;
-
 		src->unlock();
 		unlock();
 	}
@@ -145,15 +131,26 @@ public:
 	virtual MM_HeapRegionDescriptorSegregated *
 	pop()
 	{
-		lock();
-		MM_HeapRegionDescriptorSegregated *result = popInternal();
-		unlock();
+		MM_HeapRegionDescriptorSegregated *result = NULL;
+		if (isLockFree()) {
+			result = _lockFreeStack.pop();
+			if (NULL != result) {
+				MM_AtomicOperations::subtract((volatile uintptr_t *)&_length, 1);
+				MM_AtomicOperations::subtract(&_totalRegionsCount, result->getRange());
+			}
+		} else {
+			lock();
+			result = popInternal();
+			unlock();
+		}
 		return result;
 	}
 	
 	virtual void
 	detach(MM_HeapRegionDescriptorSegregated *cur)
 	{
+		/* a region in the middle of a lock-free list can't be unlinked */
+		Assert_MM_true(!isLockFree());
 		lock();
 		detachInternal(cur);
 		unlock();
@@ -177,9 +174,79 @@ public:
 
 protected:
 private:
-	MMINLINE void lock() { omrthread_monitor_enter(_lockMonitor); }
+	MMINLINE void
+	lock()
+	{
+		if (!isLockFree()) {
+			omrthread_monitor_enter(_lockMonitor);
+		}
+	}
 	
-	MMINLINE void unlock() { omrthread_monitor_exit(_lockMonitor); }
+	MMINLINE void
+	unlock()
+	{
+		if (!isLockFree()) {
+			omrthread_monitor_exit(_lockMonitor);
+		}
+	}
+
+	/**
+	 * @return the first region of the list. Following the chain of a lock-free list is only safe while it is not being updated.
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *getFirst() { return isLockFree() ? _lockFreeStack.peek() : _head; }
+
+	/**
+	 * Remove every region from the list. The caller holds the lock of a locking list.
+	 * @param[out] back the last region removed
+	 * @param[out] length number of regions removed
+	 * @param[out] regionsCount sum of the ranges of the regions removed
+	 * @return the first region removed, or NULL if the list was empty
+	 */
+	MM_HeapRegionDescriptorSegregated *
+	detachAllInternal(MM_HeapRegionDescriptorSegregated **back, uintptr_t *length, uintptr_t *regionsCount)
+	{
+		MM_HeapRegionDescriptorSegregated *front = NULL;
+		if (isLockFree()) {
+			front = _lockFreeStack.popAll(back, length, regionsCount);
+			if (NULL != front) {
+				MM_AtomicOperations::subtract((volatile uintptr_t *)&_length, *length);
+				MM_AtomicOperations::subtract(&_totalRegionsCount, *regionsCount);
+			}
+		} else {
+			front = _head;
+			*back = _tail;
+			*length = _length;
+			*regionsCount = _totalRegionsCount;
+			_head = NULL;
+			_tail = NULL;
+			_length = 0;
+			_totalRegionsCount = 0;
+		}
+		return front;
+	}
+
+	/**
+	 * Add a chain of regions linked in both directions to the front of the list. The caller holds the lock of a locking list.
+	 */
+	void
+	pushInternal(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t length, uintptr_t regionsCount)
+	{
+		if (isLockFree()) {
+			MM_AtomicOperations::add((volatile uintptr_t *)&_length, length);
+			MM_AtomicOperations::add(&_totalRegionsCount, regionsCount);
+			_lockFreeStack.push(front, back);
+		} else {
+			back->setNext(_head); /* OK even if _head is NULL */
+			if (_head == NULL) {
+				_tail = back;
+			} else {
+				_head->setPrev(back);
+			}
+			_head = front;
+			_length += length;
+			_totalRegionsCount += regionsCount;
+		}
+	}
 
 	void
 	pushInternal(MM_HeapRegionDescriptorSegregated *region)
@@ -37,13 +37,14 @@
  * This value will not necessarily be accurate. It will remain fairly accurate as long as single
  * region push and pop operations are used and updateCounts doesn't get called on a region that lives
  * on the list.
+ * @param lockFreeRegionManager if not NULL, a concurrent queue of single regions is kept on a lock-free stack
  */
 MM_LockingHeapRegionQueue *
-MM_LockingHeapRegionQueue::newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool singleRegionsOnly, bool concurrentAccess, bool trackFreeBytes)
+MM_LockingHeapRegionQueue::newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool singleRegionsOnly, bool concurrentAccess, bool trackFreeBytes, MM_HeapRegionManager *lockFreeRegionManager)
 {
 	MM_LockingHeapRegionQueue *regionList = (MM_LockingHeapRegionQueue *)env->getForge()->allocate(sizeof(MM_LockingHeapRegionQueue), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (regionList) {
-		new (regionList) MM_LockingHeapRegionQueue(regionListKind, singleRegionsOnly, concurrentAccess, trackFreeBytes);
+		new (regionList) MM_LockingHeapRegionQueue(regionListKind, singleRegionsOnly, concurrentAccess, trackFreeBytes, lockFreeRegionManager);
 		if (!regionList->initialize(env)) {
 			regionList->kill(env);
 			return NULL;
@@ -87,7 +88,7 @@ MM_LockingHeapRegionQueue::getTotalRegions()
 	} else {
 		uintptr_t count = 0;
 		lock();
-		for (MM_HeapRegionDescriptorSegregated *cur = _head; cur != NULL; cur = cur->getNext()) {
+		for (MM_HeapRegionDescriptorSegregated *cur = getFirst(); cur != NULL; cur = cur->getNext()) {
 			count += cur->getRange();
 		}
 		unlock();
@@ -103,7 +104,7 @@ MM_LockingHeapRegionQueue::showList(MM_EnvironmentBase *env)
 	uintptr_t count = 0;	
 	lock();
 	omrtty_printf("LockingHeapRegionList 0x%x: ", this);
-	for (MM_HeapRegionDescriptorSegregated *cur = _head; cur != NULL; cur = cur->getNext()) {
+	for (MM_HeapRegionDescriptorSegregated *cur = getFirst(); cur != NULL; cur = cur->getNext()) {
 		omrtty_printf("  %d-%d-%d ", count, index, cur->getRange());
 		count += 1;
 		index += cur->getRange();
@@ -123,7 +124,7 @@ MM_LockingHeapRegionQueue::debugCountFreeBytesInRegions()
 {
 	uintptr_t freeBytes = 0;
 	lock();
-	for (MM_HeapRegionDescriptorSegregated *cur = _head; cur != NULL; cur = cur->getNext()) {
+	for (MM_HeapRegionDescriptorSegregated *cur = getFirst(); cur != NULL; cur = cur->getNext()) {
 		freeBytes += cur->debugCountFreeBytes();
 	}
 	unlock();
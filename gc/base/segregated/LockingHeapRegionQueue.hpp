@@ -35,6 +35,7 @@
 #include "EnvironmentBase.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "HeapRegionQueue.hpp"
+#include "LockFreeHeapRegionStack.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -52,9 +53,10 @@ private:
 	bool _needLock;
 	omrthread_monitor_t _lockMonitor;
 	uintptr_t _totalRegionsCount;
+	MM_LockFreeHeapRegionStack _lockFreeStack; /**< holds the regions instead of _head/_tail when the queue is lock-free */
 	
 public:
-	static MM_LockingHeapRegionQueue *newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool singleRegionOnly, bool concurrentAccess, bool trackFreeBytes = false);
+	static MM_LockingHeapRegionQueue *newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool singleRegionOnly, bool concurrentAccess, bool trackFreeBytes = false, MM_HeapRegionManager *lockFreeRegionManager = NULL);
 	virtual void kill(MM_EnvironmentBase *env);
 	
 	bool initialize(MM_EnvironmentBase *env);
@@ -65,68 +67,76 @@ public:
 	 * This value will not necessarily be accurate. It will remain fairly accurate as long as single
 	 * region push and pop operations are used and updateCounts doesn't get called on a region that lives
 	 * on the list.
+	 * @param lockFreeRegionManager if not NULL, a concurrent queue of single regions is kept on a lock-free stack
+	 * indexed into this manager's region table. Regions then come off the queue in LIFO rather than FIFO order.
 	 */
-	MM_LockingHeapRegionQueue(RegionListKind regionListKind, bool singleRegionOnly, bool concurrentAccess, bool trackFreeBytes) :
+	MM_LockingHeapRegionQueue(RegionListKind regionListKind, bool singleRegionOnly, bool concurrentAccess, bool trackFreeBytes, MM_HeapRegionManager *lockFreeRegionManager = NULL) :
 		MM_HeapRegionQueue(regionListKind, singleRegionOnly, trackFreeBytes),
 		_head(NULL),
 		_tail(NULL),
-		_needLock(concurrentAccess),
+		_needLock(concurrentAccess && !(singleRegionOnly && (NULL != lockFreeRegionManager))),
 		_lockMonitor(NULL),
-		_totalRegionsCount(0)
+		_totalRegionsCount(0),
+		_lockFreeStack((singleRegionOnly && concurrentAccess) ? lockFreeRegionManager : NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
 
 	virtual bool isEmpty() { return 0 == _length; }
 
+	MMINLINE bool isLockFree() { return _lockFreeStack.isEnabled(); }
+
 	virtual uintptr_t getTotalRegions();
 
 	virtual void enqueue(MM_HeapRegionDescriptorSegregated *region)
 	{
-		lock();
-		enqueueInternal(region);
-		unlock();
+		if (isLockFree()) {
+			assert1(NULL == region->getNext() && NULL == region->getPrev());
+			/* counts go up before the region is visible and down after it is taken, so they never underflow */
+			MM_AtomicOperations::add((volatile uintptr_t *)&_length, 1);
+			MM_AtomicOperations::add(&_totalRegionsCount, region->getRange());
+			_lockFreeStack.push(region, region);
+		} else {
+			lock();
+			enqueueInternal(region);
+			unlock();
+		}
 	}
 
-	/* enqueue src at the _end_ of the receiver's queue */
+	/* enqueue src at the _end_ of the receiver's queue (at the top if the receiver is lock-free) */
 	virtual void enqueue(MM_HeapRegionQueue *srcAsPQ)
 	{
 		MM_LockingHeapRegionQueue* src = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(srcAsPQ);
-		if (NULL == src->_head) { /* Nothing to move - single read needs no lock */
+		if (src->isEmpty()) { /* Nothing to move - single read needs no lock */
 			return;
 		}
 		lock();
 		src->lock();
-		/* Remove from src */
-		MM_HeapRegionDescriptorSegregated *front = src->_head;
-		MM_HeapRegionDescriptorSegregated *back = src->_tail;
-		uintptr_t srcLength = src->_length;
-		uintptr_t srcRegionsCount = src->_totalRegionsCount;
-		src->_head = NULL;
-		src->_tail = NULL;
-		src->_length = 0;
-		src->_totalRegionsCount = 0;
-		
-		/* Add to back of self */
-		front->setPrev(_tail); /* OK even if _tail is NULL */
-		if (_tail == NULL) {
-			_head = front;
-		} else {
-			_tail->setNext(front);
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t srcLength = 0;
+		uintptr_t srcRegionsCount = 0;
+		MM_HeapRegionDescriptorSegregated *front = src->detachAllInternal(&back, &srcLength, &srcRegionsCount);
+		if (NULL != front) {
+			appendInternal(front, back, srcLength, srcRegionsCount);
 		}
-		_tail = back;
-		_length += srcLength;
-		_totalRegionsCount += srcRegionsCount;
-		
 		src->unlock();
 		unlock();
 	}
 
 	virtual MM_HeapRegionDescriptorSegregated *dequeue()
 	{
-		lock();
-		MM_HeapRegionDescriptorSegregated *result = dequeueInternal();
-		unlock();
+		MM_HeapRegionDescriptorSegregated *result = NULL;
+		if (isLockFree()) {
+			result = _lockFreeStack.pop();
+			if (NULL != result) {
+				MM_AtomicOperations::subtract((volatile uintptr_t *)&_length, 1);
+				MM_AtomicOperations::subtract(&_totalRegionsCount, result->getRange());
+			}
+		} else {
+			lock();
+			result = dequeueInternal();
+			unlock();
+		}
 		return result;
 	}
 
@@ -135,9 +145,7 @@ public:
 	{
 		MM_HeapRegionDescriptorSegregated *region = NULL;
 		if (0 != _length) {
-			lock();
-			region = dequeueInternal();
-			unlock();
+			region = dequeue();
 		}
 		return region;
 	}
@@ -145,6 +153,20 @@ public:
 	virtual uintptr_t dequeue(MM_HeapRegionQueue *targetAsPQ, uintptr_t count)
 	{
 		MM_LockingHeapRegionQueue* target = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(targetAsPQ);
+		if (isLockFree()) {
+			/* take the whole batch with one swap, then hand it over in one piece */
+			MM_HeapRegionDescriptorSegregated *back = NULL;
+			uintptr_t moved = 0;
+			MM_HeapRegionDescriptorSegregated *front = _lockFreeStack.pop(count, &back, &moved);
+			if (NULL != front) {
+				MM_AtomicOperations::subtract((volatile uintptr_t *)&_length, moved);
+				MM_AtomicOperations::subtract(&_totalRegionsCount, moved);
+				target->lock();
+				target->appendInternal(front, back, moved, moved);
+				target->unlock();
+			}
+			return moved;
+		}
 		lock();
 		target->lock();
 		uintptr_t moved = dequeueInternal(target, count);
@@ -173,6 +195,65 @@ private:
 			omrthread_monitor_exit(_lockMonitor);
 		}
 	}
+
+	/**
+	 * @return the first region of the queue. Following the chain of a lock-free queue is only safe while it is not being updated.
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *getFirst() { return isLockFree() ? _lockFreeStack.peek() : _head; }
+
+	/**
+	 * Remove every region from the queue. The caller holds the lock of a locking queue.
+	 * @param[out] back the last region removed
+	 * @param[out] length number of regions removed
+	 * @param[out] regionsCount sum of the ranges of the regions removed
+	 * @return the first region removed, or NULL if the queue was empty
+	 */
+	MM_HeapRegionDescriptorSegregated *
+	detachAllInternal(MM_HeapRegionDescriptorSegregated **back, uintptr_t *length, uintptr_t *regionsCount)
+	{
+		MM_HeapRegionDescriptorSegregated *front = NULL;
+		if (isLockFree()) {
+			front = _lockFreeStack.popAll(back, length, regionsCount);
+			if (NULL != front) {
+				MM_AtomicOperations::subtract((volatile uintptr_t *)&_length, *length);
+				MM_AtomicOperations::subtract(&_totalRegionsCount, *regionsCount);
+			}
+		} else {
+			front = _head;
+			*back = _tail;
+			*length = _length;
+			*regionsCount = _totalRegionsCount;
+			_head = NULL;
+			_tail = NULL;
+			_length = 0;
+			_totalRegionsCount = 0;
+		}
+		return front;
+	}
+
+	/**
+	 * Add a chain of regions linked in both directions to the back of the queue, or to the top of a lock-free queue.
+	 * The caller holds the lock of a locking queue.
+	 */
+	void
+	appendInternal(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t length, uintptr_t regionsCount)
+	{
+		if (isLockFree()) {
+			MM_AtomicOperations::add((volatile uintptr_t *)&_length, length);
+			MM_AtomicOperations::add(&_totalRegionsCount, regionsCount);
+			_lockFreeStack.push(front, back);
+		} else {
+			front->setPrev(_tail); /* OK even if _tail is NULL */
+			if (_tail == NULL) {
+				_head = front;
+			} else {
+				_tail->setNext(front);
+			}
+			_tail = back;
+			_length += length;
+			_totalRegionsCount += regionsCount;
+		}
+	}
 	
 	void enqueueInternal(MM_HeapRegionDescriptorSegregated *region)
 	{ 
@@ -197,7 +278,8 @@ private:
 				break;
 			}
 			moved++;
-			target->enqueueInternal(p);
+			/* append rather than enqueueInternal(), which only knows _head/_tail, so a lock-free target gets the region on its stack */
+			target->appendInternal(p, p, 1, p->getRange());
 		}
 		return moved;
 	}
@@ -80,7 +80,10 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 		_smallSweepRegions[szClass] = NULL;
 	}
 
-	_singleFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_FREE, true);
+	/* with lockFreeRegionQueues the shared lists of single regions index into the region table instead of taking a lock */
+	MM_HeapRegionManager *lockFreeRegionManager = env->getExtensions()->lockFreeRegionQueues ? _heapRegionManager : NULL;
+
+	_singleFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_FREE, true, lockFreeRegionManager);
 	_multiFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_MULTI_FREE, false);
 	_coalesceFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_COALESCE, false);
 	if ((_singleFreeList == NULL) || (_multiFreeList == NULL) || (_coalesceFreeList == NULL)) {
@@ -98,14 +101,14 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[szClass][i];
 			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
 				/* The available lists should track the free bytes in their regions (4th param = true) */
-				new (&regionQueue[j]) MM_LockingHeapRegionQueue(MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true);
+				new (&regionQueue[j]) MM_LockingHeapRegionQueue(MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true, lockFreeRegionManager);
 				if (!(&regionQueue[j])->initialize(env)) {
 					return false;
 				}
 			}
 		}
-		_smallFullRegions[szClass] = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_FULL, true, true, false);
-		_smallSweepRegions[szClass] = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_SWEEP, true, true, false);
+		_smallFullRegions[szClass] = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_FULL, true, true, false, lockFreeRegionManager);
+		_smallSweepRegions[szClass] = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_SWEEP, true, true, false, lockFreeRegionManager);
 		if (NULL == _smallFullRegions[szClass] || NULL == _smallSweepRegions[szClass]) {
 			return false;
 		}
@@ -113,9 +116,9 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 	}
 	
 	/* The available lists should track the free bytes in their regions (4th param = true) */
-	_arrayletAvailableRegions = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true);
-	_arrayletFullRegions = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_FULL, true, true, false);
-	_arrayletSweepRegions = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_SWEEP, true, true, false);
+	_arrayletAvailableRegions = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true, lockFreeRegionManager);
+	_arrayletFullRegions = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_FULL, true, true, false, lockFreeRegionManager);
+	_arrayletSweepRegions = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_SWEEP, true, true, false, lockFreeRegionManager);
 	if ((NULL == _arrayletAvailableRegions) || (NULL == _arrayletFullRegions) || (NULL == _arrayletSweepRegions)) {
 		return false;
 	}
@@ -133,15 +136,15 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 
 
 MM_HeapRegionQueue*
-MM_RegionPoolSegregated::allocateHeapRegionQueue(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, bool concurrentAccess, bool trackFreeBytes)
+MM_RegionPoolSegregated::allocateHeapRegionQueue(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, bool concurrentAccess, bool trackFreeBytes, MM_HeapRegionManager *lockFreeRegionManager)
 {
-	return MM_LockingHeapRegionQueue::newInstance(env, regionListKind, singleRegionsOnly, concurrentAccess, trackFreeBytes);
+	return MM_LockingHeapRegionQueue::newInstance(env, regionListKind, singleRegionsOnly, concurrentAccess, trackFreeBytes, lockFreeRegionManager);
 }
 
 MM_FreeHeapRegionList*
-MM_RegionPoolSegregated::allocateFreeHeapRegionList(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly)
+MM_RegionPoolSegregated::allocateFreeHeapRegionList(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, MM_HeapRegionManager *lockFreeRegionManager)
 {
-	return MM_LockingFreeHeapRegionList::newInstance(env, regionListKind, singleRegionsOnly);
+	return MM_LockingFreeHeapRegionList::newInstance(env, regionListKind, singleRegionsOnly, lockFreeRegionManager);
 }
 
 void
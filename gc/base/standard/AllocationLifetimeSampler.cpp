@@ -0,0 +1,221 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "mmprivatehook.h"
+#include "ut_j9mm.h"
+
+#include "AllocationLifetimeSampler.hpp"
+
+#include "Forge.hpp"
+#include "ForwardedHeader.hpp"
+#include "Scavenger.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+MM_AllocationLifetimeSampler *
+MM_AllocationLifetimeSampler::newInstance(MM_EnvironmentBase *env)
+{
+	MM_AllocationLifetimeSampler *sampler = (MM_AllocationLifetimeSampler *)env->getForge()->allocate(sizeof(MM_AllocationLifetimeSampler), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != sampler) {
+		new(sampler) MM_AllocationLifetimeSampler(env);
+		if (!sampler->initialize(env)) {
+			sampler->kill(env);
+			sampler = NULL;
+		}
+	}
+	return sampler;
+}
+
+void
+MM_AllocationLifetimeSampler::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_AllocationLifetimeSampler::initialize(MM_EnvironmentBase *env)
+{
+	OMRPortLibrary *portLibrary = env->getPortLibrary();
+
+	if (!_lock.initialize(env, &_extensions->lnrlOptions, "MM_AllocationLifetimeSampler:_lock")) {
+		return false;
+	}
+
+	_samples = (Sample *)env->getForge()->allocate(ALLOCATION_LIFETIME_SAMPLE_TABLE_SIZE * sizeof(Sample), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _samples) {
+		return false;
+	}
+
+	/* track twice as many sites as are reported, so that the counts of the reported ones are close to exact */
+	if (NULL == (_sampledSites = spaceSavingNew(portLibrary, ALLOCATION_LIFETIME_REPORT_SIZE * 2))) {
+		return false;
+	}
+	if (NULL == (_survivorSites = spaceSavingNew(portLibrary, ALLOCATION_LIFETIME_REPORT_SIZE * 2))) {
+		return false;
+	}
+	if (NULL == (_tenuredSites = spaceSavingNew(portLibrary, ALLOCATION_LIFETIME_REPORT_SIZE * 2))) {
+		return false;
+	}
+
+	J9HookInterface **mmPrivateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	if (0 != (*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, hookScavengeEnd, OMR_GET_CALLSITE(), (void *)this)) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_AllocationLifetimeSampler::tearDown(MM_EnvironmentBase *env)
+{
+	J9HookInterface **mmPrivateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	(*mmPrivateHooks)->J9HookUnregister(mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, hookScavengeEnd, (void *)this);
+
+	if (NULL != _tenuredSites) {
+		spaceSavingFree(_tenuredSites);
+		_tenuredSites = NULL;
+	}
+	if (NULL != _survivorSites) {
+		spaceSavingFree(_survivorSites);
+		_survivorSites = NULL;
+	}
+	if (NULL != _sampledSites) {
+		spaceSavingFree(_sampledSites);
+		_sampledSites = NULL;
+	}
+	if (NULL != _samples) {
+		env->getForge()->free(_samples);
+		_samples = NULL;
+	}
+
+	_lock.tearDown();
+}
+
+void
+MM_AllocationLifetimeSampler::recordSample(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t size, uintptr_t site)
+{
+	uintptr_t thread = omrthread_get_osId(env->getOmrVMThread()->_os_thread);
+
+	_lock.acquire();
+	_samplesTaken += 1;
+	spaceSavingUpdate(_sampledSites, (void *)site, size);
+	/* objects allocated directly into tenure space are never scavenged */
+	if (!_extensions->isOld(objectPtr)) {
+		if (_sampleCount < ALLOCATION_LIFETIME_SAMPLE_TABLE_SIZE) {
+			Sample *sample = &_samples[_sampleCount];
+			sample->object = objectPtr;
+			sample->site = site;
+			sample->size = size;
+			sample->thread = thread;
+			sample->age = 0;
+			_sampleCount += 1;
+		} else {
+			_samplesDropped += 1;
+		}
+	}
+	_lock.release();
+
+	Trc_MM_AllocationLifetimeSampler_recordSample(env->getLanguageVMThread(), objectPtr, size, site);
+}
+
+void
+MM_AllocationLifetimeSampler::scavengeCompleted(MM_EnvironmentBase *env)
+{
+	if (_extensions->isScavengerBackOutFlagRaised()) {
+		/* an aborted scavenge undoes its forwarding, so the samples are still where they were */
+		return;
+	}
+
+	MM_Scavenger *scavenger = _extensions->scavenger;
+	bool const compressed = env->compressObjectReferences();
+	uintptr_t sampleCount = _sampleCount;
+	uintptr_t liveCount = 0;
+
+	/* mutators are stopped, the table is compacted in place without the lock */
+	for (uintptr_t i = 0; i < sampleCount; i++) {
+		Sample *sample = &_samples[i];
+		if (scavenger->isObjectInEvacuateMemory(sample->object)) {
+			MM_ForwardedHeader forwardedHeader(sample->object, compressed);
+			if (!forwardedHeader.isForwardedPointer()) {
+				/* died in the nursery, the cheap case */
+				continue;
+			}
+			omrobjectptr_t forwardedPtr = forwardedHeader.getForwardedObject();
+			sample->age += 1;
+			spaceSavingUpdate(_survivorSites, (void *)sample->site, sample->size);
+			if (_extensions->isOld(forwardedPtr)) {
+				_samplesTenured += 1;
+				spaceSavingUpdate(_tenuredSites, (void *)sample->site, sample->size);
+				Trc_MM_AllocationLifetimeSampler_sampleTenured(env->getLanguageVMThread(), sample->site, sample->size, sample->age, sample->thread);
+				continue;
+			}
+			sample->object = forwardedPtr;
+		}
+		/* objects allocated during a concurrent scavenge are outside evacuate space until the next cycle */
+		_samples[liveCount] = *sample;
+		liveCount += 1;
+	}
+	_sampleCount = liveCount;
+
+	Trc_MM_AllocationLifetimeSampler_scavengeCompleted(env->getLanguageVMThread(), sampleCount, liveCount, _samplesTenured);
+}
+
+void
+MM_AllocationLifetimeSampler::printSites(MM_EnvironmentBase *env, const char *title, OMRSpaceSaving *sites)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t count = OMR_MIN(spaceSavingGetCurSize(sites), (uintptr_t)ALLOCATION_LIFETIME_REPORT_SIZE);
+
+	omrtty_printf("  top sites by sampled bytes %s:\n", title);
+	for (uintptr_t k = 1; k <= count; k++) {
+		omrtty_printf("    %2zu. site 0x%zx: %zu bytes\n", k, (uintptr_t)spaceSavingGetKthMostFreq(sites, k), spaceSavingGetKthMostFreqCount(sites, k));
+	}
+}
+
+void
+MM_AllocationLifetimeSampler::report(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	omrtty_printf("Allocation lifetime sampling every %zu bytes: %zu samples, %zu tenured, %zu still in new space, %zu not followed\n",
+			_extensions->allocationLifetimeSamplingInterval, _samplesTaken, _samplesTenured, _sampleCount, _samplesDropped);
+	printSites(env, "copied", _survivorSites);
+	printSites(env, "tenured", _tenuredSites);
+	printSites(env, "allocated", _sampledSites);
+}
+
+void
+MM_AllocationLifetimeSampler::hookScavengeEnd(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_ScavengeEndEvent *event = (MM_ScavengeEndEvent *)eventData;
+
+	/* a concurrent scavenge forwards objects until its final increment */
+	if (event->cycleEnd) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+		((MM_AllocationLifetimeSampler *)userData)->scavengeCompleted(env);
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
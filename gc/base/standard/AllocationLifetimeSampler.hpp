@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(ALLOCATIONLIFETIMESAMPLER_HPP_)
+#define ALLOCATIONLIFETIMESAMPLER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "spacesaving.h"
+
+#include "AllocateDescription.hpp"
+#include "Base.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/* Live samples are pruned at every scavenge, so the table only has to hold those allocated in two nursery lifetimes */
+#define ALLOCATION_LIFETIME_SAMPLE_TABLE_SIZE 4096
+#define ALLOCATION_LIFETIME_REPORT_SIZE 16
+
+/**
+ * Attributes the cost of scavenging to the code allocating the survivors. Each thread samples one
+ * allocation in every allocationLifetimeSamplingInterval bytes it allocates, recording the site token
+ * the language sets in the allocate description, the size and the allocating thread. Sampled nursery
+ * objects are followed through the forwarding pointers left by each scavenge until they die or are
+ * tenured, and sites are ranked by the bytes their samples cost to copy and to tenure.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_AllocationLifetimeSampler : public MM_Base
+{
+private:
+	struct Sample {
+		omrobjectptr_t object; /**< current location of the sampled object */
+		uintptr_t site; /**< site token of the allocation */
+		uintptr_t size; /**< bytes allocated for the object */
+		uintptr_t thread; /**< OS thread id of the allocating thread */
+		uintptr_t age; /**< number of scavenges the object has survived */
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	MM_LightweightNonReentrantLock _lock; /**< serializes mutators recording samples */
+	Sample *_samples; /**< table of the samples still in new space, live entries are kept at the front */
+	uintptr_t _sampleCount; /**< number of samples in the table */
+	uintptr_t _samplesTaken; /**< number of allocations sampled */
+	uintptr_t _samplesDropped; /**< number of nursery samples not followed because the table was full */
+	uintptr_t _samplesTenured; /**< number of followed samples that were tenured */
+	OMRSpaceSaving *_sampledSites; /**< top sites by sampled bytes allocated */
+	OMRSpaceSaving *_survivorSites; /**< top sites by sampled bytes copied by scavenges, into survivor or tenure space */
+	OMRSpaceSaving *_tenuredSites; /**< top sites by sampled bytes tenured */
+
+private:
+	void recordSample(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t size, uintptr_t site);
+	void printSites(MM_EnvironmentBase *env, const char *title, OMRSpaceSaving *sites);
+	static void hookScavengeEnd(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_AllocationLifetimeSampler *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Account for an object allocated by the thread and sample it if the thread has allocated
+	 * a sampling interval since its last sample.
+	 * @param env the allocating thread
+	 * @param objectPtr the allocated object
+	 * @param allocDescription the description of the allocation, carrying the site token
+	 */
+	MMINLINE void
+	objectAllocated(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MM_AllocateDescription *allocDescription)
+	{
+		uintptr_t size = allocDescription->getContiguousBytes();
+		env->_lifetimeSamplingBytes += size;
+		if (env->_lifetimeSamplingBytes >= _extensions->allocationLifetimeSamplingInterval) {
+			env->_lifetimeSamplingBytes %= _extensions->allocationLifetimeSamplingInterval;
+			recordSample(env, objectPtr, size, allocDescription->getAllocationSiteToken());
+		}
+	}
+
+	/**
+	 * Follow the samples through a completed scavenge: samples left unforwarded in evacuate space
+	 * died, the others are charged to their site as copied (and tenured, if they were) and moved
+	 * to their new location. Must be called while evacuate space still holds forwarding pointers.
+	 */
+	void scavengeCompleted(MM_EnvironmentBase *env);
+
+	/**
+	 * Print the top sites by bytes copied, bytes tenured and bytes allocated.
+	 */
+	void report(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getSamplesTaken() { return _samplesTaken; }
+	MMINLINE uintptr_t getSamplesTracked() { return _sampleCount; }
+	MMINLINE uintptr_t getSamplesTenured() { return _samplesTenured; }
+	MMINLINE OMRSpaceSaving *getSampledSites() { return _sampledSites; }
+	MMINLINE OMRSpaceSaving *getSurvivorSites() { return _survivorSites; }
+	MMINLINE OMRSpaceSaving *getTenuredSites() { return _tenuredSites; }
+
+	MM_AllocationLifetimeSampler(MM_EnvironmentBase *env)
+		: MM_Base()
+		, _extensions(env->getExtensions())
+		, _lock()
+		, _samples(NULL)
+		, _sampleCount(0)
+		, _samplesTaken(0)
+		, _samplesDropped(0)
+		, _samplesTenured(0)
+		, _sampledSites(NULL)
+		, _survivorSites(NULL)
+		, _tenuredSites(NULL)
+	{}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+#endif /* ALLOCATIONLIFETIMESAMPLER_HPP_ */
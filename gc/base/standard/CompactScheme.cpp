@@ -46,6 +46,7 @@
 #include "HeapStats.hpp"
 #include "MarkingScheme.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -286,6 +287,11 @@ MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _blockSummaryTable) {
+		env->getForge()->free(_blockSummaryTable);
+		_blockSummaryTable = NULL;
+		_blockSummaryTableSize = 0;
+	}
 	_delegate.tearDown(env);
 }
 
@@ -357,6 +363,10 @@ MM_CompactScheme::workerSetupForGC(MM_EnvironmentStandard *env, bool singleThrea
 	createSubAreaTable(env, singleThreaded);
 	setRealLimitsSubAreas(env);
 	removeNullSubAreas(env);
+	if (_partialCompaction) {
+		measureSubAreas(env);
+		selectPartialCompactionArea(env);
+	}
 	completeSubAreaTable(env);
 }
 
@@ -369,9 +379,45 @@ MM_CompactScheme::mainSetupForGC(MM_EnvironmentStandard *env)
 	_compactTable = (CompactTableEntry*)_markingScheme->getMarkMap()->getMarkBits();
 	_subAreaTable = (SubAreaEntry*)_extensions->sweepHeapSectioning->getBackingStoreAddress();
 	_subAreaTableSize = _extensions->sweepHeapSectioning->getBackingStoreSize();
+	_slidingCompaction = prepareSlidingCompaction(env);
 	_delegate.mainSetupForGC(env);
 }
 
+bool
+MM_CompactScheme::prepareSlidingCompaction(MM_EnvironmentStandard *env)
+{
+	bool result = false;
+
+#if defined(OMR_ENV_DATA64) && !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+	/* objects must not grow when they move, as forwarding addresses are derived from their current sizes,
+	 * and the granule bits of a block must fit a uintptr_t
+	 */
+	if (_extensions->slidingCompaction) {
+		uintptr_t heapSize = (uintptr_t)_heap->getHeapTop() - _heapBase;
+		uintptr_t tableSize = MM_Math::roundToCeiling(sizeof_summary_block, heapSize) / sizeof_summary_block;
+
+		/* block summaries count live granules in 32 bits */
+		if (((uint64_t)heapSize / sizeof_summary_granule) <= (uint64_t)0xFFFFFFFF) {
+			if ((NULL != _blockSummaryTable) && (_blockSummaryTableSize < tableSize)) {
+				env->getForge()->free(_blockSummaryTable);
+				_blockSummaryTable = NULL;
+				_blockSummaryTableSize = 0;
+			}
+			if (NULL == _blockSummaryTable) {
+				_blockSummaryTable = (uint64_t *)env->getForge()->allocate(tableSize * sizeof(uint64_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+				if (NULL != _blockSummaryTable) {
+					_blockSummaryTableSize = tableSize;
+				}
+			}
+			/* fall back to evacuating compaction if the table can't be allocated */
+			result = (NULL != _blockSummaryTable);
+		}
+	}
+#endif /* defined(OMR_ENV_DATA64) && !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+
+	return result;
+}
+
 omrobjectptr_t
 MM_CompactScheme::freeChunkEnd(omrobjectptr_t chunk)
 {
@@ -509,6 +555,92 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 				j++;
 			}
 		}
+		/* the entries past the kept ones are stale, end the table where the passes over the whole heap stop */
+		_subAreaTable[j].state = SubAreaEntry::end_heap;
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+void
+MM_CompactScheme::measureSubAreas(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::measuring_live_bytes)) {
+				omrobjectptr_t start = subAreaTable[i].firstObject;
+				omrobjectptr_t finish = subAreaTable[i+1].firstObject;
+				uintptr_t liveBytes = 0;
+
+				MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)start, (uintptr_t *)pageStart(pageIndex(finish)));
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+					liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+				}
+				subAreaTable[i].liveBytes = liveBytes;
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::selectPartialCompactionArea(MM_EnvironmentStandard *env)
+{
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		uintptr_t maxBytes = (_heap->getActiveMemorySize() / 100) * _extensions->partialCompactionMaxPercent;
+		uintptr_t bestFirst = 0;
+		uintptr_t bestLast = 0;
+		uintptr_t bestFreeBytes = 0;
+		uintptr_t first = 0;
+		uintptr_t freeBytes = 0;
+
+		/* slide a window over the subAreas of each region, keeping it no wider than maxBytes unless it holds a single subArea */
+		for (uintptr_t i = 0; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
+			if (SubAreaEntry::end_segment == _subAreaTable[i].state) {
+				/* objects are only evacuated within their region */
+				first = i + 1;
+				freeBytes = 0;
+				continue;
+			}
+			freeBytes += ((uintptr_t)_subAreaTable[i+1].firstObject - (uintptr_t)_subAreaTable[i].firstObject) - _subAreaTable[i].liveBytes;
+			while ((first < i) && (((uintptr_t)_subAreaTable[i+1].firstObject - (uintptr_t)_subAreaTable[first].firstObject) > maxBytes)) {
+				freeBytes -= ((uintptr_t)_subAreaTable[first+1].firstObject - (uintptr_t)_subAreaTable[first].firstObject) - _subAreaTable[first].liveBytes;
+				first += 1;
+			}
+			if (freeBytes > bestFreeBytes) {
+				bestFirst = first;
+				bestLast = i;
+				bestFreeBytes = freeBytes;
+			}
+		}
+
+		if (bestFreeBytes < _partialCompactionTarget) {
+			Trc_MM_CompactScheme_selectPartialCompactionArea_wholeHeap(env->getLanguageVMThread(), _partialCompactionTarget, bestFreeBytes);
+			_partialCompaction = false;
+		} else {
+			/* only the subAreas of the window move, the others keep their objects and are just fixed up */
+			for (uintptr_t i = 0; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
+				if ((SubAreaEntry::init == _subAreaTable[i].state) && ((i < bestFirst) || (i > bestLast))) {
+					_subAreaTable[i].state = SubAreaEntry::fixup_only;
+				}
+			}
+			_compactFrom = _subAreaTable[bestFirst].firstObject;
+			_compactTo = _subAreaTable[bestLast+1].firstObject;
+			_partialCompactBytes = (uintptr_t)_compactTo - (uintptr_t)_compactFrom;
+			Trc_MM_CompactScheme_selectPartialCompactionArea(env->getLanguageVMThread(), _compactFrom, _compactTo, bestFreeBytes, _partialCompactionTarget);
+		}
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
@@ -556,6 +688,15 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		 * done at a synchronize point?
 		 */
 		mainSetupForGC(env);
+
+		/* Aggressive compactions must not leave fragmented sub areas behind. Objects outside the
+		 * evacuated sub areas keep their addresses, which sliding can't provide.
+		 */
+		_partialCompaction = (0 != _partialCompactionTarget) && !aggressive && !_extensions->usingSATBBarrier();
+		_partialCompactBytes = 0;
+		if (_partialCompaction) {
+			_slidingCompaction = false;
+		}
 #if defined(DEBUG)
 		_delegate.verifyHeap(env, _markMap);
 #endif /* DEBUG */
@@ -577,28 +718,33 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
-	workerSetupForGC(env, singleThreaded);
+	/* a partial compaction still needs sub areas to choose from when there are no worker threads */
+	workerSetupForGC(env, singleThreaded && !_partialCompaction);
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
 
 	/* If a single threaded compaction force compact to run on main thread. Required
 	 * to ensure all events issued on main thread.
 	 */
 	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		env->_compactStats._moveStartTime = omrtime_hires_clock();
-		moveObjects(env, objectCount, byteCount, skippedObjectCount);
-		env->_compactStats._moveEndTime = omrtime_hires_clock();
+		if (_slidingCompaction) {
+			slideCompact(env, singleThreaded, objectCount, byteCount, fixupObjectsCount);
+		} else {
+			env->_compactStats._moveStartTime = omrtime_hires_clock();
+			moveObjects(env, objectCount, byteCount, skippedObjectCount);
+			env->_compactStats._moveEndTime = omrtime_hires_clock();
 
-		if (!singleThreaded) {
-			env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
-			MM_AtomicOperations::sync();
-		}
+			if (!singleThreaded) {
+				env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+				MM_AtomicOperations::sync();
+			}
 
-		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+			env->_compactStats._fixupStartTime = omrtime_hires_clock();
 
-		fixupObjects(env, fixupObjectsCount);
+			fixupObjects(env, fixupObjectsCount);
 
 
-		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+			env->_compactStats._fixupEndTime = omrtime_hires_clock();
+		}
 
 		if (singleThreaded) {
 			env->_currentTask->releaseSynchronizedGCThreads(env);
@@ -698,10 +844,11 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 					currentFreeSize = 0;
 					currentFreeBase = (void *)subAreaTable[i].freeChunk;
 				}
+			} else if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+				/* The objects of the sub area were not moved, its free memory is between them */
+				addFixupOnlySubAreaFreeEntries(env, memorySubSpace, poolState, subAreaTable, (intptr_t)i, currentFreeBase);
 			} else {
-				/* Either there is no free area in the sub area or sub area is
-				 * a fixup_only sub area, i.e. IC is active
-				 */
+				/* There is no free area in the sub area */
 				if (NULL != currentFreeBase) {
 					currentFreeSize = (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)currentFreeBase;
 
@@ -727,6 +874,32 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_CompactScheme::addFixupOnlySubAreaFreeEntries(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, SubAreaEntry *subAreaTable, intptr_t i, void *&currentFreeBase)
+{
+	omrobjectptr_t start = subAreaTable[i].firstObject;
+	omrobjectptr_t finish = subAreaTable[i+1].firstObject;
+
+	/* The first sub area of a region starts at the region base rather than at an object */
+	if (NULL == currentFreeBase) {
+		currentFreeBase = (void *)start;
+	}
+
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)start, (uintptr_t *)pageStart(pageIndex(finish)));
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		if ((void *)objectPtr > currentFreeBase) {
+			addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, (uintptr_t)objectPtr - (uintptr_t)currentFreeBase);
+		}
+		currentFreeBase = (void *)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+	}
+
+	/* Free memory after the last object runs into the next sub area */
+	if (currentFreeBase == (void *)finish) {
+		currentFreeBase = NULL;
+	}
+}
+
 /*
  * Call appropriate Memory Pool to add a new free entry to the pool. If the free entry
  * spans more than one subpool then it will be split into 2 free entries.
@@ -896,7 +1069,7 @@ MM_CompactScheme::evacuateSubArea(MM_EnvironmentStandard *env, MM_HeapRegionDesc
         	if ((subAreaTableEvacuate[j].state == SubAreaEntry::ready) &&
         		(SubAreaEntry::ready == MM_AtomicOperations::lockCompareExchange(&subAreaTableEvacuate[j].state, SubAreaEntry::ready, SubAreaEntry::busy)))
 			{
-				MM_AtomicOperations::loadSync();
+				MM_AtomicOperations::readBarrier();
 				freeChunk = subAreaTableEvacuate[j].freeChunk;
 				break;
 			}
@@ -1286,6 +1459,16 @@ MM_CompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
 		return objectPtr;
 	}
 
+	if (_slidingCompaction) {
+		/* new address is the heap base plus all live granules below the object */
+		uint64_t summary = _blockSummaryTable[summaryBlockIndex(objectPtr)];
+		uintptr_t liveGranulesInBlock = (uintptr_t)(summary & makeMask(summaryGranuleIndex(objectPtr)));
+		uintptr_t liveGranules = (uintptr_t)(summary >> 32) + MM_Bits::populationCount(liveGranulesInBlock);
+		omrobjectptr_t forwardingPtr = (omrobjectptr_t)(_heapBase + (liveGranules * sizeof_summary_granule));
+		MM_CompactSchemeFixupObject::verifyForwardingPtr(objectPtr, forwardingPtr);
+		return forwardingPtr;
+	}
+
 	intptr_t index = pageIndex(objectPtr);
 	omrobjectptr_t forwardingPtr = _compactTable[index].getAddr();
 	if (forwardingPtr == 0) {
@@ -1357,7 +1540,9 @@ MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCou
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
-        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
+        		/* objects have not moved yet when sliding, so only the marked ones are walkable */
+        		bool markedOnly = _slidingCompaction || (subAreaTable[i].state == SubAreaEntry::fixup_only);
+        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, markedOnly, objectCount);
 			}
         }
         /* Number of regions in regionTable, including
@@ -1405,6 +1590,11 @@ MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t first
 void
 MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 {
+	if (_slidingCompaction) {
+		rebuildMarkbitsAfterSliding(env);
+		return;
+	}
+
 	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
 	GC_HeapRegionIteratorStandard regionIterator(regionManager);
 	MM_HeapRegionDescriptorStandard *region = NULL;
@@ -1417,7 +1607,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1452,6 +1642,355 @@ MM_CompactScheme::rebuildMarkbitsInSubArea(MM_EnvironmentStandard *env, MM_HeapR
 	}
 }
 
+void
+MM_CompactScheme::slideCompact(MM_EnvironmentStandard *env, bool singleThreaded, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &fixupObjectCount)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	/* Compute forwarding addresses while all objects are still in place */
+	clearBlockSummaries(env);
+	if (!singleThreaded) {
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+	}
+	summarizeSubAreas(env);
+	if (singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		computeSubAreaDestinations(env);
+		if (!singleThreaded) {
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+	}
+	computeBlockForwarding(env);
+	if (!singleThreaded) {
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		MM_AtomicOperations::sync();
+	}
+
+	/* Forwarding addresses do not depend on object contents, so references are fixed up before anything moves */
+	env->_compactStats._fixupStartTime = omrtime_hires_clock();
+	fixupObjects(env, fixupObjectCount);
+	env->_compactStats._fixupEndTime = omrtime_hires_clock();
+	if (!singleThreaded) {
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		MM_AtomicOperations::sync();
+	}
+
+	env->_compactStats._moveStartTime = omrtime_hires_clock();
+	slideObjects(env, objectCount, byteCount);
+	env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+	if (singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		setSlidingFreeChunks(env);
+		if (!singleThreaded) {
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+	}
+}
+
+void
+MM_CompactScheme::clearBlockSummaries(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			/* sliding needs every subArea to be movable */
+			Assert_MM_true(SubAreaEntry::init == subAreaTable[i].state);
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::clearing_block_summaries)) {
+				/* a subArea owns the blocks from the one holding its first object up to the one holding the next subArea's first object */
+				uintptr_t firstBlock = summaryBlockIndex(subAreaTable[i].firstObject);
+				uintptr_t endBlock = summaryBlockIndex(subAreaTable[i+1].firstObject);
+				memset(&_blockSummaryTable[firstBlock], 0, (endBlock - firstBlock) * sizeof(uint64_t));
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::summarizeSubAreas(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::summarizing)) {
+				omrobjectptr_t start = subAreaTable[i].firstObject;
+				omrobjectptr_t finish = subAreaTable[i+1].firstObject;
+				/* the first and last blocks may also hold objects of the neighbouring subAreas */
+				uintptr_t firstBlock = summaryBlockIndex(start);
+				uintptr_t endBlock = summaryBlockIndex(finish);
+				uintptr_t currentBlock = firstBlock;
+				uint64_t currentMask = 0;
+				uintptr_t liveBytes = 0;
+
+				MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)start, (uintptr_t *)pageStart(pageIndex(finish)));
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+					uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+					omrobjectptr_t objectEnd = (omrobjectptr_t)((uintptr_t)objectPtr + objectSize);
+					uintptr_t lastBlock = summaryBlockIndex((omrobjectptr_t)((uintptr_t)objectEnd - 1));
+					liveBytes += objectSize;
+
+					for (uintptr_t block = summaryBlockIndex(objectPtr); block <= lastBlock; block++) {
+						if (block != currentBlock) {
+							if ((currentBlock == firstBlock) || (currentBlock == endBlock)) {
+								atomicOrBlockSummary(currentBlock, currentMask);
+							} else {
+								_blockSummaryTable[currentBlock] = currentMask;
+							}
+							currentBlock = block;
+							currentMask = 0;
+						}
+						uintptr_t lowGranule = (block == summaryBlockIndex(objectPtr)) ? summaryGranuleIndex(objectPtr) : 0;
+						uintptr_t highGranule = (block == lastBlock) ? (summaryGranuleIndex((omrobjectptr_t)((uintptr_t)objectEnd - 1)) + 1) : (sizeof_summary_block / sizeof_summary_granule);
+						currentMask |= (uint64_t)(makeMask(highGranule) & ~makeMask(lowGranule));
+					}
+				}
+				if (0 != currentMask) {
+					if ((currentBlock == firstBlock) || (currentBlock == endBlock)) {
+						atomicOrBlockSummary(currentBlock, currentMask);
+					} else {
+						_blockSummaryTable[currentBlock] = currentMask;
+					}
+				}
+				subAreaTable[i].liveBytes = liveBytes;
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::computeSubAreaDestinations(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		/* objects slide towards the bottom of their region */
+		omrobjectptr_t destination = (omrobjectptr_t)region->getLowAddress();
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			subAreaTable[i].destination = destination;
+			destination = (omrobjectptr_t)((uintptr_t)destination + subAreaTable[i].liveBytes);
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::computeBlockForwarding(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::computing_forwarding)) {
+				omrobjectptr_t start = subAreaTable[i].firstObject;
+				uintptr_t firstBlock = summaryBlockIndex(start);
+				uintptr_t endBlock = summaryBlockIndex(subAreaTable[i+1].firstObject);
+				/* granules of the previous subArea which precede our first object in the first block are counted by that subArea */
+				uintptr_t precedingGranules = MM_Bits::populationCount((uintptr_t)(_blockSummaryTable[firstBlock] & makeMask(summaryGranuleIndex(start))));
+				uint64_t liveGranules = (((uintptr_t)subAreaTable[i].destination - _heapBase) / sizeof_summary_granule) - precedingGranules;
+
+				for (uintptr_t block = firstBlock; block < endBlock; block++) {
+					uint64_t mask = _blockSummaryTable[block] & makeMask(sizeof_summary_block / sizeof_summary_granule);
+					_blockSummaryTable[block] = (liveGranules << 32) | mask;
+					liveGranules += MM_Bits::populationCount((uintptr_t)mask);
+				}
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			/* subAreas are claimed in address order, so a lower subArea we wait for has already been claimed */
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::evacuating)) {
+				omrobjectptr_t destination = subAreaTable[i].destination;
+
+				/* wait for the lower subAreas whose objects are still to be moved out of our destination */
+				for (intptr_t j = i - 1; (j >= 0) && (subAreaTable[j+1].firstObject > destination); j--) {
+					while (SubAreaEntry::full != subAreaTable[j].state) {
+						omrthread_yield();
+					}
+				}
+				MM_AtomicOperations::readBarrier();
+
+				omrobjectptr_t finish = subAreaTable[i+1].firstObject;
+				MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)subAreaTable[i].firstObject, (uintptr_t *)pageStart(pageIndex(finish)));
+				omrobjectptr_t objectPtr = NULL;
+				omrobjectptr_t nextObject = NULL;
+				for (objectPtr = markedObjectIterator.nextObject(); NULL != objectPtr; objectPtr = nextObject) {
+					nextObject = markedObjectIterator.nextObject();
+					uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+					assume0(destination == getForwardingPtr(objectPtr));
+
+					if (destination != objectPtr) {
+						preObjectMove(env, objectPtr);
+						memmove(destination, objectPtr, objectSize);
+						postObjectMove(env, destination);
+						objectCount += 1;
+						byteCount += objectSize;
+					}
+					destination = (omrobjectptr_t)((uintptr_t)destination + objectSize);
+				}
+
+				MM_AtomicOperations::storeSync();
+				uintptr_t state = MM_AtomicOperations::lockCompareExchange(&subAreaTable[i].state, SubAreaEntry::init, SubAreaEntry::full);
+				Assert_MM_true(state == SubAreaEntry::init);
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::setSlidingFreeChunks(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		omrobjectptr_t regionTop = (omrobjectptr_t)region->getLowAddress();
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			regionTop = (omrobjectptr_t)((uintptr_t)subAreaTable[i].destination + subAreaTable[i].liveBytes);
+		}
+
+		/* all free space of the region is now in one run at its top: it starts in the subArea holding regionTop
+		 * and covers every subArea above it entirely
+		 */
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (subAreaTable[i+1].firstObject <= regionTop) {
+				subAreaTable[i].freeChunk = 0;
+			} else if (subAreaTable[i].firstObject <= regionTop) {
+				subAreaTable[i].freeChunk = regionTop;
+			} else {
+				subAreaTable[i].freeChunk = subAreaTable[i].firstObject;
+			}
+		}
+		omrobjectptr_t regionEnd = (omrobjectptr_t)region->getHighAddress();
+		if (regionTop < regionEnd) {
+			setFreeChunk(regionTop, regionEnd);
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::rebuildMarkbitsAfterSliding(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+
+	{
+		GC_HeapRegionIteratorStandard regionIterator(regionManager);
+		MM_HeapRegionDescriptorStandard *region = NULL;
+		SubAreaEntry *subAreaTable = _subAreaTable;
+
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (!region->isCommitted() || (0 == region->getSize())) {
+				continue;
+			}
+			intptr_t i;
+			for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+				if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
+					_markMap->setBitsInRange(env, pageStart(pageIndex(subAreaTable[i].firstObject)), pageStart(pageIndex(subAreaTable[i+1].firstObject)), true);
+				}
+			}
+			/* Number of regions in regionTable, including
+			 * the end_segment region, is i+1 */
+			subAreaTable += (i+1);
+		}
+	}
+
+	/* moved objects of a subArea may land in the range cleared by another one */
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	{
+		GC_HeapRegionIteratorStandard regionIterator(regionManager);
+		MM_HeapRegionDescriptorStandard *region = NULL;
+		SubAreaEntry *subAreaTable = _subAreaTable;
+
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (!region->isCommitted() || (0 == region->getSize())) {
+				continue;
+			}
+			intptr_t i;
+			for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+				if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::setting_mark_bits)) {
+					/* the objects of a subArea are contiguous after sliding */
+					omrobjectptr_t objectPtr = subAreaTable[i].destination;
+					omrobjectptr_t end = (omrobjectptr_t)((uintptr_t)objectPtr + subAreaTable[i].liveBytes);
+					while (objectPtr < end) {
+						_markMap->atomicSetBit(objectPtr);
+						objectPtr = (omrobjectptr_t)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+					}
+				}
+			}
+			/* Number of regions in regionTable, including
+			 * the end_segment region, is i+1 */
+			subAreaTable += (i+1);
+		}
+	}
+}
+
 /*
  * fixHeapForWalk isn't required in Phase 4, since it simply attempts to fix up any areas which
  * weren't compacted. In Tarok, regions are entirely compacted or entirely fixed up. There is
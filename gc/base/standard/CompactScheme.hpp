@@ -92,6 +92,8 @@ private:
 		omrobjectptr_t freeChunk;
 		volatile uintptr_t state;
 		volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+		uintptr_t liveBytes; /**< sliding compaction: number of live bytes in the subarea */
+		omrobjectptr_t destination; /**< sliding compaction: new address of the first live object of the subarea */
         
 		/* legal values for currentAction */
 		enum {
@@ -100,7 +102,12 @@ private:
 			evacuating,
 			fixing_up,
 			rebuilding_mark_bits,
-			fixing_heap_for_walk
+			fixing_heap_for_walk,
+			clearing_block_summaries,
+			summarizing,
+			computing_forwarding,
+			setting_mark_bits,
+			measuring_live_bytes
 		};
     	
 		/* legal values for state
@@ -138,6 +145,12 @@ protected:
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
 	MM_CompactDelegate     _delegate;
+	uint64_t               *_blockSummaryTable; /**< Sliding compaction: one word per block, live granules in the heap before the block (high 32 bits) and live granules in the block (low 32 bits) */
+	uintptr_t              _blockSummaryTableSize; /**< Number of entries in _blockSummaryTable */
+	bool                   _slidingCompaction; /**< True if the current compaction slides objects and forwards them through _blockSummaryTable */
+	uintptr_t              _partialCompactionTarget; /**< Size of the free entry the next compaction must produce by evacuating only part of the heap, 0 to compact the whole heap */
+	bool                   _partialCompaction; /**< True if the current compaction only evacuates the subAreas between _compactFrom and _compactTo */
+	uintptr_t              _partialCompactBytes; /**< Size of the address range evacuated by the last compaction if it was partial, otherwise 0 */
 
 public:
 
@@ -148,6 +161,13 @@ public:
 	 */
 	ddr_constant(sizeof_page, 2 * J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT);
 
+	/*
+	 * Sliding compaction describes each block of heap with one summary word. Each bit of the
+	 * low half of the word stands for one granule (minimum object alignment) of the block.
+	 */
+	ddr_constant(sizeof_summary_block, 256);
+	ddr_constant(sizeof_summary_granule, OMR_MINIMUM_OBJECT_ALIGNMENT);
+
 private:
 	omrobjectptr_t freeChunkEnd(omrobjectptr_t chunk);
 	size_t getFreeChunkSize(omrobjectptr_t freeChunk);
@@ -170,6 +190,34 @@ protected:
 	void removeNullSubAreas(MM_EnvironmentStandard *env);
 	void completeSubAreaTable(MM_EnvironmentStandard *env);
 
+	/**
+	 * Record the live bytes of each subArea from the mark map, the input of selectPartialCompactionArea.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void measureSubAreas(MM_EnvironmentStandard *env);
+
+	/**
+	 * Find the run of subAreas of one region with the most free bytes that spans no more than
+	 * partialCompactionMaxPercent of the heap, and turn every other subArea into a fixup_only one.
+	 * If even that run does not hold _partialCompactionTarget free bytes the whole heap is compacted.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void selectPartialCompactionArea(MM_EnvironmentStandard *env);
+
+	/**
+	 * Add the gaps between the marked objects of a fixup_only subArea to the free list being rebuilt.
+	 *
+	 * @param env[in] the current thread
+	 * @param memorySubSpace[in] the subspace owning the subArea
+	 * @param poolState[in] the free list being rebuilt
+	 * @param subAreaTable[in] the subAreas of the region
+	 * @param i index of the fixup_only subArea
+	 * @param currentFreeBase[in/out] start of the free range carried over from the previous subArea, or NULL
+	 */
+	void addFixupOnlySubAreaFreeEntries(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, SubAreaEntry *subAreaTable, intptr_t i, void *&currentFreeBase);
+
 	void saveForwardingPtr(class CompactTableEntry&,
 					omrobjectptr_t objectPtr,
 					omrobjectptr_t forwardingPtr,
@@ -281,6 +329,117 @@ protected:
 
 	void rebuildMarkbits(MM_EnvironmentStandard *env);
 
+	/**
+	 * Decide whether this compaction slides objects, allocating the block summary table on first use.
+	 * Called by the main thread during setup.
+	 *
+	 * @param env[in] the current thread
+	 * @return true if the compaction will slide objects
+	 */
+	bool prepareSlidingCompaction(MM_EnvironmentStandard *env);
+
+	/**
+	 * Compute forwarding addresses from the mark map, fix up all objects and slide them
+	 * down within their region. All phases are parallel over subAreas.
+	 *
+	 * @param env[in] the current thread
+	 * @param singleThreaded[in] true if only the main thread participates
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 * @param[in/out] fixupObjectCount the number of objects fixed up (accumulated)
+	 */
+	void slideCompact(MM_EnvironmentStandard *env, bool singleThreaded, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &fixupObjectCount);
+
+	/**
+	 * Zero the block summaries owned by each subArea.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void clearBlockSummaries(MM_EnvironmentStandard *env);
+
+	/**
+	 * Record the live granules of each block and the live bytes of each subArea from the mark map.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void summarizeSubAreas(MM_EnvironmentStandard *env);
+
+	/**
+	 * Prefix sum the live bytes of the subAreas of each region to find where each subArea slides to.
+	 * Must be called by a single thread.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void computeSubAreaDestinations(MM_EnvironmentStandard *env);
+
+	/**
+	 * Prefix sum the live granules of the blocks owned by each subArea into their block summaries.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void computeBlockForwarding(MM_EnvironmentStandard *env);
+
+	/**
+	 * Slide the objects of each subArea to their forwarding addresses. A subArea is only moved once
+	 * all lower subAreas that overlap its destination have been moved.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 */
+	void slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount);
+
+	/**
+	 * Turn the space left at the top of each region after sliding into a free chunk.
+	 * Must be called by a single thread.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void setSlidingFreeChunks(MM_EnvironmentStandard *env);
+
+	/**
+	 * Rebuild mark bits after sliding: clear the mark map of the compacted area, then set
+	 * the bits of the objects at their new addresses.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void rebuildMarkbitsAfterSliding(MM_EnvironmentStandard *env);
+
+	/**
+	 * Merge the specified live granule mask into the summary of a block which is shared with another subArea.
+	 *
+	 * @param blockIndex[in] index of the block summary
+	 * @param mask[in] the live granules to add
+	 */
+	MMINLINE void atomicOrBlockSummary(uintptr_t blockIndex, uint64_t mask)
+	{
+		volatile uint64_t *summary = (volatile uint64_t *)&_blockSummaryTable[blockIndex];
+		uint64_t oldValue = *summary;
+		while (true) {
+			uint64_t value = MM_AtomicOperations::lockCompareExchangeU64(summary, oldValue, oldValue | mask);
+			if (value == oldValue) {
+				break;
+			}
+			oldValue = value;
+		}
+	}
+
+	/**
+	 * Return the index of the block summary for an address.
+	 */
+	MMINLINE uintptr_t summaryBlockIndex(omrobjectptr_t objectPtr) const
+	{
+		return ((uintptr_t)objectPtr - _heapBase) / sizeof_summary_block;
+	}
+
+	/**
+	 * Return the granule of an address within its block.
+	 */
+	MMINLINE uintptr_t summaryGranuleIndex(omrobjectptr_t objectPtr) const
+	{
+		return (((uintptr_t)objectPtr - _heapBase) % sizeof_summary_block) / sizeof_summary_granule;
+	}
+
 	/**
 	 * Rebuild mark bits within the specified subArea
 	 *
@@ -323,6 +482,23 @@ public:
 	
 	MMINLINE void setMarkMap(MM_MarkMap *markMap) {	_markMap = markMap;}
 
+	/**
+	 * Request that the next compaction only evacuates the most fragmented subAreas, enough to produce a
+	 * free entry of the given size. Aggressive compactions always compact the whole heap.
+	 * @param target size of the free entry to produce, 0 to compact the whole heap
+	 */
+	MMINLINE void setPartialCompactionTarget(uintptr_t target) { _partialCompactionTarget = target; }
+
+	/**
+	 * @return size of the address range evacuated by the last compaction if it was partial, otherwise 0
+	 */
+	MMINLINE uintptr_t getPartialCompactBytes() { return _partialCompactBytes; }
+
+	/**
+	 * @return true if the last compaction slid objects and forwarded them through block summaries
+	 */
+	MMINLINE bool isSlidingCompaction() { return _slidingCompaction; }
+
 	/**
 	 * Create a CompactScheme object.
 	 */
@@ -336,6 +512,12 @@ public:
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
 		, _delegate()
+		, _blockSummaryTable(NULL)
+		, _blockSummaryTableSize(0)
+		, _slidingCompaction(false)
+		, _partialCompactionTarget(0)
+		, _partialCompaction(false)
+		, _partialCompactBytes(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -50,6 +50,12 @@ public:
 	};
 	
 protected:
+	MM_ConfigurationFlat(MM_EnvironmentBase* env, uintptr_t regionSize)
+		: MM_ConfigurationStandard(env, env->getExtensions()->configurationOptions._gcPolicy, regionSize)
+	{
+		_typeId = __FUNCTION__;
+	};
+
 private:
 };
 
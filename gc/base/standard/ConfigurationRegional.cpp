@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_REGIONAL)
+
+#include "ConfigurationRegional.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "RegionalGC.hpp"
+
+MM_Configuration*
+MM_ConfigurationRegional::newInstance(MM_EnvironmentBase* env)
+{
+	MM_ConfigurationRegional* configuration;
+
+	configuration = (MM_ConfigurationRegional*)env->getForge()->allocate(sizeof(MM_ConfigurationRegional), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != configuration) {
+		new (configuration) MM_ConfigurationRegional(env);
+		if (!configuration->initialize(env)) {
+			configuration->kill(env);
+			configuration = NULL;
+		}
+	}
+	return configuration;
+}
+
+bool
+MM_ConfigurationRegional::initialize(MM_EnvironmentBase* env)
+{
+	bool result = MM_ConfigurationFlat::initialize(env);
+	if (result) {
+		MM_GCExtensionsBase* extensions = env->getExtensions();
+
+		/* the collector owns the free list between pauses, so the heap does not resize and the pool is not split or lazily swept */
+		extensions->initialMemorySize = extensions->memoryMax;
+		extensions->minOldSpaceSize = extensions->memoryMax;
+		extensions->oldSpaceSize = extensions->memoryMax;
+		extensions->maxOldSpaceSize = extensions->memoryMax;
+		extensions->lazySweep = false;
+		extensions->largeObjectArea = false;
+		extensions->numaAffinity = false;
+		extensions->splitFreeListSplitAmount = 1;
+	}
+	return result;
+}
+
+MM_GlobalCollector*
+MM_ConfigurationRegional::createCollectors(MM_EnvironmentBase* env)
+{
+	return MM_RegionalGC::newInstance(env);
+}
+
+#endif /* defined(OMR_GC_REGIONAL) */
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONFIGURATIONREGIONAL_HPP_)
+#define CONFIGURATIONREGIONAL_HPP_
+
+#include "omrcfg.h"
+
+#include "ConfigurationFlat.hpp"
+
+#if defined(OMR_GC_REGIONAL)
+
+/**
+ * Flat heap collected by MM_RegionalGC. The heap is fixed at its maximum size, since the collector hands
+ * it out region by region, and is allocated from a single address ordered pool.
+ */
+class MM_ConfigurationRegional : public MM_ConfigurationFlat {
+public:
+protected:
+	static const uintptr_t REGIONAL_TARGET_REGION_COUNT = 1024;
+private:
+public:
+	static MM_Configuration* newInstance(MM_EnvironmentBase* env);
+
+	virtual MM_GlobalCollector* createCollectors(MM_EnvironmentBase* env);
+
+	MM_ConfigurationRegional(MM_EnvironmentBase* env)
+		: MM_ConfigurationFlat(env, getRegionSize(env))
+	{
+		_typeId = __FUNCTION__;
+	};
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase* env);
+
+private:
+	/**
+	 * Regions are at least the standard region size, and larger for large heaps so that the remembered set,
+	 * a bit per pair of regions, stays small.
+	 */
+	static uintptr_t getRegionSize(MM_EnvironmentBase* env)
+	{
+		return OMR_MAX(STANDARD_REGION_SIZE_BYTES, env->getExtensions()->memoryMax / REGIONAL_TARGET_REGION_COUNT);
+	}
+};
+
+#endif /* defined(OMR_GC_REGIONAL) */
+
+#endif /* CONFIGURATIONREGIONAL_HPP_ */
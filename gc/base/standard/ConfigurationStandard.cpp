@@ -87,6 +87,24 @@ MM_ConfigurationStandard::initialize(MM_EnvironmentBase* env)
 	if (result) {
 		extensions->payAllocationTax = extensions->isConcurrentMarkEnabled() || extensions->isConcurrentSweepEnabled();
 		extensions->setStandardGC(true);
+
+		/* lazy sweep leaves the free list incomplete between collects, which only a flat heap with a single address ordered pool,
+		 * collected entirely in the pause, can tolerate
+		 */
+		if (extensions->isScavengerEnabled() || extensions->isConcurrentMarkEnabled() || extensions->isConcurrentSweepEnabled() || extensions->largeObjectArea) {
+			extensions->lazySweep = false;
+		}
+
+		/* node local allocation needs one split free list per affinity leader, each covering that leader's heap stripe */
+		if (extensions->numaAffinity) {
+			uintptr_t nodeCount = extensions->_numaManager.getAffinityLeaderCount();
+			if (1 < nodeCount) {
+				extensions->splitFreeListSplitAmount = nodeCount;
+				extensions->lazySweep = false;
+			} else {
+				extensions->numaAffinity = false;
+			}
+		}
 	}
 
 	if (!extensions->heapExpansionGCRatioThreshold._wasSpecified) {
@@ -164,6 +182,13 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 	}
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+	if (extensions->lazySweep) {
+		doSplit = false;
+		/* as for concurrent sweep, free entry stats are incomplete until the sweep finishes */
+		extensions->processLargeAllocateStats = false;
+		extensions->estimateFragmentation = NO_ESTIMATE_FRAGMENTATION;
+	}
+
 	if ((UDATA_MAX == extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold) && extensions->processLargeAllocateStats) {
 		extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold = OMR_MAX(10*1024*1024, extensions->memoryMax/100);
 	}
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(COPYSCANCACHEDEQUE_HPP_)
+#define COPYSCANCACHEDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+
+class MM_CopyScanCacheStandard;
+
+/**
+ * Bounded Chase-Lev work-stealing deque of scan caches.
+ * The owning GC thread pushes and pops at the bottom without atomics (except when racing
+ * for the last entry), other GC threads steal from the top with a single compare-and-swap.
+ * The deque never grows: when it is full the owner is expected to fall back to the shared
+ * MM_CopyScanCacheList.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_CopyScanCacheDeque
+{
+	/* Data Members */
+public:
+	enum {
+		CAPACITY = 64 /**< number of entries held by the deque (power of 2) */
+	};
+
+private:
+	volatile uintptr_t _top; /**< index of the oldest entry, advanced by thieves and by the owner racing for the last entry */
+	volatile uintptr_t _bottom; /**< index one past the youngest entry, only written by the owner */
+	MM_CopyScanCacheStandard * volatile _entries[CAPACITY]; /**< circular buffer of entries */
+	uintptr_t _stealSeed; /**< owner-private state of the victim selection pseudo-random generator */
+
+	/* Member Functions */
+private:
+protected:
+public:
+	/**
+	 * Push a cache entry onto the bottom of the deque. Must only be called by the owning thread.
+	 * @param[in] cache the cache entry to push
+	 * @return true if the entry was pushed, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_CopyScanCacheStandard *cache)
+	{
+		uintptr_t bottom = _bottom;
+		uintptr_t top = _top;
+		if ((bottom - top) >= CAPACITY) {
+			return false;
+		}
+		_entries[bottom & (CAPACITY - 1)] = cache;
+		/* entry must be visible before the new bottom is */
+		MM_AtomicOperations::storeSync();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the youngest cache entry from the bottom of the deque. Must only be called by the owning thread.
+	 * @return the cache entry, or NULL if the deque is empty or the last entry was stolen
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	pop()
+	{
+		MM_CopyScanCacheStandard *cache = NULL;
+		uintptr_t bottom = _bottom;
+		if (bottom != _top) {
+			bottom -= 1;
+			_bottom = bottom;
+			/* publish the reservation of the bottom entry before reading top */
+			MM_AtomicOperations::sync();
+			uintptr_t top = _top;
+			if ((intptr_t)(bottom - top) >= 0) {
+				cache = _entries[bottom & (CAPACITY - 1)];
+				if (bottom == top) {
+					/* last entry - race against thieves for it */
+					if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+						cache = NULL;
+					}
+					_bottom = top + 1;
+				}
+			} else {
+				/* a thief got the last entry first */
+				_bottom = top;
+			}
+		}
+		return cache;
+	}
+
+	/**
+	 * Steal the oldest cache entry from the top of the deque. May be called by any GC thread.
+	 * @param[out] contended set to true if an entry was present but another thread won the race for it
+	 * @return the cache entry, or NULL if the deque is empty or the steal lost a race
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	steal(bool *contended)
+	{
+		MM_CopyScanCacheStandard *cache = NULL;
+		uintptr_t top = _top;
+		/* read top before bottom */
+		MM_AtomicOperations::sync();
+		uintptr_t bottom = _bottom;
+		*contended = false;
+		if ((intptr_t)(bottom - top) > 0) {
+			cache = _entries[top & (CAPACITY - 1)];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				cache = NULL;
+				*contended = true;
+			}
+		}
+		return cache;
+	}
+
+	/**
+	 * @return true if the deque appears to be empty. The result is only a hint when other threads are active.
+	 */
+	MMINLINE bool
+	isEmpty()
+	{
+		return (intptr_t)(_bottom - _top) <= 0;
+	}
+
+	/**
+	 * @return approximate number of entries in the deque (meant for statistics only)
+	 */
+	MMINLINE uintptr_t
+	getApproximateEntryCount()
+	{
+		intptr_t count = (intptr_t)(_bottom - _top);
+		return (count > 0) ? (uintptr_t)count : 0;
+	}
+
+	/**
+	 * Pick the next victim to steal from among worker IDs 0 to idCount - 1, never choosing the owner.
+	 * Must only be called by the owning thread.
+	 * @param[in] ownerIndex the worker ID of the owning thread
+	 * @param[in] idCount number of worker IDs to choose from (must be greater than 1)
+	 * @return worker ID of the victim
+	 */
+	MMINLINE uintptr_t
+	nextVictim(uintptr_t ownerIndex, uintptr_t idCount)
+	{
+		/* xorshift, good enough to spread thieves across victims */
+		uintptr_t seed = _stealSeed;
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		_stealSeed = seed;
+		uintptr_t victim = seed % (idCount - 1);
+		if (victim >= ownerIndex) {
+			victim += 1;
+		}
+		return victim;
+	}
+
+	/**
+	 * Seed victim selection. Must only be called by the owning thread.
+	 * @param[in] seed new seed, must not be 0
+	 */
+	MMINLINE void
+	setStealSeed(uintptr_t seed)
+	{
+		_stealSeed = seed;
+	}
+
+	/**
+	 * Create a CopyScanCacheDeque object.
+	 */
+	MM_CopyScanCacheDeque()
+		: _top(0)
+		, _bottom(0)
+		, _stealSeed(1)
+	{
+		for (uintptr_t i = 0; i < CAPACITY; i++) {
+			_entries[i] = NULL;
+		}
+	}
+};
+
+#endif /* COPYSCANCACHEDEQUE_HPP_ */
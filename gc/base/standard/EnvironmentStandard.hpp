@@ -33,6 +33,7 @@
 #include "omrport.h"
 #include "modronopt.h"
 
+#include "CopyScanCacheDeque.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "SublistFragment.hpp"
@@ -60,6 +61,7 @@ public:
 	
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	J9VMGC_SublistFragment _scavengerRememberedSet;
+	MM_CopyScanCacheDeque _scanCacheDeque; /**< scan caches pushed by this thread, stolen by idle GC threads (only used if scavengerWorkStealing is enabled) */
 #endif
 	void *_tenureTLHRemainderBase;  /**< base and top pointers of the last unused tenure TLH copy cache, that might be reused  on next copy refresh */
 	void *_tenureTLHRemainderTop;
@@ -93,6 +95,9 @@ public:
 		,_inactiveDeferredCopyCache(NULL)
 		,_inactiveTenureCopyScanCache(NULL)
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_scanCacheDeque()
+#endif /* OMR_GC_MODRON_SCAVENGER */
 		,_tenureTLHRemainderBase(NULL)
 		,_tenureTLHRemainderTop(NULL)
 		,_loaAllocation(false)
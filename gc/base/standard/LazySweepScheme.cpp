@@ -0,0 +1,474 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "omrutil.h"
+
+#include "AllocateDescription.hpp"
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "FreeEntrySizeClassStats.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMemoryPoolIterator.hpp"
+#include "LargeObjectAllocateStats.hpp"
+#include "LazySweepScheme.hpp"
+#include "MemoryPoolAddressOrderedList.hpp"
+#include "MemorySubSpace.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelSweepChunk.hpp"
+#include "SweepHeapSectioning.hpp"
+#include "SweepPoolManager.hpp"
+#include "SweepPoolState.hpp"
+#include "ModronAssertions.h"
+
+/* Chunks swept and connected at a time by an allocating thread which ran out of free memory */
+#define LAZY_SWEEP_REPLENISH_CHUNKS 4
+/* Minimum number of chunks swept and connected at a time during a collect */
+#define LAZY_SWEEP_MINIMUM_BATCH_SIZE 8
+
+void
+MM_LazySweepTask::run(MM_EnvironmentBase *env)
+{
+	_lazySweepScheme->sweepChunkRange(env, _firstChunk, _chunkCount);
+}
+
+MM_LazySweepScheme *
+MM_LazySweepScheme::newInstance(MM_EnvironmentBase *env)
+{
+	MM_LazySweepScheme *sweepScheme = (MM_LazySweepScheme *)env->getForge()->allocate(sizeof(MM_LazySweepScheme), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != sweepScheme) {
+		new(sweepScheme) MM_LazySweepScheme(env);
+		if (!sweepScheme->initialize(env)) {
+			sweepScheme->kill(env);
+			sweepScheme = NULL;
+		}
+	}
+
+	return sweepScheme;
+}
+
+bool
+MM_LazySweepScheme::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_ParallelSweepScheme::initialize(env)) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_helperMonitor, 0, "MM_LazySweepScheme::_helperMonitor")) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_LazySweepScheme::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _helperMonitor) {
+		omrthread_monitor_destroy(_helperMonitor);
+		_helperMonitor = NULL;
+	}
+
+	MM_ParallelSweepScheme::tearDown(env);
+}
+
+MM_MemoryPoolAddressOrderedList *
+MM_LazySweepScheme::getLazySweepPool(MM_EnvironmentBase *env)
+{
+	MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+	MM_MemoryPool *memoryPool = poolIterator.nextPool();
+
+	if ((NULL == memoryPool) || (NULL != poolIterator.nextPool())) {
+		/* chunks of several pools can't be connected in a single address ordered pass */
+		return NULL;
+	}
+	return (MM_MemoryPoolAddressOrderedList *)memoryPool;
+}
+
+MMINLINE bool
+MM_LazySweepScheme::claimChunk(MM_ParallelSweepChunk *chunk)
+{
+	return (chunk_unswept == chunk->_lazySweepState)
+		&& (chunk_unswept == MM_AtomicOperations::lockCompareExchange(&chunk->_lazySweepState, chunk_unswept, chunk_sweeping));
+}
+
+MMINLINE void
+MM_LazySweepScheme::releaseChunk(MM_ParallelSweepChunk *chunk)
+{
+	/* the chunk's free entries and projection must be visible before the chunk can be connected */
+	MM_AtomicOperations::storeSync();
+	chunk->_lazySweepState = chunk_swept;
+}
+
+void
+MM_LazySweepScheme::sweepChunkRange(MM_EnvironmentBase *env, MM_ParallelSweepChunk *firstChunk, uintptr_t chunkCount)
+{
+	bool sweptChunks = false;
+	MM_ParallelSweepChunk *chunk = firstChunk;
+
+	for (uintptr_t chunkNum = 0; (NULL != chunk) && (chunkNum < chunkCount); chunkNum++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			/* the helper thread may have swept the chunk before the collect started */
+			if (claimChunk(chunk)) {
+				if (!sweptChunks) {
+					env->_freeEntrySizeClassStats.initializeFrequentAllocation(_memoryPool->getLargeObjectAllocateStats());
+					sweptChunks = true;
+				}
+				sweepChunk(env, chunk);
+				releaseChunk(chunk);
+			}
+		}
+		chunk = chunk->_next;
+	}
+
+	if (sweptChunks) {
+		_memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+	}
+}
+
+void
+MM_LazySweepScheme::sweepChunkForAllocate(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk)
+{
+	if (claimChunk(chunk)) {
+		sweepChunk(env, chunk);
+		releaseChunk(chunk);
+	} else {
+		/* the helper thread owns it, it never blocks while sweeping a chunk so this is short */
+		while (chunk_sweeping == chunk->_lazySweepState) {
+			omrthread_yield();
+		}
+	}
+}
+
+uintptr_t
+MM_LazySweepScheme::connectChunks(MM_EnvironmentBase *env, uintptr_t maximumChunks)
+{
+	MM_MemoryPoolAddressOrderedList *memoryPool = _memoryPool;
+	MM_SweepPoolManager *sweepPoolManager = memoryPool->getSweepPoolManager();
+
+	/* connect the chunks into a list of their own, so the regular connect logic (coalescing across chunks,
+	 * statistics) applies unchanged, then put it in front of the entries connected by earlier batches
+	 */
+	uintptr_t freeBytes = memoryPool->getActualFreeMemorySize();
+	uintptr_t freeEntryCount = memoryPool->getActualFreeEntryCount();
+	uintptr_t largestFreeEntry = memoryPool->getLargestFreeEntry();
+	MM_HeapLinkedFreeHeader *freeList = memoryPool->detachFreeList();
+	MM_SweepPoolState *sweepState = sweepPoolManager->getPoolState(memoryPool);
+	sweepState->initializeForSweep(env);
+	/* the trailing free space of the last chunk connected is left as it is (still walkable) until the next chunk is
+	 * connected: cutting it at the chunk top could split a dead object that spans both chunks
+	 */
+	sweepState->_connectPreviousChunk = _lastConnectedChunk;
+
+	uintptr_t connectedChunks = 0;
+	uintptr_t connectedBytes = 0;
+	MM_ParallelSweepChunk *chunk = _connectCursor;
+	while ((NULL != chunk) && (connectedChunks < maximumChunks) && (chunk_swept == chunk->_lazySweepState)) {
+		MM_AtomicOperations::loadSync();
+		connectChunk(env, chunk);
+		chunk->_lazySweepState = chunk_connected;
+		connectedBytes += chunk->size();
+		connectedChunks += 1;
+		_lastConnectedChunk = chunk;
+		chunk = chunk->_next;
+	}
+	_connectCursor = chunk;
+
+	if (NULL == _connectCursor) {
+		sweepPoolManager->flushFinalChunk(env, memoryPool);
+	}
+	sweepPoolManager->connectFinalChunk(env, memoryPool);
+	_connectedFreeBytes += memoryPool->getActualFreeMemorySize();
+	memoryPool->reattachFreeList(env, freeList, freeBytes, freeEntryCount, largestFreeEntry);
+
+	_connectedBytes += connectedBytes;
+	_unconnectedBytes -= connectedBytes;
+
+	if (NULL == _connectCursor) {
+		/* every chunk is on the free list, finish the sweep the way a full sweep would */
+		_active = false;
+		sweepPoolManager->poolPostProcess(env, memoryPool);
+	}
+	updateApproximateFreeMemorySize();
+
+	return connectedChunks;
+}
+
+void
+MM_LazySweepScheme::updateApproximateFreeMemorySize()
+{
+	uintptr_t approximateFreeBytes = 0;
+	if (_active && (0 != _connectedBytes)) {
+		/* assume the rest of the heap is as dense as the part connected so far */
+		approximateFreeBytes = (uintptr_t)(((double)_unconnectedBytes * (double)_connectedFreeBytes) / (double)_connectedBytes);
+	}
+	_memoryPool->setApproximateFreeMemorySize(approximateFreeBytes);
+}
+
+bool
+MM_LazySweepScheme::sweepForMinimumSize(MM_EnvironmentBase *env, MM_MemorySubSpace *baseMemorySubSpace, MM_AllocateDescription *allocateDescription)
+{
+	Assert_MM_true(!_active);
+	_helperCursor = NULL;
+	_memoryPool = getLazySweepPool(env);
+	if (NULL == _memoryPool) {
+		return MM_ParallelSweepScheme::sweepForMinimumSize(env, baseMemorySubSpace, allocateDescription);
+	}
+
+	setupForSweep(env);
+	_extensions->heap->resetLargestFreeEntry();
+	uintptr_t chunkCount = prepareAllChunks(env);
+	_extensions->splitFreeListNumberChunksPrepared = chunkCount;
+
+	MM_SweepHeapSectioningIterator sectioningIterator(_sweepHeapSectioning);
+	_connectCursor = (0 == chunkCount) ? NULL : sectioningIterator.nextChunk();
+	_lastConnectedChunk = NULL;
+	_unconnectedBytes = 0;
+	for (MM_ParallelSweepChunk *chunk = _connectCursor; NULL != chunk; chunk = chunk->_next) {
+		_unconnectedBytes += chunk->size();
+	}
+	_connectedBytes = 0;
+	_connectedFreeBytes = 0;
+	_batchSize = OMR_MAX(2 * _extensions->dispatcher->threadCount(), LAZY_SWEEP_MINIMUM_BATCH_SIZE);
+	_active = true;
+
+	if (NULL == _connectCursor) {
+		/* nothing to sweep, leave the pool empty */
+		connectChunks(env, 0);
+	}
+
+	/* sweep in address order until the allocate that triggered the collect can be satisfied */
+	uintptr_t minimumFreeSize = (NULL == allocateDescription) ? 0 : allocateDescription->getBytesRequested();
+	while (_active) {
+		MM_LazySweepTask sweepTask(env, _extensions->dispatcher, this, _connectCursor, _batchSize);
+		_extensions->dispatcher->run(env, &sweepTask);
+		connectChunks(env, _batchSize);
+		if (_memoryPool->getLargestFreeEntry() >= minimumFreeSize) {
+			break;
+		}
+	}
+
+	if (_active) {
+		_helperCursor = _connectCursor;
+		requestHelperSweep();
+	}
+
+	if (NULL != allocateDescription) {
+		return minimumFreeSize <= baseMemorySubSpace->findLargestFreeEntry(env, allocateDescription);
+	}
+	return true;
+}
+
+void
+MM_LazySweepScheme::completeSweep(MM_EnvironmentBase *env, SweepCompletionReason reason)
+{
+	if (_active) {
+		if (ABOUT_TO_GC == reason) {
+			/* the collect rebuilds the free list from its own mark map, the chunks left unswept are simply dropped */
+			_active = false;
+			_connectCursor = NULL;
+			updateApproximateFreeMemorySize();
+		} else {
+			MM_LazySweepTask sweepTask(env, _extensions->dispatcher, this, _connectCursor, UDATA_MAX);
+			_extensions->dispatcher->run(env, &sweepTask);
+			connectChunks(env, UDATA_MAX);
+			Assert_MM_true(!_active);
+		}
+		_helperCursor = NULL;
+	}
+}
+
+bool
+MM_LazySweepScheme::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	bool replenished = false;
+
+	if (_active && (memoryPool == (MM_MemoryPool *)_memoryPool)) {
+		MM_LargeObjectAllocateStats *largeObjectAllocateStats = _memoryPool->getLargeObjectAllocateStats();
+		env->_freeEntrySizeClassStats.initializeFrequentAllocation(largeObjectAllocateStats);
+
+		do {
+			MM_ParallelSweepChunk *chunk = _connectCursor;
+			for (uintptr_t chunkNum = 0; (NULL != chunk) && (chunkNum < LAZY_SWEEP_REPLENISH_CHUNKS); chunkNum++) {
+				sweepChunkForAllocate(env, chunk);
+				chunk = chunk->_next;
+			}
+			if (0 != connectChunks(env, LAZY_SWEEP_REPLENISH_CHUNKS)) {
+				replenished = true;
+			}
+		} while (_active && (_memoryPool->getLargestFreeEntry() < size));
+
+		largeObjectAllocateStats->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+	}
+
+	return replenished;
+}
+
+void
+MM_LazySweepScheme::helperSweep(MM_EnvironmentBase *env)
+{
+	if (!_active) {
+		return;
+	}
+
+	MM_LargeObjectAllocateStats *largeObjectAllocateStats = _memoryPool->getLargeObjectAllocateStats();
+	_memoryPool->lock(env);
+	env->_freeEntrySizeClassStats.initializeFrequentAllocation(largeObjectAllocateStats);
+	_memoryPool->unlock(env);
+
+	while (_active && (NULL != _helperCursor) && !env->isExclusiveAccessRequestWaiting()) {
+		MM_ParallelSweepChunk *chunk = _helperCursor;
+		_helperCursor = chunk->_next;
+		if (claimChunk(chunk)) {
+			sweepChunk(env, chunk);
+			releaseChunk(chunk);
+			/* allocating threads update the pool statistics under the pool lock */
+			_memoryPool->lock(env);
+			largeObjectAllocateStats->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+			_memoryPool->unlock(env);
+		}
+	}
+}
+
+void
+MM_LazySweepScheme::requestHelperSweep()
+{
+	omrthread_monitor_enter(_helperMonitor);
+	if (helper_waiting == _helperState) {
+		_helperState = helper_sweep_requested;
+		omrthread_monitor_notify(_helperMonitor);
+	}
+	omrthread_monitor_exit(_helperMonitor);
+}
+
+uintptr_t
+MM_LazySweepScheme::helperThreadProc2(OMRPortLibrary *portLib, void *info)
+{
+	MM_LazySweepScheme *sweepScheme = (MM_LazySweepScheme *)info;
+	/* jump into the helper thread procedure and wait for work.  This method will NOT return */
+	sweepScheme->helperThreadEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+int J9THREAD_PROC
+MM_LazySweepScheme::helperThreadProc(void *info)
+{
+	MM_LazySweepScheme *sweepScheme = (MM_LazySweepScheme *)info;
+	MM_GCExtensionsBase *extensions = sweepScheme->_extensions;
+	OMR_VM *omrVM = extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(helperThreadProc2, info,
+			extensions->dispatcher->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+void
+MM_LazySweepScheme::helperThreadEntryPoint()
+{
+	OMR_VMThread *omrVMThread = MM_EnvironmentBase::attachVMThread(_extensions->getOmrVM(), "Lazy Sweep Helper", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	if (NULL == omrVMThread) {
+		/* we failed to attach so notify the creating thread that we should fail to start up */
+		omrthread_monitor_enter(_helperMonitor);
+		_helperState = helper_error;
+		omrthread_monitor_notify(_helperMonitor);
+		omrthread_exit(_helperMonitor);
+	} else {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		env->initializeGCThread();
+		env->setThreadType(CON_SWEEP_HELPER_THREAD);
+
+		omrthread_monitor_enter(_helperMonitor);
+		_helperState = helper_waiting;
+		omrthread_monitor_notify(_helperMonitor);
+		do {
+			if (helper_sweep_requested == _helperState) {
+				_helperState = helper_waiting;
+				omrthread_monitor_exit(_helperMonitor);
+				/* a chunk must never be left half swept across a collect, VM access is held for the whole pass */
+				env->acquireVMAccess();
+				helperSweep(env);
+				env->releaseVMAccess();
+				omrthread_monitor_enter(_helperMonitor);
+			} else if (helper_waiting == _helperState) {
+				omrthread_monitor_wait(_helperMonitor);
+			}
+		} while (helper_termination_requested != _helperState);
+
+		_helperState = helper_terminated;
+		omrthread_monitor_notify(_helperMonitor);
+		MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrVMThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+		omrthread_exit(_helperMonitor);
+	}
+}
+
+bool
+MM_LazySweepScheme::startupHelperThread(MM_GCExtensionsBase *extensions)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it can't notify us of its state before we wait */
+	omrthread_monitor_enter(_helperMonitor);
+	_helperState = helper_starting;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		helperThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (helper_starting == _helperState) {
+			omrthread_monitor_wait(_helperMonitor);
+		}
+		success = (helper_error != _helperState);
+	} else {
+		_helperState = helper_error;
+	}
+	omrthread_monitor_exit(_helperMonitor);
+
+	return success;
+}
+
+void
+MM_LazySweepScheme::shutdownHelperThread(MM_GCExtensionsBase *extensions)
+{
+	if ((helper_disabled != _helperState) && (helper_error != _helperState)) {
+		/* tell the helper to shut down and then wait for it to exit */
+		omrthread_monitor_enter(_helperMonitor);
+		while (helper_terminated != _helperState) {
+			_helperState = helper_termination_requested;
+			omrthread_monitor_notify(_helperMonitor);
+			omrthread_monitor_wait(_helperMonitor);
+		}
+		omrthread_monitor_exit(_helperMonitor);
+	}
+}
@@ -0,0 +1,228 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(LAZYSWEEPSCHEME_HPP_)
+#define LAZYSWEEPSCHEME_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+#include "modronbase.h"
+
+#include "ParallelSweepScheme.hpp"
+
+class MM_MemoryPoolAddressOrderedList;
+class MM_ParallelSweepChunk;
+class MM_LazySweepScheme;
+
+/**
+ * Task to sweep a run of address ordered chunks in parallel.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_LazySweepTask : public MM_ParallelSweepTask
+{
+private:
+	MM_LazySweepScheme *_lazySweepScheme;
+	MM_ParallelSweepChunk *_firstChunk; /**< first chunk of the run */
+	uintptr_t _chunkCount; /**< maximum number of chunks in the run */
+
+public:
+	virtual void run(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a LazySweepTask object.
+	 */
+	MM_LazySweepTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_LazySweepScheme *sweepScheme, MM_ParallelSweepChunk *firstChunk, uintptr_t chunkCount) :
+		MM_ParallelSweepTask(env, dispatcher, (MM_ParallelSweepScheme *)sweepScheme),
+		_lazySweepScheme(sweepScheme),
+		_firstChunk(firstChunk),
+		_chunkCount(chunkCount)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+/**
+ * Sweep scheme that leaves most of the sweep until the memory is needed.
+ * A global collect only sweeps and connects chunks, in address order, until the failed allocate can be satisfied.
+ * The remaining chunks are swept by a background helper thread and by allocating threads which run out of free
+ * memory, and are connected to the end of the free list by the allocating threads under the pool lock.
+ * Only supported on a flat heap with a single address ordered pool.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_LazySweepScheme : public MM_ParallelSweepScheme
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum ChunkState {
+		chunk_unswept = 0, /**< not swept yet (the state a chunk is cleared to) */
+		chunk_sweeping, /**< claimed by a thread which is sweeping it */
+		chunk_swept, /**< swept, waiting to be connected */
+		chunk_connected /**< free entries are on the pool free list */
+	};
+
+	enum HelperState {
+		helper_disabled = 0, /**< no helper thread was started */
+		helper_starting,
+		helper_waiting, /**< waiting for a sweep to be requested */
+		helper_sweep_requested, /**< a collect left chunks to sweep */
+		helper_termination_requested,
+		helper_terminated,
+		helper_error /**< the thread failed to attach */
+	};
+
+private:
+	MM_MemoryPoolAddressOrderedList *_memoryPool; /**< the pool being swept */
+	MM_ParallelSweepChunk *_connectCursor; /**< next chunk to connect, NULL once all chunks are connected */
+	MM_ParallelSweepChunk *_lastConnectedChunk; /**< last chunk connected, its trailing free space is connected with the next chunk */
+	MM_ParallelSweepChunk *_helperCursor; /**< next chunk the helper thread will look at */
+	volatile bool _active; /**< true while some chunks of the last collect are not connected */
+	uintptr_t _batchSize; /**< number of chunks swept and connected at a time during a collect */
+	uintptr_t _unconnectedBytes; /**< heap bytes covered by chunks which are not connected */
+	uintptr_t _connectedBytes; /**< heap bytes covered by connected chunks */
+	uintptr_t _connectedFreeBytes; /**< free bytes found in connected chunks */
+
+	omrthread_monitor_t _helperMonitor; /**< protects _helperState */
+	volatile HelperState _helperState;
+
+	/*
+	 * Function members
+	 */
+private:
+	static int J9THREAD_PROC helperThreadProc(void *info);
+	static uintptr_t helperThreadProc2(OMRPortLibrary *portLib, void *info);
+	void helperThreadEntryPoint();
+
+	/**
+	 * Sweep chunks on behalf of the helper thread until none are left or exclusive access is requested.
+	 * @note the caller holds VM access
+	 */
+	void helperSweep(MM_EnvironmentBase *env);
+
+	/**
+	 * Sweep up to chunkCount chunks from firstChunk which no other thread has claimed.
+	 * Called by each thread of a MM_LazySweepTask.
+	 */
+	void sweepChunkRange(MM_EnvironmentBase *env, MM_ParallelSweepChunk *firstChunk, uintptr_t chunkCount);
+
+	/**
+	 * Claim a chunk for sweeping.
+	 * @return true if the calling thread now owns the chunk
+	 */
+	MMINLINE bool claimChunk(MM_ParallelSweepChunk *chunk);
+
+	/**
+	 * Publish a chunk swept by the calling thread.
+	 */
+	MMINLINE void releaseChunk(MM_ParallelSweepChunk *chunk);
+
+	/**
+	 * Make sure a chunk is swept, sweeping it on the calling thread if nobody has claimed it yet, waiting for the
+	 * owner otherwise.
+	 * @note called by an allocating thread, under the pool lock
+	 */
+	void sweepChunkForAllocate(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk);
+
+	/**
+	 * Connect consecutive swept chunks, starting at the connect cursor, to the end of the pool free list.
+	 * Completes the sweep once the last chunk is connected.
+	 * @param maximumChunks maximum number of chunks to connect
+	 * @return number of chunks connected
+	 */
+	uintptr_t connectChunks(MM_EnvironmentBase *env, uintptr_t maximumChunks);
+
+	/**
+	 * Update the pool's estimate of the free memory still to be connected.
+	 */
+	void updateApproximateFreeMemorySize();
+
+	/**
+	 * @return the single address ordered pool of the heap, or NULL if the heap can't be swept lazily
+	 */
+	MM_MemoryPoolAddressOrderedList *getLazySweepPool(MM_EnvironmentBase *env);
+
+	/**
+	 * Wake the helper thread after a collect left chunks to sweep.
+	 */
+	void requestHelperSweep();
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_LazySweepScheme *newInstance(MM_EnvironmentBase *env);
+
+	virtual void completeSweep(MM_EnvironmentBase *env, SweepCompletionReason reason);
+	virtual bool sweepForMinimumSize(MM_EnvironmentBase *env, MM_MemorySubSpace *baseMemorySubSpace, MM_AllocateDescription *allocateDescription);
+	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
+	virtual bool isSweepCompleted(MM_EnvironmentBase *env) { return !_active; }
+
+	/**
+	 * @return heap bytes covered by the chunks connected to the free list since the last collect
+	 */
+	MMINLINE uintptr_t getConnectedBytes() { return _connectedBytes; }
+
+	/**
+	 * Start the background sweep helper thread.
+	 * @return true if the thread started
+	 */
+	bool startupHelperThread(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Stop the background sweep helper thread and wait for it to exit.
+	 */
+	void shutdownHelperThread(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Create a LazySweepScheme object.
+	 */
+	MM_LazySweepScheme(MM_EnvironmentBase *env)
+		: MM_ParallelSweepScheme(env)
+		, _memoryPool(NULL)
+		, _connectCursor(NULL)
+		, _lastConnectedChunk(NULL)
+		, _helperCursor(NULL)
+		, _active(false)
+		, _batchSize(0)
+		, _unconnectedBytes(0)
+		, _connectedBytes(0)
+		, _connectedFreeBytes(0)
+		, _helperMonitor(NULL)
+		, _helperState(helper_disabled)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	/*
+	 * Friends
+	 */
+	friend class MM_LazySweepTask;
+};
+
+#endif /* LAZYSWEEPSCHEME_HPP_ */
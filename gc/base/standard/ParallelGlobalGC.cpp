@@ -444,6 +444,11 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 	uintptr_t regionSize = _extensions->regionSize;
 	Assert_MM_true((0 != regionSize) && (0 == (heapBase % regionSize)));
 
+	if (_extensions->lazySweep) {
+		/* chunks the lazy sweep of the previous cycle did not get to are dropped, this collect rebuilds the free list */
+		_sweepScheme->completeSweep(env, ABOUT_TO_GC);
+	}
+
 	/* Reset memory pools of associated memory spaces */
 	_extensions->heap->resetSpacesForGarbageCollect(env);
 	
@@ -452,6 +457,7 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 	_compactThisCycle = false;
+	_partialCompactionTarget = 0;
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	_fixHeapForWalkCompleted = false;
@@ -627,6 +633,9 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		
 		if(bytesRequested > largestFreeEntry){
 			compactReason = COMPACT_LARGE;
+			if (_extensions->partialCompaction) {
+				_partialCompactionTarget = bytesRequested;
+			}
 			goto compactionReqd;
 		}
 	}
@@ -648,6 +657,9 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 			
 			if(failedTenureLargest > largestTenureFreeEntry){
 				compactReason = COMPACT_LARGE;
+				if (_extensions->partialCompaction) {
+					_partialCompactionTarget = failedTenureLargest;
+				}
 				goto compactionReqd;
 			}
 		}	
@@ -725,7 +737,10 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if (!_extensions->concurrentSweep)
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+		{
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -762,9 +777,21 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		}
 	}
 
+	/* Compact the most fragmented sub areas before the large allocations are forecast to fail */
+	if (_extensions->partialCompaction && _extensions->processLargeAllocateStats) {
+		uintptr_t forecastTarget = _fragmentationForecaster.getCompactionTarget();
+		if (0 != forecastTarget) {
+			Trc_MM_ParallelGlobalGC_fragmentationForecast(env->getLanguageVMThread(), _fragmentationForecaster.getProjectedLargestFreeEntry(), forecastTarget, _extensions->fragmentationForecastHorizon);
+			compactReason = COMPACT_FRAGMENTATION_FORECAST;
+			_partialCompactionTarget = forecastTarget;
+			goto compactionReqd;
+		}
+	}
+
 	
 nocompact:	
 	/* Compaction not required or prevented from running */
+	_partialCompactionTarget = 0;
 	_extensions->globalGCStats.compactStats._compactReason = compactReason;
 	_extensions->globalGCStats.compactStats._compactPreventedReason = compactPreventedReason;
 	return false;
@@ -853,6 +880,8 @@ compactionReqd:
 	 * Remember why for verbose
 	 */
 	_extensions->globalGCStats.compactStats._compactReason = COMPACT_CONTRACT;
+	/* contraction needs the free memory at the top of the heap, which only a full compaction provides */
+	_partialCompactionTarget = 0;
 	
 	return true;
 }
@@ -870,6 +899,12 @@ MM_ParallelGlobalGC::sweep(MM_EnvironmentBase *env, MM_AllocateDescription *allo
 
 	if (_extensions->processLargeAllocateStats) {
 		processLargeAllocateStatsAfterSweep(env);
+#if defined(OMR_GC_MODRON_COMPACTION)
+		if (_extensions->partialCompaction) {
+			MM_MemoryPool *tenurePool = _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool();
+			_fragmentationForecaster.update(tenurePool->getLargeObjectAllocateStats(), _extensions->fragmentationForecastHorizon);
+		}
+#endif /* OMR_GC_MODRON_COMPACTION */
 	}
 
 	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
@@ -992,15 +1027,26 @@ MM_ParallelGlobalGC::mainThreadCompact(MM_EnvironmentBase *env, MM_AllocateDescr
 	markMap->setMarkMapValid(false);
 	_compactScheme->setMarkMap(markMap);
 
+	_compactScheme->setPartialCompactionTarget(_partialCompactionTarget);
+
 	reportCompactStart(env);
 	compactStats->_startTime = omrtime_hires_clock();
 	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact());
 	_dispatcher->run(env, &compactTask);
 	compactStats->_endTime = omrtime_hires_clock();
+	compactStats->_partialCompactBytes = _compactScheme->getPartialCompactBytes();
+	compactStats->_slidingCompaction = _compactScheme->isSlidingCompaction();
 	reportCompactEnd(env);
 	
-	/* Remember the gc count of the last compaction */ 
-	_extensions->globalGCStats.compactStats._lastHeapCompaction= _extensions->globalGCStats.gcCount;
+	/* the free list no longer follows the sampled trend */
+	_fragmentationForecaster.reset();
+
+	/* Remember the gc count of the last compaction, a partial one leaves most of the heap fragmented
+	 * so it must not prevent an aggressive collect from compacting
+	 */
+	if (0 == compactStats->_partialCompactBytes) {
+		_extensions->globalGCStats.compactStats._lastHeapCompaction= _extensions->globalGCStats.gcCount;
+	}
 }
 #endif /* OMR_GC_MODRON_COMPACTION */
 
@@ -1249,6 +1295,9 @@ MM_ParallelGlobalGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySu
 void
 MM_ParallelGlobalGC::prepareHeapForWalk(MM_EnvironmentBase *env)
 {
+	/* the walk re-marks the heap, the mark map of the last collect must not be needed any more */
+	_sweepScheme->completeSweep(env, HEAP_WALK_REQUIRED);
+
 	GC_OMRVMInterface::flushCachesForGC(env);
 
 	_markingScheme->mainSetupForWalk(env);
@@ -1298,6 +1347,9 @@ MM_ParallelGlobalGC::fixHeapForWalk(MM_EnvironmentBase *env, UDATA walkFlags, ui
 bool
 MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
 {
+	/* the sweep chunks are rebuilt for the new range */
+	_sweepScheme->completeSweep(env, EXPANSION_REQUIRED);
+
 	bool result = _markingScheme->heapAddRange(env, subspace, size, lowAddress, highAddress);
 	if (0 == result) {
 		goto markingScheme_failed_heapAddRange;
@@ -1341,6 +1393,8 @@ markingScheme_failed_heapAddRange:
 bool
 MM_ParallelGlobalGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
 {
+	_sweepScheme->completeSweep(env, CONTRACTION_REQUIRED);
+
 	bool result = _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 	result = result && _sweepScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
@@ -1358,6 +1412,16 @@ MM_ParallelGlobalGC::heapReconfigured(MM_EnvironmentBase *env, HeapReconfigReaso
 	_sweepScheme->heapReconfigured(env);
 }
 
+/**
+ * Replenish a pool's free list from the sweep work left by the last collect, if any.
+ * @note This call is made under the pool's allocation lock
+ */
+bool
+MM_ParallelGlobalGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
+}
+
 bool
 MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
@@ -1366,6 +1430,9 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	if (extensions->lazySweep) {
+		return ((MM_LazySweepScheme *)_sweepScheme)->startupHelperThread(extensions);
+	}
 	return true;
 }
 
@@ -1377,6 +1444,9 @@ MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 		extensions->scavenger->collectorShutdown(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	if (extensions->lazySweep) {
+		((MM_LazySweepScheme *)_sweepScheme)->shutdownHelperThread(extensions);
+	}
 }
 
 /**
@@ -1448,6 +1518,14 @@ globalGCHookAFCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventDa
 
 	/* ..and remember time of last AF end */
 	extensions->heap->getResizeStats()->setLastAFEndTime(omrtime_hires_clock());
+
+	if (extensions->isGoalDrivenHeapResizing()) {
+		/* the pause of a global collection is the time the allocation failure kept mutators stopped */
+		MM_HeapResizeStats *resizeStats = extensions->heap->getResizeStats();
+		if (resizeStats->getLastAFEndTime() > resizeStats->getThisAFStartTime()) {
+			resizeStats->getTenureGoal()->recordPause(omrtime_hires_delta(resizeStats->getThisAFStartTime(), resizeStats->getLastAFEndTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+		}
+	}
 	
 	/* If we have contracted and compacted on this GC then reset ratio ticks as compact will obviously result
 	 * in a large increase in time in GC and could result in an unexpected/undesirable ratio EXPAND on next GC
@@ -32,8 +32,12 @@
 #endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
+#if defined(OMR_GC_MODRON_COMPACTION)
+#include "FragmentationForecaster.hpp"
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
+#include "LazySweepScheme.hpp"
 #include "MarkMap.hpp"
 #include "MarkingScheme.hpp"
 #include "ParallelHeapWalker.hpp"
@@ -70,6 +74,8 @@ private:
 #if defined(OMR_GC_MODRON_COMPACTION)
 	MM_CompactScheme *_compactScheme;
 	bool _compactThisCycle;		/**< keep a decision should compact run this cycle */
+	uintptr_t _partialCompactionTarget; /**< size of the free entry this cycle's compaction must produce if only part of the heap is compacted, 0 for a full compaction */
+	MM_FragmentationForecaster _fragmentationForecaster; /**< predicts when the tenure largest free entry falls below the large allocation sizes */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 protected:
@@ -119,6 +125,13 @@ private:
 	 * 	- average TLH size drops below threshold; currently 1024 bytes
 	 *  - If -Xgc:compactToSatisfyAllocate is set, we ONLY compact if the
 	 *    allocate could not be satisfied
+	 *  - If -Xgc:partialCompaction is set, the largest free entry is forecast
+	 *    to fall below the large allocation sizes within
+	 *    -Xgc:fragmentationForecastHorizon collections
+	 *
+	 * With -Xgc:partialCompaction, compactions run to satisfy an allocation
+	 * or the forecast set _partialCompactionTarget so that only the most
+	 * fragmented sub areas are evacuated.
 	 * 
 	 * Further the user can control whether a compaction is performed 
 	 * on a system GC or not using the following command line options:
@@ -145,13 +158,6 @@ private:
 	bool compactRequiredBeforeHeapContraction(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t contractionSize);
 #endif /* OMR_GC_MODRON_COMPACTION */
 
-	/**
-	 *	Mark operation - Complete Mark operation
-	 *	Use for compatibility with old collectors
-	 *	@param initMarkMap instruct should mark map be initialized (might be already partially done like in conrurrentGC) 
-	 */
-	void markAll(MM_EnvironmentBase *env, bool initMarkMap);
-	
 	/**
 	 *	Main call for Sweep operation
 	 *	Start of sweep for concurrentGC, full sweep for other cases
@@ -171,18 +177,11 @@ private:
 	void mainThreadCompact(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool rebuildMarkBits);
 #endif /* OMR_GC_MODRON_COMPACTION */
 
-	void mainThreadRestartAllocationCaches(MM_EnvironmentBase *env);
-
 	/**
 	 *	Initializations before GC cycle 
 	 */
 	void setupBeforeGC(MM_EnvironmentBase *env);
 	
-	/**
-	 *	Last few settings to complete GC cycle 
-	 */
-	void cleanupAfterGC(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
-
 	/**
 	 * redistribute free memory in tenure after global collection (move free memory from LOA to SOA)
 	 */
@@ -191,6 +190,20 @@ protected:
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env);
 
+	/**
+	 *	Mark operation - Complete Mark operation
+	 *	Use for compatibility with old collectors
+	 *	@param initMarkMap instruct should mark map be initialized (might be already partially done like in conrurrentGC) 
+	 */
+	void markAll(MM_EnvironmentBase *env, bool initMarkMap);
+
+	void mainThreadRestartAllocationCaches(MM_EnvironmentBase *env);
+
+	/**
+	 *	Last few settings to complete GC cycle 
+	 */
+	void cleanupAfterGC(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
+
 	virtual void mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap, bool rebuildMarkBits);
 
 	virtual void setupForGC(MM_EnvironmentBase *env);
@@ -258,7 +271,9 @@ protected:
 			sweepScheme = MM_ConcurrentSweepScheme::newInstance(env, globalCollector);
 		} else
 #endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
-		{
+		if (_extensions->lazySweep) {
+			sweepScheme = MM_LazySweepScheme::newInstance(env);
+		} else {
 			sweepScheme = MM_ParallelSweepScheme::newInstance(env);
 		}
 
@@ -291,6 +306,8 @@ public:
 	virtual bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
 	virtual void heapReconfigured(MM_EnvironmentBase *env, HeapReconfigReason reason, MM_MemorySubSpace *subspace, void *lowAddress, void *highAddress);
 
+	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
+
 	virtual	uint32_t getGCTimePercentage(MM_EnvironmentBase *env);
 
 	/**
@@ -317,6 +334,14 @@ public:
 	{
 		return _markingScheme;
 	}
+
+	/**
+	 * Return reference to Sweep Scheme
+	 */
+	MM_ParallelSweepScheme *getSweepScheme()
+	{
+		return _sweepScheme;
+	}
 	
 #if defined(OMR_GC_MODRON_COMPACTION)
 	MM_CompactScheme *
@@ -345,6 +370,8 @@ public:
 #if defined(OMR_GC_MODRON_COMPACTION)
 		, _compactScheme(NULL)
 		, _compactThisCycle(false)
+		, _partialCompactionTarget(0)
+		, _fragmentationForecaster()
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
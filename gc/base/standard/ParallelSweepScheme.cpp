@@ -53,10 +53,12 @@
 
 #if defined(OMR_ENV_DATA64)
 #define J9MODRON_OBM_SLOT_EMPTY ((uintptr_t)0x0000000000000000)
+#define J9MODRON_OBM_SLOT_FULL ((uintptr_t)0xFFFFFFFFFFFFFFFF)
 #define J9MODRON_OBM_SLOT_FIRST_SLOT ((uintptr_t)0x0000000000000001)
 #define J9MODRON_OBM_SLOT_LAST_SLOT ((uintptr_t)0x8000000000000000)
 #else /* OMR_ENV_DATA64 */
 #define J9MODRON_OBM_SLOT_EMPTY ((uintptr_t)0x00000000)
+#define J9MODRON_OBM_SLOT_FULL ((uintptr_t)0xFFFFFFFF)
 #define J9MODRON_OBM_SLOT_FIRST_SLOT ((uintptr_t)0x00000001)
 #define J9MODRON_OBM_SLOT_LAST_SLOT ((uintptr_t)0x80000000)
 #endif /* OMR_ENV_DATA64 */
@@ -341,14 +343,8 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		/* Sparse heaps have long runs of empty map slots, skip them in bulk */
+		markMapCurrent = _extensions->heapMapScan.skipSlots(markMapCurrent + 1, markMapChunkTop, J9MODRON_OBM_SLOT_EMPTY);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -518,6 +514,17 @@ MM_ParallelSweepScheme::sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChun
 		/* Check if the map slot is part of a candidate free list entry */
 		sweepMarkMapBody(markMapCurrent, markMapChunkTop, markMapFreeHead, heapSlotFreeCount, heapSlotFreeCurrent, heapSlotFreeHead);
 		if (0 == heapSlotFreeCount) {
+			if (J9MODRON_OBM_SLOT_FULL == *markMapCurrent) {
+				/* A run of fully marked slots holds neither free memory nor dark matter - step over it in bulk,
+				 * still accounting for the (empty) samples it would have provided.
+				 */
+				uintptr_t fullSlots = _extensions->heapMapScan.skipSlots(markMapCurrent + 1, markMapChunkTop, J9MODRON_OBM_SLOT_FULL) - markMapCurrent;
+				darkMatterSamples += ((darkMatterCandidates + fullSlots) / darkMatterSampleRate) - (darkMatterCandidates / darkMatterSampleRate);
+				darkMatterCandidates += fullSlots;
+				heapSlotFreeCurrent += J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * fullSlots;
+				markMapCurrent += fullSlots;
+				continue;
+			}
 			darkMatterCandidates += 1;
 			if (0 == (darkMatterCandidates % darkMatterSampleRate)) {
 				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent, heapSlotFreeCurrent);
@@ -857,7 +864,6 @@ MM_ParallelSweepScheme::sweepForMinimumSize(
 	}	
 }
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 /**
  * Replenish a pools free lists to satisfy a given allocate.
  * The given pool was unable to satisfy an allocation request of (at least) the given size.  See if there is work
@@ -871,7 +877,6 @@ MM_ParallelSweepScheme::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_Mem
 {
 	return false;
 }
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 void
 MM_ParallelSweepScheme::setMarkMap(MM_MarkMap *markMap)
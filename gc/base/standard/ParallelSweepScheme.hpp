@@ -189,9 +189,7 @@ public:
 	 */
 	void heapReconfigured(MM_EnvironmentBase *env);
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	/**
 	 * Accurately measure the dark matter within the mark map uintptr_t beginning at heapSlotFreeCurrent.
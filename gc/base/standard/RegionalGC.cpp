@@ -0,0 +1,779 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "ut_j9mm.h"
+
+#if defined(OMR_GC_REGIONAL)
+
+#include <string.h>
+
+#include "RegionalGC.hpp"
+
+#include "AllocateDescription.hpp"
+#include "Bits.hpp"
+#include "CycleState.hpp"
+#include "Forge.hpp"
+#include "ForwardedHeader.hpp"
+#include "GCCode.hpp"
+#include "GlobalAllocationManager.hpp"
+#include "Heap.hpp"
+#include "HeapRegionManager.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapMapIterator.hpp"
+#include "MarkingScheme.hpp"
+#include "MarkMap.hpp"
+#include "MemoryPoolAddressOrderedList.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "ObjectModel.hpp"
+#include "ObjectScanner.hpp"
+#include "RegionalRememberedSet.hpp"
+#include "SlotObject.hpp"
+
+#define REGIONAL_INITIAL_MARK_STACK_SIZE 256
+
+MM_RegionalGC *
+MM_RegionalGC::newInstance(MM_EnvironmentBase *env)
+{
+	MM_RegionalGC *regionalGC = (MM_RegionalGC *)env->getForge()->allocate(sizeof(MM_RegionalGC), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != regionalGC) {
+		new(regionalGC) MM_RegionalGC(env);
+		if (!regionalGC->initialize(env)) {
+			regionalGC->kill(env);
+			regionalGC = NULL;
+		}
+	}
+	return regionalGC;
+}
+
+void
+MM_RegionalGC::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_RegionalGC::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_ParallelGlobalGC::initialize(env)) {
+		return false;
+	}
+	if (!_regionalDelegate.initialize(env, this)) {
+		return false;
+	}
+
+	MM_Forge *forge = env->getForge();
+	_heapBase = (uint8_t *)_extensions->heap->getHeapBase();
+	_regionSize = _extensions->regionSize;
+	_regionShift = _extensions->heapRegionManager->getRegionShift();
+	_regionCount = ((uintptr_t)_extensions->heap->getHeapTop() - (uintptr_t)_heapBase) >> _regionShift;
+	Assert_MM_true((0 != _regionCount) && (_regionSize == ((uintptr_t)1 << _regionShift)));
+
+	_regions = (Region *)forge->allocate(sizeof(Region) * _regionCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _regions) {
+		return false;
+	}
+	memset(_regions, 0, sizeof(Region) * _regionCount);
+
+	_copyCaches = (MM_CopyScanCacheStandard *)forge->allocate(sizeof(MM_CopyScanCacheStandard) * _regionCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _copyCaches) {
+		return false;
+	}
+	for (uintptr_t index = 0; index < _regionCount; index++) {
+		new(&_copyCaches[index]) MM_CopyScanCacheStandard(OMR_COPYSCAN_CACHE_TYPE_HEAP);
+	}
+
+	_rememberedSet = MM_RegionalRememberedSet::newInstance(env, _heapBase, _regionCount, _regionShift);
+	if (NULL == _rememberedSet) {
+		return false;
+	}
+	_extensions->regionalRememberedSet = _rememberedSet;
+
+	_sourceRegions = (uintptr_t *)forge->allocate(sizeof(uintptr_t) * _rememberedSet->getWordsPerRow(), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _sourceRegions) {
+		return false;
+	}
+
+	_markStack = (omrobjectptr_t *)forge->allocate(sizeof(omrobjectptr_t) * REGIONAL_INITIAL_MARK_STACK_SIZE, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _markStack) {
+		return false;
+	}
+	_markStackSize = REGIONAL_INITIAL_MARK_STACK_SIZE;
+
+	return true;
+}
+
+void
+MM_RegionalGC::tearDown(MM_EnvironmentBase *env)
+{
+	MM_Forge *forge = env->getForge();
+	if (NULL != _markStack) {
+		forge->free(_markStack);
+		_markStack = NULL;
+	}
+	if (NULL != _sourceRegions) {
+		forge->free(_sourceRegions);
+		_sourceRegions = NULL;
+	}
+	if (NULL != _rememberedSet) {
+		_extensions->regionalRememberedSet = NULL;
+		_rememberedSet->kill(env);
+		_rememberedSet = NULL;
+	}
+	if (NULL != _copyCaches) {
+		forge->free(_copyCaches);
+		_copyCaches = NULL;
+	}
+	if (NULL != _regions) {
+		forge->free(_regions);
+		_regions = NULL;
+	}
+	_regionalDelegate.tearDown(env);
+	MM_ParallelGlobalGC::tearDown(env);
+}
+
+void
+MM_RegionalGC::heapReconfigured(MM_EnvironmentBase *env, HeapReconfigReason reason, MM_MemorySubSpace *subspace, void *lowAddress, void *highAddress)
+{
+	MM_ParallelGlobalGC::heapReconfigured(env, reason, subspace, lowAddress, highAddress);
+
+	if ((HEAP_RECONFIG_EXPAND == reason) && (NULL == _memoryPool)) {
+		/* the heap is fixed in size, so this is the initial inflate handing the whole heap to the pool as one entry.
+		 * A collector created after the heap is told without a subspace or range.
+		 */
+		if (NULL == subspace) {
+			/* the flat subspace holds the generic subspace that owns the pool */
+			subspace = _extensions->heap->getDefaultMemorySpace()->getDefaultMemorySubSpace()->getChildren();
+		}
+		_memoryPool = (MM_MemoryPoolAddressOrderedList *)subspace->getMemoryPool();
+		_memoryPool->reset();
+
+		for (uintptr_t index = 0; index < _regionCount; index++) {
+			freeRegion(env, index);
+		}
+		_freeRegionCount = _regionCount;
+		uint8_t *regionsTop = getRegionTop(_regionCount - 1);
+		uint8_t *heapTop = (uint8_t *)_extensions->heap->getHeapTop();
+		if (heapTop > regionsTop) {
+			MM_HeapLinkedFreeHeader::fillWithHoles(regionsTop, (uintptr_t)heapTop - (uintptr_t)regionsTop, _extensions->compressObjectReferences());
+		}
+		_rememberedSet->clear();
+
+		rebuildEden(env);
+	}
+}
+
+void
+MM_RegionalGC::freeRegion(MM_EnvironmentBase *env, uintptr_t index)
+{
+	Region *region = &_regions[index];
+	region->_state = REGION_FREE;
+	region->_liveBytes = 0;
+	region->_inCollectionSet = false;
+	region->_retained = false;
+	MM_HeapLinkedFreeHeader::fillWithHoles(getRegionBase(index), _regionSize, _extensions->compressObjectReferences());
+}
+
+void
+MM_RegionalGC::rebuildEden(MM_EnvironmentBase *env)
+{
+	uintptr_t edenTarget = _extensions->regionalEdenSize >> _regionShift;
+	if (0 == edenTarget) {
+		edenTarget = _regionCount / 4;
+	}
+	edenTarget = OMR_MAX(edenTarget, 1);
+
+	/* hold back enough free regions to copy what is expected to survive the eden, and the old regions evacuated with it */
+	uintptr_t reserve = (uintptr_t)((double)edenTarget * _survivalRate) + 1 + _extensions->regionalOldRegionsPerPause;
+	uintptr_t edenCount = 0;
+	if (_freeRegionCount > reserve) {
+		edenCount = OMR_MIN(edenTarget, _freeRegionCount - reserve);
+	}
+	_globalCollectRequired = (edenCount < OMR_MAX(edenTarget / 4, 1));
+	if (0 == edenCount) {
+		/* a partial pause could not copy the eden, so keep allocating until a global pause and leave it one region to defragment into */
+		edenCount = (1 < _freeRegionCount) ? (_freeRegionCount - 1) : _freeRegionCount;
+	}
+
+	/* the pool was reset by the pause, build one free entry per eden region in address order */
+	MM_HeapLinkedFreeHeader *freeList = NULL;
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	uintptr_t freeBytes = 0;
+	uintptr_t freeEntryCount = 0;
+	_edenRegionCount = 0;
+	for (uintptr_t index = 0; (index < _regionCount) && (_edenRegionCount < edenCount); index++) {
+		Region *region = &_regions[index];
+		if (REGION_FREE == region->_state) {
+			uint8_t *base = getRegionBase(index);
+			_memoryPool->createFreeEntry(env, base, base + _regionSize, previousFreeEntry, NULL);
+			previousFreeEntry = (MM_HeapLinkedFreeHeader *)base;
+			if (NULL == freeList) {
+				freeList = previousFreeEntry;
+			}
+			freeBytes += _regionSize;
+			freeEntryCount += 1;
+			region->_state = REGION_EDEN;
+			_edenRegionCount += 1;
+		}
+	}
+	_freeRegionCount -= _edenRegionCount;
+	_memoryPool->reattachFreeList(env, freeList, freeBytes, freeEntryCount, (0 == freeEntryCount) ? 0 : _regionSize);
+
+	Trc_MM_RegionalGC_rebuildEden(env->getLanguageVMThread(), _edenRegionCount, _freeRegionCount, (uintptr_t)(_survivalRate * 100), _globalCollectRequired ? 1 : 0);
+}
+
+void
+MM_RegionalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap, bool rebuildMarkBits)
+{
+	if (_extensions->trackMutatorThreadCategory) {
+		/* This thread is doing GC work, account for the time spent into the GC bucket */
+		omrthread_set_category(env->getOmrVMThread()->_os_thread, J9THREAD_CATEGORY_SYSTEM_GC_THREAD, J9THREAD_TYPE_SET_GC);
+	}
+
+	/* Tell the GAM to flush its contexts */
+	MM_GlobalAllocationManager *gam = _extensions->globalAllocationManager;
+	if (NULL != gam) {
+		gam->flushAllocationContexts(env);
+	}
+
+	/* Reset memory pools of associated memory spaces, the eden is rebuilt when the pause completes */
+	_extensions->heap->resetSpacesForGarbageCollect(env);
+	_extensions->globalGCStats.clear();
+	_delegate.mainThreadGarbageCollectStarted(env);
+
+	MM_GCCode gcCode = env->_cycleState->_gcCode;
+	if (_globalCollectRequired || gcCode.isExplicitGC() || gcCode.isAggressiveGC()) {
+		globalCollect(env);
+	} else {
+		selectPartialCollectionSet(env);
+		evacuate(env);
+		if (0 != _collectionSetBytes) {
+			double survivalRate = (double)_bytesCopied / (double)_collectionSetBytes;
+			_survivalRate = (_survivalRate + OMR_MIN(survivalRate, 1.0)) / 2;
+		}
+		_partialCollectCount += 1;
+	}
+
+	rebuildEden(env);
+
+	/* every region is walkable when a pause completes, so there is no fix up for heap walks */
+	_delegate.mainThreadGarbageCollectFinished(env, false);
+
+	/* Restart the allocation caches associated to all threads */
+	mainThreadRestartAllocationCaches(env);
+
+	reportGlobalGCCollectComplete(env);
+
+	cleanupAfterGC(env, allocDescription);
+
+	if (_extensions->trackMutatorThreadCategory) {
+		/* Done doing GC, reset the category back to the old one */
+		omrthread_set_category(env->getOmrVMThread()->_os_thread, 0, J9THREAD_TYPE_SET_GC);
+	}
+}
+
+void
+MM_RegionalGC::selectPartialCollectionSet(MM_EnvironmentBase *env)
+{
+	_collectionSetSize = 0;
+	_collectionSetBytes = 0;
+	for (uintptr_t index = 0; index < _regionCount; index++) {
+		Region *region = &_regions[index];
+		if (REGION_EDEN == region->_state) {
+			region->_inCollectionSet = true;
+			_collectionSetSize += 1;
+			_collectionSetBytes += _regionSize;
+		}
+	}
+
+	/* the free regions left after copying the expected eden survivors bound the live bytes of the old regions added */
+	uintptr_t freeBytes = _freeRegionCount << _regionShift;
+	uintptr_t expectedSurvivorBytes = (uintptr_t)((double)_collectionSetBytes * _survivalRate);
+	uintptr_t budget = (freeBytes > expectedSurvivorBytes) ? (freeBytes - expectedSurvivorBytes) : 0;
+	for (uintptr_t count = 0; count < _extensions->regionalOldRegionsPerPause; count++) {
+		uintptr_t best = _regionCount;
+		for (uintptr_t index = 0; index < _regionCount; index++) {
+			Region *region = &_regions[index];
+			if ((REGION_OLD == region->_state)
+				&& !region->_inCollectionSet
+				&& ((region->_liveBytes * 2) <= _regionSize)
+				&& (region->_liveBytes <= budget)
+				&& ((_regionCount == best) || (region->_liveBytes < _regions[best]._liveBytes))
+			) {
+				best = index;
+			}
+		}
+		if (_regionCount == best) {
+			break;
+		}
+		_regions[best]._inCollectionSet = true;
+		_collectionSetSize += 1;
+		_collectionSetBytes += _regions[best]._liveBytes;
+		budget -= _regions[best]._liveBytes;
+	}
+}
+
+void
+MM_RegionalGC::selectDefragmentCollectionSet(MM_EnvironmentBase *env)
+{
+	_collectionSetSize = 0;
+	_collectionSetBytes = 0;
+
+	/* evacuating a region that is at most half live frees at least half a region, take the sparsest first */
+	uintptr_t budget = _freeRegionCount << _regionShift;
+	for (;;) {
+		uintptr_t best = _regionCount;
+		for (uintptr_t index = 0; index < _regionCount; index++) {
+			Region *region = &_regions[index];
+			if ((REGION_OLD == region->_state)
+				&& !region->_inCollectionSet
+				&& ((region->_liveBytes * 2) <= _regionSize)
+				&& (region->_liveBytes <= budget)
+				&& ((_regionCount == best) || (region->_liveBytes < _regions[best]._liveBytes))
+			) {
+				best = index;
+			}
+		}
+		if (_regionCount == best) {
+			break;
+		}
+		_regions[best]._inCollectionSet = true;
+		_collectionSetSize += 1;
+		_collectionSetBytes += _regions[best]._liveBytes;
+		budget -= _regions[best]._liveBytes;
+	}
+}
+
+void
+MM_RegionalGC::evacuate(MM_EnvironmentBase *env)
+{
+	MM_MarkMap *markMap = _markingScheme->getMarkMap();
+	uintptr_t wordsPerRow = _rememberedSet->getWordsPerRow();
+	uintptr_t edenRegions = 0;
+
+	_copyCache = NULL;
+	_scanList = NULL;
+	_retiredList = NULL;
+	_markStackTop = 0;
+	_markStackOverflow = false;
+	_bytesCopied = 0;
+	_copyFailed = false;
+
+	/* the regions that may reference the collection set are the sources remembered for it, less the collection set itself */
+	memset(_sourceRegions, 0, sizeof(uintptr_t) * wordsPerRow);
+	for (uintptr_t index = 0; index < _regionCount; index++) {
+		if (_regions[index]._inCollectionSet) {
+			_rememberedSet->addSources(index, _sourceRegions);
+			markMap->setBitsInRange(env, getRegionBase(index), getRegionTop(index), true);
+		}
+	}
+	for (uintptr_t index = 0; index < _regionCount; index++) {
+		if (_regions[index]._inCollectionSet) {
+			if (REGION_EDEN == _regions[index]._state) {
+				edenRegions += 1;
+			}
+			_sourceRegions[index / J9BITS_BITS_IN_SLOT] &= ~((uintptr_t)1 << (index % J9BITS_BITS_IN_SLOT));
+			/* the references of and into the collection set are remembered again as its survivors are scanned */
+			_rememberedSet->clearRow(index);
+			_rememberedSet->clearColumn(index);
+		}
+	}
+
+	_regionalDelegate.scanRoots(env);
+
+	uintptr_t sourceRegionCount = 0;
+	for (uintptr_t word = 0; word < wordsPerRow; word++) {
+		uintptr_t bits = _sourceRegions[word];
+		for (uintptr_t bit = 0; 0 != bits; bit++, bits >>= 1) {
+			if (0 != (bits & 1)) {
+				scanSourceRegion(env, (word * J9BITS_BITS_IN_SLOT) + bit);
+				sourceRegionCount += 1;
+			}
+		}
+	}
+
+	completeScan(env);
+
+	_regionalDelegate.scanClearable(env);
+
+	/* the destinations become old regions holding what was copied into them */
+	if (NULL != _copyCache) {
+		retireCopyCache(env, _copyCache);
+		_copyCache = NULL;
+	}
+	while (NULL != _retiredList) {
+		MM_CopyScanCacheStandard *cache = _retiredList;
+		_retiredList = (MM_CopyScanCacheStandard *)cache->next;
+		retireCopyCache(env, cache);
+	}
+
+	for (uintptr_t index = 0; index < _regionCount; index++) {
+		Region *region = &_regions[index];
+		if (region->_inCollectionSet) {
+			if (region->_retained) {
+				cleanRetainedRegion(env, index);
+			} else {
+				freeRegion(env, index);
+				_freeRegionCount += 1;
+			}
+		}
+	}
+
+	Trc_MM_RegionalGC_evacuate(env->getLanguageVMThread(), edenRegions, _collectionSetSize - edenRegions, sourceRegionCount, _bytesCopied, _copyFailed ? 1 : 0);
+}
+
+void
+MM_RegionalGC::scanSourceRegion(MM_EnvironmentBase *env, uintptr_t index)
+{
+	/* the column of the region is rebuilt from the references found by the scan */
+	_rememberedSet->clearColumn(index);
+	GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, (omrobjectptr_t)getRegionBase(index), (omrobjectptr_t)getRegionTop(index), false);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = objectIterator.nextObject())) {
+		scanObject(env, objectPtr);
+	}
+}
+
+void
+MM_RegionalGC::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	GC_ObjectScannerState objectScannerState;
+	GC_ObjectScanner *objectScanner = _regionalDelegate.getObjectScanner(env, objectPtr, &objectScannerState);
+	if (NULL != objectScanner) {
+		GC_SlotObject *slotObject = NULL;
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			omrobjectptr_t target = slotObject->readReferenceFromSlot();
+			if (NULL != target) {
+				if (isObjectInCollectionSet(target)) {
+					target = copyObject(env, target);
+					slotObject->writeReferenceToSlot(target);
+				}
+				_rememberedSet->rememberReference(objectPtr, target);
+			}
+		}
+	}
+}
+
+omrobjectptr_t
+MM_RegionalGC::copyObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	MM_ForwardedHeader forwardedHeader(objectPtr, _extensions->compressObjectReferences());
+	if (forwardedHeader.isForwardedPointer()) {
+		return forwardedHeader.getForwardedObject();
+	}
+	if (_markingScheme->getMarkMap()->isBitSet(objectPtr)) {
+		return objectPtr;
+	}
+
+	uintptr_t size = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+	omrobjectptr_t destinationPtr = (omrobjectptr_t)reserveCopySpace(env, size);
+	if (NULL == destinationPtr) {
+		markInPlace(env, objectPtr);
+		return objectPtr;
+	}
+	memcpy((void *)destinationPtr, (void *)objectPtr, size);
+	forwardedHeader.setForwardedObject(destinationPtr);
+	_bytesCopied += size;
+	return destinationPtr;
+}
+
+void
+MM_RegionalGC::copyObjectSlot(MM_EnvironmentBase *env, volatile omrobjectptr_t *slotPtr)
+{
+	omrobjectptr_t objectPtr = *slotPtr;
+	if ((NULL != objectPtr) && isObjectInCollectionSet(objectPtr)) {
+		*slotPtr = copyObject(env, objectPtr);
+	}
+}
+
+omrobjectptr_t
+MM_RegionalGC::getSurvivingObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	MM_ForwardedHeader forwardedHeader(objectPtr, _extensions->compressObjectReferences());
+	if (forwardedHeader.isForwardedPointer()) {
+		return forwardedHeader.getForwardedObject();
+	}
+	if (_markingScheme->getMarkMap()->isBitSet(objectPtr)) {
+		return objectPtr;
+	}
+	return NULL;
+}
+
+void *
+MM_RegionalGC::reserveCopySpace(MM_EnvironmentBase *env, uintptr_t size)
+{
+	if ((NULL == _copyCache) || (size > ((uintptr_t)_copyCache->cacheTop - (uintptr_t)_copyCache->cacheAlloc))) {
+		if ((size > _regionSize) || (0 == _freeRegionCount)) {
+			return NULL;
+		}
+		uintptr_t index = 0;
+		while (REGION_FREE != _regions[index]._state) {
+			index += 1;
+		}
+		Region *region = &_regions[index];
+		region->_state = REGION_OLD;
+		region->_liveBytes = 0;
+		_freeRegionCount -= 1;
+
+		/* the filled destination keeps the objects it has left to scan */
+		if (NULL != _copyCache) {
+			_copyCache->next = _scanList;
+			_scanList = _copyCache;
+		}
+		_copyCache = &_copyCaches[index];
+		_copyCache->reinitCache(getRegionBase(index), getRegionTop(index));
+		_copyCache->next = NULL;
+	}
+
+	void *copy = _copyCache->cacheAlloc;
+	_copyCache->cacheAlloc = (void *)((uintptr_t)copy + size);
+	return copy;
+}
+
+void
+MM_RegionalGC::retireCopyCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandard *cache)
+{
+	uintptr_t used = (uintptr_t)cache->cacheAlloc - (uintptr_t)cache->cacheBase;
+	uintptr_t remaining = (uintptr_t)cache->cacheTop - (uintptr_t)cache->cacheAlloc;
+	if (0 != remaining) {
+		MM_HeapLinkedFreeHeader::fillWithHoles(cache->cacheAlloc, remaining, _extensions->compressObjectReferences());
+	}
+	Region *region = &_regions[getRegionIndex(cache->cacheBase)];
+	region->_state = REGION_OLD;
+	region->_liveBytes = used;
+	cache->reinitCache(NULL, NULL);
+	cache->next = NULL;
+}
+
+void
+MM_RegionalGC::markInPlace(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	_copyFailed = true;
+	_markingScheme->getMarkMap()->setBit(objectPtr);
+	_regions[getRegionIndex(objectPtr)]._retained = true;
+
+	if (_markStackTop == _markStackSize) {
+		uintptr_t newSize = _markStackSize * 2;
+		omrobjectptr_t *newStack = (omrobjectptr_t *)env->getForge()->allocate(sizeof(omrobjectptr_t) * newSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == newStack) {
+			/* the object is marked, it is found again by rescanning the retained regions */
+			_markStackOverflow = true;
+			return;
+		}
+		memcpy(newStack, _markStack, sizeof(omrobjectptr_t) * _markStackTop);
+		env->getForge()->free(_markStack);
+		_markStack = newStack;
+		_markStackSize = newSize;
+	}
+	_markStack[_markStackTop++] = objectPtr;
+}
+
+uintptr_t
+MM_RegionalGC::getCollectionSetObjectSize(omrobjectptr_t objectPtr)
+{
+	GC_ObjectModel *objectModel = &_extensions->objectModel;
+	if (objectModel->isDeadObject(objectPtr)) {
+		return objectModel->getSizeInBytesDeadObject(objectPtr);
+	}
+	MM_ForwardedHeader forwardedHeader(objectPtr, _extensions->compressObjectReferences());
+	if (forwardedHeader.isForwardedPointer()) {
+		return objectModel->getConsumedSizeInBytesWithHeader(forwardedHeader.getForwardedObject());
+	}
+	return objectModel->getConsumedSizeInBytesWithHeader(objectPtr);
+}
+
+void
+MM_RegionalGC::rescanRetainedRegions(MM_EnvironmentBase *env)
+{
+	MM_MarkMap *markMap = _markingScheme->getMarkMap();
+	for (uintptr_t index = 0; index < _regionCount; index++) {
+		if (_regions[index]._retained) {
+			uint8_t *cursor = getRegionBase(index);
+			uint8_t *top = getRegionTop(index);
+			while (cursor < top) {
+				omrobjectptr_t objectPtr = (omrobjectptr_t)cursor;
+				uintptr_t size = getCollectionSetObjectSize(objectPtr);
+				if (markMap->isBitSet(objectPtr)) {
+					scanObject(env, objectPtr);
+				}
+				cursor += size;
+			}
+		}
+	}
+}
+
+void
+MM_RegionalGC::completeScan(MM_EnvironmentBase *env)
+{
+	for (;;) {
+		if (NULL != _scanList) {
+			MM_CopyScanCacheStandard *cache = _scanList;
+			_scanList = (MM_CopyScanCacheStandard *)cache->next;
+			while (cache->isScanWorkAvailable()) {
+				omrobjectptr_t objectPtr = (omrobjectptr_t)cache->scanCurrent;
+				cache->scanCurrent = (void *)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+				scanObject(env, objectPtr);
+			}
+			cache->next = _retiredList;
+			_retiredList = cache;
+		} else if ((NULL != _copyCache) && _copyCache->isScanWorkAvailable()) {
+			/* the scan may fill the destination and move it to the scan list, so step the scan pointer first */
+			omrobjectptr_t objectPtr = (omrobjectptr_t)_copyCache->scanCurrent;
+			_copyCache->scanCurrent = (void *)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+			scanObject(env, objectPtr);
+		} else if (0 != _markStackTop) {
+			_markStackTop -= 1;
+			scanObject(env, _markStack[_markStackTop]);
+		} else if (_markStackOverflow) {
+			_markStackOverflow = false;
+			rescanRetainedRegions(env);
+		} else {
+			break;
+		}
+	}
+}
+
+void
+MM_RegionalGC::cleanRetainedRegion(MM_EnvironmentBase *env, uintptr_t index)
+{
+	MM_MarkMap *markMap = _markingScheme->getMarkMap();
+	GC_ObjectModel *objectModel = &_extensions->objectModel;
+	bool const compressed = _extensions->compressObjectReferences();
+	uint8_t *cursor = getRegionBase(index);
+	uint8_t *top = getRegionTop(index);
+	uint8_t *deadStart = NULL;
+	uintptr_t liveBytes = 0;
+
+	/* copied objects, unmarked objects and holes all become holes, merged into runs ahead of the next live object */
+	while (cursor < top) {
+		omrobjectptr_t objectPtr = (omrobjectptr_t)cursor;
+		uintptr_t size = getCollectionSetObjectSize(objectPtr);
+		bool live = false;
+		if (!objectModel->isDeadObject(objectPtr)) {
+			MM_ForwardedHeader forwardedHeader(objectPtr, compressed);
+			live = !forwardedHeader.isForwardedPointer() && markMap->isBitSet(objectPtr);
+		}
+		if (live) {
+			if (NULL != deadStart) {
+				MM_HeapLinkedFreeHeader::fillWithHoles(deadStart, (uintptr_t)cursor - (uintptr_t)deadStart, compressed);
+				deadStart = NULL;
+			}
+			liveBytes += size;
+		} else if (NULL == deadStart) {
+			deadStart = cursor;
+		}
+		cursor += size;
+	}
+	if (NULL != deadStart) {
+		MM_HeapLinkedFreeHeader::fillWithHoles(deadStart, (uintptr_t)top - (uintptr_t)deadStart, compressed);
+	}
+
+	Region *region = &_regions[index];
+	region->_state = REGION_OLD;
+	region->_liveBytes = liveBytes;
+	region->_inCollectionSet = false;
+	region->_retained = false;
+}
+
+uintptr_t
+MM_RegionalGC::sweepRegion(MM_EnvironmentBase *env, uintptr_t index)
+{
+	bool const compressed = _extensions->compressObjectReferences();
+	uint8_t *base = getRegionBase(index);
+	uint8_t *top = getRegionTop(index);
+	uint8_t *cursor = base;
+	uintptr_t liveBytes = 0;
+
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markingScheme->getMarkMap(), (uintptr_t *)base, (uintptr_t *)top);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		if ((uint8_t *)objectPtr > cursor) {
+			MM_HeapLinkedFreeHeader::fillWithHoles(cursor, (uintptr_t)objectPtr - (uintptr_t)cursor, compressed);
+		}
+		uintptr_t size = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		cursor = (uint8_t *)objectPtr + size;
+		liveBytes += size;
+
+		/* remember the references of the survivor that leave its region */
+		GC_ObjectScannerState objectScannerState;
+		GC_ObjectScanner *objectScanner = _regionalDelegate.getObjectScanner(env, objectPtr, &objectScannerState);
+		if (NULL != objectScanner) {
+			GC_SlotObject *slotObject = NULL;
+			while (NULL != (slotObject = objectScanner->getNextSlot())) {
+				omrobjectptr_t target = slotObject->readReferenceFromSlot();
+				if (NULL != target) {
+					_rememberedSet->rememberReference(objectPtr, target);
+				}
+			}
+		}
+	}
+	if (cursor < top) {
+		MM_HeapLinkedFreeHeader::fillWithHoles(cursor, (uintptr_t)top - (uintptr_t)cursor, compressed);
+	}
+	return liveBytes;
+}
+
+void
+MM_RegionalGC::globalCollect(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+
+	markAll(env, true);
+	_delegate.postMarkProcessing(env);
+
+	reportSweepStart(env);
+	sweepStats->_startTime = omrtime_hires_clock();
+	_rememberedSet->clear();
+	for (uintptr_t index = 0; index < _regionCount; index++) {
+		Region *region = &_regions[index];
+		if (REGION_FREE != region->_state) {
+			uintptr_t liveBytes = sweepRegion(env, index);
+			if (0 == liveBytes) {
+				region->_state = REGION_FREE;
+				region->_liveBytes = 0;
+				_freeRegionCount += 1;
+			} else {
+				region->_state = REGION_OLD;
+				region->_liveBytes = liveBytes;
+			}
+		}
+	}
+	sweepStats->_endTime = omrtime_hires_clock();
+	reportSweepEnd(env);
+
+	/* the mark map is reused for the objects kept in place, the defragmenting evacuation clears it in the collection set */
+	selectDefragmentCollectionSet(env);
+	uintptr_t defragmentedRegions = _collectionSetSize;
+	if (0 != _collectionSetSize) {
+		evacuate(env);
+	}
+	_globalCollectCount += 1;
+
+	Trc_MM_RegionalGC_globalCollect(env->getLanguageVMThread(), _regionCount, _freeRegionCount, defragmentedRegions);
+}
+
+#endif /* defined(OMR_GC_REGIONAL) */
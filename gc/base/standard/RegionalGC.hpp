@@ -0,0 +1,295 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(REGIONALGC_HPP_)
+#define REGIONALGC_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "CopyScanCacheStandard.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "RegionalDelegate.hpp"
+
+#if defined(OMR_GC_REGIONAL)
+
+class MM_MemoryPoolAddressOrderedList;
+class MM_MemorySubSpace;
+class MM_RegionalRememberedSet;
+
+/**
+ * Region based incremental collector. The heap is divided into fixed size regions and mutators only
+ * allocate into eden regions, which are handed to the memory pool one free entry per region. A partial
+ * pause evacuates the eden regions, together with the few old regions holding the most garbage, into
+ * free regions through a copy cache per destination region, then frees the regions it evacuated. The
+ * references into this collection set from the rest of the heap are found through a region granular
+ * remembered set kept by the write barrier, so the work of a partial pause is bounded by the size of
+ * the collection set and of the regions referencing it rather than by the size of the heap.
+ *
+ * Old region garbage is measured by a global pause, which marks the whole heap, sweeps each region
+ * into holes, rebuilds the remembered set and evacuates the sparsest old regions to defragment. It
+ * runs when an explicit or aggressive collect is requested and when partial pauses can no longer keep
+ * enough free regions for the eden.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RegionalGC : public MM_ParallelGlobalGC
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum RegionState {
+		REGION_FREE = 0, /**< the region is a single hole */
+		REGION_EDEN, /**< the region was handed to the memory pool for allocation */
+		REGION_OLD, /**< the region holds objects that survived a pause */
+	};
+
+private:
+	struct Region {
+		RegionState _state;
+		uintptr_t _liveBytes; /**< bytes found live in the region by the last pause that evacuated, swept or filled it */
+		bool _inCollectionSet; /**< the region is evacuated by the current pause */
+		bool _retained; /**< an object of the collection set region could not be copied, the region survives the pause */
+	};
+
+	MM_RegionalDelegate _regionalDelegate;
+	MM_RegionalRememberedSet *_rememberedSet;
+	Region *_regions; /**< table of region states, indexed by region */
+	MM_CopyScanCacheStandard *_copyCaches; /**< one copy cache per region, used while the region is a copy destination */
+	uintptr_t *_sourceRegions; /**< bit per region, set for the regions to scan for references into the collection set */
+	omrobjectptr_t *_markStack; /**< collection set objects that could not be copied and still have to be scanned in place */
+	uintptr_t _markStackSize; /**< capacity of the mark stack */
+	uintptr_t _markStackTop; /**< number of objects on the mark stack */
+	bool _markStackOverflow; /**< an object marked in place did not fit on the mark stack, retained regions have to be rescanned */
+	uint8_t *_heapBase; /**< base of the first region */
+	uintptr_t _regionCount; /**< number of regions in the heap */
+	uintptr_t _regionShift; /**< log2 of the region size */
+	uintptr_t _regionSize; /**< size of a region in bytes */
+	MM_MemoryPoolAddressOrderedList *_memoryPool; /**< memory pool the eden regions are handed to */
+	MM_CopyScanCacheStandard *_copyCache; /**< destination currently copied into */
+	MM_CopyScanCacheStandard *_scanList; /**< filled destinations with objects left to scan */
+	MM_CopyScanCacheStandard *_retiredList; /**< filled destinations that have been scanned */
+	uintptr_t _freeRegionCount; /**< regions in the REGION_FREE state */
+	uintptr_t _edenRegionCount; /**< regions handed to the memory pool since the last pause */
+	uintptr_t _collectionSetSize; /**< regions in the collection set of the current pause */
+	uintptr_t _collectionSetBytes; /**< bytes in use in the collection set when the pause started */
+	uintptr_t _bytesCopied; /**< bytes copied by the current pause */
+	double _survivalRate; /**< decaying average of the fraction of eden bytes that survive a partial pause */
+	bool _copyFailed; /**< an object could not be copied during the current pause */
+	bool _globalCollectRequired; /**< the free regions left for the eden fell below the minimum, the next pause is global */
+	uintptr_t _partialCollectCount; /**< number of partial pauses */
+	uintptr_t _globalCollectCount; /**< number of global pauses */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE uintptr_t getRegionIndex(void *address) { return ((uintptr_t)address - (uintptr_t)_heapBase) >> _regionShift; }
+	MMINLINE uint8_t *getRegionBase(uintptr_t index) { return _heapBase + (index << _regionShift); }
+	MMINLINE uint8_t *getRegionTop(uintptr_t index) { return _heapBase + ((index + 1) << _regionShift); }
+
+	/**
+	 * Turn a region into a single hole.
+	 */
+	void freeRegion(MM_EnvironmentBase *env, uintptr_t index);
+
+	/**
+	 * Hand free regions to the memory pool as the eden for the next mutator interval, and decide whether
+	 * the next pause has to be global.
+	 */
+	void rebuildEden(MM_EnvironmentBase *env);
+
+	/**
+	 * Select the collection set of a partial pause: every eden region and the old regions with the most
+	 * garbage, as far as the free regions can hold what is expected to survive.
+	 */
+	void selectPartialCollectionSet(MM_EnvironmentBase *env);
+
+	/**
+	 * Select the sparsest old regions after a global sweep, as far as the free regions can hold their live bytes.
+	 */
+	void selectDefragmentCollectionSet(MM_EnvironmentBase *env);
+
+	/**
+	 * Copy the live objects out of the collection set and free the regions they were copied out of.
+	 */
+	void evacuate(MM_EnvironmentBase *env);
+
+	/**
+	 * Scan every object of a region outside the collection set that may reference into it, and refine the
+	 * remembered set column of the region to the references found.
+	 */
+	void scanSourceRegion(MM_EnvironmentBase *env, uintptr_t index);
+
+	/**
+	 * Scan the slots of an object, copying the collection set objects they reference, and remember the
+	 * references that leave the region of the object.
+	 */
+	void scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Copy a collection set object, unless it was already copied or kept in place.
+	 * @return the copy, or the object itself if it is kept in place
+	 */
+	omrobjectptr_t copyObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Size of an object or hole found walking a collection set region. The header of a copied object has been
+	 * overwritten by its forwarding pointer, so it is measured through its copy.
+	 */
+	uintptr_t getCollectionSetObjectSize(omrobjectptr_t objectPtr);
+
+	/**
+	 * Scan the objects marked in place in the retained regions again, after the mark stack overflowed.
+	 */
+	void rescanRetainedRegions(MM_EnvironmentBase *env);
+
+	/**
+	 * Scan copied objects and objects marked in place until no work is left.
+	 */
+	void completeScan(MM_EnvironmentBase *env);
+
+	/**
+	 * Reserve space for a copy in the current destination, moving to a new free region when it is full.
+	 * @return the address of the copy, or NULL if no free region is left
+	 */
+	void *reserveCopySpace(MM_EnvironmentBase *env, uintptr_t size);
+
+	/**
+	 * Finish a destination region: fill the space left after its last copy with a hole and make the region old.
+	 */
+	void retireCopyCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandard *cache);
+
+	/**
+	 * Keep a collection set object that could not be copied in place, marking it so it is scanned and its
+	 * region survives the pause.
+	 */
+	void markInPlace(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Fill the dead objects of a retained collection set region with holes and make the region old.
+	 */
+	void cleanRetainedRegion(MM_EnvironmentBase *env, uintptr_t index);
+
+	/**
+	 * Mark the whole heap, then sweep every region into holes, rebuilding the remembered set from the
+	 * live objects and freeing the regions left empty.
+	 */
+	void globalCollect(MM_EnvironmentBase *env);
+
+	/**
+	 * Sweep one region against the mark map.
+	 * @return the live bytes in the region
+	 */
+	uintptr_t sweepRegion(MM_EnvironmentBase *env, uintptr_t index);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	virtual void mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap, bool rebuildMarkBits);
+
+public:
+	static MM_RegionalGC *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	virtual void heapReconfigured(MM_EnvironmentBase *env, HeapReconfigReason reason, MM_MemorySubSpace *subspace, void *lowAddress, void *highAddress);
+
+	/**
+	 * @return true if the object lies in a region evacuated by the current pause
+	 */
+	MMINLINE bool
+	isObjectInCollectionSet(omrobjectptr_t objectPtr)
+	{
+		return _regions[getRegionIndex(objectPtr)]._inCollectionSet;
+	}
+
+	/**
+	 * Copy the collection set object referenced by a slot, if it was not copied yet, and update the slot.
+	 * This is used by the delegate for the root slots, which are outside of the heap.
+	 * @param[in] env the current environment
+	 * @param[in] slotPtr the slot to update
+	 */
+	void copyObjectSlot(MM_EnvironmentBase *env, volatile omrobjectptr_t *slotPtr);
+
+	/**
+	 * Find what became of a collection set object at the end of a pause. This is used by the delegate to
+	 * update or clear references that do not keep objects alive.
+	 * @param[in] env the current environment
+	 * @param[in] objectPtr the object, which must be in the collection set
+	 * @return the copy of the object, the object itself if it was kept in place, or NULL if it did not survive
+	 */
+	omrobjectptr_t getSurvivingObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+	MMINLINE uintptr_t getPartialCollectCount() { return _partialCollectCount; }
+	MMINLINE uintptr_t getGlobalCollectCount() { return _globalCollectCount; }
+	MMINLINE uintptr_t getRegionCount() { return _regionCount; }
+	MMINLINE uintptr_t getFreeRegionCount() { return _freeRegionCount; }
+	MMINLINE uintptr_t getEdenRegionCount() { return _edenRegionCount; }
+
+	/**
+	 * @return the number of regions in the collection set of the last pause
+	 */
+	MMINLINE uintptr_t getCollectionSetSize() { return _collectionSetSize; }
+
+	MM_RegionalGC(MM_EnvironmentBase *env)
+		: MM_ParallelGlobalGC(env)
+		, _regionalDelegate()
+		, _rememberedSet(NULL)
+		, _regions(NULL)
+		, _copyCaches(NULL)
+		, _sourceRegions(NULL)
+		, _markStack(NULL)
+		, _markStackSize(0)
+		, _markStackTop(0)
+		, _markStackOverflow(false)
+		, _heapBase(NULL)
+		, _regionCount(0)
+		, _regionShift(0)
+		, _regionSize(0)
+		, _memoryPool(NULL)
+		, _copyCache(NULL)
+		, _scanList(NULL)
+		, _retiredList(NULL)
+		, _freeRegionCount(0)
+		, _edenRegionCount(0)
+		, _collectionSetSize(0)
+		, _collectionSetBytes(0)
+		, _bytesCopied(0)
+		, _survivalRate(0.5)
+		, _copyFailed(false)
+		, _globalCollectRequired(false)
+		, _partialCollectCount(0)
+		, _globalCollectCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_REGIONAL) */
+
+#endif /* REGIONALGC_HPP_ */
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "RegionalRememberedSet.hpp"
+
+#include <string.h>
+
+#include "Forge.hpp"
+
+#if defined(OMR_GC_REGIONAL)
+
+MM_RegionalRememberedSet *
+MM_RegionalRememberedSet::newInstance(MM_EnvironmentBase *env, void *heapBase, uintptr_t regionCount, uintptr_t regionShift)
+{
+	MM_RegionalRememberedSet *rememberedSet = (MM_RegionalRememberedSet *)env->getForge()->allocate(sizeof(MM_RegionalRememberedSet), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != rememberedSet) {
+		new(rememberedSet) MM_RegionalRememberedSet(env, heapBase, regionCount, regionShift);
+		if (!rememberedSet->initialize(env)) {
+			rememberedSet->kill(env);
+			rememberedSet = NULL;
+		}
+	}
+	return rememberedSet;
+}
+
+void
+MM_RegionalRememberedSet::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_RegionalRememberedSet::initialize(MM_EnvironmentBase *env)
+{
+	uintptr_t size = _regionCount * _wordsPerRow * sizeof(uintptr_t);
+	_rows = (uintptr_t *)env->getForge()->allocate(size, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _rows) {
+		return false;
+	}
+	clear();
+	return true;
+}
+
+void
+MM_RegionalRememberedSet::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _rows) {
+		env->getForge()->free(_rows);
+		_rows = NULL;
+	}
+}
+
+void
+MM_RegionalRememberedSet::addSources(uintptr_t targetIndex, uintptr_t *regionSet)
+{
+	uintptr_t *row = getRow(targetIndex);
+	for (uintptr_t i = 0; i < _wordsPerRow; i++) {
+		regionSet[i] |= row[i];
+	}
+}
+
+uintptr_t
+MM_RegionalRememberedSet::countSources(uintptr_t targetIndex)
+{
+	uintptr_t *row = getRow(targetIndex);
+	uintptr_t count = 0;
+	for (uintptr_t i = 0; i < _wordsPerRow; i++) {
+		count += MM_Bits::populationCount(row[i]);
+	}
+	return count;
+}
+
+void
+MM_RegionalRememberedSet::clearRow(uintptr_t targetIndex)
+{
+	memset(getRow(targetIndex), 0, _wordsPerRow * sizeof(uintptr_t));
+}
+
+void
+MM_RegionalRememberedSet::clearColumn(uintptr_t sourceIndex)
+{
+	uintptr_t wordIndex = sourceIndex / J9BITS_BITS_IN_SLOT;
+	uintptr_t mask = ~((uintptr_t)1 << (sourceIndex % J9BITS_BITS_IN_SLOT));
+	for (uintptr_t targetIndex = 0; targetIndex < _regionCount; targetIndex++) {
+		getRow(targetIndex)[wordIndex] &= mask;
+	}
+}
+
+void
+MM_RegionalRememberedSet::clear()
+{
+	memset(_rows, 0, _regionCount * _wordsPerRow * sizeof(uintptr_t));
+}
+
+#endif /* defined(OMR_GC_REGIONAL) */
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(REGIONALREMEMBEREDSET_HPP_)
+#define REGIONALREMEMBEREDSET_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "Bits.hpp"
+#include "EnvironmentBase.hpp"
+
+#if defined(OMR_GC_REGIONAL)
+
+/**
+ * Region granular remembered set of the regional collector. For every region of the heap it records the
+ * set of other regions that may hold a reference into it, as a row of one bit per source region. The write
+ * barrier sets bits as references are stored, and collections refine the column of every region they scan
+ * so that it only describes the references found. A region is always scanned whole, so the set is precise
+ * enough to find every reference into a collection set without scanning the regions that have none.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RegionalRememberedSet : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t *_rows; /**< one row of _wordsPerRow words per target region */
+	uintptr_t _heapBase; /**< lowest address covered by the set */
+	uintptr_t _regionShift; /**< log2 of the region size */
+	uintptr_t _regionCount; /**< number of regions covered */
+	uintptr_t _wordsPerRow; /**< words needed for a bit per region */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE uintptr_t *getRow(uintptr_t targetIndex) { return _rows + (targetIndex * _wordsPerRow); }
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_RegionalRememberedSet *newInstance(MM_EnvironmentBase *env, void *heapBase, uintptr_t regionCount, uintptr_t regionShift);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getRegionIndex(void *address) { return ((uintptr_t)address - _heapBase) >> _regionShift; }
+	MMINLINE uintptr_t getWordsPerRow() { return _wordsPerRow; }
+
+	/**
+	 * Record that an object in one region references an object in another. This is called by the write
+	 * barrier, so it only writes the row when the bit is not set yet.
+	 * @param[in] sourceObject the object holding the reference
+	 * @param[in] targetObject the referenced object
+	 */
+	MMINLINE void
+	rememberReference(void *sourceObject, void *targetObject)
+	{
+		uintptr_t sourceIndex = getRegionIndex(sourceObject);
+		uintptr_t targetIndex = getRegionIndex(targetObject);
+		if (sourceIndex != targetIndex) {
+			volatile uintptr_t *word = getRow(targetIndex) + (sourceIndex / J9BITS_BITS_IN_SLOT);
+			uintptr_t bit = (uintptr_t)1 << (sourceIndex % J9BITS_BITS_IN_SLOT);
+			if (0 == (*word & bit)) {
+				MM_AtomicOperations::bitOr(word, bit);
+			}
+		}
+	}
+
+	/**
+	 * @return true if the source region may hold a reference into the target region
+	 */
+	MMINLINE bool
+	isRemembered(uintptr_t sourceIndex, uintptr_t targetIndex)
+	{
+		uintptr_t bit = (uintptr_t)1 << (sourceIndex % J9BITS_BITS_IN_SLOT);
+		return 0 != (getRow(targetIndex)[sourceIndex / J9BITS_BITS_IN_SLOT] & bit);
+	}
+
+	/**
+	 * Add the regions that may reference the target region to a set of regions.
+	 * @param[in] targetIndex index of the target region
+	 * @param[in,out] regionSet getWordsPerRow() words with a bit per region
+	 */
+	void addSources(uintptr_t targetIndex, uintptr_t *regionSet);
+
+	/**
+	 * @return the number of regions that may reference the target region
+	 */
+	uintptr_t countSources(uintptr_t targetIndex);
+
+	/**
+	 * Forget all references into a region.
+	 */
+	void clearRow(uintptr_t targetIndex);
+
+	/**
+	 * Forget all references out of a region, before it is rescanned or once it is empty.
+	 */
+	void clearColumn(uintptr_t sourceIndex);
+
+	/**
+	 * Forget all references, before the set is rebuilt from a complete scan of the heap.
+	 */
+	void clear();
+
+	MM_RegionalRememberedSet(MM_EnvironmentBase *env, void *heapBase, uintptr_t regionCount, uintptr_t regionShift)
+		: MM_BaseVirtual()
+		, _rows(NULL)
+		, _heapBase((uintptr_t)heapBase)
+		, _regionShift(regionShift)
+		, _regionCount(regionCount)
+		, _wordsPerRow((regionCount + J9BITS_BITS_IN_SLOT - 1) / J9BITS_BITS_IN_SLOT)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_REGIONAL) */
+
+#endif /* REGIONALREMEMBEREDSET_HPP_ */
@@ -46,6 +46,7 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
 #include "AllocateDescription.hpp"
+#include "AllocationLifetimeSampler.hpp"
 #include "AtomicOperations.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
@@ -236,6 +237,17 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	/* Work stealing relies on only the owner pushing to its deque, which does not hold for Concurrent Scavenger
+	 * (GC threads flush copy caches on behalf of mutator threads) - it is therefore only used for STW scavenges */
+	if (_extensions->scavengerWorkStealing && !IS_CONCURRENT_ENABLED) {
+		_scanCacheDequeOwnersSize = _extensions->gcThreadCount;
+		_scanCacheDequeOwners = (MM_EnvironmentStandard * volatile *)env->getForge()->allocate(_scanCacheDequeOwnersSize * sizeof(MM_EnvironmentStandard *), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _scanCacheDequeOwners) {
+			return false;
+		}
+		memset((void *)_scanCacheDequeOwners, 0, _scanCacheDequeOwnersSize * sizeof(MM_EnvironmentStandard *));
+	}
+
 	/* do not spin when acquiring monitor to notify blocking thread about new work */
 	((J9ThreadAbstractMonitor *)_scanCacheMonitor)->flags &= ~J9THREAD_MONITOR_TRY_ENTER_SPIN;
 
@@ -296,17 +308,35 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (0 != _extensions->allocationLifetimeSamplingInterval) {
+		_extensions->allocationLifetimeSampler = MM_AllocationLifetimeSampler::newInstance(env);
+		if (NULL == _extensions->allocationLifetimeSampler) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
 void
 MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _extensions->allocationLifetimeSampler) {
+		_extensions->allocationLifetimeSampler->report(env);
+		_extensions->allocationLifetimeSampler->kill(env);
+		_extensions->allocationLifetimeSampler = NULL;
+	}
+
 	_delegate.tearDown(env);
 
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _scanCacheDequeOwners) {
+		env->getForge()->free((void *)_scanCacheDequeOwners);
+		_scanCacheDequeOwners = NULL;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -335,6 +365,20 @@ MM_Scavenger::reinitializeForRestore(MM_EnvironmentBase *env)
 		rc = false;
 	}
 
+	/* the restored thread pool may be larger than the one the deque owner table was sized for */
+	if (rc && (NULL != _scanCacheDequeOwners) && (_extensions->gcThreadCount > _scanCacheDequeOwnersSize)) {
+		uintptr_t newOwnersSize = _extensions->gcThreadCount;
+		MM_EnvironmentStandard * volatile *newOwners = (MM_EnvironmentStandard * volatile *)env->getForge()->allocate(newOwnersSize * sizeof(MM_EnvironmentStandard *), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == newOwners) {
+			rc = false;
+		} else {
+			memset((void *)newOwners, 0, newOwnersSize * sizeof(MM_EnvironmentStandard *));
+			env->getForge()->free((void *)_scanCacheDequeOwners);
+			_scanCacheDequeOwners = newOwners;
+			_scanCacheDequeOwnersSize = newOwnersSize;
+		}
+	}
+
 	return rc;
 }
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
@@ -402,6 +446,12 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	/* Reinitialize the copy scan caches */
 	Assert_MM_true(_scavengeCacheFreeList.areAllCachesReturned());
 	Assert_MM_true(0 == _cachedEntryCount);
+
+	if (isScanCacheWorkStealingEnabled()) {
+		/* Only the threads taking part in this scavenge register their deques (see workerSetupForGC()). Which worker IDs
+		 * take part varies from cycle to cycle, and threads from an earlier cycle may since have been shut down. */
+		memset((void *)_scanCacheDequeOwners, 0, _scanCacheDequeOwnersSize * sizeof(MM_EnvironmentStandard *));
+	}
 	_extensions->copyScanRatio.reset(env, true);
 
 	/* Cache heap ranges for fast "valid object" checks (this can change in an expanding heap situation, so we refetch every cycle) */
@@ -501,6 +551,15 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	Assert_MM_false(env->_loaAllocation);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderBase);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderTop);
+
+	if (isScanCacheWorkStealingEnabled()) {
+		uintptr_t workerID = env->getWorkerID();
+		Assert_MM_true(env->_scanCacheDeque.isEmpty());
+		Assert_MM_true(workerID < _scanCacheDequeOwnersSize);
+		/* worker IDs of the threads in a task need not be dense, so the owner table is indexed by worker ID over the whole pool */
+		_scanCacheDequeOwners[workerID] = env;
+		env->_scanCacheDeque.setStealSeed((((workerID + 1) * 0x9E3779B9) ^ _extensions->scavengerStats._gcCount) | 1);
+	}
 }
 
 uintptr_t
@@ -815,6 +874,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_releaseScanListCount += scavStats->_releaseScanListCount;
 	finalGCStats->_acquireListLockCount += scavStats->_acquireListLockCount;
 	finalGCStats->_aliasToCopyCacheCount += scavStats->_aliasToCopyCacheCount;
+	finalGCStats->_scanCacheStealCount += scavStats->_scanCacheStealCount;
+	finalGCStats->_scanCacheFailedStealCount += scavStats->_scanCacheFailedStealCount;
+	finalGCStats->_scanCacheDequeOverflowCount += scavStats->_scanCacheDequeOverflowCount;
 	finalGCStats->_arraySplitCount += scavStats->_arraySplitCount;
 	finalGCStats->_arraySplitAmount += scavStats->_arraySplitAmount;
 	finalGCStats->_totalDeepStructures += scavStats->_totalDeepStructures;
@@ -1067,7 +1129,7 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 		cacheSize = OMR_MIN(cacheSizeBasedOnWaitingCount, cacheSize);
 	}
 
-	env->approxScanCacheCount = _scavengeCacheScanList.getApproximateEntryCount();
+	env->approxScanCacheCount = getApproximateScanCacheCount(env);
 	if (env->approxScanCacheCount < threadCount) {
 		uintptr_t cacheSizeBasedOnScanCacheCount = calculateCopyScanCacheSizeForQueueLength(maxCacheSize, threadCount, env->approxScanCacheCount);
 		cacheSize = OMR_MIN(cacheSizeBasedOnScanCacheCount, cacheSize);
@@ -2345,12 +2407,13 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
  	while (!doneFlag && !shouldAbortScanLoop(env)) {
- 		while (_cachedEntryCount > 0) {
+ 		while (isScanCacheWorkQueued(env)) {
  			cache = getNextScanCacheFromList(env);
 
 			if (NULL != cache) {
- 				/* Check if there are threads waiting that should be notified because of pending entries */
- 				if((_cachedEntryCount > 0) && _waitingCount) {
+ 				/* Check if there are threads waiting that should be notified because of pending entries, on the
+				 * scan list or on this thread's deque (other owners notify when they push to theirs) */
+ 				if ((0 != _waitingCount) && ((0 != _cachedEntryCount) || (isScanCacheWorkStealingEnabled() && !env->_scanCacheDeque.isEmpty()))) {
 					if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
 						if(0 != _waitingCount) {
 							omrthread_monitor_notify(_scanCacheMonitor);
@@ -2371,7 +2434,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 		_waitingCount += 1;
 
 		if(doneIndex == _doneIndex) {
-			if((env->_currentTask->getThreadCount() == _waitingCount) && (0 == _cachedEntryCount)) {
+			if((env->_currentTask->getThreadCount() == _waitingCount) && !isScanCacheWorkQueued(env)) {
 				flushBuffersForGetNextScanCache(env, true);
 
 				if (shouldDoFinalNotify(env)) {
@@ -2382,7 +2445,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 					env->_scavengerStats.addToNotifyStallTime(notifyStartTime, omrtime_hires_clock());
 				}
 			} else {
-				while((0 == _cachedEntryCount) && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
+				while(!isScanCacheWorkQueued(env) && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
 					flushBuffersForGetNextScanCache(env);
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 					uint64_t waitEndTime, waitStartTime;
@@ -3615,7 +3678,13 @@ MM_Scavenger::returnEmptyCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
-	_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	if (!isScanCacheWorkStealingEnabled()) {
+		_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	} else if (!env->_scanCacheDeque.push(newCacheEntry)) {
+		/* deque is full, overflow to the shared scan list */
+		env->_scavengerStats._scanCacheDequeOverflowCount += 1;
+		_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	}
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
 		if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
@@ -3694,7 +3763,96 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard *env, GC_SlotObject *scann
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 {
-	return _scavengeCacheScanList.popCache(env);
+	MM_CopyScanCacheStandard *cache = NULL;
+	if (isScanCacheWorkStealingEnabled()) {
+		/* own deque first (most recently pushed, likely still in cache), then other threads' deques, then the overflow list */
+		cache = env->_scanCacheDeque.pop();
+		if (NULL == cache) {
+			cache = stealScanCache(env);
+		}
+	}
+	if (NULL == cache) {
+		cache = _scavengeCacheScanList.popCache(env);
+	}
+	return cache;
+}
+
+MMINLINE MM_CopyScanCacheStandard *
+MM_Scavenger::stealScanCache(MM_EnvironmentStandard *env)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+	if ((env->_currentTask->getThreadCount() > 1) && (_scanCacheDequeOwnersSize > 1)) {
+		uintptr_t workerID = env->getWorkerID();
+		for (uintptr_t attempt = 0; (NULL == cache) && (attempt < _extensions->scavengerStealAttempts); attempt++) {
+			/* probe from a random worker ID up to the next one taking part in the task (IDs of idle pool threads are unregistered) */
+			uintptr_t victimID = env->_scanCacheDeque.nextVictim(workerID, _scanCacheDequeOwnersSize);
+			MM_EnvironmentStandard *victim = NULL;
+			for (uintptr_t probe = 0; (NULL == victim) && (probe < _scanCacheDequeOwnersSize); probe++) {
+				if (victimID != workerID) {
+					victim = _scanCacheDequeOwners[victimID];
+				}
+				victimID = (victimID + 1) % _scanCacheDequeOwnersSize;
+			}
+			if (NULL != victim) {
+				bool contended = false;
+				cache = victim->_scanCacheDeque.steal(&contended);
+				if (NULL != cache) {
+					env->_scavengerStats._scanCacheStealCount += 1;
+				} else {
+					env->_scavengerStats._scanCacheFailedStealCount += 1;
+				}
+			}
+		}
+	}
+	return cache;
+}
+
+bool
+MM_Scavenger::isScanCacheWorkQueued(MM_EnvironmentStandard *env)
+{
+	bool workQueued = (0 != _cachedEntryCount);
+	if (!workQueued && isScanCacheWorkStealingEnabled()) {
+		workQueued = !env->_scanCacheDeque.isEmpty();
+		for (uintptr_t index = 0; !workQueued && (index < _scanCacheDequeOwnersSize); index++) {
+			MM_EnvironmentStandard *owner = _scanCacheDequeOwners[index];
+			workQueued = (NULL != owner) && !owner->_scanCacheDeque.isEmpty();
+		}
+	}
+	return workQueued;
+}
+
+uintptr_t
+MM_Scavenger::getApproximateScanCacheCount(MM_EnvironmentStandard *env)
+{
+	uintptr_t count = _scavengeCacheScanList.getApproximateEntryCount();
+	if (isScanCacheWorkStealingEnabled()) {
+		for (uintptr_t index = 0; index < _scanCacheDequeOwnersSize; index++) {
+			MM_EnvironmentStandard *owner = _scanCacheDequeOwners[index];
+			if (NULL != owner) {
+				count += owner->_scanCacheDeque.getApproximateEntryCount();
+			}
+		}
+	}
+	return count;
+}
+
+void
+MM_Scavenger::flushScanCacheDeques(MM_EnvironmentStandard *env)
+{
+	if (isScanCacheWorkStealingEnabled()) {
+		for (uintptr_t index = 0; index < _scanCacheDequeOwnersSize; index++) {
+			MM_EnvironmentStandard *owner = _scanCacheDequeOwners[index];
+			if (NULL != owner) {
+				MM_CopyScanCacheStandard *cache = NULL;
+				bool contended = false;
+				/* steal, rather than pop, since the deque is not owned by the current thread */
+				while (NULL != (cache = owner->_scanCacheDeque.steal(&contended))) {
+					flushCache(env, cache);
+				}
+				Assert_MM_false(contended);
+			}
+		}
+	}
 }
 
 /**
@@ -4116,6 +4274,7 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
 				flushCache(env, cache);
 			}
+			flushScanCacheDeques(env);
 		}
 		Assert_MM_true(0 == _cachedEntryCount);
 
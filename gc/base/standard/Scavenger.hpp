@@ -117,6 +117,8 @@ private:
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
+	MM_EnvironmentStandard * volatile *_scanCacheDequeOwners; /**< table, indexed by worker ID over the whole thread pool, of the environments of the GC threads taking part in the current scavenge (NULL if work stealing is disabled) */
+	uintptr_t _scanCacheDequeOwnersSize; /**< number of entries in _scanCacheDequeOwners */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
@@ -437,6 +439,41 @@ public:
 	MMINLINE uintptr_t copyCacheDistanceMetric(MM_CopyScanCacheStandard* cache);
 
 	MMINLINE MM_CopyScanCacheStandard *getNextScanCacheFromList(MM_EnvironmentStandard *env);
+
+	/**
+	 * Try to steal a scan cache from the deques of randomly chosen GC threads participating in the current task.
+	 * Participants need not have consecutive worker IDs, so victims are picked from the whole owner table.
+	 * @param env[in] the current GC thread
+	 * @return the stolen cache, or NULL if no victim had work (or all races were lost)
+	 */
+	MMINLINE MM_CopyScanCacheStandard *stealScanCache(MM_EnvironmentStandard *env);
+
+	/**
+	 * Check whether any scan cache is queued, either on the scan list or on any deque of the threads in the current task.
+	 * Walks the whole owner table when work stealing is enabled and the thread's own deque is empty, so it is meant for the
+	 * (infrequent) stall and termination decisions.
+	 * @param env[in] the current GC thread
+	 * @return true if scan work is queued
+	 */
+	bool isScanCacheWorkQueued(MM_EnvironmentStandard *env);
+
+	/**
+	 * @return approximate number of scan caches queued on the scan list and on the deques (meant for heuristics only)
+	 */
+	uintptr_t getApproximateScanCacheCount(MM_EnvironmentStandard *env);
+
+	/**
+	 * Flush all scan caches left in the deques of the threads of the current task. Must only be called
+	 * when no other thread accesses the deques (e.g. by the main thread while backing out).
+	 * @param env[in] the current GC thread
+	 */
+	void flushScanCacheDeques(MM_EnvironmentStandard *env);
+
+	MMINLINE bool
+	isScanCacheWorkStealingEnabled()
+	{
+		return (NULL != _scanCacheDequeOwners);
+	}
 	/**
 	 * Called at the end of a task to return empty caches to the global free pool
 	 */
@@ -964,6 +1001,8 @@ public:
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
+		, _scanCacheDequeOwners(NULL)
+		, _scanCacheDequeOwnersSize(0)
 		, _cachesPerThread(0)
 		, _scanCacheMonitor(NULL)
 		, _freeCacheMonitor(NULL)
@@ -30,6 +30,9 @@
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ObjectModel.hpp"
+#if defined(OMR_GC_REGIONAL)
+#include "RegionalRememberedSet.hpp"
+#endif /* defined(OMR_GC_REGIONAL) */
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
 
@@ -39,8 +42,8 @@ struct OMR_VMThread;
  * Out-of-line write barrier. In the absence of other (equivalent inline) write barrier, this method must
  * be called whenever a child reference is assigned to a parent slot.
  *
- * To support OMR concurrent marking and/or generational collectors, this method calls the necessary
- * concurrent and generational write barriers.
+ * To support OMR concurrent marking, generational and/or regional collectors, this method calls the necessary
+ * concurrent, generational and inter-region write barriers.
  *
  * @param omrThread The thread making the assignment of child reference into parent slot
  * @param parentObject the parent object
@@ -49,7 +52,7 @@ struct OMR_VMThread;
 MMINLINE void
 standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrobjectptr_t childObject)
 {
-#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_REGIONAL)
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -67,7 +70,12 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 		extensions->cardTable->dirtyCard(env, parentObject);
 	}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_REGIONAL)
+	if ((NULL != extensions->regionalRememberedSet) && (NULL != childObject)) {
+		extensions->regionalRememberedSet->rememberReference(parentObject, childObject);
+	}
+#endif /* defined(OMR_GC_REGIONAL) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_REGIONAL) */
 }
 
 /**
@@ -89,4 +97,76 @@ standardWriteBarrierStore(OMR_VMThread *omrThread, omrobjectptr_t parentObject,
 	standardWriteBarrier(omrThread, parentObject, childObject);
 }
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+/**
+ * Out-of-line read barrier for the concurrent scavenger. Roots are scavenged when a concurrent scavenge
+ * starts, so a mutator can only come across an object that is still in evacuate space by loading it from
+ * a heap slot or from a weak or indirect reference that is not a root. While a concurrent scavenge is in
+ * progress this method must be called on such slots before the loaded reference is used.
+ *
+ * If the referenced object is in evacuate space it is copied (or, if it was already copied, the forwarding
+ * pointer installed in its header is followed) and the slot is updated to the new location. If the object
+ * cannot be copied it is self-forwarded and the cycle is aborted, as it would be for a GC thread. Copy caches
+ * used by the mutator are deactivated straight away, so that GC threads can take them over for scanning.
+ *
+ * @param omrThread The thread loading the reference
+ * @param slotObject The slot holding the reference
+ */
+MMINLINE void
+standardReadBarrier(OMR_VMThread *omrThread, GC_SlotObject *slotObject)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isConcurrentScavengerEnabled() && extensions->scavenger->isConcurrentCycleInProgress()) {
+		omrobjectptr_t objectPtr = slotObject->readReferenceFromSlot();
+		if ((NULL != objectPtr) && extensions->scavenger->isObjectInEvacuateMemory(objectPtr)) {
+			MM_EnvironmentStandard *envStandard = MM_EnvironmentStandard::getEnvironment(env);
+			extensions->scavenger->copyObjectSlot(envStandard, slotObject);
+			extensions->scavenger->threadReleaseCaches(envStandard, envStandard, false, false);
+		}
+	}
+}
+
+/**
+ * Read barrier for a full width reference held outside of the heap, such as an entry in a weak or
+ * indirect table that is not scanned as a root.
+ *
+ * @param omrThread The thread loading the reference
+ * @param referencePtr Points to the reference
+ * @see standardReadBarrier(OMR_VMThread *, GC_SlotObject *)
+ */
+MMINLINE void
+standardReadBarrier(OMR_VMThread *omrThread, volatile omrobjectptr_t *referencePtr)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isConcurrentScavengerEnabled() && extensions->scavenger->isConcurrentCycleInProgress()) {
+		omrobjectptr_t objectPtr = *referencePtr;
+		if ((NULL != objectPtr) && extensions->scavenger->isObjectInEvacuateMemory(objectPtr)) {
+			MM_EnvironmentStandard *envStandard = MM_EnvironmentStandard::getEnvironment(env);
+			extensions->scavenger->copyObjectSlot(envStandard, referencePtr);
+			extensions->scavenger->threadReleaseCaches(envStandard, envStandard, false, false);
+		}
+	}
+}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+
+/**
+ * Convenience method to load a child reference from a parent slot, calling the read barrier first
+ * if one is required.
+ *
+ * @param omrThread The thread loading the child reference
+ * @param parentSlot Points to the slot in the parent object that holds the child reference
+ * @return the child reference
+ */
+MMINLINE omrobjectptr_t
+standardReadBarrierLoad(OMR_VMThread *omrThread, fomrobject_t *parentSlot)
+{
+	GC_SlotObject slotObject(omrThread->_vm, parentSlot);
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	standardReadBarrier(omrThread, &slotObject);
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+	return slotObject.readReferenceFromSlot();
+}
+
 #endif /* STANDARDWRITEBARRIER_HPP_ */
@@ -117,6 +117,7 @@ typedef U_8 Card;
 #define OMRVMSTATE_GC_TGC (J9VMSTATE_GC | 0x0024)
 #define OMRVMSTATE_GC_DISPATCHER_IDLE (J9VMSTATE_GC | 0x0025)
 #define OMRVMSTATE_GC_CONCURRENT_SCAVENGER (J9VMSTATE_GC | 0x0026)
+#define OMRVMSTATE_GC_PRE_TOUCH_HEAP (J9VMSTATE_GC | 0x0027)
 
 #define OMRVMSTATE_GC_CARD_CLEANER_FOR_MARKING (J9VMSTATE_GC | 0x0101)
 #define OMRVMSTATE_GC_COPY_FORWARD_GMP_CARD_CLEANER (J9VMSTATE_GC | 0x0102)
@@ -43,6 +43,7 @@
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
 #include "ParallelDispatcher.hpp"
+#include "ParallelPreTouchTask.hpp"
 #include "VerboseManager.hpp"
 
 /* ****************
@@ -220,6 +221,9 @@ OMR_GC_InitializeDispatcherThreads(OMR_VMThread* omrVMThread)
 	if (!extensions->dispatcher->startUpThreads()) {
 		extensions->dispatcher->shutDownThreads();
 		rc = OMR_ERROR_INTERNAL;
+	} else if (extensions->preTouchHeap) {
+		/* fault in the initial heap now, with every GC thread, rather than one page at a time as the mutators first allocate */
+		MM_ParallelPreTouchTask::preTouchHeap(MM_EnvironmentBase::getEnvironment(omrVMThread));
 	}
 
 	return rc;
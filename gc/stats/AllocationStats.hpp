@@ -42,6 +42,7 @@ public:
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhRefreshCountHot; 	/**< Number of fresh refreshes made by threads classified as hot allocators (adaptiveTLHSizing only). */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -65,6 +66,11 @@ public:
 	uintptr_t tlhBytesAllocated() { return _tlhAllocatedFresh - _tlhDiscardedBytes; }
 	uintptr_t tlhBytesAllocatedUsed() { return _tlhAllocatedUsed; }
 	uintptr_t nontlhBytesAllocated() { return _allocationBytes; }
+
+	/**
+	 * @return the fraction of the fresh TLH memory which was left unused in abandoned TLH tails
+	 */
+	double tlhWasteRatio() { return (0 == _tlhAllocatedFresh) ? 0.0 : ((double)_tlhDiscardedBytes / (double)_tlhAllocatedFresh); }
 #endif
 
 	/* return bytesAllocated includes new refreshed TLH, if includeJustRefreshedTLH == true(default)
@@ -109,6 +115,7 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhRefreshCountHot(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
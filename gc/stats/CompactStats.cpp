@@ -40,6 +40,8 @@ MM_CompactStats::clear()
 	_movedBytes = 0;
 	
 	_fixupObjects = 0;
+	_partialCompactBytes = 0;
+	_slidingCompaction = false;
 	_setupStartTime = 0;
 	_setupEndTime = 0;
 	_moveStartTime = 0;
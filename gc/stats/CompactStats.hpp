@@ -50,6 +50,8 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	uintptr_t _partialCompactBytes; /**< size of the address range a partial compaction evacuated, 0 if the whole heap was compacted */
+	bool _slidingCompaction; /**< true if the compaction slid objects and forwarded them through block summaries */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
 	uint64_t _moveStartTime;
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#include "FragmentationForecaster.hpp"
+
+#if defined(OMR_GC_MODRON_STANDARD)
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+#include "spacesaving.h"
+
+#include "LargeObjectAllocateStats.hpp"
+
+uintptr_t
+MM_FragmentationForecaster::computeLargeAllocateSize(MM_LargeObjectAllocateStats *stats, uintptr_t percentile)
+{
+	/* prefer the history average, the current round is only populated between two collections */
+	OMRSpaceSaving *spaceSaving = stats->getSpaceSavingSizesAveragePercent();
+	if (0 == spaceSavingGetCurSize(spaceSaving)) {
+		spaceSaving = stats->getSpaceSavingSizes();
+	}
+
+	uintptr_t sizes = spaceSavingGetCurSize(spaceSaving);
+	uint64_t totalWeight = 0;
+	for (uintptr_t k = 1; k <= sizes; k++) {
+		totalWeight += spaceSavingGetKthMostFreqCount(spaceSaving, k);
+	}
+
+	uintptr_t result = 0;
+	if (0 != totalWeight) {
+		uint64_t threshold = (totalWeight * percentile) / 100;
+		/* only the top few sizes are tracked, so a quadratic scan is cheaper than sorting them */
+		for (uintptr_t k = 1; k <= sizes; k++) {
+			uintptr_t candidate = (uintptr_t)spaceSavingGetKthMostFreq(spaceSaving, k);
+			if ((0 != result) && (candidate >= result)) {
+				continue;
+			}
+			uint64_t weightAtOrBelow = 0;
+			for (uintptr_t j = 1; j <= sizes; j++) {
+				if ((uintptr_t)spaceSavingGetKthMostFreq(spaceSaving, j) <= candidate) {
+					weightAtOrBelow += spaceSavingGetKthMostFreqCount(spaceSaving, j);
+				}
+			}
+			if (weightAtOrBelow >= threshold) {
+				result = candidate;
+			}
+		}
+	}
+
+	return result;
+}
+
+void
+MM_FragmentationForecaster::update(MM_LargeObjectAllocateStats *stats, uintptr_t horizon)
+{
+	uintptr_t largestFreeEntry = stats->getLargestFreeEntry();
+	_freeMemory = stats->getFreeMemory();
+	_largeAllocateSize = computeLargeAllocateSize(stats, FRAGMENTATION_FORECAST_PERCENTILE);
+	if (0 != _largeAllocateSize) {
+		/* free entries are only known to the lower bound of their size class, compare like with like */
+		_largeAllocateSize = OMR_MAX(stats->getLargeObjectThreshold(), stats->getSizeClassSizes(stats->getSizeClassIndex(_largeAllocateSize)));
+	}
+
+	_largestFreeEntryHistory[_nextSample] = largestFreeEntry;
+	_nextSample = (_nextSample + 1) % FRAGMENTATION_FORECAST_SAMPLES;
+	if (_sampleCount < FRAGMENTATION_FORECAST_SAMPLES) {
+		_sampleCount += 1;
+	}
+
+	_projectedLargestFreeEntry = largestFreeEntry;
+	if (_sampleCount > 1) {
+		/* once the history wraps the oldest sample is the one about to be overwritten */
+		uintptr_t oldestSample = (_sampleCount < FRAGMENTATION_FORECAST_SAMPLES) ? 0 : _nextSample;
+		intptr_t slope = ((intptr_t)largestFreeEntry - (intptr_t)_largestFreeEntryHistory[oldestSample]) / (intptr_t)(_sampleCount - 1);
+		if (slope < 0) {
+			uintptr_t decline = (uintptr_t)(-slope) * horizon;
+			_projectedLargestFreeEntry = (decline < largestFreeEntry) ? (largestFreeEntry - decline) : 0;
+		}
+	}
+}
+
+uintptr_t
+MM_FragmentationForecaster::getCompactionTarget()
+{
+	uintptr_t target = 0;
+
+	/* compaction can not produce an entry larger than the free memory there is */
+	if ((0 != _largeAllocateSize) && (_projectedLargestFreeEntry < _largeAllocateSize) && (_freeMemory >= _largeAllocateSize)) {
+		target = _largeAllocateSize;
+	}
+
+	return target;
+}
+
+#endif /* OMR_GC_MODRON_COMPACTION */
+#endif /* OMR_GC_MODRON_STANDARD */
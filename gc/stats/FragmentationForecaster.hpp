@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(FRAGMENTATIONFORECASTER_HPP_)
+#define FRAGMENTATIONFORECASTER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#if defined(OMR_GC_MODRON_STANDARD)
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+#include "Base.hpp"
+
+class MM_LargeObjectAllocateStats;
+
+#define FRAGMENTATION_FORECAST_SAMPLES 4
+#define FRAGMENTATION_FORECAST_PERCENTILE 90
+
+/**
+ * Predicts when the largest free entry of a memory pool will no longer satisfy the large allocations observed
+ * on it. The largest free entry is sampled from the free entry size class stats after every global sweep, and its
+ * trend over the last few samples is projected a number of collections ahead. The projection is compared to a byte
+ * weighted percentile of the large allocation sizes, so that a partial compaction can be run before an allocation
+ * actually fails.
+ * @ingroup GC_Stats
+ */
+class MM_FragmentationForecaster : public MM_Base
+{
+private:
+	uintptr_t _largestFreeEntryHistory[FRAGMENTATION_FORECAST_SAMPLES]; /**< largest free entry after the most recent sweeps, oldest first once wrapped */
+	uintptr_t _sampleCount; /**< number of valid samples in _largestFreeEntryHistory */
+	uintptr_t _nextSample; /**< index of the slot the next sample is stored in */
+	uintptr_t _largeAllocateSize; /**< FRAGMENTATION_FORECAST_PERCENTILE of the large allocation sizes, weighted by bytes allocated */
+	uintptr_t _projectedLargestFreeEntry; /**< largest free entry expected after the forecast horizon */
+	uintptr_t _freeMemory; /**< free memory represented by the size class stats at the last sample */
+
+	/**
+	 * Find the smallest size such that at least percentile percent of the bytes allocated by large allocations
+	 * were allocated with that size or smaller.
+	 * @return the size, or 0 if no large allocations were recorded
+	 */
+	uintptr_t computeLargeAllocateSize(MM_LargeObjectAllocateStats *stats, uintptr_t percentile);
+
+public:
+	/**
+	 * Sample the pool's stats and recompute the forecast. Must be called after the free entry stats have been merged.
+	 * @param stats the large object allocate stats of the pool
+	 * @param horizon number of global collections to project the largest free entry ahead
+	 */
+	void update(MM_LargeObjectAllocateStats *stats, uintptr_t horizon);
+
+	/**
+	 * @return the size of the free entry a partial compaction should produce, or 0 if the forecast does not call for one
+	 */
+	uintptr_t getCompactionTarget();
+
+	/**
+	 * Forget the sampled trend, used once a compaction has reshaped the free list.
+	 */
+	void reset()
+	{
+		_sampleCount = 0;
+		_nextSample = 0;
+		_projectedLargestFreeEntry = 0;
+	}
+
+	uintptr_t getLargeAllocateSize() { return _largeAllocateSize; }
+	uintptr_t getProjectedLargestFreeEntry() { return _projectedLargestFreeEntry; }
+
+	MM_FragmentationForecaster()
+		: MM_Base()
+		, _sampleCount(0)
+		, _nextSample(0)
+		, _largeAllocateSize(0)
+		, _projectedLargestFreeEntry(0)
+		, _freeMemory(0)
+	{
+		for (uintptr_t i = 0; i < FRAGMENTATION_FORECAST_SAMPLES; i++) {
+			_largestFreeEntryHistory[i] = 0;
+		}
+	}
+};
+
+#endif /* OMR_GC_MODRON_COMPACTION */
+#endif /* OMR_GC_MODRON_STANDARD */
+#endif /* FRAGMENTATIONFORECASTER_HPP_ */
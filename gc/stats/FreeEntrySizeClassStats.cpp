@@ -295,6 +295,35 @@ MM_FreeEntrySizeClassStats::getPageAlignedFreeMemory(const uintptr_t sizeClassSi
 	return resusableFreeMemory;
 }
 
+uintptr_t
+MM_FreeEntrySizeClassStats::getLargestFreeEntry(const uintptr_t sizeClassSizes[])
+{
+	uintptr_t largestFreeEntry = 0;
+
+	/* walk down from the largest size class, the first populated one holds the largest entry */
+	for (intptr_t sizeClassIndex = (intptr_t)_maxSizeClasses - 1; sizeClassIndex >= 0; sizeClassIndex--) {
+		if (NULL != _frequentAllocationHead) {
+			MM_FreeEntrySizeClassStats::FrequentAllocation *curr = _frequentAllocationHead[sizeClassIndex];
+			while (NULL != curr) {
+				if (0 < (intptr_t)curr->_count) {
+					largestFreeEntry = OMR_MAX(largestFreeEntry, curr->_size);
+				}
+				curr = curr->_nextInSizeClass;
+			}
+		}
+
+		if (0 < (intptr_t)_count[sizeClassIndex]) {
+			largestFreeEntry = OMR_MAX(largestFreeEntry, sizeClassSizes[sizeClassIndex]);
+		}
+
+		if (0 != largestFreeEntry) {
+			break;
+		}
+	}
+
+	return largestFreeEntry;
+}
+
 uintptr_t
 MM_FreeEntrySizeClassStats::copyTo(MM_FreeEntrySizeClassStats *stats, const uintptr_t sizeClassSizes[])
 {
@@ -86,6 +86,8 @@ public:
 	uintptr_t getFreeMemory(const uintptr_t sizeClassSizes[]);
 	/* return the 'average' number of pages which can be freed */
 	uintptr_t getPageAlignedFreeMemory(const uintptr_t sizeClassSizes[], uintptr_t pageSize);
+	/* return the size of the largest free entry represented by this structure (lower bound of its size class, exact for frequent allocate sizes) */
+	uintptr_t getLargestFreeEntry(const uintptr_t sizeClassSizes[]);
 
 	uintptr_t getMaxSizeClasses() { return _maxSizeClasses; }
 	/**< @param factorVeryLargeEntryPool : multiple factor for _maxVeryLargeEntrySizes, default = 1, double for splitFreeList case 
@@ -89,3 +89,52 @@ MM_HeapResizeStats::updateHeapResizeStats()
 		updateRatioTicks(timeInGC, timeOutsideGC);
 	}			
 }	
+
+MM_HeapResizeGoal::Decision
+MM_HeapResizeGoal::decide(uint64_t targetPauseUs, uintptr_t targetGCPercentage, uintptr_t gcPercentage, uintptr_t hysteresis, double *resizeFactor)
+{
+	uint64_t recentPauseUs = getRecentPauseUs();
+	Decision vote = goal_hold;
+	double factor = 0.0;
+
+	if ((0 != targetPauseUs) && (recentPauseUs > targetPauseUs)) {
+		/* pauses grow with the space, shrink it in proportion to the overshoot */
+		vote = goal_contract_pause;
+		factor = 1.0 - ((double)targetPauseUs / (double)recentPauseUs);
+	} else if ((gcPercentage * 4) > (targetGCPercentage * 5)) {
+		/* more than 25% above the gc time target, grow unless that would push pauses past their target */
+		if ((0 == targetPauseUs) || ((recentPauseUs * 10) < (targetPauseUs * 9))) {
+			vote = goal_expand;
+			factor = ((double)gcPercentage / (double)targetGCPercentage) - 1.0;
+		}
+	} else if ((gcPercentage * 2) < targetGCPercentage) {
+		/* well under the gc time target, give back memory a small step at a time */
+		if ((0 == targetPauseUs) || ((recentPauseUs * 2) < targetPauseUs)) {
+			vote = goal_contract_footprint;
+			factor = HEAP_RESIZE_GOAL_MINIMUM_STEP;
+		}
+	}
+
+	/* the band between the expand and contract thresholds holds, and so does any change of mind */
+	if (goal_hold == vote) {
+		_votes = 0;
+	} else if (goal_expand == vote) {
+		_votes = (_votes > 0) ? (_votes + 1) : 1;
+	} else {
+		_votes = (_votes < 0) ? (_votes - 1) : -1;
+	}
+
+	Decision decision = goal_hold;
+	if ((uintptr_t)((_votes < 0) ? -_votes : _votes) >= OMR_MAX(hysteresis, (uintptr_t)1)) {
+		decision = vote;
+		_votes = 0;
+		if (goal_expand == decision) {
+			factor = OMR_MIN(OMR_MAX(factor, HEAP_RESIZE_GOAL_MINIMUM_STEP), HEAP_RESIZE_GOAL_MAXIMUM_EXPAND);
+		} else {
+			factor = OMR_MIN(OMR_MAX(factor, HEAP_RESIZE_GOAL_MINIMUM_STEP), HEAP_RESIZE_GOAL_MAXIMUM_CONTRACT);
+		}
+		*resizeFactor = factor;
+	}
+
+	return decision;
+}
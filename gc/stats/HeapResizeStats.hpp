@@ -31,6 +31,76 @@
 
 #define RATIO_RESIZE_HISTORIES				3
 
+/* Bounds on the fraction of its size a space is resized by in one step when resizing towards pause and gc time targets */
+#define HEAP_RESIZE_GOAL_MINIMUM_STEP		0.05
+#define HEAP_RESIZE_GOAL_MAXIMUM_EXPAND		0.5
+#define HEAP_RESIZE_GOAL_MAXIMUM_CONTRACT	0.2
+
+/**
+ * Pause history and resize votes of one space (tenure or nursery) for goal driven resizing
+ * (-Xgc:targetPauseTime=, -Xgc:targetGCPercentage=).
+ *
+ * Every collection votes to expand, contract or hold the space, and the space is only resized once the
+ * last -Xgc:heapResizeHysteresis= collections voted the same way, so a single burst does not flip the
+ * heap between expansion and contraction.
+ * @ingroup GC_Stats
+ */
+class MM_HeapResizeGoal
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum Decision {
+		goal_hold = 0, /**< both targets are met, or the collections disagree */
+		goal_expand, /**< gc time is above its target and pauses have headroom */
+		goal_contract_pause, /**< pauses are longer than their target */
+		goal_contract_footprint /**< gc time is well below its target, give memory back */
+	};
+
+private:
+	uint64_t _lastPauseUs; /**< pause of the last collection of the space */
+	uint64_t _averagePauseUs; /**< weighted average pause of recent collections */
+	intptr_t _votes; /**< consecutive collections which voted to expand (positive) or contract (negative) */
+
+	/*
+	 * Function members
+	 */
+public:
+	MMINLINE void
+	recordPause(uint64_t pauseUs)
+	{
+		_lastPauseUs = pauseUs;
+		if (0 == _averagePauseUs) {
+			_averagePauseUs = pauseUs;
+		} else {
+			_averagePauseUs = ((_averagePauseUs * 3) + pauseUs) / 4;
+		}
+	}
+
+	/**
+	 * @return the pause the targets are compared with, the worse of the last and the average pause
+	 */
+	MMINLINE uint64_t getRecentPauseUs() { return OMR_MAX(_lastPauseUs, _averagePauseUs); }
+
+	/**
+	 * Record the vote of the current collection and decide whether the space should be resized.
+	 * @param targetPauseUs pause target in microseconds, 0 if there is none
+	 * @param targetGCPercentage target percentage of time spent collecting the space
+	 * @param gcPercentage recent percentage of time spent collecting the space
+	 * @param hysteresis number of consecutive identical votes required before resizing
+	 * @param[out] resizeFactor fraction of its current size to resize the space by, if the decision is not goal_hold
+	 * @return the resize decision
+	 */
+	Decision decide(uint64_t targetPauseUs, uintptr_t targetGCPercentage, uintptr_t gcPercentage, uintptr_t hysteresis, double *resizeFactor);
+
+	MM_HeapResizeGoal() :
+		_lastPauseUs(0),
+		_averagePauseUs(0),
+		_votes(0)
+	{}
+};
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Stats
@@ -71,6 +141,9 @@ private:
 	uint64_t 				_ticksOutsideGC[RATIO_RESIZE_HISTORIES];
 	bool					_excludeCurrentGCTimeFromStats;
 
+	MM_HeapResizeGoal		_tenureGoal; /**< goal driven resizing state of the tenure (or flat) space */
+	MM_HeapResizeGoal		_nurseryGoal; /**< goal driven resizing state of the nursery */
+
 protected:
 public:
 
@@ -175,6 +248,9 @@ public:
 		}			
 	}
 
+	MMINLINE MM_HeapResizeGoal *getTenureGoal() { return &_tenureGoal; }
+	MMINLINE MM_HeapResizeGoal *getNurseryGoal() { return &_nurseryGoal; }
+
 	MMINLINE void resetExcludeCurrentGCTimeFromStats() { _excludeCurrentGCTimeFromStats = FALSE; }
 	MMINLINE void setExcludeCurrentGCTimeFromStats() { _excludeCurrentGCTimeFromStats = TRUE; }
 	MMINLINE bool getExcludeCurrentGCTimeFromStats() { return _excludeCurrentGCTimeFromStats; }
@@ -196,7 +272,9 @@ public:
 		_lastGCPercentage(0),
 		_lastTimeOutsideGC(0),
 		_globalGCCountAtAF(0),
-		_excludeCurrentGCTimeFromStats(true)
+		_excludeCurrentGCTimeFromStats(true),
+		_tenureGoal(),
+		_nurseryGoal()
 	{
 		resetRatioTicks();
 	}
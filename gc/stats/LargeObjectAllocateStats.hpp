@@ -221,6 +221,7 @@ public:
 	uintptr_t getMaxHeapSize() {return _maxHeapSize; }
 	uintptr_t getFreeMemory(){return _freeEntrySizeClassStats.getFreeMemory(_sizeClassSizes);}
 	uintptr_t getPageAlignedFreeMemory(uintptr_t pageSize) {return _freeEntrySizeClassStats.getPageAlignedFreeMemory(_sizeClassSizes, pageSize);}
+	uintptr_t getLargestFreeEntry() {return _freeEntrySizeClassStats.getLargestFreeEntry(_sizeClassSizes);}
 
 
 	MM_LargeObjectAllocateStats(MM_EnvironmentBase* env) :
@@ -103,6 +103,17 @@ public:
 	 */
 	MMINLINE uint64_t getScanTime() { return _scanTime; }
 
+	/**
+	 * Get the mark throughput, the rate at which objects were scanned.
+	 * @param durationMicros wall time of the mark phase, in microseconds
+	 * @return objects scanned per millisecond, or 0 if no time was measured
+	 */
+	MMINLINE double
+	getScanRate(uint64_t durationMicros)
+	{
+		return (0 == durationMicros) ? 0.0 : (((double)_objectsScanned * 1000.0) / (double)durationMicros);
+	}
+
 	MM_MarkStats() :
 		MM_Base()
 		,_scanTime(0)
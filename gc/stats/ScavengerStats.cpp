@@ -51,6 +51,9 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_acquireScanListCount(0)
 	,_acquireListLockCount(0)
 	,_aliasToCopyCacheCount(0)
+	,_scanCacheStealCount(0)
+	,_scanCacheFailedStealCount(0)
+	,_scanCacheDequeOverflowCount(0)
 	,_arraySplitCount(0)
 	,_arraySplitAmount(0)
 	,_workStallCount(0)
@@ -163,6 +166,9 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_acquireScanListCount = 0;
 	_acquireListLockCount = 0;
 	_aliasToCopyCacheCount = 0;
+	_scanCacheStealCount = 0;
+	_scanCacheFailedStealCount = 0;
+	_scanCacheDequeOverflowCount = 0;
 	_arraySplitCount = 0;
 	_arraySplitAmount = 0;
 	_workStallCount = 0;
@@ -82,6 +82,9 @@ public:
 	uintptr_t _acquireScanListCount;
 	uintptr_t _acquireListLockCount;  /**< cumulative (for scan&free list) lock count. if this number is much larger than cumulative acquire list count, it indicates over-splitting */
 	uintptr_t _aliasToCopyCacheCount;
+	uintptr_t _scanCacheStealCount; /**< The number of scan caches stolen from other threads' deques */
+	uintptr_t _scanCacheFailedStealCount; /**< The number of steal attempts that found the victim deque empty or lost the race for its entry */
+	uintptr_t _scanCacheDequeOverflowCount; /**< The number of scan caches pushed to the scan list because the thread's deque was full */
 	uintptr_t _arraySplitCount;
 	uintptr_t _arraySplitAmount;
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
@@ -47,6 +47,9 @@ public:
 	uintptr_t workPacketsAcquired;
 	uintptr_t workPacketsReleased;
 	uintptr_t workPacketsExchanged; /**< The number of output packets converted into input packets without being returned to the shared pool first */
+	uintptr_t workPacketsCASRetries; /**< The number of failed compare-and-swap attempts on lock-free packet list heads */
+	uintptr_t workPacketsRemoteSublistPops; /**< The number of packets popped from a sublist other than the thread's own, because its own was empty (measures sublist imbalance) */
+	uintptr_t workPacketsLockFreePops; /**< The number of packets popped from packet lists in lock-free mode */
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
@@ -73,6 +76,9 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		workPacketsCASRetries = 0;
+		workPacketsRemoteSublistPops = 0;
+		workPacketsLockFreePops = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +97,9 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		workPacketsCASRetries += statsToMerge->workPacketsCASRetries;
+		workPacketsRemoteSublistPops += statsToMerge->workPacketsRemoteSublistPops;
+		workPacketsLockFreePops += statsToMerge->workPacketsLockFreePops;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -147,6 +156,9 @@ public:
 		,workPacketsAcquired(0)
 		,workPacketsReleased(0)
 		,workPacketsExchanged(0)
+		,workPacketsCASRetries(0)
+		,workPacketsRemoteSublistPops(0)
+		,workPacketsLockFreePops(0)
 		,_workStallCount(0)
 		,_completeStallCount(0)
 		,_workStallTime(0)
@@ -0,0 +1,286 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "VerboseBinaryDecoder.hpp"
+
+#include "VerboseManagerBase.hpp"
+
+#include <string.h>
+
+#define VERBOSEGC_DECODED_CLOCK_WARNING "<warning details=\"clock error detected, following timing may be inaccurate\" />\n"
+
+bool
+MM_VerboseBinaryDecoder::decode(const char *binaryFilename, intptr_t outputFile)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	if (!readLog(binaryFilename)) {
+		return false;
+	}
+	_outputFile = outputFile;
+
+	uint64_t nextSequence = _header->nextSequence;
+	/* older records have been overwritten by the ring wrapping around */
+	uint64_t sequence = (nextSequence > _header->recordCount) ? (nextSequence - _header->recordCount) : 0;
+
+	omrfile_printf(_outputFile, VERBOSEGC_HEADER, _header->gcVersion);
+	for (; sequence < nextSequence; sequence++) {
+		MM_VerboseBinaryRecord *record = &_records[sequence & (_header->recordCount - 1)];
+		/* skip records which were still being written when the log was copied */
+		if ((sequence + 1) == record->sequence) {
+			outputRecord(record);
+		}
+	}
+	omrfile_printf(_outputFile, VERBOSEGC_FOOTER);
+
+	freeLog();
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::readLog(const char *binaryFilename)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	MM_VerboseBinaryHeader header;
+
+	intptr_t fd = omrfile_open(binaryFilename, EsOpenRead, 0);
+	if (-1 == fd) {
+		return false;
+	}
+
+	int64_t fileLength = omrfile_flength(fd);
+	if ((fileLength < VERBOSEGC_BINARY_HEADER_SIZE)
+		|| (sizeof(header) != omrfile_read(fd, &header, sizeof(header)))
+		|| (0 != memcmp(header.eyecatcher, VERBOSEGC_BINARY_EYECATCHER, sizeof(VERBOSEGC_BINARY_EYECATCHER)))
+		|| (VERBOSEGC_BINARY_VERSION != header.version)
+		|| (sizeof(MM_VerboseBinaryRecord) != header.recordSize)
+		|| (0 == header.recordCount)
+		|| (0 != (header.recordCount & (header.recordCount - 1)))
+		|| ((uint64_t)fileLength < (VERBOSEGC_BINARY_HEADER_SIZE + (header.recordCount * sizeof(MM_VerboseBinaryRecord))))
+	) {
+		omrfile_close(fd);
+		return false;
+	}
+
+	uintptr_t logSize = VERBOSEGC_BINARY_HEADER_SIZE + (uintptr_t)(header.recordCount * sizeof(MM_VerboseBinaryRecord));
+	_header = (MM_VerboseBinaryHeader *)omrmem_allocate_memory(logSize, OMRMEM_CATEGORY_MM);
+	if (NULL == _header) {
+		omrfile_close(fd);
+		return false;
+	}
+
+	bool success = (0 == omrfile_seek(fd, 0, EsSeekSet));
+	uintptr_t offset = 0;
+	while (success && (offset < logSize)) {
+		intptr_t bytesRead = omrfile_read(fd, (char *)_header + offset, logSize - offset);
+		if (bytesRead <= 0) {
+			success = false;
+		} else {
+			offset += bytesRead;
+		}
+	}
+	omrfile_close(fd);
+
+	if (!success) {
+		freeLog();
+		return false;
+	}
+
+	/* the strings are only trusted up to the size of their entries */
+	_header->gcVersion[sizeof(_header->gcVersion) - 1] = '\0';
+	for (uintptr_t i = 0; i < VERBOSEGC_BINARY_STRING_COUNT; i++) {
+		_header->strings[i][VERBOSEGC_BINARY_STRING_LENGTH - 1] = '\0';
+	}
+	_records = (MM_VerboseBinaryRecord *)((uintptr_t)_header + VERBOSEGC_BINARY_HEADER_SIZE);
+
+	return true;
+}
+
+void
+MM_VerboseBinaryDecoder::freeLog()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	if (NULL != _header) {
+		omrmem_free_memory(_header);
+		_header = NULL;
+		_records = NULL;
+	}
+}
+
+const char *
+MM_VerboseBinaryDecoder::getString(uint32_t index)
+{
+	const char *string = "unknown";
+
+	if ((index < VERBOSEGC_BINARY_STRING_COUNT) && ('\0' != _header->strings[index][0])) {
+		string = _header->strings[index];
+	}
+
+	return string;
+}
+
+void
+MM_VerboseBinaryDecoder::getTimestamp(char *buf, uintptr_t bufsize, uint64_t wallTimeMs)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	uintptr_t bufPos = 0;
+
+	bufPos += omrstr_printf(buf, bufsize, "timestamp=\"");
+	bufPos += omrstr_ftime(buf + bufPos, bufsize - bufPos, VERBOSEGC_DATE_FORMAT_PRE_MS, wallTimeMs);
+	bufPos += omrstr_printf(buf + bufPos, bufsize - bufPos, "%03llu", wallTimeMs % 1000);
+	bufPos += omrstr_ftime(buf + bufPos, bufsize - bufPos, VERBOSEGC_DATE_FORMAT_POST_MS, wallTimeMs);
+	omrstr_printf(buf + bufPos, bufsize - bufPos, "\"");
+}
+
+void
+MM_VerboseBinaryDecoder::outputClockWarning(MM_VerboseBinaryRecord *record)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	if (0 != (record->flags & VERBOSEGC_BINARY_FLAG_CLOCK_ERROR)) {
+		omrfile_printf(_outputFile, VERBOSEGC_DECODED_CLOCK_WARNING);
+	}
+}
+
+void
+MM_VerboseBinaryDecoder::outputInitialized(MM_VerboseBinaryRecord *record, const char *timestamp)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	omrfile_printf(_outputFile, "<initialized id=\"%llu\" %s>\n", record->id, timestamp);
+	omrfile_printf(_outputFile, "  <attribute name=\"gcPolicy\" value=\"%s\" />\n", getString(record->typeString));
+	omrfile_printf(_outputFile, "  <attribute name=\"maxHeapSize\" value=\"0x%llx\" />\n", record->data.initialized.maxHeapSize);
+	omrfile_printf(_outputFile, "  <attribute name=\"initialHeapSize\" value=\"0x%llx\" />\n", record->data.initialized.initialHeapSize);
+	omrfile_printf(_outputFile, "  <attribute name=\"pageSize\" value=\"0x%llx\" />\n", record->data.initialized.pageSize);
+	omrfile_printf(_outputFile, "  <attribute name=\"pageType\" value=\"%s\" />\n", getString(record->reasonString));
+	omrfile_printf(_outputFile, "  <attribute name=\"requestedPageSize\" value=\"0x%llx\" />\n", record->data.initialized.requestedPageSize);
+	omrfile_printf(_outputFile, "  <attribute name=\"gcthreads\" value=\"%llu\" />\n", record->data.initialized.gcThreads);
+	omrfile_printf(_outputFile, "  <attribute name=\"packetListSplit\" value=\"%llu\" />\n", record->data.initialized.packetListSplit);
+	omrfile_printf(_outputFile, "  <attribute name=\"splitFreeListSplitAmount\" value=\"%llu\" />\n", record->data.initialized.splitFreeListSplitAmount);
+	omrfile_printf(_outputFile, "  <attribute name=\"numaNodes\" value=\"%llu\" />\n", record->data.initialized.numaNodes);
+	omrfile_printf(_outputFile, "  <system>\n");
+	omrfile_printf(_outputFile, "    <attribute name=\"physicalMemory\" value=\"%llu\" />\n", record->data.initialized.physicalMemory);
+	omrfile_printf(_outputFile, "    <attribute name=\"numCPUs\" value=\"%llu\" />\n", record->data.initialized.numCPUs);
+	omrfile_printf(_outputFile, "  </system>\n");
+	omrfile_printf(_outputFile, "</initialized>\n\n");
+}
+
+void
+MM_VerboseBinaryDecoder::outputRecord(MM_VerboseBinaryRecord *record)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	char timestamp[64];
+	uint64_t timeUs = 0;
+	uint64_t free = 0;
+	uint64_t total = 0;
+
+	getTimestamp(timestamp, sizeof(timestamp), record->wallTimeMs);
+
+	switch (record->type) {
+	case VERBOSEGC_BINARY_RECORD_INITIALIZED:
+		outputInitialized(record, timestamp);
+		break;
+	case VERBOSEGC_BINARY_RECORD_CYCLE_START:
+		timeUs = record->data.cycleStart.intervalUs;
+		outputClockWarning(record);
+		omrfile_printf(_outputFile, "<cycle-start id=\"%llu\" type=\"%s\" contextid=\"%llu\" %s intervalms=\"%llu.%03llu\" />\n",
+				record->id, getString(record->typeString), record->contextId, timestamp, timeUs / 1000, timeUs % 1000);
+		break;
+	case VERBOSEGC_BINARY_RECORD_CYCLE_END:
+		omrfile_printf(_outputFile, "<cycle-end id=\"%llu\" type=\"%s\" contextid=\"%llu\" %s />\n",
+				record->id, getString(record->typeString), record->contextId, timestamp);
+		if (VERBOSEGC_BINARY_NO_STRING != record->reasonString) {
+			timeUs = record->data.cycleEnd.fixupTimeUs;
+			omrfile_printf(_outputFile, "<heap-fixup timems=\"%llu.%03llu\" reason=\"%s\"  %s />\n",
+					timeUs / 1000, timeUs % 1000, getString(record->reasonString), timestamp);
+		}
+		break;
+	case VERBOSEGC_BINARY_RECORD_GC_START:
+		free = record->data.gcStart.freeBytes;
+		total = record->data.gcStart.totalBytes;
+		omrfile_printf(_outputFile, "<gc-start id=\"%llu\" type=\"%s\" contextid=\"%llu\" %s>\n",
+				record->id, getString(record->typeString), record->contextId, timestamp);
+		omrfile_printf(_outputFile, "  <mem-info id=\"%llu\" free=\"%llu\" total=\"%llu\" percent=\"%llu\" />\n",
+				record->data.gcStart.memInfoId, free, total, (0 == total) ? 0 : ((free * 100) / total));
+		omrfile_printf(_outputFile, "</gc-start>\n");
+		omrfile_printf(_outputFile, "<allocation-stats totalBytes=\"%llu\" >\n", record->data.gcStart.allocatedBytes);
+		omrfile_printf(_outputFile, "  <allocated-bytes non-tlh=\"%llu\" tlh=\"%llu\" />\n", record->data.gcStart.nonTLHBytes, record->data.gcStart.tlhBytes);
+		omrfile_printf(_outputFile, "</allocation-stats>\n");
+		break;
+	case VERBOSEGC_BINARY_RECORD_GC_END:
+		free = record->data.gcEnd.freeBytes;
+		total = record->data.gcEnd.totalBytes;
+		outputClockWarning(record);
+		omrfile_printf(_outputFile, "<gc-end id=\"%llu\" type=\"%s\" contextid=\"%llu\" durationms=\"%llu.%03llu\" usertimems=\"%llu.%03llu\" systemtimems=\"%llu.%03llu\" stalltimems=\"%llu.%03llu\" %s activeThreads=\"%llu\">\n",
+				record->id, getString(record->typeString), record->contextId,
+				record->data.gcEnd.durationUs / 1000, record->data.gcEnd.durationUs % 1000,
+				record->data.gcEnd.userTimeUs / 1000, record->data.gcEnd.userTimeUs % 1000,
+				record->data.gcEnd.systemTimeUs / 1000, record->data.gcEnd.systemTimeUs % 1000,
+				record->data.gcEnd.stallTimeUs / 1000, record->data.gcEnd.stallTimeUs % 1000,
+				timestamp, record->data.gcEnd.activeThreads);
+		omrfile_printf(_outputFile, "  <mem-info id=\"%llu\" free=\"%llu\" total=\"%llu\" percent=\"%llu\" />\n",
+				record->data.gcEnd.memInfoId, free, total, (0 == total) ? 0 : ((free * 100) / total));
+		omrfile_printf(_outputFile, "</gc-end>\n");
+		break;
+	case VERBOSEGC_BINARY_RECORD_GC_OP_MARK:
+		timeUs = record->data.mark.timeUs;
+		outputClockWarning(record);
+		omrfile_printf(_outputFile, "<gc-op id=\"%llu\" type=\"mark\" timems=\"%llu.%03llu\" contextid=\"%llu\" %s>\n",
+				record->id, timeUs / 1000, timeUs % 1000, record->contextId, timestamp);
+		omrfile_printf(_outputFile, "  <trace-info objectcount=\"%llu\" scancount=\"%llu\" scanbytes=\"%llu\" scanrate=\"%.3f\" />\n",
+				record->data.mark.objectsMarked, record->data.mark.objectsScanned, record->data.mark.bytesScanned,
+				((0 == timeUs) || (0 != (record->flags & VERBOSEGC_BINARY_FLAG_CLOCK_ERROR))) ? 0.0 : (((double)record->data.mark.objectsScanned * 1000.0) / (double)timeUs));
+		omrfile_printf(_outputFile, "</gc-op>\n");
+		break;
+	case VERBOSEGC_BINARY_RECORD_GC_OP_SWEEP:
+		timeUs = record->data.sweep.timeUs;
+		outputClockWarning(record);
+		omrfile_printf(_outputFile, "<gc-op id=\"%llu\" type=\"sweep\" timems=\"%llu.%03llu\" contextid=\"%llu\" %s />\n",
+				record->id, timeUs / 1000, timeUs % 1000, record->contextId, timestamp);
+		break;
+	case VERBOSEGC_BINARY_RECORD_GC_OP_COMPACT:
+		timeUs = record->data.compact.timeUs;
+		outputClockWarning(record);
+		omrfile_printf(_outputFile, "<gc-op id=\"%llu\" type=\"compact\" timems=\"%llu.%03llu\" contextid=\"%llu\" %s>\n",
+				record->id, timeUs / 1000, timeUs % 1000, record->contextId, timestamp);
+		if (0 == (record->flags & VERBOSEGC_BINARY_FLAG_COMPACT_PREVENTED)) {
+			omrfile_printf(_outputFile, "  <compact-info movecount=\"%llu\" movebytes=\"%llu\" reason=\"%s\" />\n",
+					record->data.compact.movedObjects, record->data.compact.movedBytes, getString(record->reasonString));
+		} else {
+			omrfile_printf(_outputFile, "  <compact-info reason=\"%s\" />\n", getString(record->reasonString));
+			omrfile_printf(_outputFile, "  <warning details=\"compaction prevented due to %s\" />\n", getString(record->data.compact.preventedReasonString));
+		}
+		omrfile_printf(_outputFile, "</gc-op>\n");
+		break;
+	case VERBOSEGC_BINARY_RECORD_HEAP_RESIZE:
+		timeUs = record->data.heapResize.timeUs;
+		omrfile_printf(_outputFile, "<heap-resize id=\"%llu\" type=\"%s\" space=\"%s\" amount=\"%llu\" count=\"%llu\" timems=\"%llu.%03llu\" reason=\"%s\" %s />\n",
+				record->id, getString(record->typeString), getString(record->data.heapResize.spaceString),
+				record->data.heapResize.amount, record->data.heapResize.count, timeUs / 1000, timeUs % 1000,
+				getString(record->reasonString), timestamp);
+		break;
+	default:
+		/* written by a newer writer, nothing to render */
+		break;
+	}
+}
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYDECODER_HPP_)
+#define VERBOSEBINARYDECODER_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "VerboseBinaryRecord.hpp"
+
+/**
+ * Renders a binary verbose:gc log written with -Xgc:binaryVerboseLog as the verbose:gc XML the
+ * standard file writers produce. Only needs a port library, so it can run outside of the process
+ * which wrote the log.
+ * @see MM_VerboseWriterFileLoggingBinary
+ */
+class MM_VerboseBinaryDecoder
+{
+	/*
+	 * Data members
+	 */
+private:
+	OMRPortLibrary *_portLibrary;
+	MM_VerboseBinaryHeader *_header; /**< copy of the log being decoded */
+	MM_VerboseBinaryRecord *_records; /**< the ring of records of the copy */
+	intptr_t _outputFile; /**< file descriptor the XML is written to */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Decode a binary log.
+	 * @param binaryFilename the binary log to read
+	 * @param outputFile file descriptor to write the XML to
+	 * @return true on success, false if the log could not be read or is not a binary verbose:gc log
+	 */
+	bool decode(const char *binaryFilename, intptr_t outputFile);
+
+	MM_VerboseBinaryDecoder(OMRPortLibrary *portLibrary)
+		: _portLibrary(portLibrary)
+		, _header(NULL)
+		, _records(NULL)
+		, _outputFile(-1)
+	{}
+
+private:
+	bool readLog(const char *binaryFilename);
+	void freeLog();
+
+	/**
+	 * Answer an entry of the log's string table.
+	 */
+	const char *getString(uint32_t index);
+
+	/**
+	 * Format the timestamp attribute of a stanza.
+	 */
+	void getTimestamp(char *buf, uintptr_t bufsize, uint64_t wallTimeMs);
+
+	void outputRecord(MM_VerboseBinaryRecord *record);
+	void outputInitialized(MM_VerboseBinaryRecord *record, const char *timestamp);
+	void outputClockWarning(MM_VerboseBinaryRecord *record);
+};
+
+#endif /* VERBOSEBINARYDECODER_HPP_ */
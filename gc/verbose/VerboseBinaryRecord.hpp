@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYRECORD_HPP_)
+#define VERBOSEBINARYRECORD_HPP_
+
+#include "omrcomp.h"
+
+/*
+ * Layout of a binary verbose:gc log (-Xgc:binaryVerboseLog).
+ *
+ * The file is a header page followed by a ring of fixed size records. Writers claim the next sequence
+ * number with an atomic increment of the header's nextSequence and fill the slot at sequence modulo
+ * recordCount in place. A slot's sequence field is cleared while the record is written and set to
+ * sequence + 1 once it is complete, so a reader keeps only the slots whose sequence field matches
+ * the position they were expected at and drops torn or overwritten records.
+ *
+ * Strings (cycle types, reasons and so on) are stored once in the header's string table and referenced
+ * by index, so recording an event never formats anything.
+ */
+
+#define VERBOSEGC_BINARY_EYECATCHER "OMRVGCB"
+#define VERBOSEGC_BINARY_VERSION 1
+#define VERBOSEGC_BINARY_HEADER_SIZE 4096
+#define VERBOSEGC_BINARY_STRING_COUNT 96
+#define VERBOSEGC_BINARY_STRING_LENGTH 32
+#define VERBOSEGC_BINARY_NO_STRING ((uint32_t)-1)
+
+/* Record types */
+#define VERBOSEGC_BINARY_RECORD_INITIALIZED 1
+#define VERBOSEGC_BINARY_RECORD_CYCLE_START 2
+#define VERBOSEGC_BINARY_RECORD_CYCLE_END 3
+#define VERBOSEGC_BINARY_RECORD_GC_START 4
+#define VERBOSEGC_BINARY_RECORD_GC_END 5
+#define VERBOSEGC_BINARY_RECORD_GC_OP_MARK 6
+#define VERBOSEGC_BINARY_RECORD_GC_OP_SWEEP 7
+#define VERBOSEGC_BINARY_RECORD_GC_OP_COMPACT 8
+#define VERBOSEGC_BINARY_RECORD_HEAP_RESIZE 9
+
+/* Record flags */
+#define VERBOSEGC_BINARY_FLAG_CLOCK_ERROR 0x1 /**< a time delta in the record could not be computed */
+#define VERBOSEGC_BINARY_FLAG_COMPACT_PREVENTED 0x2 /**< compaction was prevented, data.compact.preventedReasonString says why */
+
+typedef struct MM_VerboseBinaryHeader {
+	char eyecatcher[8]; /**< VERBOSEGC_BINARY_EYECATCHER */
+	uint32_t version; /**< VERBOSEGC_BINARY_VERSION */
+	uint32_t recordSize; /**< sizeof(MM_VerboseBinaryRecord) of the writer */
+	uint64_t recordCount; /**< number of slots in the ring, a power of two */
+	volatile uint64_t nextSequence; /**< sequence number the next record will be written with */
+	char gcVersion[2 * VERBOSEGC_BINARY_STRING_LENGTH]; /**< version attribute of the rendered <verbosegc> element */
+	char strings[VERBOSEGC_BINARY_STRING_COUNT][VERBOSEGC_BINARY_STRING_LENGTH]; /**< string table, unused entries are empty */
+} MM_VerboseBinaryHeader;
+
+typedef struct MM_VerboseBinaryRecord {
+	volatile uint64_t sequence; /**< 1 + sequence number of a complete record, 0 while the record is being written */
+	uint64_t wallTimeMs; /**< wall clock time of the event */
+	uint32_t type; /**< VERBOSEGC_BINARY_RECORD_* */
+	uint32_t flags; /**< VERBOSEGC_BINARY_FLAG_* */
+	uint32_t typeString; /**< string table index of the cycle, resize or policy type */
+	uint32_t reasonString; /**< string table index of the reason, if the event has one */
+	uint64_t id; /**< verbose id of the event */
+	uint64_t contextId; /**< verbose id of the enclosing cycle */
+	union {
+		struct {
+			uint64_t maxHeapSize;
+			uint64_t initialHeapSize;
+			uint64_t pageSize;
+			uint64_t requestedPageSize;
+			uint64_t gcThreads;
+			uint64_t packetListSplit;
+			uint64_t splitFreeListSplitAmount;
+			uint64_t numaNodes;
+			uint64_t physicalMemory;
+			uint64_t numCPUs;
+		} initialized; /**< reasonString is the page type */
+		struct {
+			uint64_t intervalUs;
+		} cycleStart;
+		struct {
+			uint64_t fixupTimeUs;
+		} cycleEnd; /**< reasonString is the heap fixup reason if the heap was fixed up for walking */
+		struct {
+			uint64_t memInfoId;
+			uint64_t freeBytes;
+			uint64_t totalBytes;
+			uint64_t allocatedBytes;
+			uint64_t nonTLHBytes;
+			uint64_t tlhBytes;
+		} gcStart;
+		struct {
+			uint64_t memInfoId;
+			uint64_t freeBytes;
+			uint64_t totalBytes;
+			uint64_t durationUs;
+			uint64_t userTimeUs;
+			uint64_t systemTimeUs;
+			uint64_t stallTimeUs;
+			uint64_t activeThreads;
+		} gcEnd;
+		struct {
+			uint64_t timeUs;
+			uint64_t objectsMarked;
+			uint64_t objectsScanned;
+			uint64_t bytesScanned;
+		} mark;
+		struct {
+			uint64_t timeUs;
+		} sweep;
+		struct {
+			uint64_t timeUs;
+			uint64_t movedObjects;
+			uint64_t movedBytes;
+			uint32_t preventedReasonString;
+			uint32_t reserved;
+		} compact; /**< reasonString is the compaction reason */
+		struct {
+			uint64_t amount;
+			uint64_t count;
+			uint64_t timeUs;
+			uint32_t spaceString;
+			uint32_t reserved;
+		} heapResize; /**< typeString is the resize type and reasonString its reason */
+		uint64_t raw[10];
+	} data;
+} MM_VerboseBinaryRecord;
+
+#endif /* VERBOSEBINARYRECORD_HPP_ */
@@ -429,15 +429,9 @@ MM_VerboseHandlerOutput::handleReinitialized(J9HookInterface** hook, uintptr_t e
 }
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 
-void
-MM_VerboseHandlerOutput::handleCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+bool
+MM_VerboseHandlerOutput::getCycleStartInterval(MM_EnvironmentBase *env, uint64_t currentTime, uint64_t *deltaTime)
 {
-	MM_GCCycleStartEvent* event = (MM_GCCycleStartEvent*)eventData;
-	MM_VerboseWriterChain* writer = _manager->getWriterChain();
-	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
-	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
-
-	uint64_t currentTime = event->timestamp;
 	uint64_t previousTime = 0;
 
 	switch (env->_cycleState->_type) {
@@ -469,8 +463,20 @@ MM_VerboseHandlerOutput::handleCycleStart(J9HookInterface** hook, uintptr_t even
 		previousTime = _manager->getInitializedTime();
 	}
 
+	return getTimeDeltaInMicroSeconds(deltaTime, previousTime, currentTime);
+}
+
+
+void
+MM_VerboseHandlerOutput::handleCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCCycleStartEvent* event = (MM_GCCycleStartEvent*)eventData;
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
 	uint64_t deltaTime = 0;
-	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&deltaTime, previousTime, currentTime);
+	bool deltaTimeSuccess = getCycleStartInterval(env, event->timestamp, &deltaTime);
 
 	const char* cycleType = getCurrentCycleType(env);
 	char tagTemplate[200];
@@ -1027,6 +1033,30 @@ MM_VerboseHandlerOutput::handleHeapResize(J9HookInterface** hook, uintptr_t even
 	exitAtomicReportingBlock();
 }
 
+void
+MM_VerboseHandlerOutput::getHeapResizeStrings(HeapResizeType resizeType, uintptr_t reason, const char **resizeTypeName, const char **reasonString)
+{
+	if (HEAP_EXPAND == resizeType) {
+		*resizeTypeName = "expand";
+		*reasonString = getExpandReasonAsString((ExpandReason)reason);
+	} else if (HEAP_CONTRACT == resizeType) {
+		*resizeTypeName = "contract";
+		*reasonString = getContractReasonAsString((ContractReason)reason);
+	} else if (HEAP_LOA_EXPAND == resizeType) {
+		*resizeTypeName = "loa expand";
+		*reasonString = getLoaResizeReasonAsString((LoaResizeReason)reason);
+	} else if (HEAP_LOA_CONTRACT == resizeType) {
+		*resizeTypeName = "loa contract";
+		*reasonString = getLoaResizeReasonAsString((LoaResizeReason)reason);
+	} else if (HEAP_RELEASE_FREE_PAGES == resizeType) {
+		*resizeTypeName = "release free pages";
+		*reasonString = "idle";
+	} else {
+		*resizeTypeName = "unknown";
+		*reasonString = "unknown";
+	}
+}
+
 void
 MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t indent, HeapResizeType resizeType, uintptr_t resizeAmount, uintptr_t resizeCount, uintptr_t subSpaceType, uintptr_t reason, uint64_t timeInMicroSeconds)
 {
@@ -1037,25 +1067,7 @@ MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t
 	const char *resizeTypeName = NULL;
 	char tagTemplate[200];
 
-	if (HEAP_EXPAND == resizeType) {
-		resizeTypeName = "expand";
-		reasonString = getExpandReasonAsString((ExpandReason)reason);
-	} else if (HEAP_CONTRACT == resizeType) {
-		resizeTypeName = "contract";
-		reasonString = getContractReasonAsString((ContractReason)reason);
-	} else if (HEAP_LOA_EXPAND == resizeType) {
-		resizeTypeName = "loa expand";
-		reasonString = getLoaResizeReasonAsString((LoaResizeReason)reason);
-	} else if (HEAP_LOA_CONTRACT == resizeType) {
-		resizeTypeName = "loa contract";
-		reasonString = getLoaResizeReasonAsString((LoaResizeReason)reason);
-	} else if (HEAP_RELEASE_FREE_PAGES == resizeType) {
-		resizeTypeName = "release free pages";
-		reasonString = "idle";
-	} else {
-		resizeTypeName = "unknown";
-		reasonString = "unknown";
-	}
+	getHeapResizeStrings(resizeType, reason, &resizeTypeName, &reasonString);
 
 	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
 
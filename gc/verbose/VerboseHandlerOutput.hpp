@@ -93,6 +93,16 @@ protected:
 		return true;
 	}
 
+	/**
+	 * Record the start of a cycle of the current type and answer the time since the previous cycle of
+	 * that type started (or since initialization for the first one).
+	 * @param env current GC thread.
+	 * @param currentTime hires start time of the cycle
+	 * @param[out] deltaTime the interval in microseconds
+	 * @return true if the interval could be calculated
+	 */
+	bool getCycleStartInterval(MM_EnvironmentBase *env, uint64_t currentTime, uint64_t *deltaTime);
+
 	/**
 	 * Answer a string representation of the current cycle type.
 	 * @param env current GC thread.
@@ -205,6 +215,15 @@ protected:
 
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 
+	/**
+	 * Answer the human readable names of a heap resize and its reason.
+	 * @param resizeType type of resize (ie compact or expand)
+	 * @param reason the reason for the resize
+	 * @param[out] resizeTypeName the name of the resize type
+	 * @param[out] reasonString the name of the reason
+	 */
+	void getHeapResizeStrings(HeapResizeType resizeType, uintptr_t reason, const char **resizeTypeName, const char **reasonString);
+
 	/**
 	 * Output a stand-alone stanza heap resize events.
 	 * @param env GC thread used for output.
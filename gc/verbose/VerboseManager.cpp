@@ -30,10 +30,13 @@
 
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
+#include "VerboseHandlerOutputStandardBinary.hpp"
 #include "VerboseWriter.hpp"
 #include "VerboseWriterChain.hpp"
 #include "VerboseWriterHook.hpp"
 #include "VerboseWriterFileLogging.hpp"
+#include "VerboseWriterFileLoggingAsync.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterStreamOutput.hpp"
@@ -121,7 +124,11 @@ MM_VerboseManager::createVerboseHandlerOutputObject(MM_EnvironmentBase *env)
 
 	if (extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
-		handler = MM_VerboseHandlerOutputStandard::newInstance(env, this);
+		if (extensions->binaryVerboseLog) {
+			handler = MM_VerboseHandlerOutputStandardBinary::newInstance(env, this);
+		} else {
+			handler = MM_VerboseHandlerOutputStandard::newInstance(env, this);
+		}
 #endif /* defined(OMR_GC_MODRON_STANDARD) */
 	} else {
 		handler = MM_VerboseHandlerOutput::newInstance(env, this);
@@ -250,6 +257,14 @@ MM_VerboseManager::parseWriterType(MM_EnvironmentBase *env, char *filename, uint
 		return VERBOSE_WRITER_HOOK;
 	}
 
+	if (extensions->binaryVerboseLog) {
+		return VERBOSE_WRITER_FILE_LOGGING_BINARY;
+	}
+
+	if (extensions->asyncVerboseLog) {
+		return VERBOSE_WRITER_FILE_LOGGING_ASYNC;
+	}
+
 	if (extensions->bufferedLogging) {
 		return VERBOSE_WRITER_FILE_LOGGING_BUFFERED;
 	}
@@ -330,6 +345,30 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *
 			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
 		}
 		break;
+	case VERBOSE_WRITER_FILE_LOGGING_BINARY:
+		writer = MM_VerboseWriterFileLoggingBinary::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to map the file and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
+	case VERBOSE_WRITER_FILE_LOGGING_ASYNC:
+		writer = MM_VerboseWriterFileLoggingAsync::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
 
 	default:
 		return NULL;
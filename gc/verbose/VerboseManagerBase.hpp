@@ -81,6 +81,10 @@ typedef struct{
 #define VERBOSEGC_DATE_FORMAT_PRE_MS "%Y-%m-%dT%H:%M:%S."
 #define VERBOSEGC_DATE_FORMAT_POST_MS ""
 
+/* Output constants */
+#define VERBOSEGC_HEADER "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n\n"
+#define VERBOSEGC_FOOTER "</verbosegc>\n"
+
 /**
  * The central class of the verbose gc mechanism.
  * Acts as the anchor point for the EventStream and Output Agent chain.
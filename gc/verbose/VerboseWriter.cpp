@@ -25,16 +25,13 @@
 #include "VerboseWriter.hpp"
 
 #include "GCExtensionsBase.hpp"
+#include "VerboseManagerBase.hpp"
 
 #undef _UTE_MODULE_HEADER_
 #undef UT_MODULE_LOADED
 #undef UT_MODULE_UNLOADED
 #include "ut_j9vgc.h"
 
-/* Output constants */
-#define VERBOSEGC_HEADER "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n\n"
-#define VERBOSEGC_FOOTER "</verbosegc>\n"
-
 MM_VerboseWriter::MM_VerboseWriter(WriterType type)
 	: MM_Base()
 	,_nextWriter(NULL)
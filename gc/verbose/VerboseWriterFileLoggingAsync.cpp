@@ -0,0 +1,447 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrutil.h"
+#include "modronapicore.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingAsync.hpp"
+
+#include "GCExtensionsBase.hpp"
+#include "EnvironmentBase.hpp"
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+#include <string.h>
+
+/* Largest chunk the writer thread writes at once, and the fewest chunks the buffer is split into */
+#define VERBOSE_ASYNC_MAX_CHUNK_SIZE ((uintptr_t)64 * 1024)
+#define VERBOSE_ASYNC_MIN_CHUNK_COUNT 4
+
+MM_VerboseWriterFileLoggingAsync::MM_VerboseWriterFileLoggingAsync(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNC)
+	,_omrVM(env->getOmrVM())
+	,_logFileDescriptor(-1)
+	,_monitor(NULL)
+	,_writerState(writer_disabled)
+	,_chunks(NULL)
+	,_chunkCount(0)
+	,_chunkSize(0)
+	,_head(0)
+	,_queued(0)
+	,_droppedStrings(0)
+	,_droppedBytes(0)
+	,_reportedDroppedStrings(0)
+	,_reportedDroppedBytes(0)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsync instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsync.
+ */
+MM_VerboseWriterFileLoggingAsync *
+MM_VerboseWriterFileLoggingAsync::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsync *agent = (MM_VerboseWriterFileLoggingAsync *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsync), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsync(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsync instance.
+ * Opens the first file, then splits -Xgc:asyncVerboseLogBufferSize= bytes into chunks and starts the writer thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsync::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	_chunkSize = OMR_MIN(VERBOSE_ASYNC_MAX_CHUNK_SIZE, extensions->asyncVerboseLogBufferSize / VERBOSE_ASYNC_MIN_CHUNK_COUNT);
+	_chunkSize = OMR_MAX(_chunkSize, (uintptr_t)INITIAL_BUFFER_SIZE);
+	_chunkCount = OMR_MAX((uintptr_t)VERBOSE_ASYNC_MIN_CHUNK_COUNT, extensions->asyncVerboseLogBufferSize / _chunkSize);
+	_head = 0;
+	_queued = 0;
+
+	_chunks = (Chunk *)extensions->getForge()->allocate((sizeof(Chunk) + _chunkSize) * _chunkCount, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _chunks) {
+		return false;
+	}
+	char *data = (char *)(_chunks + _chunkCount);
+	for (uintptr_t i = 0; i < _chunkCount; i++) {
+		_chunks[i].data = data;
+		_chunks[i].used = 0;
+		_chunks[i].rotateAfter = false;
+		data += _chunkSize;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileLoggingAsync::_monitor")) {
+		_monitor = NULL;
+		return false;
+	}
+
+	return startupWriterThread(env);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsync.
+ * Stops the writer thread once it has written everything queued.
+ */
+void
+MM_VerboseWriterFileLoggingAsync::tearDown(MM_EnvironmentBase *env)
+{
+	shutdownWriterThread(env);
+
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+
+	if (NULL != _chunks) {
+		env->getExtensions()->getForge()->free(_chunks);
+		_chunks = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsync::startupWriterThread(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it can't notify us of its state before we wait */
+	omrthread_monitor_enter(_monitor);
+	_writerState = writer_starting;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		writerThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (writer_starting == _writerState) {
+			omrthread_monitor_wait(_monitor);
+		}
+		success = true;
+	} else {
+		_writerState = writer_disabled;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return success;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::shutdownWriterThread(MM_EnvironmentBase *env)
+{
+	if ((NULL != _monitor) && (writer_disabled != _writerState)) {
+		/* tell the writer to drain the queue and shut down, then wait for it to exit */
+		omrthread_monitor_enter(_monitor);
+		queueFillChunk(false);
+		while (writer_terminated != _writerState) {
+			_writerState = writer_termination_requested;
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+		_writerState = writer_disabled;
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsync::writerThreadProc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsync *writer = (MM_VerboseWriterFileLoggingAsync *)info;
+	/* jump into the writer thread procedure and wait for work.  This method will NOT return */
+	writer->writerThreadEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::writerThreadEntryPoint()
+{
+	/* the writer never touches the heap, a standalone environment is enough to format stanzas */
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_monitor);
+	_writerState = writer_waiting;
+	omrthread_monitor_notify_all(_monitor);
+	while (true) {
+		if (0 != _queued) {
+			Chunk *chunk = &_chunks[_head];
+			omrthread_monitor_exit(_monitor);
+			writeChunk(&env, chunk);
+			omrthread_monitor_enter(_monitor);
+			chunk->used = 0;
+			chunk->rotateAfter = false;
+			_head = (_head + 1) % _chunkCount;
+			_queued -= 1;
+			/* wake anyone flushing */
+			omrthread_monitor_notify_all(_monitor);
+		} else if (_droppedStrings != _reportedDroppedStrings) {
+			/* the writer caught up, say what was lost in the meantime (strings are queued whole so this is between stanzas) */
+			uintptr_t droppedStrings = _droppedStrings;
+			uintptr_t droppedBytes = _droppedBytes;
+			omrthread_monitor_exit(_monitor);
+			reportDropped(&env, droppedStrings - _reportedDroppedStrings, droppedBytes - _reportedDroppedBytes);
+			omrthread_monitor_enter(_monitor);
+			_reportedDroppedStrings = droppedStrings;
+			_reportedDroppedBytes = droppedBytes;
+			omrthread_monitor_notify_all(_monitor);
+		} else if (writer_termination_requested == _writerState) {
+			break;
+		} else {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+
+	_writerState = writer_terminated;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::queueFillChunk(bool rotateAfter)
+{
+	if (_queued < _chunkCount) {
+		Chunk *chunk = &_chunks[(_head + _queued) % _chunkCount];
+		if ((0 != chunk->used) || rotateAfter) {
+			chunk->rotateAfter = rotateAfter;
+			_queued += 1;
+			omrthread_monitor_notify_all(_monitor);
+		}
+	} else if (rotateAfter) {
+		/* every chunk is queued, so nothing was written since the last one; rotate after it instead */
+		_chunks[(_head + _queued - 1) % _chunkCount].rotateAfter = true;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+
+	if (writer_disabled == _writerState) {
+		/* still initializing, or the writer thread is gone */
+		writeString(env, string, length);
+		return;
+	}
+
+	omrthread_monitor_enter(_monitor);
+	uintptr_t available = 0;
+	if (_queued < _chunkCount) {
+		available = ((_chunkCount - _queued) * _chunkSize) - _chunks[(_head + _queued) % _chunkCount].used;
+	}
+	if (length > available) {
+		/* drop the whole string rather than leave a torn stanza in the log */
+		_droppedStrings += 1;
+		_droppedBytes += length;
+	} else {
+		while (0 != length) {
+			Chunk *chunk = &_chunks[(_head + _queued) % _chunkCount];
+			uintptr_t copy = OMR_MIN(length, _chunkSize - chunk->used);
+			memcpy(chunk->data + chunk->used, string, copy);
+			chunk->used += copy;
+			string += copy;
+			length -= copy;
+			if (_chunkSize == chunk->used) {
+				queueFillChunk(false);
+			}
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::endOfCycle(MM_EnvironmentBase *env)
+{
+	bool rotate = false;
+
+	if (rotating_files == _mode) {
+		_currentCycle = (_currentCycle + 1) % _numCycles;
+		rotate = (0 == _currentCycle);
+	}
+
+	if (writer_disabled == _writerState) {
+		MM_VerboseWriterFileLogging::endOfCycle(env);
+	} else {
+		omrthread_monitor_enter(_monitor);
+		queueFillChunk(rotate);
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::flush(MM_EnvironmentBase *env)
+{
+	if ((NULL != _monitor) && (writer_disabled != _writerState)) {
+		omrthread_monitor_enter(_monitor);
+		queueFillChunk(false);
+		while (((0 != _queued) || (_droppedStrings != _reportedDroppedStrings)) && (writer_terminated != _writerState)) {
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::writeChunk(MM_EnvironmentBase *env, Chunk *chunk)
+{
+	if (0 != chunk->used) {
+		writeString(env, chunk->data, chunk->used);
+	}
+
+	if (chunk->rotateAfter) {
+		closeLogFile(env);
+		_currentFile = (_currentFile + 1) % _numFiles;
+		openLogFile(env, true);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::reportDropped(MM_EnvironmentBase *env, uintptr_t strings, uintptr_t bytes)
+{
+	char warning[128];
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	uintptr_t length = omrstr_printf(warning, sizeof(warning), "<warning details=\"verbose output dropped, %zu strings (%zu bytes) did not fit in the async log buffer\" />\n", strings, bytes);
+	writeString(env, warning, length);
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::writeString(MM_EnvironmentBase *env, const char *string, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 == _logFileDescriptor) {
+		/* the file could not be opened when the log was rotated, try again */
+		openLogFile(env, false);
+	}
+
+	if(-1 != _logFileDescriptor){
+		omrfile_write_text(_logFileDescriptor, string, length);
+	} else {
+		omrfile_write_text(OMRPORT_TTY_ERR, string, length);
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingAsync::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	flush(env);
+	return openLogFile(env, printInitializedHeader);
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::closeFile(MM_EnvironmentBase *env)
+{
+	flush(env);
+	closeLogFile(env);
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsync::openLogFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	int32_t openFlags =  EsOpenRead | EsOpenWrite | EsOpenCreate | _manager->fileOpenMode(env);
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, openFlags, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, openFlags, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	omrfile_printf(_logFileDescriptor, getHeader(env), version);
+	/* Print an Initialized Stanza in new file, directly since the writer thread may be the one opening it */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			writeString(env, buffer->contents(), strlen(buffer->contents()));
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingAsync::closeLogFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 != _logFileDescriptor) {
+		omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
+		omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
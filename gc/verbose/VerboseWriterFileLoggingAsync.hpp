@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNC_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNC_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which directs verbosegc output to file from a dedicated low priority thread (-Xgc:asyncVerboseLog).
+ *
+ * GC threads only copy completed output into a bounded ring of chunks; the writer thread writes each chunk
+ * with a single write and performs file rotation in between chunks, so a slow disk no longer lengthens pauses.
+ * Output which does not fit in the free chunks is dropped a whole string at a time and counted, and the
+ * writer reports the loss in the log the next time it catches up.
+ */
+class MM_VerboseWriterFileLoggingAsync : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum WriterThreadState {
+		writer_disabled = 0, /**< no writer thread was started */
+		writer_starting,
+		writer_waiting, /**< waiting for a chunk to be queued */
+		writer_termination_requested,
+		writer_terminated
+	};
+
+protected:
+private:
+	struct Chunk {
+		char *data;
+		uintptr_t used; /**< bytes of data filled */
+		bool rotateAfter; /**< the log moves to the next rotating file once the chunk is written */
+	};
+
+	OMR_VM *_omrVM;
+	intptr_t _logFileDescriptor; /**< the file being written to, only touched by the writer thread while it runs */
+
+	omrthread_monitor_t _monitor; /**< protects the chunk ring, the drop counters and _writerState */
+	volatile WriterThreadState _writerState;
+	Chunk *_chunks; /**< ring of chunks, the one after the last queued chunk is being filled */
+	uintptr_t _chunkCount;
+	uintptr_t _chunkSize;
+	uintptr_t _head; /**< index of the oldest queued chunk, the one the writer thread is writing */
+	uintptr_t _queued; /**< number of chunks queued for the writer thread */
+
+	uintptr_t _droppedStrings; /**< strings dropped because the writer thread fell behind */
+	uintptr_t _droppedBytes; /**< bytes of the dropped strings */
+	uintptr_t _reportedDroppedStrings; /**< dropped strings already reported in the log */
+	uintptr_t _reportedDroppedBytes;
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsync *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	/**
+	 * Queue the output of the cycle for the writer thread, and the switch to the next file when rotating.
+	 */
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	/**
+	 * Wait for the writer thread to write all of the output queued so far.
+	 */
+	void flush(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getDroppedStrings() { return _droppedStrings; }
+	MMINLINE uintptr_t getDroppedBytes() { return _droppedBytes; }
+
+protected:
+	MM_VerboseWriterFileLoggingAsync(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Open the file to log to, after the writer thread has written everything queued for the current file.
+	 */
+	virtual bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+
+	/**
+	 * Close the file being logged to, after the writer thread has written everything queued for it.
+	 */
+	virtual void closeFile(MM_EnvironmentBase *env);
+
+private:
+	static int J9THREAD_PROC writerThreadProc(void *info);
+	void writerThreadEntryPoint();
+
+	bool startupWriterThread(MM_EnvironmentBase *env);
+	void shutdownWriterThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Queue the chunk being filled, if it holds anything or has to rotate the log.
+	 * @note the caller holds _monitor
+	 */
+	void queueFillChunk(bool rotateAfter);
+
+	/**
+	 * Write a queued chunk and rotate the log if it asks for it. Called without holding _monitor.
+	 */
+	void writeChunk(MM_EnvironmentBase *env, Chunk *chunk);
+
+	/**
+	 * Write a warning stanza for output dropped since the last report. Called without holding _monitor.
+	 */
+	void reportDropped(MM_EnvironmentBase *env, uintptr_t strings, uintptr_t bytes);
+
+	void writeString(MM_EnvironmentBase *env, const char *string, uintptr_t length);
+
+	bool openLogFile(MM_EnvironmentBase *env, bool printInitializedHeader);
+	void closeLogFile(MM_EnvironmentBase *env);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNC_HPP_ */
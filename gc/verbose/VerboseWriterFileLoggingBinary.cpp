@@ -0,0 +1,212 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_logFileDescriptor(-1)
+	,_mapHandle(NULL)
+	,_header(NULL)
+	,_records(NULL)
+	,_recordMask(0)
+{
+	for (uintptr_t i = 0; i < VERBOSEGC_BINARY_STRING_COUNT; i++) {
+		_internedStrings[i] = NULL;
+	}
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t capabilities = omrmmap_capabilities();
+
+	if (OMR_ARE_NO_BITS_SET(capabilities, OMRPORT_MMAP_CAPABILITY_WRITE)) {
+		return false;
+	}
+
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ * Unmaps the log file if it is still mapped.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	closeFile(env);
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log to, sizes it for the ring and maps it. The ring starts out empty in every file.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	uint64_t recordCount = 1;
+	while (recordCount < extensions->binaryVerboseLogRecords) {
+		recordCount <<= 1;
+	}
+	uintptr_t fileSize = VERBOSEGC_BINARY_HEADER_SIZE + ((uintptr_t)recordCount * sizeof(MM_VerboseBinaryRecord));
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	/* a ring can not be appended to, the file always starts over */
+	int32_t openFlags = EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate;
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, openFlags, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, openFlags, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	if (0 == omrfile_set_length(_logFileDescriptor, fileSize)) {
+		_mapHandle = omrmmap_map_file(_logFileDescriptor, 0, fileSize, filenameToOpen, OMRPORT_MMAP_FLAG_WRITE | OMRPORT_MMAP_FLAG_SHARED, OMRMEM_CATEGORY_MM);
+	}
+	extensions->getForge()->free(filenameToOpen);
+
+	if ((NULL == _mapHandle) || (NULL == _mapHandle->pointer)) {
+		_mapHandle = NULL;
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+		return false;
+	}
+
+	MM_VerboseBinaryHeader *header = (MM_VerboseBinaryHeader *)_mapHandle->pointer;
+	memset(header, 0, VERBOSEGC_BINARY_HEADER_SIZE);
+	memcpy(header->eyecatcher, VERBOSEGC_BINARY_EYECATCHER, sizeof(VERBOSEGC_BINARY_EYECATCHER));
+	header->version = VERBOSEGC_BINARY_VERSION;
+	header->recordSize = sizeof(MM_VerboseBinaryRecord);
+	header->recordCount = recordCount;
+	header->nextSequence = 0;
+	strncpy(header->gcVersion, version, sizeof(header->gcVersion) - 1);
+
+	for (uintptr_t i = 0; i < VERBOSEGC_BINARY_STRING_COUNT; i++) {
+		_internedStrings[i] = NULL;
+	}
+	_records = (MM_VerboseBinaryRecord *)((uintptr_t)header + VERBOSEGC_BINARY_HEADER_SIZE);
+	_recordMask = recordCount - 1;
+	MM_AtomicOperations::writeBarrier();
+	/* the initialized event is recorded once by the handler, a rotated file does not repeat it */
+	_header = header;
+
+	return true;
+}
+
+/**
+ * Unmaps and closes the file being logged to. Records stay in the file as they were written.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	_header = NULL;
+	_records = NULL;
+	if (NULL != _mapHandle) {
+		omrmmap_unmap_file(_mapHandle);
+		_mapHandle = NULL;
+	}
+	if (-1 != _logFileDescriptor) {
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+uint32_t
+MM_VerboseWriterFileLoggingBinary::internString(const char *string)
+{
+	for (uint32_t index = 0; index < VERBOSEGC_BINARY_STRING_COUNT; index++) {
+		const char *interned = _internedStrings[index];
+		if (NULL == interned) {
+			interned = (const char *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_internedStrings[index], (uintptr_t)NULL, (uintptr_t)string);
+			if (NULL == interned) {
+				/* this thread owns the entry, the terminating NUL is already in the cleared table */
+				strncpy(_header->strings[index], string, VERBOSEGC_BINARY_STRING_LENGTH - 1);
+				return index;
+			}
+		}
+		if (interned == string) {
+			return index;
+		}
+	}
+
+	return VERBOSEGC_BINARY_NO_STRING;
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "AtomicOperations.hpp"
+#include "VerboseBinaryRecord.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which records verbosegc events as fixed layout binary records in a ring mapped onto the log file.
+ * Events are written in place by the binary verbose handler and rendered as XML offline, so recording one costs
+ * an atomic increment and a few stores instead of formatting a stanza.
+ * @see VerboseBinaryRecord.hpp for the file layout
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	intptr_t _logFileDescriptor; /**< the file being mapped */
+	J9MmapHandle *_mapHandle; /**< mapping of the whole file */
+	MM_VerboseBinaryHeader *_header; /**< start of the mapping, NULL if no file is mapped */
+	MM_VerboseBinaryRecord *_records; /**< the ring of records following the header */
+	uint64_t _recordMask; /**< number of records in the ring minus one */
+	const char * volatile _internedStrings[VERBOSEGC_BINARY_STRING_COUNT]; /**< strings already copied to the string table of the current file */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	/**
+	 * Formatted output has nowhere to go in a binary log and is dropped.
+	 */
+	virtual void outputString(MM_EnvironmentBase *env, const char* string) {}
+
+	/**
+	 * Claim the next slot of the ring. The caller fills the record and passes it to commitRecord().
+	 * @param[out] sequence the sequence number of the record
+	 * @return the record to fill in, or NULL if no file is mapped
+	 */
+	MMINLINE MM_VerboseBinaryRecord *
+	reserveRecord(uint64_t *sequence)
+	{
+		MM_VerboseBinaryRecord *record = NULL;
+		MM_VerboseBinaryHeader *header = _header;
+
+		if (NULL != header) {
+			*sequence = MM_AtomicOperations::addU64(&header->nextSequence, 1) - 1;
+			record = &_records[*sequence & _recordMask];
+			/* a reader must not take the slot for its previous occupant while it is overwritten */
+			record->sequence = 0;
+			MM_AtomicOperations::writeBarrier();
+		}
+
+		return record;
+	}
+
+	/**
+	 * Publish a record claimed with reserveRecord().
+	 */
+	MMINLINE void
+	commitRecord(MM_VerboseBinaryRecord *record, uint64_t sequence)
+	{
+		MM_AtomicOperations::writeBarrier();
+		record->sequence = sequence + 1;
+	}
+
+	/**
+	 * Answer the string table index of a string, copying it into the table the first time it is seen.
+	 * Strings are identified by address, so only strings which live as long as the writer (literals, extensions
+	 * fields) may be passed. Only valid while a file is mapped.
+	 * @return the index, or VERBOSEGC_BINARY_NO_STRING if the table is full
+	 */
+	uint32_t internString(const char *string);
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Renders a binary verbose:gc log written with -Xgc:binaryVerboseLog as verbose:gc XML.
+ *
+ * usage: omrvgcdecode <binary log> [<xml file>]
+ *
+ * The XML goes to stdout if no output file is given.
+ */
+
+#include <stdio.h>
+
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "VerboseBinaryDecoder.hpp"
+
+int
+main(int argc, char **argv)
+{
+	OMRPortLibrary portLibrary;
+	intptr_t rc = 0;
+
+	if ((argc < 2) || (argc > 3)) {
+		fprintf(stderr, "usage: %s <binary log> [<xml file>]\n", argv[0]);
+		return 1;
+	}
+
+	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return 1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		omrthread_detach(NULL);
+		return 1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	intptr_t outputFile = OMRPORT_TTY_OUT;
+	if (3 == argc) {
+		outputFile = omrfile_open(argv[2], EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == outputFile) {
+			fprintf(stderr, "unable to open %s\n", argv[2]);
+			rc = 1;
+		}
+	}
+
+	if (0 == rc) {
+		MM_VerboseBinaryDecoder decoder(&portLibrary);
+		if (!decoder.decode(argv[1], outputFile)) {
+			fprintf(stderr, "%s is not a readable binary verbose:gc log\n", argv[1]);
+			rc = 1;
+		}
+		if (OMRPORT_TTY_OUT != outputFile) {
+			omrfile_close(outputFile);
+		}
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return (int)rc;
+}
@@ -0,0 +1,446 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "omrgcconsts.h"
+#include "gcutils.h"
+
+#include "AllocationStats.hpp"
+#include "CollectionStatistics.hpp"
+#include "CycleState.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "ParallelDispatcher.hpp"
+#include "VerboseBinaryRecord.hpp"
+#include "VerboseHandlerOutputStandardBinary.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterChain.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+static void verboseBinaryInitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseBinaryCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseBinaryCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseBinaryGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseBinaryGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseBinaryMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseBinarySweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#if defined(OMR_GC_MODRON_COMPACTION)
+static void verboseBinaryCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+static void verboseBinaryHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+
+MM_VerboseHandlerOutput *
+MM_VerboseHandlerOutputStandardBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseHandlerOutputStandardBinary *verboseHandlerOutput = (MM_VerboseHandlerOutputStandardBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseHandlerOutputStandardBinary), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != verboseHandlerOutput) {
+		new(verboseHandlerOutput) MM_VerboseHandlerOutputStandardBinary(extensions);
+		if(!verboseHandlerOutput->initialize(env, manager)) {
+			verboseHandlerOutput->kill(env);
+			verboseHandlerOutput = NULL;
+		}
+	}
+	return verboseHandlerOutput;
+}
+
+void
+MM_VerboseHandlerOutputStandardBinary::enableVerbose()
+{
+	/* Only the events which have a binary record are hooked, everything else is not reported at all */
+	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_INITIALIZED, verboseBinaryInitialized, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseBinaryHeapResize, OMR_GET_CALLSITE(), (void *)this);
+
+	/* Cycle */
+	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, verboseBinaryCycleStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, verboseBinaryCycleEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* STW GC increment */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, verboseBinaryGCStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, verboseBinaryGCEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* GCOps */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_MARK_END, verboseBinaryMarkEnd, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, verboseBinarySweepEnd, OMR_GET_CALLSITE(), (void *)this);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_COMPACT_END, verboseBinaryCompactEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+}
+
+void
+MM_VerboseHandlerOutputStandardBinary::disableVerbose()
+{
+	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_INITIALIZED, verboseBinaryInitialized, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseBinaryHeapResize, NULL);
+
+	/* Cycle */
+	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, verboseBinaryCycleStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, verboseBinaryCycleEnd, NULL);
+
+	/* STW GC increment */
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, verboseBinaryGCStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, verboseBinaryGCEnd, NULL);
+
+	/* GCOps */
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_MARK_END, verboseBinaryMarkEnd, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, verboseBinarySweepEnd, NULL);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_COMPACT_END, verboseBinaryCompactEnd, NULL);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+}
+
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseHandlerOutputStandardBinary::getBinaryWriter()
+{
+	MM_VerboseWriter *writer = _manager->getWriterChain()->getFirstWriter();
+	while (NULL != writer) {
+		if ((VERBOSE_WRITER_FILE_LOGGING_BINARY == writer->getType()) && writer->isActive()) {
+			break;
+		}
+		writer = writer->getNextWriter();
+	}
+	return (MM_VerboseWriterFileLoggingBinary *)writer;
+}
+
+MM_VerboseBinaryRecord *
+MM_VerboseHandlerOutputStandardBinary::reserveRecord(MM_EnvironmentBase *env, MM_VerboseWriterFileLoggingBinary *writer, uint32_t type, uint64_t *sequence)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_VerboseBinaryRecord *record = NULL;
+
+	if (NULL != writer) {
+		record = writer->reserveRecord(sequence);
+		if (NULL != record) {
+			record->wallTimeMs = omrtime_current_time_millis();
+			record->type = type;
+			record->flags = 0;
+			record->typeString = VERBOSEGC_BINARY_NO_STRING;
+			record->reasonString = VERBOSEGC_BINARY_NO_STRING;
+			record->id = _manager->getIdAndIncrement();
+			record->contextId = (NULL != env->_cycleState) ? env->_cycleState->_verboseContextID : 0;
+		}
+	}
+
+	return record;
+}
+
+void
+MM_VerboseHandlerOutputStandardBinary::recordInitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_InitializedEvent* event = (MM_InitializedEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_VerboseWriterFileLoggingBinary *writer = getBinaryWriter();
+	uint64_t sequence = 0;
+
+	_manager->setInitializedTime(event->timestamp);
+
+	MM_VerboseBinaryRecord *record = reserveRecord(env, writer, VERBOSEGC_BINARY_RECORD_INITIALIZED, &sequence);
+	if (NULL != record) {
+		record->contextId = 0;
+		record->typeString = writer->internString(_extensions->gcModeString);
+		record->reasonString = writer->internString(getPageTypeString(_extensions->heap->getPageFlags()));
+		record->data.initialized.maxHeapSize = _extensions->memoryMax;
+		record->data.initialized.initialHeapSize = _extensions->initialMemorySize;
+		record->data.initialized.pageSize = _extensions->heap->getPageSize();
+		record->data.initialized.requestedPageSize = _extensions->requestedPageSize;
+		record->data.initialized.gcThreads = _extensions->gcThreadCount;
+		record->data.initialized.packetListSplit = _extensions->packetListSplit;
+		record->data.initialized.splitFreeListSplitAmount = _extensions->splitFreeListSplitAmount;
+		record->data.initialized.numaNodes = _extensions->_numaManager.getAffinityLeaderCount();
+		record->data.initialized.physicalMemory = omrsysinfo_get_physical_memory();
+		record->data.initialized.numCPUs = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE);
+		writer->commitRecord(record, sequence);
+	}
+}
+
+void
+MM_VerboseHandlerOutputStandardBinary::recordCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCCycleStartEvent* event = (MM_GCCycleStartEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+	MM_VerboseWriterFileLoggingBinary *writer = getBinaryWriter();
+	uint64_t sequence = 0;
+
+	uint64_t deltaTime = 0;
+	bool deltaTimeSuccess = getCycleStartInterval(env, event->timestamp, &deltaTime);
+
+	MM_VerboseBinaryRecord *record = reserveRecord(env, writer, VERBOSEGC_BINARY_RECORD_CYCLE_START, &sequence);
+	if (NULL != record) {
+		env->_cycleState->_verboseContextID = (uintptr_t)record->id;
+		record->contextId = 0;
+		record->flags = deltaTimeSuccess ? 0 : VERBOSEGC_BINARY_FLAG_CLOCK_ERROR;
+		record->typeString = writer->internString(getCurrentCycleType(env));
+		record->data.cycleStart.intervalUs = deltaTime;
+		writer->commitRecord(record, sequence);
+	}
+}
+
+void
+MM_VerboseHandlerOutputStandardBinary::recordCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCPostCycleEndEvent* event = (MM_GCPostCycleEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_VerboseWriterFileLoggingBinary *writer = getBinaryWriter();
+	uint64_t sequence = 0;
+
+	MM_VerboseBinaryRecord *record = reserveRecord(env, writer, VERBOSEGC_BINARY_RECORD_CYCLE_END, &sequence);
+	if (NULL != record) {
+		record->typeString = writer->internString(getCurrentCycleType(env));
+		if ((OMR_GC_CYCLE_TYPE_GLOBAL == event->cycleType) && (FIXUP_NONE != event->fixHeapForWalkReason)) {
+			record->reasonString = writer->internString(getHeapFixupReasonString(event->fixHeapForWalkReason));
+			record->data.cycleEnd.fixupTimeUs = event->fixHeapForWalkTime;
+		} else {
+			record->data.cycleEnd.fixupTimeUs = 0;
+		}
+		writer->commitRecord(record, sequence);
+	}
+
+	/* rotates the log once a file holds the requested number of cycles */
+	_manager->getWriterChain()->endOfCycle(env);
+}
+
+void
+MM_VerboseHandlerOutputStandardBinary::recordGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCIncrementStartEvent * event = (MM_GCIncrementStartEvent *)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_CollectionStatistics *stats = (MM_CollectionStatistics *)event->stats;
+	MM_AllocationStats* systemStats = &_extensions->allocationStats;
+	MM_VerboseWriterFileLoggingBinary *writer = getBinaryWriter();
+	uint64_t sequence = 0;
+
+	MM_VerboseBinaryRecord *record = reserveRecord(env, writer, VERBOSEGC_BINARY_RECORD_GC_START, &sequence);
+	if (NULL != record) {
+		record->typeString = writer->internString(getCurrentCycleType(env));
+		record->data.gcStart.memInfoId = _manager->getIdAndIncrement();
+		record->data.gcStart.freeBytes = stats->_totalFreeHeapSize;
+		record->data.gcStart.totalBytes = stats->_totalHeapSize;
+		record->data.gcStart.allocatedBytes = systemStats->bytesAllocated();
+		record->data.gcStart.nonTLHBytes = systemStats->nontlhBytesAllocated();
+		record->data.gcStart.tlhBytes = systemStats->tlhBytesAllocated();
+		writer->commitRecord(record, sequence);
+	}
+}
+
+void
+MM_VerboseHandlerOutputStandardBinary::recordGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCIncrementEndEvent * event = (MM_GCIncrementEndEvent *)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_CollectionStatistics *stats = (MM_CollectionStatistics *)event->stats;
+	MM_VerboseWriterFileLoggingBinary *writer = getBinaryWriter();
+	uint64_t sequence = 0;
+	uint64_t durationInMicroseconds   = 0;
+	uint64_t userTimeInMicroseconds   = 0;
+	uint64_t systemTimeInMicroseconds = 0;
+	uint64_t stallTimeInMicroseconds  = 0;
+
+	/* convert from nanoseconds to microseconds */
+	uint64_t startUserTime   = (uint64_t)stats->_startProcessTimes._userTime   / 1000;
+	uint64_t startSystemTime = (uint64_t)stats->_startProcessTimes._systemTime / 1000;
+	uint64_t endUserTime     = (uint64_t)stats->_endProcessTimes._userTime     / 1000;
+	uint64_t endSystemTime   = (uint64_t)stats->_endProcessTimes._systemTime   / 1000;
+
+	bool getDurationTimeSuccessful = getTimeDeltaInMicroSeconds(&durationInMicroseconds, stats->_startTime, stats->_endTime);
+	bool getUserTimeSuccessful = getTimeDelta(&userTimeInMicroseconds, startUserTime, endUserTime);
+	bool getSystemTimeSuccessful = getTimeDelta(&systemTimeInMicroseconds, startSystemTime, endSystemTime);
+	bool getStallTimeSuccessful = getTimeDeltaInMicroSeconds(&stallTimeInMicroseconds, 0, stats->_stallTime);
+
+	MM_VerboseBinaryRecord *record = reserveRecord(env, writer, VERBOSEGC_BINARY_RECORD_GC_END, &sequence);
+	if (NULL != record) {
+		if (!getDurationTimeSuccessful || !getUserTimeSuccessful || !getSystemTimeSuccessful || !getStallTimeSuccessful) {
+			record->flags = VERBOSEGC_BINARY_FLAG_CLOCK_ERROR;
+		}
+		record->typeString = writer->internString(getCurrentCycleType(env));
+		record->data.gcEnd.memInfoId = _manager->getIdAndIncrement();
+		record->data.gcEnd.freeBytes = stats->_totalFreeHeapSize;
+		record->data.gcEnd.totalBytes = stats->_totalHeapSize;
+		record->data.gcEnd.durationUs = durationInMicroseconds;
+		record->data.gcEnd.userTimeUs = userTimeInMicroseconds;
+		record->data.gcEnd.systemTimeUs = systemTimeInMicroseconds;
+		record->data.gcEnd.stallTimeUs = stallTimeInMicroseconds;
+		record->data.gcEnd.activeThreads = _extensions->dispatcher->activeThreadCount();
+		writer->commitRecord(record, sequence);
+	}
+}
+
+void
+MM_VerboseHandlerOutputStandardBinary::recordMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_MarkEndEvent* event = (MM_MarkEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_MarkStats *markStats = &_extensions->globalGCStats.markStats;
+	MM_VerboseWriterFileLoggingBinary *writer = getBinaryWriter();
+	uint64_t sequence = 0;
+	uint64_t duration = 0;
+	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, markStats->_startTime, markStats->_endTime);
+
+	MM_VerboseBinaryRecord *record = reserveRecord(env, writer, VERBOSEGC_BINARY_RECORD_GC_OP_MARK, &sequence);
+	if (NULL != record) {
+		record->flags = deltaTimeSuccess ? 0 : VERBOSEGC_BINARY_FLAG_CLOCK_ERROR;
+		record->data.mark.timeUs = duration;
+		record->data.mark.objectsMarked = markStats->_objectsMarked;
+		record->data.mark.objectsScanned = markStats->_objectsScanned;
+		record->data.mark.bytesScanned = markStats->_bytesScanned;
+		writer->commitRecord(record, sequence);
+	}
+}
+
+void
+MM_VerboseHandlerOutputStandardBinary::recordSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_SweepEndEvent* event = (MM_SweepEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+	MM_VerboseWriterFileLoggingBinary *writer = getBinaryWriter();
+	uint64_t sequence = 0;
+	uint64_t duration = 0;
+	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
+
+	MM_VerboseBinaryRecord *record = reserveRecord(env, writer, VERBOSEGC_BINARY_RECORD_GC_OP_SWEEP, &sequence);
+	if (NULL != record) {
+		record->flags = deltaTimeSuccess ? 0 : VERBOSEGC_BINARY_FLAG_CLOCK_ERROR;
+		record->data.sweep.timeUs = duration;
+		writer->commitRecord(record, sequence);
+	}
+}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+void
+MM_VerboseHandlerOutputStandardBinary::recordCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_CompactEndEvent* event = (MM_CompactEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+	MM_CompactStats *compactStats = &_extensions->globalGCStats.compactStats;
+	MM_VerboseWriterFileLoggingBinary *writer = getBinaryWriter();
+	uint64_t sequence = 0;
+	uint64_t duration = 0;
+	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, compactStats->_startTime, compactStats->_endTime);
+
+	MM_VerboseBinaryRecord *record = reserveRecord(env, writer, VERBOSEGC_BINARY_RECORD_GC_OP_COMPACT, &sequence);
+	if (NULL != record) {
+		record->flags = deltaTimeSuccess ? 0 : VERBOSEGC_BINARY_FLAG_CLOCK_ERROR;
+		record->reasonString = writer->internString(getCompactionReasonAsString(compactStats->_compactReason));
+		record->data.compact.timeUs = duration;
+		record->data.compact.movedObjects = compactStats->_movedObjects;
+		record->data.compact.movedBytes = compactStats->_movedBytes;
+		record->data.compact.preventedReasonString = VERBOSEGC_BINARY_NO_STRING;
+		if (COMPACT_PREVENTED_NONE != compactStats->_compactPreventedReason) {
+			record->flags |= VERBOSEGC_BINARY_FLAG_COMPACT_PREVENTED;
+			record->data.compact.preventedReasonString = writer->internString(getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
+		}
+		writer->commitRecord(record, sequence);
+	}
+}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
+void
+MM_VerboseHandlerOutputStandardBinary::recordHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_HeapResizeEvent * event = (MM_HeapResizeEvent *)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	HeapResizeType resizeType = (HeapResizeType) event->resizeType;
+	uintptr_t reason = event->reason;
+	MM_VerboseWriterFileLoggingBinary *writer = getBinaryWriter();
+	uint64_t sequence = 0;
+
+	if ((0 == event->amount) || ((HEAP_EXPAND == resizeType) && (SATISFY_COLLECTOR == (ExpandReason)reason))) {
+		/* not reported, as in the XML output */
+		return;
+	}
+
+	MM_VerboseBinaryRecord *record = reserveRecord(env, writer, VERBOSEGC_BINARY_RECORD_HEAP_RESIZE, &sequence);
+	if (NULL != record) {
+		const char *resizeTypeName = NULL;
+		const char *reasonString = NULL;
+		getHeapResizeStrings(resizeType, reason, &resizeTypeName, &reasonString);
+		record->contextId = 0;
+		record->typeString = writer->internString(resizeTypeName);
+		record->reasonString = writer->internString(reasonString);
+		record->data.heapResize.amount = event->amount;
+		record->data.heapResize.count = 1;
+		record->data.heapResize.timeUs = event->timeTaken;
+		record->data.heapResize.spaceString = writer->internString(getSubSpaceType(event->subSpaceType));
+		record->data.heapResize.reserved = 0;
+		writer->commitRecord(record, sequence);
+	}
+}
+
+void
+verboseBinaryInitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandardBinary *)userData)->recordInitialized(hook, eventNum, eventData);
+}
+
+void
+verboseBinaryCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandardBinary *)userData)->recordCycleStart(hook, eventNum, eventData);
+}
+
+void
+verboseBinaryCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandardBinary *)userData)->recordCycleEnd(hook, eventNum, eventData);
+}
+
+void
+verboseBinaryGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandardBinary *)userData)->recordGCStart(hook, eventNum, eventData);
+}
+
+void
+verboseBinaryGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandardBinary *)userData)->recordGCEnd(hook, eventNum, eventData);
+}
+
+void
+verboseBinaryMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandardBinary *)userData)->recordMarkEnd(hook, eventNum, eventData);
+}
+
+void
+verboseBinarySweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandardBinary *)userData)->recordSweepEnd(hook, eventNum, eventData);
+}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+void
+verboseBinaryCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandardBinary *)userData)->recordCompactEnd(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
+void
+verboseBinaryHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandardBinary *)userData)->recordHeapResize(hook, eventNum, eventData);
+}
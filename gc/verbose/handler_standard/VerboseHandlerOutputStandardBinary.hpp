@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEHANDLEROUTPUTSTANDARDBINARY_HPP_)
+#define VERBOSEHANDLEROUTPUTSTANDARDBINARY_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "VerboseHandlerOutputStandard.hpp"
+
+class MM_EnvironmentBase;
+class MM_VerboseWriterFileLoggingBinary;
+struct MM_VerboseBinaryRecord;
+
+/**
+ * Verbose handler for -Xgc:binaryVerboseLog. Instead of formatting stanzas it records cycle, increment,
+ * GC operation and heap resize events as fixed layout records into the binary file writer, which are
+ * rendered as verbose:gc XML offline.
+ * @see MM_VerboseWriterFileLoggingBinary
+ */
+class MM_VerboseHandlerOutputStandardBinary : public MM_VerboseHandlerOutputStandard
+{
+private:
+protected:
+public:
+
+private:
+	/**
+	 * Answer the active binary writer of the writer chain, if any.
+	 */
+	MM_VerboseWriterFileLoggingBinary *getBinaryWriter();
+
+	/**
+	 * Claim a record of the binary writer and fill in the fields common to all records.
+	 * @param writer the binary writer
+	 * @param type VERBOSEGC_BINARY_RECORD_* type of the record
+	 * @param[out] sequence sequence number to commit the record with
+	 * @return the record, or NULL if nothing can be recorded
+	 */
+	MM_VerboseBinaryRecord *reserveRecord(MM_EnvironmentBase *env, MM_VerboseWriterFileLoggingBinary *writer, uint32_t type, uint64_t *sequence);
+
+protected:
+	MM_VerboseHandlerOutputStandardBinary(MM_GCExtensionsBase *extensions) :
+		MM_VerboseHandlerOutputStandard(extensions)
+	{};
+
+public:
+	static MM_VerboseHandlerOutput *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual void enableVerbose();
+	virtual void disableVerbose();
+
+	void recordInitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void recordCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void recordCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void recordGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void recordGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void recordMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void recordSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	void recordCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+	void recordHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+};
+
+#endif /* VERBOSEHANDLEROUTPUTSTANDARDBINARY_HPP_ */
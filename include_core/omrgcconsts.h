@@ -294,7 +294,8 @@ typedef enum {
 	COMPACT_CONTRACT = 11,
 	COMPACT_AGGRESSIVE= 12,
 	COMPACT_PAGE = 13,
-	COMPACT_MICRO_FRAG = 14
+	COMPACT_MICRO_FRAG = 14,
+	COMPACT_FRAGMENTATION_FORECAST = 15
 } CompactReason;
 
 typedef enum {
@@ -435,6 +436,8 @@ typedef enum {
 	SATISFY_EXPAND,
 	FORCED_NURSERY_CONTRACT,
 	SOFT_MX_CONTRACT,
+	PAUSE_TIME_ABOVE_TARGET,
+	GC_TIME_BELOW_TARGET,
 } ContractReason;
 
 typedef enum {
@@ -447,7 +450,8 @@ typedef enum {
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
 	FORCED_NURSERY_EXPAND,
-	HINT_PREVIOUS_RUNS
+	HINT_PREVIOUS_RUNS,
+	GC_TIME_ABOVE_TARGET
 } ExpandReason;
 
 typedef enum {
@@ -474,7 +478,8 @@ typedef enum {
 	CONTRACTION_REQUIRED,
 	EXPANSION_REQUIRED,
 	LOA_RESIZE,
-	SYSTEM_GC
+	SYSTEM_GC,
+	HEAP_WALK_REQUIRED
 } SweepCompletionReason;
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -0,0 +1,427 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "control/CodeStore.hpp"
+
+#if defined(OMR_OS_WINDOWS)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+#include <new>
+#include <stdio.h>
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/FrontEnd.hpp"
+#include "env/RawAllocator.hpp"
+#include "env/VerboseLog.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
+
+#define CODE_STORE_MAGIC 0x4A42434Fu /* "JBCO" */
+#define CODE_STORE_VERSION 1
+#define CODE_STORE_ALIGNMENT 64 /* the body keeps its start address modulo this */
+#define CODE_STORE_PATH_LENGTH 1024
+
+namespace
+{
+
+/**
+ * The layout of a stored body: this header, then the key, the code and the relocation records.
+ */
+struct EntryHeader
+   {
+   uint32_t _magic;
+   uint32_t _version;
+   uint32_t _keyLength;
+   uint32_t _codeLength;
+   uint32_t _entryOffset;
+   uint32_t _relocationsLength; /**< in bytes */
+   uint64_t _codeStart; /**< the address the body was compiled at */
+   };
+
+/**
+ * Each relocation record is followed by the name of its symbol.
+ */
+struct RelocationRecord
+   {
+   uint32_t _offset; /**< from the start of the body */
+   uint8_t _size; /**< a TR::StaticRelocationSize */
+   uint8_t _type; /**< a TR::StaticRelocationType */
+   uint16_t _symbolLength; /**< zero for a reference the body makes to itself */
+   };
+
+}
+
+static void
+appendToKey(std::vector<uint8_t> &key, const void *bytes, size_t length)
+   {
+   const uint8_t *cursor = static_cast<const uint8_t *>(bytes);
+   key.insert(key.end(), cursor, cursor + length);
+   }
+
+static void
+appendStringToKey(std::vector<uint8_t> &key, const char *string)
+   {
+   uint32_t length = (NULL != string) ? static_cast<uint32_t>(strlen(string)) : 0;
+   appendToKey(key, &length, sizeof(length));
+   appendToKey(key, string, length);
+   }
+
+// 64-bit FNV-1a
+static uint64_t
+hashKey(const std::vector<uint8_t> &key)
+   {
+   uint64_t hash = 0xCBF29CE484222325ULL;
+   for (size_t i = 0; i < key.size(); i++)
+      {
+      hash ^= key[i];
+      hash *= 0x100000001B3ULL;
+      }
+   return hash;
+   }
+
+static bool
+readFile(const char *path, std::vector<uint8_t> &contents)
+   {
+   FILE *file = fopen(path, "rb");
+   if (NULL == file)
+      return false;
+
+   bool success = false;
+   if (0 == fseek(file, 0, SEEK_END))
+      {
+      long length = ftell(file);
+      if ((length > 0) && (0 == fseek(file, 0, SEEK_SET)))
+         {
+         contents.resize(length);
+         success = (fread(&contents[0], 1, length, file) == (size_t)length);
+         }
+      }
+   fclose(file);
+   return success;
+   }
+
+static uint32_t
+relocationWidth(uint8_t size)
+   {
+   switch (size)
+      {
+      case TR::StaticRelocationSize::word32: return 4;
+      case TR::StaticRelocationSize::word64: return 8;
+      default: return 0;
+      }
+   }
+
+JitBuilder::CodeStore *JitBuilder::CodeStore::_instance = NULL;
+
+JitBuilder::CodeStore::CodeStore(const char *directory, const char *options) :
+   _directory(directory, directory + strlen(directory) + 1)
+   {
+   // anything outside the IL that selects the code a method compiles to
+   uint32_t version = CODE_STORE_VERSION;
+   appendToKey(_keyPrefix, &version, sizeof(version));
+   uint32_t pointerSize = sizeof(void *);
+   appendToKey(_keyPrefix, &pointerSize, sizeof(pointerSize));
+   appendStringToKey(_keyPrefix, options);
+   appendStringToKey(_keyPrefix, feGetEnv("TR_Options"));
+   OMRProcessorDesc processor = TR::Compiler->target.cpu.getProcessorDescription();
+   appendToKey(_keyPrefix, &processor, sizeof(processor));
+   }
+
+bool
+JitBuilder::CodeStore::open(const char *directory, const char *options)
+   {
+#if defined(TR_TARGET_X86) && defined(TR_TARGET_64BIT) && !defined(OMR_OS_WINDOWS)
+   if ((NULL != _instance) || (NULL == directory))
+      return false;
+
+   TR::RawAllocator rawAllocator;
+   void *storage = rawAllocator.allocate(sizeof(CodeStore), std::nothrow);
+   if (NULL == storage)
+      return false;
+
+   _instance = new (storage) CodeStore(directory, options);
+   return true;
+#else
+   return false;
+#endif /* defined(TR_TARGET_X86) && defined(TR_TARGET_64BIT) && !defined(OMR_OS_WINDOWS) */
+   }
+
+void
+JitBuilder::CodeStore::close()
+   {
+   CodeStore *store = _instance;
+   if (NULL == store)
+      return;
+
+   _instance = NULL;
+   store->~CodeStore();
+   TR::RawAllocator rawAllocator;
+   rawAllocator.deallocate(store);
+   }
+
+int32_t
+JitBuilder::CodeStore::compile(TR::MethodBuilder *methodBuilder, void **entry, TR::SegmentAllocator *scratchSegmentProvider)
+   {
+   Request request(this);
+   int32_t rc = methodBuilder->Compile(entry, scratchSegmentProvider, &request);
+   if (COMPILATION_SUCCEEDED == rc)
+      request.save();
+   return rc;
+   }
+
+void
+JitBuilder::CodeStore::entryPath(uint64_t hash, char *path, size_t pathLength)
+   {
+   snprintf(path, pathLength, "%s/%016llx.jbcode", &_directory[0], (unsigned long long)hash);
+   }
+
+uint8_t *
+JitBuilder::CodeStore::install(TR::MethodBuilder *methodBuilder, const uint8_t *entry, size_t entryLength, const std::vector<uint8_t> &key)
+   {
+   EntryHeader header;
+   if (entryLength < sizeof(header))
+      return NULL;
+   memcpy(&header, entry, sizeof(header));
+   if ((CODE_STORE_MAGIC != header._magic) || (CODE_STORE_VERSION != header._version))
+      return NULL;
+   if (sizeof(header) + (uint64_t)header._keyLength + header._codeLength + header._relocationsLength != entryLength)
+      return NULL;
+   if (header._entryOffset >= header._codeLength)
+      return NULL;
+
+   // a different key that hashed to the same file
+   if ((header._keyLength != key.size()) || (0 != memcmp(entry + sizeof(header), &key[0], key.size())))
+      return NULL;
+
+   const uint8_t *code = entry + sizeof(header) + header._keyLength;
+   const uint8_t *relocations = code + header._codeLength;
+   const uint8_t *relocationsEnd = relocations + header._relocationsLength;
+
+   // Resolve every symbol before taking any code memory, so that a body that cannot be used costs nothing
+   std::vector<uintptr_t> targets;
+   for (const uint8_t *cursor = relocations; cursor < relocationsEnd; )
+      {
+      RelocationRecord record;
+      if ((size_t)(relocationsEnd - cursor) < sizeof(record))
+         return NULL;
+      memcpy(&record, cursor, sizeof(record));
+      cursor += sizeof(record);
+
+      uint32_t width = relocationWidth(record._size);
+      if ((0 == width)
+          || (TR::StaticRelocationType::Absolute != record._type)
+          || ((uint64_t)record._offset + width > header._codeLength)
+          || ((size_t)(relocationsEnd - cursor) < record._symbolLength))
+         return NULL;
+
+      uintptr_t target = 0;
+      if (record._symbolLength > 0)
+         {
+         std::vector<char> symbol(cursor, cursor + record._symbolLength);
+         symbol.push_back('\0');
+         TR::ResolvedMethod *function = methodBuilder->lookupFunction(&symbol[0]);
+         if ((NULL == function) || (NULL == function->getEntryPoint()))
+            return NULL;
+         target = (uintptr_t)function->getEntryPoint();
+         }
+      targets.push_back(target);
+      cursor += record._symbolLength;
+      }
+
+   TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+   size_t allocationSize = header._codeLength + CODE_STORE_ALIGNMENT - 1;
+   int32_t numReserved = 0;
+   TR::CodeCache *codeCache = manager->reserveCodeCache(false, allocationSize, 0, &numReserved);
+   if (NULL == codeCache)
+      return NULL;
+   uint8_t *coldCode = NULL;
+   uint8_t *memory = manager->allocateCodeMemory(allocationSize, 0, &codeCache, &coldCode, false);
+   manager->unreserveCodeCache(codeCache);
+   if (NULL == memory)
+      return NULL;
+
+   // keep the alignment the body was compiled with, as it may hold aligned constants
+   uint8_t *body = memory + ((header._codeStart - (uintptr_t)memory) & (CODE_STORE_ALIGNMENT - 1));
+   memcpy(body, code, header._codeLength);
+
+   uintptr_t displacement = (uintptr_t)body - (uintptr_t)header._codeStart;
+   size_t index = 0;
+   for (const uint8_t *cursor = relocations; cursor < relocationsEnd; index++)
+      {
+      RelocationRecord record;
+      memcpy(&record, cursor, sizeof(record));
+      cursor += sizeof(record) + record._symbolLength;
+
+      uint8_t *location = body + record._offset;
+      if (8 == relocationWidth(record._size))
+         {
+         uint64_t value = targets[index];
+         if (0 == record._symbolLength)
+            {
+            memcpy(&value, location, sizeof(value));
+            value += displacement;
+            }
+         memcpy(location, &value, sizeof(value));
+         }
+      else
+         {
+         uint32_t value = (uint32_t)targets[index];
+         if (0 == record._symbolLength)
+            {
+            memcpy(&value, location, sizeof(value));
+            value += (uint32_t)displacement;
+            }
+         memcpy(location, &value, sizeof(value));
+         }
+      }
+
+   return body + header._entryOffset;
+   }
+
+void *
+JitBuilder::CodeStore::Request::lookup(TR::MethodBuilder *methodBuilder, const uint8_t *fingerprint, uint32_t fingerprintLength)
+   {
+   _key = _store->_keyPrefix;
+   appendToKey(_key, fingerprint, fingerprintLength);
+   _hash = hashKey(_key);
+
+   char path[CODE_STORE_PATH_LENGTH];
+   _store->entryPath(_hash, path, sizeof(path));
+   std::vector<uint8_t> entry;
+   if (!readFile(path, entry))
+      return NULL;
+
+   uint8_t *entryPoint = _store->install(methodBuilder, &entry[0], entry.size(), _key);
+   if ((NULL != entryPoint) && TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompileEnd))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "code store installed %s @ " POINTER_PRINTF_FORMAT, path, entryPoint);
+
+   // a stored body that cannot be installed is replaced by the one compiled now
+   return entryPoint;
+   }
+
+void
+JitBuilder::CodeStore::Request::collectBody(uint8_t *codeStart, uint8_t *codeEnd, uint8_t *entryPoint)
+   {
+   _code.assign(codeStart, codeEnd);
+   _codeStart = (uintptr_t)codeStart;
+   _entryOffset = (uint32_t)(entryPoint - codeStart);
+   if ((entryPoint < codeStart) || (entryPoint >= codeEnd))
+      notStorable("its entry point is outside the body");
+   }
+
+void
+JitBuilder::CodeStore::Request::collectRelocation(const TR::StaticRelocation &relocation)
+   {
+   RelocationRecord record;
+   record._size = (uint8_t)relocation.size();
+   record._type = (uint8_t)relocation.type();
+   record._symbolLength = (NULL != relocation.symbol()) ? (uint16_t)strlen(relocation.symbol()) : 0;
+
+   uint32_t width = relocationWidth(record._size);
+   uint64_t offset = (uint64_t)((uintptr_t)relocation.location() - _codeStart);
+   if ((0 == width) || (TR::StaticRelocationType::Absolute != relocation.type()))
+      {
+      notStorable("it has a relocation that is not absolute");
+      return;
+      }
+   if (((uintptr_t)relocation.location() < _codeStart) || (offset + width > _code.size()))
+      {
+      // a TableSwitch jump table is allocated apart from the body, and would not be installed with it
+      notStorable("it has a relocation outside the body, such as a jump table entry");
+      return;
+      }
+
+   record._offset = (uint32_t)offset;
+   appendToKey(_relocations, &record, sizeof(record));
+   appendToKey(_relocations, relocation.symbol(), record._symbolLength);
+   }
+
+void
+JitBuilder::CodeStore::Request::notStorable(const char *reason)
+   {
+   if (NULL == _notStorableReason)
+      _notStorableReason = reason;
+   }
+
+bool
+JitBuilder::CodeStore::Request::save()
+   {
+   if (_key.empty() || _code.empty())
+      return false;
+
+   char path[CODE_STORE_PATH_LENGTH];
+   _store->entryPath(_hash, path, sizeof(path));
+   if (NULL != _notStorableReason)
+      {
+      if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompileEnd))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "code store did not save %s: %s", path, _notStorableReason);
+      return false;
+      }
+
+   EntryHeader header;
+   header._magic = CODE_STORE_MAGIC;
+   header._version = CODE_STORE_VERSION;
+   header._keyLength = (uint32_t)_key.size();
+   header._codeLength = (uint32_t)_code.size();
+   header._entryOffset = _entryOffset;
+   header._relocationsLength = (uint32_t)_relocations.size();
+   header._codeStart = _codeStart;
+
+   char temporaryPath[CODE_STORE_PATH_LENGTH];
+   // unique among the processes and compilation threads that share the directory
+#if defined(OMR_OS_WINDOWS)
+   int pid = _getpid();
+#else
+   int pid = (int)getpid();
+#endif
+   int length = snprintf(temporaryPath, sizeof(temporaryPath), "%s.%d.%p.tmp", path, pid, (void *)this);
+   if ((length < 0) || ((size_t)length >= sizeof(temporaryPath)))
+      return false;
+
+   FILE *file = fopen(temporaryPath, "wb");
+   if (NULL == file)
+      return false;
+
+   bool written = (1 == fwrite(&header, sizeof(header), 1, file))
+      && (1 == fwrite(&_key[0], _key.size(), 1, file))
+      && (1 == fwrite(&_code[0], _code.size(), 1, file))
+      && (_relocations.empty() || (1 == fwrite(&_relocations[0], _relocations.size(), 1, file)));
+   written = (0 == fclose(file)) && written;
+
+   // readers see either the previous file or the complete new one
+   if (!written || (0 != rename(temporaryPath, path)))
+      {
+      remove(temporaryPath);
+      return false;
+      }
+
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompileEnd))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "code store saved %s", path);
+   return true;
+   }
@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef JITBUILDER_CODESTORE_INCL
+#define JITBUILDER_CODESTORE_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "ilgen/CompiledBodyStore.hpp"
+
+namespace TR { class MethodBuilder; }
+namespace TR { class SegmentAllocator; }
+
+namespace JitBuilder
+{
+
+/**
+ * Keeps compiled method bodies in a directory, so that a later process compiling identical IL
+ * installs the stored body in its code cache instead of optimizing the IL and generating code again.
+ *
+ * Each body is kept in its own file, named after a hash of its key. The key is the fingerprint of the
+ * method builder's IL together with the Jit options and the processor features, and the whole key is
+ * stored with the body and compared on lookup, so a hash collision only costs a compilation. A stored
+ * body is installed with the same alignment it was compiled with, references it makes to itself are
+ * rebased, and calls to functions defined on the method builder are relocated to their entry points
+ * in the current process. A body is written to a temporary file and renamed into place, so processes
+ * can share a directory.
+ *
+ * The store only supports x86-64 Linux and OSX, the platforms that record static relocations for
+ * calls. A body that refers to code memory allocated apart from it, such as the jump table of a
+ * TableSwitch, is not stored, so such a method builder is compiled again every time; with
+ * verbose={compileEnd} the reason is logged. The directory should be emptied when the JitBuilder
+ * library itself changes.
+ */
+class CodeStore
+   {
+public:
+
+   /**
+    * @brief open the store kept in a directory
+    * @param directory an existing directory
+    * @param options the option string the Jit was initialized with, or NULL
+    * @return true if the store was opened, false if it is already open or not supported on this platform
+    */
+   static bool open(const char *directory, const char *options);
+
+   /**
+    * @brief close the store; bodies already installed stay in the code cache
+    */
+   static void close();
+
+   static CodeStore *instance() { return _instance; }
+
+   /**
+    * @brief compile a method builder, installing a stored body if one was compiled for identical IL,
+    *        and adding the body to the store otherwise
+    * @return the compilation return code
+    */
+   int32_t compile(TR::MethodBuilder *methodBuilder, void **entry, TR::SegmentAllocator *scratchSegmentProvider);
+
+private:
+
+   /**
+    * Attached to a single compilation: looks its IL up in the store, and otherwise collects the
+    * body that the compilation produces so that it can be saved.
+    */
+   class Request : public TR::CompiledBodyStore
+      {
+   public:
+      Request(CodeStore *store) : _store(store), _hash(0), _codeStart(0), _entryOffset(0), _notStorableReason(NULL) { }
+
+      virtual void *lookup(TR::MethodBuilder *methodBuilder, const uint8_t *fingerprint, uint32_t fingerprintLength);
+      virtual void collectBody(uint8_t *codeStart, uint8_t *codeEnd, uint8_t *entryPoint);
+      virtual void collectRelocation(const TR::StaticRelocation &relocation);
+
+      /**
+       * @brief write the collected body to the store, if the IL was looked up and the body can be relocated
+       */
+      bool save();
+
+   private:
+      /**
+       * @brief keep the collected body out of the store; the first reason given is logged by save()
+       */
+      void notStorable(const char *reason);
+
+      CodeStore *_store;
+      std::vector<uint8_t> _key;
+      uint64_t _hash;
+      std::vector<uint8_t> _code;
+      uint64_t _codeStart; /**< the address the body was compiled at */
+      uint32_t _entryOffset;
+      std::vector<uint8_t> _relocations; /**< relocation records, in the format of the store's files */
+      const char *_notStorableReason; /**< NULL while the collected body can be stored */
+      };
+
+   CodeStore(const char *directory, const char *options);
+
+   void entryPath(uint64_t hash, char *path, size_t pathLength);
+   uint8_t *install(TR::MethodBuilder *methodBuilder, const uint8_t *entry, size_t entryLength, const std::vector<uint8_t> &key);
+
+   static CodeStore *_instance;
+
+   std::vector<char> _directory;
+   std::vector<uint8_t> _keyPrefix; /**< the part of every key that does not depend on the IL */
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_CODESTORE_INCL)
@@ -0,0 +1,331 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "control/CompilationQueue.hpp"
+
+#include <new>
+#include "AtomicSupport.hpp"
+#include "compile/Compilation.hpp"
+#include "env/SystemSegmentProvider.hpp"
+#include "ilgen/MethodBuilder.hpp"
+
+extern int32_t compileMethodBuilderWithSegmentProvider(TR::MethodBuilder *m, void **entry, TR::SegmentAllocator *scratchSegmentProvider);
+
+JitBuilder::CompilationQueue *JitBuilder::CompilationQueue::_instance = NULL;
+
+JitBuilder::CompilationQueue::CompilationQueue(TR::RawAllocator rawAllocator) :
+   _rawAllocator(rawAllocator),
+   _queued(NULL),
+   _compiling(NULL),
+   _finished(NULL),
+   _outstanding(0),
+   _shuttingDown(false),
+   _numThreads(0)
+#if !defined(OMR_OS_WINDOWS)
+   , _threads(NULL)
+#endif /* !defined(OMR_OS_WINDOWS) */
+   {
+   }
+
+bool
+JitBuilder::CompilationQueue::startup(int32_t numThreads)
+   {
+   if ((NULL != _instance) || (numThreads < 1))
+      return false;
+
+   TR::RawAllocator rawAllocator;
+   CompilationQueue *queue = new (rawAllocator.allocate(sizeof(CompilationQueue), std::nothrow)) CompilationQueue(rawAllocator);
+   if (NULL == queue)
+      return false;
+
+   if (!queue->startThreads(numThreads))
+      {
+      queue->~CompilationQueue();
+      rawAllocator.deallocate(queue);
+      return false;
+      }
+
+   _instance = queue;
+   return true;
+   }
+
+void
+JitBuilder::CompilationQueue::shutdown()
+   {
+   CompilationQueue *queue = _instance;
+   if (NULL == queue)
+      return;
+
+   queue->waitForAll();
+   queue->stopThreads();
+
+   while (NULL != queue->_finished)
+      {
+      Request *request = queue->_finished;
+      queue->_finished = request->_next;
+      queue->_rawAllocator.deallocate(request);
+      }
+
+   _instance = NULL;
+   TR::RawAllocator rawAllocator = queue->_rawAllocator;
+   queue->~CompilationQueue();
+   rawAllocator.deallocate(queue);
+   }
+
+int32_t
+JitBuilder::CompilationQueue::enqueue(TR::MethodBuilder *methodBuilder, int32_t priority, void **entryPoint, AsyncCompilationCallback callback, void *userData)
+   {
+   Request *request = static_cast<Request *>(_rawAllocator.allocate(sizeof(Request), std::nothrow));
+   if (NULL == request)
+      return COMPILATION_FAILED;
+
+   request->_methodBuilder = methodBuilder;
+   request->_priority = priority;
+   request->_entryPoint = entryPoint;
+   request->_callback = callback;
+   request->_userData = userData;
+   request->_returnCode = COMPILATION_REQUESTED;
+   request->_next = NULL;
+
+#if !defined(OMR_OS_WINDOWS)
+   pthread_mutex_lock(&_mutex);
+#endif /* !defined(OMR_OS_WINDOWS) */
+   Request **insertionPoint = &_queued;
+   while ((NULL != *insertionPoint) && ((*insertionPoint)->_priority >= priority))
+      insertionPoint = &(*insertionPoint)->_next;
+   request->_next = *insertionPoint;
+   *insertionPoint = request;
+   _outstanding += 1;
+#if !defined(OMR_OS_WINDOWS)
+   pthread_cond_signal(&_requestQueued);
+   pthread_mutex_unlock(&_mutex);
+#endif /* !defined(OMR_OS_WINDOWS) */
+
+   return COMPILATION_REQUESTED;
+   }
+
+int32_t
+JitBuilder::CompilationQueue::waitFor(TR::MethodBuilder *methodBuilder)
+   {
+   int32_t returnCode = COMPILATION_FAILED;
+#if !defined(OMR_OS_WINDOWS)
+   pthread_mutex_lock(&_mutex);
+#endif /* !defined(OMR_OS_WINDOWS) */
+   while (true)
+      {
+      // the oldest finished request for the builder, if any, was made before the queued ones
+      Request *request = _finished;
+      while ((NULL != request) && (request->_methodBuilder != methodBuilder))
+         request = request->_next;
+      if (NULL != request)
+         {
+         returnCode = request->_returnCode;
+         unlink(request, &_finished);
+         _rawAllocator.deallocate(request);
+         break;
+         }
+      if (!isOutstanding(methodBuilder))
+         break;
+#if !defined(OMR_OS_WINDOWS)
+      pthread_cond_wait(&_requestFinished, &_mutex);
+#endif /* !defined(OMR_OS_WINDOWS) */
+      }
+#if !defined(OMR_OS_WINDOWS)
+   pthread_mutex_unlock(&_mutex);
+#endif /* !defined(OMR_OS_WINDOWS) */
+   return returnCode;
+   }
+
+void
+JitBuilder::CompilationQueue::waitForAll()
+   {
+#if !defined(OMR_OS_WINDOWS)
+   pthread_mutex_lock(&_mutex);
+   while (0 != _outstanding)
+      pthread_cond_wait(&_requestFinished, &_mutex);
+   pthread_mutex_unlock(&_mutex);
+#endif /* !defined(OMR_OS_WINDOWS) */
+   }
+
+bool
+JitBuilder::CompilationQueue::isOutstanding(TR::MethodBuilder *methodBuilder)
+   {
+   // called with the queue locked
+   Request *lists[] = { _queued, _compiling };
+   for (int32_t i = 0; i < 2; i++)
+      {
+      for (Request *request = lists[i]; NULL != request; request = request->_next)
+         {
+         if ((request->_methodBuilder == methodBuilder) && (NULL == request->_callback))
+            return true;
+         }
+      }
+   return false;
+   }
+
+void
+JitBuilder::CompilationQueue::compile(Request *request, TR::SegmentAllocator *scratchSegmentProvider)
+   {
+   void *entry = NULL;
+   request->_returnCode = compileMethodBuilderWithSegmentProvider(request->_methodBuilder, &entry, scratchSegmentProvider);
+   if (COMPILATION_SUCCEEDED != request->_returnCode)
+      entry = NULL;
+
+   // the code must be visible to other threads before the entry point that leads to it
+   VM_AtomicSupport::writeBarrier();
+   *(void * volatile *)request->_entryPoint = entry;
+
+   if (NULL != request->_callback)
+      request->_callback(request->_userData, entry, request->_returnCode);
+   }
+
+void
+JitBuilder::CompilationQueue::complete(Request *request)
+   {
+   // called with the queue locked
+   unlink(request, &_compiling);
+   _outstanding -= 1;
+   if (NULL != request->_callback)
+      {
+      _rawAllocator.deallocate(request);
+      }
+   else
+      {
+      // keep finished requests in completion order, so waitFor() returns the oldest first
+      Request **tail = &_finished;
+      while (NULL != *tail)
+         tail = &(*tail)->_next;
+      *tail = request;
+      }
+   }
+
+void
+JitBuilder::CompilationQueue::unlink(Request *request, Request **list)
+   {
+   while (*list != request)
+      list = &(*list)->_next;
+   *list = request->_next;
+   request->_next = NULL;
+   }
+
+#if defined(OMR_OS_WINDOWS)
+
+bool
+JitBuilder::CompilationQueue::startThreads(int32_t numThreads)
+   {
+   // compilation threads are not implemented on this platform, so no queue is ever created
+   return false;
+   }
+
+void
+JitBuilder::CompilationQueue::stopThreads()
+   {
+   }
+
+#else /* defined(OMR_OS_WINDOWS) */
+
+bool
+JitBuilder::CompilationQueue::startThreads(int32_t numThreads)
+   {
+   _threads = static_cast<pthread_t *>(_rawAllocator.allocate(numThreads * sizeof(pthread_t), std::nothrow));
+   if (NULL == _threads)
+      return false;
+
+   pthread_mutex_init(&_mutex, NULL);
+   pthread_cond_init(&_requestQueued, NULL);
+   pthread_cond_init(&_requestFinished, NULL);
+
+   for (_numThreads = 0; _numThreads < numThreads; _numThreads++)
+      {
+      if (0 != pthread_create(&_threads[_numThreads], NULL, compilationThreadMain, this))
+         {
+         stopThreads();
+         return false;
+         }
+      }
+   return true;
+   }
+
+void
+JitBuilder::CompilationQueue::stopThreads()
+   {
+   pthread_mutex_lock(&_mutex);
+   _shuttingDown = true;
+   pthread_cond_broadcast(&_requestQueued);
+   pthread_mutex_unlock(&_mutex);
+
+   for (int32_t i = 0; i < _numThreads; i++)
+      pthread_join(_threads[i], NULL);
+
+   pthread_cond_destroy(&_requestFinished);
+   pthread_cond_destroy(&_requestQueued);
+   pthread_mutex_destroy(&_mutex);
+   _rawAllocator.deallocate(_threads);
+   _threads = NULL;
+   _numThreads = 0;
+   }
+
+void *
+JitBuilder::CompilationQueue::compilationThreadMain(void *queue)
+   {
+   static_cast<CompilationQueue *>(queue)->run();
+   return NULL;
+   }
+
+JitBuilder::CompilationQueue::Request *
+JitBuilder::CompilationQueue::nextRequest()
+   {
+   // called with the queue locked
+   while ((NULL == _queued) && !_shuttingDown)
+      pthread_cond_wait(&_requestQueued, &_mutex);
+
+   Request *request = _queued;
+   if (NULL != request)
+      {
+      unlink(request, &_queued);
+      request->_next = _compiling;
+      _compiling = request;
+      }
+   return request;
+   }
+
+void
+JitBuilder::CompilationQueue::run()
+   {
+   // scratch segments of this thread's compilations never come from a provider another thread is using
+   TR::RawAllocator rawAllocator;
+   TR::SystemSegmentProvider scratchSegmentProvider(1 << 16, rawAllocator);
+
+   pthread_mutex_lock(&_mutex);
+   Request *request = NULL;
+   while (NULL != (request = nextRequest()))
+      {
+      pthread_mutex_unlock(&_mutex);
+      compile(request, &scratchSegmentProvider);
+      pthread_mutex_lock(&_mutex);
+      complete(request);
+      pthread_cond_broadcast(&_requestFinished);
+      }
+   pthread_mutex_unlock(&_mutex);
+   }
+
+#endif /* defined(OMR_OS_WINDOWS) */
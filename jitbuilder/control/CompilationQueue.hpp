@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef JITBUILDER_COMPILATIONQUEUE_INCL
+#define JITBUILDER_COMPILATIONQUEUE_INCL
+
+#include <stdint.h>
+#if !defined(OMR_OS_WINDOWS)
+#include <pthread.h>
+#endif /* !defined(OMR_OS_WINDOWS) */
+
+#include "env/RawAllocator.hpp"
+
+namespace TR { class MethodBuilder; }
+namespace TR { class SegmentAllocator; }
+
+extern "C"
+{
+/**
+ * Called on a compilation thread once an asynchronous compilation has finished and its
+ * entry point, NULL if the compilation failed, has been installed.
+ */
+typedef void (*AsyncCompilationCallback)(void *userData, void *entryPoint, int32_t returnCode);
+}
+
+namespace JitBuilder
+{
+
+/**
+ * Compiles method builders on a pool of compilation threads, so the thread that requests a
+ * compilation does not wait for it. Requests are served highest priority first, and in request
+ * order within a priority. The entry point is stored to the requester's slot, with a write barrier
+ * ahead of it, only once the code is complete, so an interpreter can dispatch through that slot
+ * without locking. The requester then either gets a callback on the compilation thread or collects
+ * the return code with waitFor().
+ *
+ * Each compilation thread owns the segment provider for the scratch memory of its compilations.
+ * Method builders compiled concurrently must not share a TypeDictionary.
+ *
+ * Compilation threads are only implemented with pthreads. On Windows startup() always fails, so
+ * there is no queue and asynchronous requests are refused rather than compiled synchronously.
+ */
+class CompilationQueue
+   {
+public:
+
+   /**
+    * @brief create the queue and start its compilation threads
+    * @param numThreads the number of compilation threads, at least one
+    * @return true if the threads were started, false if they could not be, the queue is already running
+    *         or the platform has no compilation threads (Windows)
+    */
+   static bool startup(int32_t numThreads);
+
+   /**
+    * @brief finish every queued compilation, then stop the compilation threads and destroy the queue
+    */
+   static void shutdown();
+
+   static CompilationQueue *instance() { return _instance; }
+
+   /**
+    * @brief queue a method builder for compilation
+    * @param methodBuilder the method builder, which must stay alive until its compilation has finished
+    * @param priority requests with a larger priority are compiled first
+    * @param entryPoint slot that receives the entry point; it must stay valid until the compilation has finished
+    * @param callback if not NULL, called once the compilation has finished; the request cannot then be waited for
+    * @param userData passed to callback
+    * @return COMPILATION_REQUESTED, or COMPILATION_FAILED if the request could not be queued
+    */
+   int32_t enqueue(TR::MethodBuilder *methodBuilder, int32_t priority, void **entryPoint, AsyncCompilationCallback callback, void *userData);
+
+   /**
+    * @brief wait for the oldest outstanding request, made without a callback, to compile a method builder
+    * @return the return code of the compilation, or COMPILATION_FAILED if there is no such request
+    */
+   int32_t waitFor(TR::MethodBuilder *methodBuilder);
+
+   /**
+    * @brief wait until every queued compilation has finished
+    */
+   void waitForAll();
+
+private:
+
+   struct Request
+      {
+      TR::MethodBuilder *_methodBuilder;
+      int32_t _priority;
+      void **_entryPoint;
+      AsyncCompilationCallback _callback;
+      void *_userData;
+      int32_t _returnCode;
+      Request *_next;
+      };
+
+   CompilationQueue(TR::RawAllocator rawAllocator);
+
+   bool startThreads(int32_t numThreads);
+   void stopThreads();
+
+   Request *nextRequest();
+   bool isOutstanding(TR::MethodBuilder *methodBuilder);
+   void compile(Request *request, TR::SegmentAllocator *scratchSegmentProvider);
+   void complete(Request *request);
+   void unlink(Request *request, Request **list);
+
+#if !defined(OMR_OS_WINDOWS)
+   static void *compilationThreadMain(void *queue);
+#endif /* !defined(OMR_OS_WINDOWS) */
+   void run();
+
+   static CompilationQueue *_instance;
+
+   TR::RawAllocator _rawAllocator;
+   Request *_queued; /**< waiting requests, sorted by decreasing priority */
+   Request *_compiling; /**< requests being compiled */
+   Request *_finished; /**< finished requests that were made without a callback, until they are waited for */
+   int32_t _outstanding; /**< requests queued or being compiled */
+   bool _shuttingDown;
+   int32_t _numThreads;
+#if !defined(OMR_OS_WINDOWS)
+   pthread_t *_threads;
+   pthread_mutex_t _mutex;
+   pthread_cond_t _requestQueued; /**< signalled when a request is queued or the threads must stop */
+   pthread_cond_t _requestFinished; /**< signalled when a compilation finishes */
+#endif /* !defined(OMR_OS_WINDOWS) */
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_COMPILATIONQUEUE_INCL)
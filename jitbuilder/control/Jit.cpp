@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include <stdio.h>
+#include <string.h>
 #include "codegen/CodeGenerator.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/Method.hpp"
@@ -36,6 +37,8 @@
 #include "runtime/Runtime.hpp"
 #include "runtime/JBJitConfig.hpp"
 #include "control/CompilationController.hpp"
+#include "control/CompilationQueue.hpp"
+#include "control/CodeStore.hpp"
 
 #if defined(AIXPPC)
 #include "p/codegen/PPCTableOfConstants.hpp"
@@ -44,6 +47,9 @@
 extern TR_RuntimeHelperTable runtimeHelpers;
 extern void setupCodeCacheParameters(int32_t *, OMR::CodeCacheCodeGenCallbacks *callBacks, int32_t *numHelpers, int32_t *CCPreLoadedCodeSize);
 
+// the option string the Jit was initialized with, kept because it selects the code a method compiles to
+static char *jitOptions = NULL;
+
 static void
 initHelper(void *helper, TR_RuntimeHelper id)
    {
@@ -144,6 +150,13 @@ initializeJitBuilder(TR_RuntimeHelper *helperIDs, void **helperAddresses, int32_
    if (commonJitInit(fe, options) < 0)
       return false;
 
+   if (NULL != options)
+      {
+      jitOptions = static_cast<char *>(rawAllocator.allocate(strlen(options) + 1, std::nothrow));
+      if (NULL != jitOptions)
+         strcpy(jitOptions, options);
+      }
+
    initializeCodeCache(fe.codeCacheManager());
 
    return true;
@@ -169,6 +182,17 @@ initializeJitBuilder(TR_RuntimeHelper *helperIDs, void **helperAddresses, int32_
 //     compileMethodBuilder() as many times as needed to create compiled code
 //     shuwdownJit() when the test is complete
 //
+// To compile without waiting, call startCompilationThreads() once the Jit is initialized, then
+// compileMethodBuilderAsync(). The entry point is installed in the given slot when the code is ready,
+// and is collected with waitForCompilation() or delivered to the callback, if one was given.
+// Compilation threads are not supported on Windows: startCompilationThreads() returns false there,
+// and compileMethodBuilderAsync() returns COMPILATION_FAILED without compiling, as it does whenever
+// the threads were not started.
+//
+// To reuse compiled code across processes, call openCodeStore() once the Jit is initialized. Every
+// later compilation installs the body stored for identical IL, if there is one, and stores its body
+// otherwise. closeCodeStore() must not be called while compilations are in progress.
+//
 
 
 
@@ -185,10 +209,12 @@ internal_initializeJit()
    return initializeJitBuilder(0, 0, 0, (char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator");
    }
 
+// Compiles on the calling thread; a compilation thread passes the provider it owns for scratch memory
 int32_t
-internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+compileMethodBuilderWithSegmentProvider(TR::MethodBuilder *m, void **entry, TR::SegmentAllocator *scratchSegmentProvider)
    {
-   auto rc = m->Compile(entry);
+   JitBuilder::CodeStore *store = JitBuilder::CodeStore::instance();
+   auto rc = (NULL != store) ? store->compile(m, entry, scratchSegmentProvider) : m->Compile(entry, scratchSegmentProvider);
 
 #if defined(AIXPPC)
    struct FunctionDescriptor
@@ -211,13 +237,87 @@ internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
    return rc;
    }
 
+int32_t
+internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+   {
+   return compileMethodBuilderWithSegmentProvider(m, entry, NULL);
+   }
+
+bool
+internal_openCodeStore(char *directory)
+   {
+   return JitBuilder::CodeStore::open(directory, jitOptions);
+   }
+
+void
+internal_closeCodeStore()
+   {
+   JitBuilder::CodeStore::close();
+   }
+
+bool
+internal_startCompilationThreads(int32_t numThreads)
+   {
+   return JitBuilder::CompilationQueue::startup(numThreads);
+   }
+
+int32_t
+internal_compileMethodBuilderAsync(TR::MethodBuilder *m, int32_t priority, void **entry, void *callback, void *userData)
+   {
+   JitBuilder::CompilationQueue *queue = JitBuilder::CompilationQueue::instance();
+   if (NULL == queue)
+      return COMPILATION_FAILED;
+
+   return queue->enqueue(m, priority, entry, (AsyncCompilationCallback)callback, userData);
+   }
+
+int32_t
+internal_waitForCompilation(TR::MethodBuilder *m)
+   {
+   JitBuilder::CompilationQueue *queue = JitBuilder::CompilationQueue::instance();
+   if (NULL == queue)
+      return COMPILATION_FAILED;
+
+   return queue->waitFor(m);
+   }
+
+void
+internal_waitForAllCompilations()
+   {
+   JitBuilder::CompilationQueue *queue = JitBuilder::CompilationQueue::instance();
+   if (NULL != queue)
+      queue->waitForAll();
+   }
+
 void
 internal_shutdownJit()
    {
+   // compilations still queued need the code cache
+   JitBuilder::CompilationQueue::shutdown();
+   JitBuilder::CodeStore::close();
+
+   if (NULL != jitOptions)
+      {
+      TR::RawAllocator rawAllocator;
+      rawAllocator.deallocate(jitOptions);
+      jitOptions = NULL;
+      }
+
    auto fe = JitBuilder::FrontEnd::instance();
 
    TR::CodeCacheManager &codeCacheManager = fe->codeCacheManager();
    codeCacheManager.destroy();
 
    TR::CompilationController::shutdown();
+
+   // the Jit may be initialized again with other options, which must not
+   // inherit the verbose log of this one
+   auto jitConfig = fe->jitConfig();
+   if (NULL != jitConfig->options.vLogFile && OMR::IO::Stderr != jitConfig->options.vLogFile)
+      trfclose(jitConfig->options.vLogFile);
+   jitConfig->options.vLogFile = NULL;
+   jitConfig->options.vLogFileName = NULL;
+   jitConfig->options.verboseFlags = 0;
+   for (int32_t option = 0; option < TR_NumVerboseOptions; option++)
+      TR::Options::resetVerboseOption(static_cast<TR_VerboseFlags>(option));
    }
@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Micro-benchmark for MM_HeapMapScan: sweeps synthetic mark maps of varying density the way
+ * MM_ParallelSweepScheme::sweepChunk does (free runs of whole map slots extended by the clear
+ * bits of the neighbouring slots) with the scalar and the processor specific implementation,
+ * checks that both find the same free runs and reports the time per map slot.
+ */
+
+#include <stdio.h>
+
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "Bits.hpp"
+#include "HeapMapScan.hpp"
+
+#define MAP_SLOT_COUNT ((uintptr_t)1 << 22)
+#define REPETITIONS 5
+
+typedef struct SweepResult {
+	uintptr_t freeRuns; /**< number of free runs found */
+	uintptr_t freeBits; /**< total length of the free runs, in mark bits */
+} SweepResult;
+
+typedef struct MapShape {
+	const char *name;
+	uintptr_t liveRunLength; /**< average length of a run of slots holding live objects */
+	uintptr_t freeRunLength; /**< average length of a run of empty slots */
+	uintptr_t fullPercent; /**< percentage of live slots with every bit set */
+} MapShape;
+
+static const MapShape shapes[] = {
+	{"sparse 0.1%", 4, 4000, 0},
+	{"sparse 1%", 4, 400, 0},
+	{"sparse 10%", 8, 72, 0},
+	{"half 50%", 16, 16, 0},
+	{"dense 90%", 36, 4, 0},
+	{"packed 90%", 36, 4, 90},
+	{"fragmented", 1, 1, 0},
+};
+
+static uintptr_t
+nextRandom(uintptr_t *seed)
+{
+	uintptr_t x = *seed;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*seed = x;
+	return x;
+}
+
+static void
+fillMap(uintptr_t *map, uintptr_t slotCount, const MapShape *shape, uintptr_t seed)
+{
+	uintptr_t slot = 0;
+	while (slot < slotCount) {
+		/* run lengths uniform in [1, 2 * average - 1] */
+		uintptr_t liveRun = 1 + (nextRandom(&seed) % (2 * shape->liveRunLength - 1));
+		for (uintptr_t i = 0; (i < liveRun) && (slot < slotCount); i++, slot++) {
+			if ((nextRandom(&seed) % 100) < shape->fullPercent) {
+				map[slot] = UDATA_MAX;
+			} else {
+				uintptr_t bits = nextRandom(&seed) & nextRandom(&seed);
+				map[slot] = (0 == bits) ? 1 : bits;
+			}
+		}
+		uintptr_t freeRun = 1 + (nextRandom(&seed) % (2 * shape->freeRunLength - 1));
+		for (uintptr_t i = 0; (i < freeRun) && (slot < slotCount); i++, slot++) {
+			map[slot] = 0;
+		}
+	}
+}
+
+/**
+ * Mirror of the sweepMarkMapBody/Head/Tail logic in MM_ParallelSweepScheme.
+ */
+static void
+sweepMap(MM_HeapMapScan *scan, uintptr_t *map, uintptr_t *mapTop, SweepResult *result)
+{
+	uintptr_t *current = map;
+	result->freeRuns = 0;
+	result->freeBits = 0;
+
+	while (current < mapTop) {
+		if (0 == *current) {
+			uintptr_t *runHead = current;
+			current = scan->skipSlots(current + 1, mapTop, 0);
+			uintptr_t freeBits = J9BITS_BITS_IN_SLOT * (current - runHead);
+			if (runHead > map) {
+				freeBits += MM_Bits::trailingZeroes(*(runHead - 1));
+			}
+			if (current < mapTop) {
+				freeBits += MM_Bits::leadingZeroes(*current);
+			}
+			result->freeRuns += 1;
+			result->freeBits += freeBits;
+		} else if (UDATA_MAX == *current) {
+			current = scan->skipSlots(current + 1, mapTop, UDATA_MAX);
+		} else {
+			current += 1;
+		}
+	}
+}
+
+static uint64_t
+timeSweep(OMRPortLibrary *portLibrary, MM_HeapMapScan *scan, uintptr_t *map, SweepResult *result)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint64_t best = 0;
+	for (uintptr_t i = 0; i < REPETITIONS; i++) {
+		uint64_t start = omrtime_hires_clock();
+		sweepMap(scan, map, map + MAP_SLOT_COUNT, result);
+		uint64_t elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+		if ((0 == i) || (elapsed < best)) {
+			best = elapsed;
+		}
+	}
+	return best;
+}
+
+int
+main(int argc, char **argv)
+{
+	OMRPortLibrary portLibrary;
+	int rc = 0;
+
+	if (0 != omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT)) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed\n");
+		return -1;
+	}
+	if (0 != omrport_init_library(&portLibrary, sizeof(OMRPortLibrary))) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)) failed\n");
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	uintptr_t *map = (uintptr_t *)omrmem_allocate_memory(MAP_SLOT_COUNT * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	if (NULL == map) {
+		omrtty_printf("Failed to allocate a mark map of %zu slots\n", MAP_SLOT_COUNT);
+		rc = -1;
+	} else {
+		MM_HeapMapScan scalarScan;
+		MM_HeapMapScan vectorScan;
+		scalarScan.initialize(&portLibrary, false);
+		vectorScan.initialize(&portLibrary, true);
+
+		omrtty_printf("Sweeping %zu mark map slots, scalar vs %s\n", MAP_SLOT_COUNT, vectorScan.getImplementationName());
+		omrtty_printf("%-14s %10s %12s %12s %8s\n", "map", "free runs", "scalar ns/sl", "vector ns/sl", "speedup");
+
+		for (uintptr_t i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++) {
+			SweepResult scalarResult;
+			SweepResult vectorResult;
+			fillMap(map, MAP_SLOT_COUNT, &shapes[i], 0x9E3779B9 + i);
+
+			uint64_t scalarTime = timeSweep(&portLibrary, &scalarScan, map, &scalarResult);
+			uint64_t vectorTime = timeSweep(&portLibrary, &vectorScan, map, &vectorResult);
+
+			if ((scalarResult.freeRuns != vectorResult.freeRuns) || (scalarResult.freeBits != vectorResult.freeBits)) {
+				omrtty_printf("%-14s MISMATCH scalar %zu runs/%zu bits, %s %zu runs/%zu bits\n", shapes[i].name,
+					scalarResult.freeRuns, scalarResult.freeBits, vectorScan.getImplementationName(), vectorResult.freeRuns, vectorResult.freeBits);
+				rc = 1;
+			} else {
+				omrtty_printf("%-14s %10zu %12.3f %12.3f %7.2fx\n", shapes[i].name, scalarResult.freeRuns,
+					(double)scalarTime / MAP_SLOT_COUNT, (double)vectorTime / MAP_SLOT_COUNT,
+					(0 == vectorTime) ? 0.0 : (double)scalarTime / (double)vectorTime);
+			}
+		}
+
+		omrmem_free_memory(map);
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return rc;
+}
@@ -46,4 +46,7 @@ omr_perfgctest:
 	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
 	./omrperfgctest
 
-.PHONY: all test omr_perfgctest 
+omr_perfmarkmap:
+	./omrperfmarkmap
+
+.PHONY: all test omr_perfgctest omr_perfmarkmap